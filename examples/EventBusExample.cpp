@@ -13,6 +13,7 @@
 #include "core/AudioManager.h"
 #include "core/Logger.h"
 #include "core/Components.h"
+#include "core/systems/FSMSystem.h"
 #include <entt/entt.hpp>
 
 using namespace core;
@@ -150,24 +151,25 @@ void exampleGameScene() {
     // Создаем сущность с FSM компонентом
     auto machine = registry.create();
     registry.emplace<NameComponent>(machine, "IndustrialMachine");
-    auto& fsm = registry.emplace<EntityStateComponent>(machine, "idle");
+    registry.emplace<EntityStateComponent>(machine, "idle");
 
     // Регистрируем коллбеки для состояний
-    fsm.registerOnEnter("running", []() {
+    auto& callbacks = registry.emplace<StateCallbacksComponent>(machine);
+    callbacks.registerOnEnter("running", []() {
         LOG_INFO("Machine started running!");
     });
 
-    fsm.registerOnExit("running", []() {
+    callbacks.registerOnExit("running", []() {
         LOG_INFO("Machine stopped running!");
     });
 
     // Меняем состояние (публикует StateChangedEvent)
     LOG_INFO("Changing machine state: idle -> running");
-    fsm.setState("running", machine);
+    FSMSystem::setState(registry, machine, "running");
     // StateChangeLogger автоматически залогирует изменение
 
     LOG_INFO("Changing machine state: running -> error");
-    fsm.setState("error", machine);
+    FSMSystem::setState(registry, machine, "error");
     // StateChangeLogger залогирует предупреждение об ошибке
 
     // Очистка EventBus при завершении
@@ -0,0 +1,326 @@
+#pragma once
+
+#include "core/EventBus.h"
+#include "core/StringId.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file AlarmEngine.h
+ * @brief Аварийная сигнализация: уставки с гистерезисом, квитирование, шунтирование
+ */
+
+namespace core {
+
+/// Идентификатор тревоги
+using AlarmId = uint32_t;
+
+/**
+ * @brief Условие срабатывания тревоги
+ */
+enum class AlarmCondition : uint8_t {
+    High,      ///< Значение >= уставки (сброс ниже уставки − зона нечувствительности)
+    Low,       ///< Значение <= уставки (сброс выше уставки + зона нечувствительности)
+    Discrete,  ///< Значение == уставке (дискретный сигнал)
+    Stale      ///< Тег не обновлялся дольше уставки (секунды) — потеря связи
+};
+
+/**
+ * @brief Приоритет тревоги (больше — важнее)
+ */
+enum class AlarmPriority : uint8_t {
+    Low,
+    Medium,
+    High,
+    Critical
+};
+
+/**
+ * @brief Состояние тревоги (ISA-18.2)
+ */
+enum class AlarmState : uint8_t {
+    Normal,          ///< Норма, квитировано
+    Unacknowledged,  ///< Активна, не квитирована
+    Acknowledged,    ///< Активна, квитирована
+    ReturnedUnack    ///< Вернулась в норму, не квитирована
+};
+
+/**
+ * @brief Вид перехода тревоги
+ */
+enum class AlarmEvent : uint8_t {
+    Raised,        ///< Условие стало активным
+    Cleared,       ///< Условие вернулось в норму
+    Acknowledged,  ///< Оператор квитировал
+    Shelved,       ///< Оператор шунтировал (временно скрыл)
+    Unshelved      ///< Шунтирование снято
+};
+
+/**
+ * @brief Описание тревоги
+ */
+struct AlarmDefinition {
+    StringId name;                                 ///< Имя (для UI и журнала)
+    StringId tag;                                  ///< Контролируемый тег
+    AlarmCondition condition = AlarmCondition::High;  ///< Условие
+    double setpoint = 0.0;                         ///< Уставка (Stale — секунды без обновления)
+    double deadband = 0.0;                         ///< Зона нечувствительности (High, Low)
+    double onDelay = 0.0;                          ///< Задержка срабатывания (секунды)
+    double offDelay = 0.0;                         ///< Задержка возврата в норму (секунды)
+    AlarmPriority priority = AlarmPriority::Medium;  ///< Приоритет
+};
+
+/**
+ * @brief Переход тревоги (для UI, журнала и звука)
+ */
+struct AlarmTransition {
+    AlarmId alarm = 0;                          ///< Тревога
+    StringId name;                              ///< Имя тревоги
+    AlarmEvent event = AlarmEvent::Raised;      ///< Вид перехода
+    AlarmState state = AlarmState::Normal;      ///< Состояние после перехода
+    AlarmPriority priority = AlarmPriority::Medium;  ///< Приоритет
+    double value = 0.0;                         ///< Значение тега
+    double time = 0.0;                          ///< Время перехода
+};
+
+/**
+ * @brief Пакет переходов тревог за такт
+ *
+ * Публикуется AlarmEngine::publishTransitions() одним событием на такт:
+ * панель тревог, журнал и звук подписываются один раз и не получают
+ * отдельный вызов на каждую тревогу при лавине.
+ */
+struct AlarmBatchEvent : public Event {
+    std::vector<AlarmTransition> transitions;  ///< Переходы в порядке возникновения
+
+    const char* getTypeName() const override { return "AlarmBatchEvent"; }
+};
+
+/**
+ * @brief Движок аварийной сигнализации с инкрементальной проверкой
+ *
+ * setTag() только помечает тег; update() проверяет лишь тревоги помеченных
+ * тегов, значение которых изменилось. Задержки срабатывания и возврата,
+ * контроль потери связи (Stale) и окончание шунтирования — таймеры в куче,
+ * поэтому такт без изменений тегов и без наступивших таймеров стоит одну
+ * проверку вершины кучи, сколько бы тревог ни было настроено.
+ *
+ * Гистерезис: High срабатывает при value >= setpoint и сбрасывается при
+ * value <= setpoint − deadband (Low — зеркально). Задержка требует, чтобы
+ * новое условие непрерывно держалось onDelay/offDelay секунд.
+ *
+ * Квитирование по ISA-18.2: Normal → Unacknowledged → Acknowledged → Normal
+ * или Unacknowledged → ReturnedUnack → (квитирование) → Normal. Шунтированная
+ * тревога продолжает отслеживать условие, но не показывается и не выдаёт
+ * переходов; при снятии шунта активное условие снова требует квитирования.
+ *
+ * Активные (не Normal и не шунтированные) тревоги лежат в индексированной
+ * куче: важнейшая — за O(1), смена состояния — за O(log n). Порядок:
+ * приоритет, затем неквитированные, затем более поздние.
+ *
+ * @code
+ * AlarmEngine alarms;
+ * AlarmDefinition high;
+ * high.name = "tank1.level.high";
+ * high.tag = "tank1.level";
+ * high.setpoint = 90.0;
+ * high.deadband = 2.0;
+ * high.onDelay = 5.0;
+ * high.priority = AlarmPriority::High;
+ * alarms.addAlarm(high);
+ *
+ * // Каждый такт
+ * alarms.setTag("tank1.level", level);
+ * alarms.update(simTime);
+ * alarms.publishTransitions(simTime);  // AlarmBatchEvent для UI, журнала и звука
+ * @endcode
+ *
+ * @note Не потокобезопасен; время — секунды симуляции, не убывает.
+ */
+class AlarmEngine {
+public:
+    static constexpr AlarmId NO_ALARM = std::numeric_limits<AlarmId>::max();
+
+    /**
+     * @brief Настроить тревогу
+     *
+     * @param definition Описание тревоги
+     * @param time Момент настройки (начало отсчёта для Stale)
+     * @return Идентификатор тревоги
+     */
+    AlarmId addAlarm(const AlarmDefinition& definition, double time = 0.0);
+
+    /**
+     * @brief Задать значение тега
+     *
+     * Применяется в следующем update() с его временем. Повтор того же
+     * значения не вызывает проверки уставок, но продлевает контроль связи.
+     *
+     * @return false если на теге нет тревог
+     */
+    bool setTag(StringId tag, double value);
+
+    /**
+     * @brief Обработать наступившие таймеры и изменившиеся теги
+     *
+     * @param time Текущее время симуляции (секунды)
+     * @return Количество новых переходов
+     */
+    size_t update(double time);
+
+    /**
+     * @brief Квитировать тревогу
+     * @return false если квитировать нечего (Normal, Acknowledged, шунтирована)
+     */
+    bool acknowledge(AlarmId alarm, double time);
+
+    /**
+     * @brief Квитировать все тревоги
+     * @return Количество квитированных
+     */
+    size_t acknowledgeAll(double time);
+
+    /**
+     * @brief Шунтировать тревогу
+     *
+     * @param duration Длительность (секунды); <= 0 — до unshelve()
+     * @return false если тревога уже шунтирована
+     */
+    bool shelve(AlarmId alarm, double time, double duration);
+
+    /**
+     * @brief Снять шунтирование
+     * @return false если тревога не шунтирована
+     */
+    bool unshelve(AlarmId alarm, double time);
+
+    /**
+     * @brief Забрать накопленные переходы
+     *
+     * @param out Переходы (дополняется)
+     * @return Количество добавленных переходов
+     */
+    size_t collectTransitions(std::vector<AlarmTransition>& out);
+
+    /**
+     * @brief Опубликовать накопленные переходы одним AlarmBatchEvent
+     *
+     * @param timestamp Время события
+     * @return Количество опубликованных переходов (0 — событие не публиковалось)
+     */
+    size_t publishTransitions(double timestamp);
+
+    /**
+     * @brief Активные тревоги в порядке важности
+     *
+     * @param out Тревоги (дополняется)
+     * @return Количество добавленных тревог
+     */
+    size_t collectActive(std::vector<AlarmId>& out) const;
+
+    /**
+     * @brief Важнейшая активная тревога (NO_ALARM — нет)
+     */
+    AlarmId getTopAlarm() const { return m_active.empty() ? NO_ALARM : m_active.front(); }
+
+    AlarmState getState(AlarmId alarm) const { return m_alarms[alarm].state; }
+    bool isShelved(AlarmId alarm) const { return m_alarms[alarm].shelved; }
+
+    /**
+     * @brief Условие активно с учётом задержек (независимо от шунтирования)
+     */
+    bool isConditionActive(AlarmId alarm) const { return m_alarms[alarm].active; }
+
+    const AlarmDefinition& getDefinition(AlarmId alarm) const {
+        return m_alarms[alarm].definition;
+    }
+
+    size_t getAlarmCount() const { return m_alarms.size(); }
+    size_t getActiveCount() const { return m_active.size(); }
+    size_t getUnacknowledgedCount() const { return m_unacknowledged; }
+
+    /**
+     * @brief Сколько тревог проверено в последнем update()
+     */
+    size_t getEvaluatedCount() const { return m_evaluated; }
+
+private:
+    static constexpr uint32_t NO_POSITION = std::numeric_limits<uint32_t>::max();
+
+    /// Контролируемый тег
+    struct Tag {
+        double value = 0.0;          ///< Значение
+        double lastUpdate = 0.0;     ///< Время последнего setTag()
+        bool hasValue = false;       ///< Значение задавалось
+        bool changed = false;        ///< Значение изменилось с прошлого update()
+        bool queued = false;         ///< Помечен в m_dirtyTags
+        std::vector<AlarmId> alarms; ///< Тревоги тега
+    };
+
+    /// Настроенная тревога
+    struct Alarm {
+        AlarmDefinition definition;               ///< Описание
+        uint32_t tag = 0;                         ///< Индекс в m_tags
+        AlarmState state = AlarmState::Normal;    ///< Состояние ISA-18.2
+        bool condition = false;                   ///< Условие с гистерезисом, без задержек
+        bool active = false;                      ///< Условие после задержек
+        bool pending = false;                     ///< Ожидает задержку
+        bool shelved = false;                     ///< Шунтирована
+        bool staleQueued = false;                 ///< Таймер контроля связи в куче
+        uint32_t delayGeneration = 0;             ///< Поколение таймера задержки
+        uint32_t shelveGeneration = 0;            ///< Поколение таймера шунтирования
+        uint32_t heapPosition = NO_POSITION;      ///< Позиция в m_active
+        double activatedAt = 0.0;                 ///< Время последнего Raised
+    };
+
+    /// Вид таймера
+    enum class TimerKind : uint8_t {
+        Delay,   ///< Окончание задержки срабатывания/возврата
+        Stale,   ///< Проверка потери связи
+        Shelve   ///< Окончание шунтирования
+    };
+
+    /// Таймер тревоги
+    struct Timer {
+        double deadline;      ///< Момент срабатывания
+        AlarmId alarm;        ///< Тревога
+        TimerKind kind;       ///< Вид
+        uint32_t generation;  ///< Поколение (устаревшие таймеры пропускаются)
+
+        bool operator>(const Timer& other) const { return deadline > other.deadline; }
+    };
+
+    void evaluate(AlarmId id, double time);
+    bool computeCondition(const Alarm& alarm, double time) const;
+    void applyActive(AlarmId id, bool active, double time);
+    void handleTimer(const Timer& timer);
+    void scheduleStale(AlarmId id);
+    void pushTimer(double deadline, AlarmId id, TimerKind kind, uint32_t generation);
+    void setState(AlarmId id, AlarmState state);
+    void emit(AlarmId id, AlarmEvent event, double time);
+
+    // Индексированная куча активных тревог
+    bool before(AlarmId a, AlarmId b) const;
+    void heapPlace(uint32_t position, AlarmId id);
+    void siftUp(uint32_t position);
+    void siftDown(uint32_t position);
+    void heapRemove(AlarmId id);
+
+    std::vector<Alarm> m_alarms;                       ///< Тревоги
+    std::vector<Tag> m_tags;                           ///< Теги
+    std::unordered_map<StringId, uint32_t> m_tagIndex; ///< Имя тега → индекс
+    std::vector<uint32_t> m_dirtyTags;                 ///< Теги, заданные с прошлого update()
+    std::vector<Timer> m_timers;                       ///< Куча таймеров (по времени)
+    std::vector<AlarmId> m_active;                     ///< Куча активных тревог (по важности)
+    std::vector<AlarmTransition> m_transitions;        ///< Переходы для публикации
+
+    double m_time = 0.0;          ///< Время последнего update()
+    size_t m_unacknowledged = 0;  ///< Неквитированных (не шунтированных) тревог
+    size_t m_evaluated = 0;       ///< Проверено тревог в последнем update()
+};
+
+} // namespace core
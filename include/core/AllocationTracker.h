@@ -0,0 +1,157 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+
+namespace core {
+
+/**
+ * @brief Подсистема, которой приписываются выделения памяти
+ */
+enum class AllocationTag : uint8_t {
+    Other = 0,   ///< Без тега (код вне AllocationScope)
+    Core,        ///< ECS, состояния, игровой цикл
+    Rendering,   ///< Рендеринг, тайловые карты
+    Simulation,  ///< Физика, поток симуляции
+    Resources,   ///< Загрузка текстур, шрифтов, звуков, метаданных
+    Scripting,   ///< Lua-скрипты
+    Count
+};
+
+/**
+ * @brief Имя тега для отчётов и оверлея
+ */
+const char* toString(AllocationTag tag);
+
+/**
+ * @brief Снимок счётчиков одного тега
+ */
+struct AllocationStats {
+    uint64_t allocations = 0;           ///< Всего выделений
+    uint64_t deallocations = 0;         ///< Всего освобождений
+    uint64_t bytesAllocated = 0;        ///< Всего выделено байт
+    int64_t currentBytes = 0;           ///< Занято сейчас
+    int64_t peakBytes = 0;              ///< Пик занятой памяти
+    uint64_t lastFrameAllocations = 0;  ///< Выделений за последний завершённый кадр
+};
+
+/**
+ * @brief Учёт выделений памяти по подсистемам
+ *
+ * Два источника данных:
+ * 1. Глобальные operator new/delete — только при сборке с
+ *    -DENABLE_ALLOCATION_TRACKING=ON. Выделение приписывается тегу текущего
+ *    потока (см. AllocationScope); размер и тег хранятся в заголовке блока,
+ *    поэтому освобождение учитывается там же, где выделение.
+ * 2. Тегированные pmr-ресурсы resource(tag) — работают всегда, для
+ *    контейнеров, которые нужно учитывать и без перехвата new.
+ *
+ * Счётчики — lock-free атомики, выделять память при учёте не нужно.
+ * endFrame() вызывается раз в кадр (Application::run) и фиксирует
+ * количество выделений за кадр.
+ *
+ * @code
+ * {
+ *     AllocationScope scope(AllocationTag::Resources);
+ *     texture.loadFromFile(path);  // выделения приписываются Resources
+ * }
+ * std::pmr::vector<int> values(AllocationTracker::resource(AllocationTag::Rendering));
+ * @endcode
+ */
+class AllocationTracker {
+public:
+    static constexpr size_t TAG_COUNT = static_cast<size_t>(AllocationTag::Count);
+
+    AllocationTracker() = delete;
+
+    /**
+     * @brief Перехвачены ли глобальные operator new/delete в этой сборке
+     */
+    static bool isHookEnabled();
+
+    /**
+     * @brief Учесть выделение (вызывается хуками и тегированными ресурсами)
+     */
+    static void recordAllocation(AllocationTag tag, size_t bytes);
+
+    /**
+     * @brief Учесть освобождение
+     */
+    static void recordDeallocation(AllocationTag tag, size_t bytes);
+
+    /**
+     * @brief Завершить кадр: зафиксировать выделения за кадр по всем тегам
+     */
+    static void endFrame();
+
+    /**
+     * @brief Снимок счётчиков тега
+     */
+    static AllocationStats getStats(AllocationTag tag);
+
+    /**
+     * @brief Сумма выделений за последний кадр по всем тегам
+     */
+    static uint64_t getLastFrameAllocations();
+
+    /**
+     * @brief Были ли учтены хоть какие-то выделения (для решения, печатать ли отчёт)
+     */
+    static bool hasData();
+
+    /**
+     * @brief Обнулить все счётчики (для тестов и замеров)
+     *
+     * Занятые сейчас байты тоже обнуляются — освобождения блоков, выделенных
+     * до сброса, уведут currentBytes в минус.
+     */
+    static void reset();
+
+    /**
+     * @brief Текстовый отчёт по всем тегам (для лога при завершении)
+     */
+    static std::string formatReport();
+
+    /**
+     * @brief Тегированный pmr-ресурс поверх new/delete
+     *
+     * Ресурсы живут до завершения программы.
+     */
+    static std::pmr::memory_resource* resource(AllocationTag tag);
+
+    /**
+     * @brief Тег текущего потока
+     */
+    static AllocationTag currentTag();
+
+private:
+    friend class AllocationScope;
+
+    static void setCurrentTag(AllocationTag tag);
+};
+
+/**
+ * @brief RAII-область: выделения в потоке приписываются тегу
+ *
+ * Области вкладываются, при выходе восстанавливается предыдущий тег.
+ */
+class AllocationScope {
+public:
+    explicit AllocationScope(AllocationTag tag)
+        : m_previous(AllocationTracker::currentTag()) {
+        AllocationTracker::setCurrentTag(tag);
+    }
+
+    ~AllocationScope() { AllocationTracker::setCurrentTag(m_previous); }
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+private:
+    AllocationTag m_previous;  ///< Тег до входа в область
+};
+
+} // namespace core
@@ -5,14 +5,16 @@
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/System/Time.hpp>
 #include <entt/entt.hpp>
+#include "core/StringId.h"
 #include <string>
 #include <vector>
-#include <unordered_set>
 #include <unordered_map>
 #include <algorithm>
 #include <optional>
 #include <functional>
 #include <memory>
+#include <type_traits>
+#include <cstdint>
 
 namespace core {
 
@@ -46,6 +48,16 @@ inline constexpr int toInt(RenderLayer layer) {
     return static_cast<int>(layer);
 }
 
+/**
+ * @brief Требования к "горячим" компонентам, которые системы обходят каждый кадр
+ *
+ * Тривиально копируемые и не больше 32 байт: пулы EnTT остаются плотными,
+ * а перемещение при сортировке и удалении сводится к memcpy.
+ * Холодные данные (коллбеки, имена) вынесены в отдельные компоненты.
+ */
+template <typename T>
+inline constexpr bool isHotComponent = std::is_trivially_copyable_v<T> && sizeof(T) <= 32;
+
 // ============== БАЗОВЫЕ КОМПОНЕНТЫ ==============
 
 /**
@@ -61,6 +73,8 @@ struct TransformComponent {
     float scaleY = 1.0f;         ///< Масштаб по Y
 };
 
+static_assert(isHotComponent<TransformComponent>, "TransformComponent must stay hot");
+
 /**
  * @brief Компонент спрайта
  *
@@ -68,7 +82,7 @@ struct TransformComponent {
  * Компонент содержит только чистые данные (без кеша системы).
  */
 struct SpriteComponent {
-    std::string textureName;     ///< Имя текстуры в ResourceManager
+    StringId textureName;        ///< Имя текстуры в ResourceManager (интернированное)
     sf::IntRect textureRect;     ///< Прямоугольник текстуры (для спрайт-атласов)
     sf::Color color;             ///< Цвет модуляции (белый = без изменений)
     int layer = 0;               ///< Слой отрисовки (меньше = раньше)
@@ -78,7 +92,7 @@ struct SpriteComponent {
      * @brief Конструктор по умолчанию
      */
     SpriteComponent()
-        : textureName("")
+        : textureName()
         , textureRect()
         , color(sf::Color::White)
         , layer(0)
@@ -89,7 +103,7 @@ struct SpriteComponent {
      * @brief Конструктор с текстурой
      * @param name Имя текстуры
      */
-    explicit SpriteComponent(const std::string& name)
+    explicit SpriteComponent(StringId name)
         : textureName(name)
         , textureRect()
         , color(sf::Color::White)
@@ -98,6 +112,8 @@ struct SpriteComponent {
     }
 };
 
+static_assert(isHotComponent<SpriteComponent>, "SpriteComponent must stay hot");
+
 /**
  * @brief Компонент скорости
  *
@@ -109,6 +125,8 @@ struct VelocityComponent {
     float angularVelocity = 0.0f; ///< Угловая скорость (градусов/секунду)
 };
 
+static_assert(isHotComponent<VelocityComponent>, "VelocityComponent must stay hot");
+
 /**
  * @brief Тег компонент для обозначения камеры
  *
@@ -164,6 +182,8 @@ struct LifetimeComponent {
         , fadeStartRatio(0.3f) {}
 };
 
+static_assert(isHotComponent<LifetimeComponent>, "LifetimeComponent must stay hot");
+
 /**
  * @brief Компонент анимации спрайта
  *
@@ -273,25 +293,35 @@ struct ParentComponent {
     explicit ParentComponent(entt::entity p) : parent(p) {}
 };
 
+static_assert(isHotComponent<ParentComponent>, "ParentComponent must stay hot");
+
 /**
  * @brief Компонент для хранения дочерних сущностей
  *
  * Автоматически обновляется системами при добавлении ParentComponent.
- * Использует unordered_set для O(1) операций добавления/удаления/проверки.
+ * Дочерних сущностей обычно единицы (оверлеи, индикаторы), поэтому плотный
+ * вектор с линейным поиском быстрее и компактнее хеш-множества.
  */
 struct ChildrenComponent {
-    std::unordered_set<entt::entity> children;  ///< Множество дочерних сущностей
+    std::vector<entt::entity> children;  ///< Дочерние сущности (без повторов)
 
     void addChild(entt::entity child) {
-        children.insert(child);
+        if (!hasChild(child)) {
+            children.push_back(child);
+        }
     }
 
     void removeChild(entt::entity child) {
-        children.erase(child);
+        auto it = std::find(children.begin(), children.end(), child);
+        if (it != children.end()) {
+            // Порядок не важен — удаляем обменом с последним
+            *it = children.back();
+            children.pop_back();
+        }
     }
 
     bool hasChild(entt::entity child) const {
-        return children.contains(child);
+        return std::find(children.begin(), children.end(), child) != children.end();
     }
 
     size_t childCount() const {
@@ -307,34 +337,13 @@ struct ChildrenComponent {
  * Используется для простой тайловой системы коллизий до интеграции Box2D.
  * Поддерживает solid коллизии (блокирующие движение) и trigger коллизии (детекция без блокирования).
  * Коллизии проверяются системой CollisionSystem с приоритетом 100.
+ * Коллбеки вынесены в CollisionCallbacksComponent.
  */
 struct CollisionComponent {
     bool isSolid = true;        ///< Блокирует движение других объектов
     bool isTrigger = false;     ///< Только детекция (не блокирует движение)
     sf::FloatRect bounds;       ///< AABB границы коллайдера (относительно позиции сущности)
-    std::string layer;          ///< Слой коллизий ("player", "wall", "sensor", "industrial")
-
-    /**
-     * @brief Коллбек при начале коллизии
-     *
-     * Вызывается когда эта сущность впервые сталкивается с другой.
-     * Параметр: entt::entity - сущность, с которой произошло столкновение.
-     */
-    std::function<void(entt::entity)> onCollisionEnter;
-
-    /**
-     * @brief Коллбек при продолжении коллизии
-     *
-     * Вызывается каждый кадр, пока коллизия активна.
-     */
-    std::function<void(entt::entity)> onCollisionStay;
-
-    /**
-     * @brief Коллбек при окончании коллизии
-     *
-     * Вызывается когда коллизия прекращается.
-     */
-    std::function<void(entt::entity)> onCollisionExit;
+    StringId layer;             ///< Слой коллизий ("player", "wall", "sensor", "industrial")
 
     /**
      * @brief Конструктор по умолчанию
@@ -352,7 +361,7 @@ struct CollisionComponent {
      * @param trigger Является ли триггером
      * @param layerName Слой коллизий
      */
-    explicit CollisionComponent(bool solid, bool trigger = false, const std::string& layerName = "default")
+    explicit CollisionComponent(bool solid, bool trigger = false, StringId layerName = "default")
         : isSolid(solid)
         , isTrigger(trigger)
         , bounds(sf::Vector2f(0.0f, 0.0f), sf::Vector2f(TILE_SIZE, TILE_SIZE))
@@ -381,80 +390,142 @@ struct CollisionComponent {
     }
 };
 
+static_assert(isHotComponent<CollisionComponent>, "CollisionComponent must stay hot");
+
+/**
+ * @brief Коллбеки коллизий (холодные данные CollisionComponent)
+ *
+ * Добавляется только сущностям, которым нужна реакция на столкновения.
+ * CollisionSystem вызывает коллбеки, если компонент присутствует.
+ */
+struct CollisionCallbacksComponent {
+    /**
+     * @brief Коллбек при начале коллизии
+     *
+     * Вызывается когда эта сущность впервые сталкивается с другой.
+     * Параметр: entt::entity - сущность, с которой произошло столкновение.
+     */
+    std::function<void(entt::entity)> onCollisionEnter;
+
+    /**
+     * @brief Коллбек при продолжении коллизии
+     *
+     * Вызывается каждый кадр, пока коллизия активна.
+     */
+    std::function<void(entt::entity)> onCollisionStay;
+
+    /**
+     * @brief Коллбек при окончании коллизии
+     *
+     * Вызывается когда коллизия прекращается.
+     */
+    std::function<void(entt::entity)> onCollisionExit;
+};
+
 // ============== КОМПОНЕНТЫ FSM (КОНЕЧНЫЙ АВТОМАТ) ==============
 
+/**
+ * @brief Коллбеки переходов FSM (холодные данные EntityStateComponent)
+ *
+ * Хранится отдельно, чтобы EntityStateComponent оставался плотным:
+ * FSMSystem обходит состояния каждый кадр, а коллбеки нужны только при переходах.
+ */
+struct StateCallbacksComponent {
+    /// Коллбеки при входе в состояние (ключ = имя состояния)
+    std::unordered_map<StringId, std::function<void()>> onEnterCallbacks;
+
+    /// Коллбеки при выходе из состояния (ключ = имя состояния)
+    std::unordered_map<StringId, std::function<void()>> onExitCallbacks;
+
+    /**
+     * @brief Зарегистрировать коллбек для входа в состояние
+     * @param stateName Имя состояния
+     * @param callback Функция, вызываемая при входе в состояние
+     */
+    void registerOnEnter(StringId stateName, std::function<void()> callback) {
+        onEnterCallbacks[stateName] = std::move(callback);
+    }
+
+    /**
+     * @brief Зарегистрировать коллбек для выхода из состояния
+     * @param stateName Имя состояния
+     * @param callback Функция, вызываемая при выходе из состояния
+     */
+    void registerOnExit(StringId stateName, std::function<void()> callback) {
+        onExitCallbacks[stateName] = std::move(callback);
+    }
+};
+
 /**
  * @brief Компонент состояния для конечных автоматов (FSM)
  *
  * Управляет состояниями сущности и переходами между ними.
- * Вызывает коллбеки при входе и выходе из состояний.
+ * Коллбеки входа/выхода хранятся в StateCallbacksComponent той же сущности;
+ * переход с коллбеками выполняет FSMSystem::setState().
  * Используется для реализации поведения промышленных объектов (idle → running → error).
  */
 struct EntityStateComponent {
-    std::string currentState;                     ///< Текущее состояние (например: "idle", "running", "error")
-    std::string previousState;                    ///< Предыдущее состояние
+    StringId currentState;                        ///< Текущее состояние (например: "idle", "running", "error")
+    StringId previousState;                       ///< Предыдущее состояние
     float timeInState = 0.0f;                     ///< Время в текущем состоянии (секунды)
 
-    /// Коллбеки при входе в состояние (ключ = имя состояния)
-    std::unordered_map<std::string, std::function<void()>> onEnterCallbacks;
-
-    /// Коллбеки при выходе из состояния (ключ = имя состояния)
-    std::unordered_map<std::string, std::function<void()>> onExitCallbacks;
-
     /**
      * @brief Конструктор по умолчанию
      */
-    EntityStateComponent() : currentState(""), previousState(""), timeInState(0.0f) {}
+    EntityStateComponent() = default;
 
     /**
      * @brief Конструктор с начальным состоянием
      * @param initialState Начальное состояние
      */
-    explicit EntityStateComponent(const std::string& initialState)
-        : currentState(initialState), previousState(""), timeInState(0.0f) {}
+    explicit EntityStateComponent(StringId initialState)
+        : currentState(initialState), previousState(), timeInState(0.0f) {}
 
     /**
      * @brief Установить новое состояние
      *
-     * Вызывает onExit для текущего состояния и onEnter для нового.
+     * Вызывает onExit для текущего состояния и onEnter для нового (если переданы коллбеки).
      * Сбрасывает timeInState в 0.
      * Публикует StateChangedEvent через EventBus (если entity != entt::null).
      *
+     * Аргументы обязательны: вызов без коллбеков молча пропускал бы onEnter/onExit.
+     * Для сущностей registry используйте FSMSystem::setState(), он сам находит
+     * StateCallbacksComponent.
+     *
      * @param newState Новое состояние
      * @param entity Сущность, которой принадлежит этот компонент (для публикации события)
+     * @param callbacks Коллбеки переходов сущности (nullptr — у сущности их нет)
      */
-    void setState(const std::string& newState, entt::entity entity = entt::null);
+    void setState(StringId newState, entt::entity entity,
+                  const StateCallbacksComponent* callbacks);
 
     /**
      * @brief Проверить, находится ли сущность в указанном состоянии
      * @param stateName Имя состояния
      * @return true если currentState == stateName
      */
-    bool isInState(const std::string& stateName) const {
+    bool isInState(StringId stateName) const {
         return currentState == stateName;
     }
-
-    /**
-     * @brief Зарегистрировать коллбек для входа в состояние
-     * @param stateName Имя состояния
-     * @param callback Функция, вызываемая при входе в состояние
-     */
-    void registerOnEnter(const std::string& stateName, std::function<void()> callback) {
-        onEnterCallbacks[stateName] = std::move(callback);
-    }
-
-    /**
-     * @brief Зарегистрировать коллбек для выхода из состояния
-     * @param stateName Имя состояния
-     * @param callback Функция, вызываемая при выходе из состояния
-     */
-    void registerOnExit(const std::string& stateName, std::function<void()> callback) {
-        onExitCallbacks[stateName] = std::move(callback);
-    }
 };
 
+static_assert(isHotComponent<EntityStateComponent>, "EntityStateComponent must stay hot");
+
 // ============== КОМПОНЕНТЫ ТАЙЛОВОЙ СИСТЕМЫ ==============
 
+/**
+ * @brief Слой занятости тайла (см. TileOccupancyGrid)
+ *
+ * Пол, объект и оверлей могут одновременно находиться на одном тайле,
+ * но два объекта одного слоя — конфликт размещения.
+ */
+enum class OccupancyLayer : uint8_t {
+    Ground = 0,    ///< Пол, покрытие
+    Object,        ///< Оборудование, стены, движущиеся объекты
+    Overlay,       ///< Индикаторы, провода поверх объектов
+    Count          ///< Количество слоёв (не слой)
+};
+
 /**
  * @brief Позиция объекта в тайловых координатах
  *
@@ -472,6 +543,7 @@ struct TilePositionComponent {
     int widthTiles = 1;      ///< Ширина объекта в тайлах
     int heightTiles = 1;     ///< Высота объекта в тайлах
     bool autoSync = true;    ///< Автоматическая синхронизация с TransformComponent
+    OccupancyLayer occupancyLayer = OccupancyLayer::Object;  ///< Слой в TileOccupancyGrid
 
     /**
      * @brief Получить пиксельную позицию (левый НИЖНИЙ угол)
@@ -516,6 +588,8 @@ struct TilePositionComponent {
     }
 };
 
+static_assert(isHotComponent<TilePositionComponent>, "TilePositionComponent must stay hot");
+
 /**
  * @brief Оверлей состояния объекта (кнопка, индикатор)
  *
@@ -536,4 +610,6 @@ struct OverlayComponent {
         : localOffset(offset), syncWithParent(sync) {}
 };
 
+static_assert(isHotComponent<OverlayComponent>, "OverlayComponent must stay hot");
+
 } // namespace core
@@ -15,6 +15,8 @@ namespace core {
  * - window: настройки окна
  * - camera: настройки камеры
  * - game: настройки игрового цикла
+ * - physics: настройки физики (LOD)
+ * - threads: имена, привязка к CPU и приоритеты потоков
  * - audio: настройки звука
  */
 class Config {
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <entt/entt.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace core {
+
+/**
+ * @brief Стабильная внешняя ссылка на сущность
+ *
+ * 64 бита: младшие 32 — индекс слота в EntityHandleTable, старшие 32 —
+ * поколение слота. Поколения начинаются с 1, поэтому нулевое значение —
+ * всегда пустой хэндл (удобно для void* userData внешних библиотек).
+ */
+class EntityHandle {
+public:
+    constexpr EntityHandle() = default;
+
+    /**
+     * @brief Собрать хэндл из индекса слота и поколения
+     */
+    static constexpr EntityHandle make(uint32_t index, uint32_t generation) {
+        return fromBits((static_cast<uint64_t>(generation) << 32) | index);
+    }
+
+    /**
+     * @brief Восстановить хэндл из сырых 64 бит (сеть, сохранения, скрипты)
+     */
+    static constexpr EntityHandle fromBits(uint64_t bits) {
+        EntityHandle handle;
+        handle.m_bits = bits;
+        return handle;
+    }
+
+    /**
+     * @brief Восстановить хэндл из userData внешней библиотеки (Box2D)
+     */
+    static EntityHandle fromUserData(const void* userData) {
+        return fromBits(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(userData)));
+    }
+
+    /**
+     * @brief Упаковать хэндл в void* userData (пустой хэндл — nullptr)
+     */
+    void* toUserData() const {
+        static_assert(sizeof(void*) >= sizeof(uint64_t), "EntityHandle requires 64-bit pointers");
+        return reinterpret_cast<void*>(static_cast<uintptr_t>(m_bits));
+    }
+
+    constexpr uint64_t bits() const { return m_bits; }
+    constexpr uint32_t index() const { return static_cast<uint32_t>(m_bits); }
+    constexpr uint32_t generation() const { return static_cast<uint32_t>(m_bits >> 32); }
+    constexpr bool isNull() const { return m_bits == 0; }
+    constexpr explicit operator bool() const { return m_bits != 0; }
+
+    friend constexpr bool operator==(EntityHandle a, EntityHandle b) = default;
+
+private:
+    uint64_t m_bits = 0;  ///< generation << 32 | index
+};
+
+/**
+ * @brief Таблица внешних хэндлов сущностей с проверкой поколения
+ *
+ * Сущности ECS, на которые ссылаются внешние системы (userData тел Box2D,
+ * буфер трансформаций потока физики, кеш спрайтов рендера, в будущем —
+ * скрипты и сетевые клиенты), передаются наружу как EntityHandle.
+ * Переиспользованный registry идентификатор сущности не может совпасть
+ * со старым хэндлом: при уничтожении сущности поколение слота
+ * увеличивается, и resolve() старого хэндла возвращает entt::null.
+ *
+ * Слот — индекс сущности в registry (без версии), поэтому acquire(),
+ * find() и resolve() — обращение к вектору по индексу, без хэш-таблиц,
+ * а индекс хэндла пригоден для плотных массивов у потребителей.
+ * Поколение 32-битное, в отличие от 12-битной версии entt::entity,
+ * и не повторяется на практике.
+ *
+ * Одна таблица на registry, хранится в его контексте:
+ * @code
+ * auto& handles = EntityHandleTable::of(registry);
+ * EntityHandle handle = handles.acquire(entity);
+ * ...
+ * entt::entity target = handles.resolve(handle);  // entt::null, если сущность удалена
+ * @endcode
+ *
+ * Не потокобезопасна: защищается тем же мьютексом, что и registry.
+ */
+class EntityHandleTable {
+public:
+    EntityHandleTable() = default;
+
+    /**
+     * @brief Отключается от сигналов registry (если таблица не принадлежит ему)
+     */
+    ~EntityHandleTable();
+
+    EntityHandleTable(const EntityHandleTable&) = delete;
+    EntityHandleTable& operator=(const EntityHandleTable&) = delete;
+
+    /**
+     * @brief Таблица registry (создаётся в его контексте при первом обращении)
+     *
+     * Обращение к контексту — поиск по типу; в горячих циклах сохраняйте ссылку.
+     */
+    static EntityHandleTable& of(entt::registry& registry);
+
+    /**
+     * @brief Подписаться на уничтожение сущностей registry
+     *
+     * Registry должен жить дольше таблицы (или вызвать shutdown() раньше).
+     */
+    void init(entt::registry& registry);
+
+    /**
+     * @brief Отписаться от сигналов registry и сбросить все хэндлы
+     */
+    void shutdown();
+
+    /**
+     * @brief Хэндл сущности (создаётся при первом запросе)
+     * @return Пустой хэндл для entt::null
+     */
+    EntityHandle acquire(entt::entity entity);
+
+    /**
+     * @brief Хэндл сущности без создания
+     * @return Пустой хэндл, если хэндл не выдавался
+     */
+    EntityHandle find(entt::entity entity) const;
+
+    /**
+     * @brief Сущность по хэндлу
+     * @return entt::null, если хэндл пустой, устарел или сущность уничтожена
+     */
+    entt::entity resolve(EntityHandle handle) const;
+
+    /**
+     * @brief Действителен ли хэндл
+     */
+    bool isValid(EntityHandle handle) const { return resolve(handle) != entt::null; }
+
+    /**
+     * @brief Сделать хэндлы сущности недействительными
+     *
+     * Вызывается автоматически при уничтожении сущности (после init()).
+     */
+    void release(entt::entity entity);
+
+    /**
+     * @brief Количество слотов (максимальный индекс сущности с хэндлом + 1)
+     */
+    size_t getSlotCount() const { return m_slots.size(); }
+
+    /**
+     * @brief Количество действительных хэндлов
+     */
+    size_t getLiveCount() const { return m_liveCount; }
+
+private:
+    /// Слот таблицы (индекс слота = индекс сущности в registry)
+    struct Slot {
+        entt::entity entity = entt::null;  ///< Сущность с версией (null — слот свободен)
+        uint32_t generation = 1;           ///< Поколение, входящее в хэндл
+    };
+
+    void onEntityDestroy(entt::registry& registry, entt::entity entity);
+
+    /**
+     * @brief Увеличить поколение слота (0 пропускается — он зарезервирован за пустым хэндлом)
+     */
+    static void bumpGeneration(Slot& slot);
+
+    std::vector<Slot> m_slots;              ///< Слоты по индексу сущности
+    size_t m_liveCount = 0;                 ///< Занятые слоты
+    entt::registry* m_registry = nullptr;   ///< Registry, к сигналам которого подключены
+    bool m_ownedByRegistry = false;         ///< Таблица живёт в контексте registry
+};
+
+} // namespace core
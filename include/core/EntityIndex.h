@@ -0,0 +1,159 @@
+#pragma once
+
+#include "core/StringId.h"
+#include <entt/entt.hpp>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace core {
+
+/**
+ * @brief Индекс сущностей по имени (NameComponent) и тегу (TagComponent)
+ *
+ * Поиск по имени или тегу за O(1) без обхода всей сцены. Для каждого
+ * имени/тега хранится плотный вектор сущностей; удаление — swap-and-pop,
+ * поэтому порядок внутри вектора не гарантируется.
+ *
+ * Имена — произвольные строки пользователя и генератора карты ("Ground_3_7",
+ * переименования в редакторе), поэтому ключи имён — собственные std::string
+ * индекса и освобождаются вместе с последней сущностью. В глобальную таблицу
+ * StringId они не попадают. Теги — небольшой закрытый набор, их ключ — StringId.
+ *
+ * Индекс поддерживается через сигналы EnTT (on_construct / on_update /
+ * on_destroy) для NameComponent и TagComponent. Переименование должно идти
+ * через registry.patch() / replace(), иначе on_update не сработает:
+ *
+ * @code
+ * EntityIndex index;
+ * index.init(registry);
+ *
+ * entt::entity lamp = index.findByName("Lamp_FSM");
+ * for (entt::entity enemy : index.findByTag("enemy")) { ... }
+ *
+ * registry.patch<NameComponent>(entity, [](auto& n) { n.name = "Pump_01"; });
+ * @endcode
+ *
+ * Возвращаемые span'ы указывают во внутреннее хранилище и действительны
+ * до следующего изменения NameComponent/TagComponent в registry.
+ * Поиск по имени блокировок не берёт; создание StringId тега из строки
+ * требует блокировки — в горячих циклах передавайте заранее созданный StringId.
+ */
+class EntityIndex {
+public:
+    EntityIndex() = default;
+
+    /**
+     * @brief Отключается от сигналов registry (если был подключен)
+     */
+    ~EntityIndex();
+
+    EntityIndex(const EntityIndex&) = delete;
+    EntityIndex& operator=(const EntityIndex&) = delete;
+
+    /**
+     * @brief Заполнить индекс существующими сущностями и подписаться на сигналы
+     *
+     * Registry должен жить дольше индекса (или вызвать shutdown() раньше).
+     *
+     * @param registry EnTT registry
+     */
+    void init(entt::registry& registry);
+
+    /**
+     * @brief Отписаться от сигналов registry и очистить индекс
+     */
+    void shutdown();
+
+    /**
+     * @brief Первая сущность с указанным именем
+     * @return entt::null если имя не найдено
+     */
+    entt::entity findByName(std::string_view name) const;
+
+    /**
+     * @brief Все сущности с указанным именем (имена не обязаны быть уникальными)
+     */
+    std::span<const entt::entity> findAllByName(std::string_view name) const;
+
+    /**
+     * @brief Все сущности с указанным тегом
+     */
+    std::span<const entt::entity> findByTag(StringId tag) const;
+
+    /**
+     * @brief Количество сущностей с указанным тегом
+     */
+    size_t countByTag(StringId tag) const { return findByTag(tag).size(); }
+
+    /**
+     * @brief Имя сущности в индексе
+     * @return Пустая строка если у сущности нет NameComponent (ссылка
+     *         действительна до следующего изменения NameComponent в registry)
+     */
+    const std::string& nameOf(entt::entity entity) const;
+
+    /**
+     * @brief Тег сущности в индексе
+     * @return Пустой StringId если у сущности нет TagComponent
+     */
+    StringId tagOf(entt::entity entity) const;
+
+    /**
+     * @brief Количество проиндексированных имён / тегов (для отладки)
+     */
+    size_t getNamedCount() const { return m_names.slots.size(); }
+    size_t getTaggedCount() const { return m_tags.slots.size(); }
+
+private:
+    /// Хеш строк с поиском по std::string_view без создания std::string
+    struct NameHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view name) const noexcept {
+            return std::hash<std::string_view>{}(name);
+        }
+    };
+
+    /**
+     * @brief Отображение ключ → плотный набор сущностей с обратными индексами
+     *
+     * Определения членов — в EntityIndex.cpp (используется только там).
+     */
+    template<typename Key, typename Hash = std::hash<Key>, typename Equal = std::equal_to<Key>>
+    struct Table {
+        using Buckets = std::unordered_map<Key, std::vector<entt::entity>, Hash, Equal>;
+        using Bucket = typename Buckets::value_type;
+
+        /// Положение сущности: корзина (узлы unordered_map не перемещаются) и индекс в ней
+        struct Slot {
+            const Bucket* bucket;
+            size_t position;
+        };
+
+        Buckets buckets;                               ///< Ключ → сущности
+        std::unordered_map<entt::entity, Slot> slots;  ///< Сущность → положение
+
+        template<typename K>
+        void insert(entt::entity entity, const K& key);
+        void erase(entt::entity entity);
+        template<typename K>
+        std::span<const entt::entity> find(const K& key) const;
+        const Key* keyOf(entt::entity entity) const;
+        void clear();
+    };
+
+    void onNameChanged(entt::registry& registry, entt::entity entity);
+    void onNameDestroyed(entt::registry& registry, entt::entity entity);
+    void onTagChanged(entt::registry& registry, entt::entity entity);
+    void onTagDestroyed(entt::registry& registry, entt::entity entity);
+
+    Table<std::string, NameHash, std::equal_to<>> m_names;  ///< Имя → сущности
+    Table<StringId> m_tags;                                  ///< Тег → сущности
+
+    entt::registry* m_registry = nullptr;  ///< Registry, к сигналам которого подключены
+};
+
+} // namespace core
@@ -0,0 +1,229 @@
+#pragma once
+
+#include "core/JumpPointSearch.h"
+#include "core/NavigationGrid.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @file FlowField.h
+ * @brief Поля потока к общим целям (доки, станции) для флотов агентов
+ */
+
+namespace core {
+
+/**
+ * @brief Прямоугольник тайлов (footprint цели)
+ */
+struct TileRect {
+    int x = 0;       ///< Левый тайл
+    int y = 0;       ///< Верхний тайл
+    int width = 1;   ///< Ширина (тайлов)
+    int height = 1;  ///< Высота (тайлов)
+
+    bool contains(int tileX, int tileY) const {
+        return tileX >= x && tileX < x + width && tileY >= y && tileY < y + height;
+    }
+
+    bool operator==(const TileRect&) const = default;
+};
+
+/**
+ * @brief Параметры кеша полей потока
+ */
+struct FlowFieldSettings {
+    int cacheSize = 64;  ///< Максимум полей в кеше (LRU)
+
+    /**
+     * @brief Загрузить параметры из секции pathfinding конфигурации
+     * @return Параметры с дефолтами для отсутствующих ключей
+     */
+    static FlowFieldSettings fromConfig();
+};
+
+/**
+ * @brief Поле потока: расстояние до цели и направление спуска для каждого тайла
+ *
+ * Строится одним обратным проходом Дейкстры от тайлов цели по снимку
+ * проходимости (целочисленные веса 10 / 14 и кольцевая очередь корзин —
+ * линейное время). После построения агент любого тайла получает следующий
+ * шаг за O(1), поэтому сотни AGV к одному доку стоят одно поле, а не сотни A*.
+ *
+ * Правила движения те же, что у JumpPointSearch: углы не срезаются, тайлы
+ * цели проходимы, даже если заняты самим оборудованием.
+ *
+ * Поле неизменяемо: агенты держат shared_ptr и продолжают пользоваться им,
+ * пока кеш строит новое.
+ */
+class FlowField {
+public:
+    static constexpr uint32_t UNREACHABLE = 0xFFFFFFFFu;  ///< Стоимость недостижимого тайла
+    static constexpr uint32_t STRAIGHT_COST = 10;         ///< Шаг по оси
+    static constexpr uint32_t DIAGONAL_COST = 14;         ///< Шаг по диагонали (≈10·√2)
+
+    /**
+     * @brief Построить поле
+     *
+     * @param grid Снимок проходимости
+     * @param destination Тайлы цели (стоимость 0)
+     * @param connectivity Связность
+     */
+    FlowField(const NavigationSnapshot& grid, const TileRect& destination,
+              PathConnectivity connectivity = PathConnectivity::Eight);
+
+    /**
+     * @brief Стоимость пути до цели в единицах STRAIGHT_COST (UNREACHABLE — недостижим)
+     */
+    uint32_t getCost(int x, int y) const {
+        return inBounds(x, y) ? m_costs[indexOf(x, y)] : UNREACHABLE;
+    }
+
+    /**
+     * @brief Расстояние до цели в тайлах
+     */
+    float getDistance(int x, int y) const {
+        const uint32_t cost = getCost(x, y);
+        return cost == UNREACHABLE ? -1.0f : static_cast<float>(cost) / STRAIGHT_COST;
+    }
+
+    bool isReachable(int x, int y) const { return getCost(x, y) != UNREACHABLE; }
+
+    /**
+     * @brief Следующий тайл по полю
+     * @return from, если тайл уже в цели или цель недостижима
+     */
+    TilePoint next(TilePoint from) const {
+        if (!inBounds(from.x, from.y)) {
+            return from;
+        }
+        const uint8_t direction = m_directions[indexOf(from.x, from.y)];
+        if (direction == NO_DIRECTION) {
+            return from;
+        }
+        return TilePoint{from.x + DIRECTIONS[direction].x, from.y + DIRECTIONS[direction].y};
+    }
+
+    /**
+     * @brief Зависит ли поле от чанка снимка
+     *
+     * Поле покрывает чанки с достижимыми тайлами; изменение в них или в
+     * соседнем чанке (может открыть новый проход) делает поле устаревшим.
+     */
+    bool dependsOnChunk(uint32_t chunkIndex) const {
+        return chunkIndex < m_dependencies.size() && m_dependencies[chunkIndex] != 0;
+    }
+
+    const TileRect& getDestination() const { return m_destination; }
+    PathConnectivity getConnectivity() const { return m_connectivity; }
+    uint64_t getGridVersion() const { return m_gridVersion; }
+    int getWidth() const { return m_width; }
+    int getHeight() const { return m_height; }
+
+    /**
+     * @brief Количество достижимых тайлов
+     */
+    size_t getReachableCount() const { return m_reachable; }
+
+private:
+    static constexpr uint8_t NO_DIRECTION = 0xFF;
+    static constexpr std::array<TilePoint, 8> DIRECTIONS = {{
+        {1, 0}, {-1, 0}, {0, 1}, {0, -1}, {1, 1}, {-1, 1}, {1, -1}, {-1, -1}
+    }};
+
+    bool inBounds(int x, int y) const {
+        return x >= 0 && y >= 0 && x < m_width && y < m_height;
+    }
+    size_t indexOf(int x, int y) const {
+        return static_cast<size_t>(y) * static_cast<size_t>(m_width) + static_cast<size_t>(x);
+    }
+
+    /**
+     * @brief Можно ли шагнуть из (x, y) в направлении direction
+     */
+    bool canStep(const NavigationSnapshot& grid, int x, int y, size_t direction) const;
+
+    void integrate(const NavigationSnapshot& grid);
+    void buildDirections(const NavigationSnapshot& grid);
+    void buildDependencies(const NavigationSnapshot& grid);
+
+    TileRect m_destination;              ///< Цель
+    PathConnectivity m_connectivity;     ///< Связность
+    int m_width = 0;                     ///< Ширина карты
+    int m_height = 0;                    ///< Высота карты
+    uint64_t m_gridVersion = 0;          ///< Версия снимка, по которому построено
+    size_t m_reachable = 0;              ///< Достижимых тайлов
+
+    std::vector<uint32_t> m_costs;       ///< Стоимость до цели по тайлам
+    std::vector<uint8_t> m_directions;   ///< Индекс в DIRECTIONS или NO_DIRECTION
+    std::vector<uint8_t> m_dependencies; ///< Чанки, от которых зависит поле (флаги)
+};
+
+/**
+ * @brief Кеш полей потока с инвалидацией по изменённым чанкам
+ *
+ * Поле строится при первом запросе цели и переиспользуется всеми агентами.
+ * При каждом get() кеш сравнивает текущий снимок NavigationGrid с прошлым
+ * (NavigationSnapshot::diffChunks) и выбрасывает только поля, зависящие от
+ * изменённых чанков: склад в другом конце цеха не перестраивает поля доков.
+ * При переполнении вытесняется давно не запрошенное поле.
+ *
+ * @code
+ * FlowFieldCache flowFields(grid);
+ *
+ * auto field = flowFields.get(dockRect);
+ * TilePoint nextTile = field->next(agentTile);
+ * @endcode
+ *
+ * @note Вызывается из главного потока (того же, что изменяет NavigationGrid).
+ */
+class FlowFieldCache {
+public:
+    explicit FlowFieldCache(NavigationGrid& grid,
+                            const FlowFieldSettings& settings = FlowFieldSettings::fromConfig());
+
+    /**
+     * @brief Поле потока к цели (из кеша или построенное заново)
+     */
+    std::shared_ptr<const FlowField> get(const TileRect& destination,
+                                         PathConnectivity connectivity = PathConnectivity::Eight);
+
+    /**
+     * @brief Синхронизироваться с сеткой: выбросить устаревшие поля
+     *
+     * Вызывается автоматически из get(); отдельный вызов раз в кадр
+     * освобождает память устаревших полей сразу.
+     *
+     * @return Количество выброшенных полей
+     */
+    size_t sync();
+
+    /**
+     * @brief Выбросить все поля
+     */
+    void clear();
+
+    size_t size() const { return m_entries.size(); }
+    size_t getBuildCount() const { return m_buildCount; }
+    size_t getInvalidatedCount() const { return m_invalidatedCount; }
+
+private:
+    /// Поле в кеше
+    struct Entry {
+        std::shared_ptr<const FlowField> field;  ///< Поле
+        uint64_t lastUse = 0;                    ///< Такт последнего get()
+    };
+
+    NavigationGrid& m_grid;                            ///< Сетка проходимости
+    FlowFieldSettings m_settings;                      ///< Параметры
+    std::shared_ptr<const NavigationSnapshot> m_snapshot;  ///< Снимок, с которым синхронизированы
+    std::vector<Entry> m_entries;                      ///< Поля (единицы-десятки, линейный поиск)
+    std::vector<uint32_t> m_changedChunks;             ///< Буфер diffChunks()
+    uint64_t m_useCounter = 0;                         ///< Счётчик для LRU
+    size_t m_buildCount = 0;                           ///< Построено полей всего
+    size_t m_invalidatedCount = 0;                     ///< Выброшено устаревших полей всего
+};
+
+} // namespace core
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace core {
+
+/**
+ * @brief Линейный (bump) аллокатор для временных данных одного кадра
+ *
+ * Выделение — сдвиг указателя, освобождение отдельных блоков не выполняется:
+ * вся память возвращается разом в reset() в конце кадра. Если за кадр
+ * понадобилось больше одного блока, reset() объединяет их в один блок
+ * суммарного размера, поэтому в установившемся режиме кадр не обращается
+ * к куче вообще.
+ *
+ * Реализует std::pmr::memory_resource, так что подходит для любых
+ * std::pmr контейнеров:
+ * @code
+ * std::pmr::vector<entt::entity> dead(&FrameArena::current());
+ * @endcode
+ *
+ * У каждого потока своя арена (FrameArena::current()). Главный поток
+ * сбрасывает её в Application::run() после рендеринга; другие потоки,
+ * использующие арену, должны сбрасывать её на границе своего шага.
+ *
+ * ВАЖНО: контейнеры на арене не должны переживать кадр (не храните их
+ * в членах классов и не передавайте в другие потоки).
+ */
+class FrameArena : public std::pmr::memory_resource {
+public:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024;  ///< Начальный размер блока (64 КБ)
+
+    /**
+     * @brief Конструктор
+     * @param initialSize Размер первого блока в байтах
+     */
+    explicit FrameArena(size_t initialSize = DEFAULT_BLOCK_SIZE);
+
+    ~FrameArena() override;
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    /**
+     * @brief Арена текущего потока
+     */
+    static FrameArena& current();
+
+    /**
+     * @brief Освободить всю память кадра
+     *
+     * Все указатели, выданные ареной до вызова, становятся недействительными.
+     */
+    void reset();
+
+    /**
+     * @brief Занято байт в текущем кадре
+     */
+    size_t getBytesUsed() const { return m_bytesUsed; }
+
+    /**
+     * @brief Максимум занятых байт за кадр с момента создания
+     */
+    size_t getPeakBytes() const { return m_peakBytes; }
+
+    /**
+     * @brief Суммарная ёмкость всех блоков
+     */
+    size_t getCapacity() const { return m_capacity; }
+
+    /**
+     * @brief Количество блоков (1 в установившемся режиме)
+     */
+    size_t getBlockCount() const { return m_blocks.size(); }
+
+    /**
+     * @brief Сколько раз арена обращалась к куче за новым блоком
+     */
+    size_t getBlockAllocations() const { return m_blockAllocations; }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+private:
+    /// Блок памяти арены
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        size_t size;
+    };
+
+    /**
+     * @brief Добавить блок, вмещающий как минимум minSize байт
+     */
+    void addBlock(size_t minSize);
+
+    std::vector<Block> m_blocks;     ///< Блоки (текущий — последний)
+    size_t m_offset = 0;             ///< Смещение в текущем блоке
+    size_t m_bytesUsed = 0;          ///< Занято за кадр (с учётом выравнивания)
+    size_t m_peakBytes = 0;          ///< Пик за кадр
+    size_t m_capacity = 0;           ///< Суммарный размер блоков
+    size_t m_blockAllocations = 0;   ///< Счётчик выделений блоков
+};
+
+} // namespace core
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "core/NavigationGrid.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @file JumpPointSearch.h
+ * @brief Поиск кратчайшего пути на тайловой сетке (Jump Point Search)
+ */
+
+namespace core {
+
+/**
+ * @brief Связность сетки при поиске пути
+ */
+enum class PathConnectivity : uint8_t {
+    Four,   ///< Только по осям (провода, трубы)
+    Eight   ///< С диагоналями без срезания углов (погрузчики, AGV)
+};
+
+/**
+ * @brief Результат поиска пути
+ */
+enum class PathStatus : uint8_t {
+    Found,            ///< Путь найден
+    NoPath,           ///< Цель недостижима
+    InvalidEndpoint,  ///< Старт или цель за пределами карты
+    LimitReached,     ///< Превышен лимит раскрытых узлов
+    Cancelled         ///< Запрос отменён (PathfindingService)
+};
+
+/**
+ * @brief Параметры запроса пути
+ */
+struct PathQuery {
+    TilePoint start;                                          ///< Начальный тайл
+    TilePoint goal;                                           ///< Целевой тайл
+    PathConnectivity connectivity = PathConnectivity::Eight;  ///< Связность
+    size_t maxExpanded = 0;  ///< Лимит раскрытых узлов (0 — без лимита)
+};
+
+/**
+ * @brief Jump Point Search на однородной сетке
+ *
+ * A* с отсечением симметричных путей: вместо соседей раскрываются только
+ * «точки прыжка» — тайлы, где оптимальный путь может повернуть. На открытых
+ * участках цеха это на порядки меньше узлов, чем у A*, и не требует
+ * предрасчёта (в отличие от JPS+), поэтому размещение объекта не
+ * инвалидирует ничего, кроме чанка снимка. Прямые прыжки проверяют по 32
+ * тайла за операцию по битовым маскам строк и столбцов снимка.
+ *
+ * Старт и цель всегда считаются проходимыми: путь может начинаться на тайле
+ * агента и заканчиваться на тайле оборудования (порт подключения).
+ *
+ * Экземпляр хранит рабочие массивы между поисками (без выделений памяти в
+ * установившемся режиме) и не потокобезопасен — по одному на поток.
+ *
+ * @code
+ * JumpPointSearch search;
+ * std::vector<TilePoint> path;
+ * if (search.findPath(*grid.snapshot(), {start, goal}, path) == PathStatus::Found) {
+ *     // path — все тайлы от start до goal включительно
+ * }
+ * @endcode
+ */
+class JumpPointSearch {
+public:
+    /**
+     * @brief Найти кратчайший путь
+     *
+     * @param grid Снимок проходимости
+     * @param query Параметры запроса
+     * @param path Тайлы пути от старта до цели включительно (перезаписывается)
+     * @return Статус поиска
+     */
+    PathStatus findPath(const NavigationSnapshot& grid, const PathQuery& query,
+                        std::vector<TilePoint>& path);
+
+    /**
+     * @brief Стоимость последнего найденного пути (1 по оси, √2 по диагонали)
+     */
+    float getPathCost() const { return m_pathCost; }
+
+    /**
+     * @brief Количество раскрытых узлов в последнем поиске
+     */
+    size_t getExpandedCount() const { return m_expanded; }
+
+private:
+    static constexpr uint32_t NONE = 0xFFFFFFFFu;
+    static constexpr int LINE_BITS = NavigationSnapshot::CHUNK_SIZE;  ///< Тайлов в маске линии
+
+    /// Состояние тайла в текущем поиске (действительно при generation == m_generation)
+    struct Node {
+        uint32_t generation = 0;  ///< Поиск, в котором узел тронут
+        uint32_t parent = NONE;   ///< Предыдущая точка прыжка
+        float g = 0.0f;           ///< Стоимость от старта
+        bool closed = false;      ///< Раскрыт
+    };
+
+    /// Элемент открытого списка (ленивое удаление устаревших записей)
+    struct OpenEntry {
+        float f;         ///< g + h
+        float g;         ///< g на момент вставки
+        uint32_t index;  ///< Индекс тайла
+    };
+
+    bool isOpen(int x, int y) const;
+    uint32_t indexOf(int x, int y) const {
+        return static_cast<uint32_t>(y) * static_cast<uint32_t>(m_width) +
+               static_cast<uint32_t>(x);
+    }
+    float heuristic(int x, int y) const;
+
+    /**
+     * @brief Найти точку прыжка из (x, y) в направлении (dx, dy)
+     * @return Индекс тайла или NONE
+     */
+    uint32_t jump(int x, int y, int dx, int dy) const;
+    uint32_t jumpStraight(int x, int y, int dx, int dy) const;
+    uint32_t jumpDiagonal(int x, int y, int dx, int dy) const;
+    uint32_t jumpHorizontal4(int x, int y, int dx) const;
+    uint32_t jumpVertical4(int x, int y, int dy) const;
+
+    /**
+     * @brief Маска проходимости 32 тайлов линии с учётом старта и цели
+     *
+     * @param vertical true — столбец line, false — строка line
+     * @param base Первая позиция на линии (кратна LINE_BITS)
+     */
+    uint32_t lineBits(bool vertical, int line, int base) const;
+
+    /**
+     * @brief Прямой прыжок по линии масками по 32 тайла
+     *
+     * @return Первая точка прыжка после from в направлении step или NONE
+     */
+    uint32_t scanLine(bool vertical, int line, int from, int step) const;
+
+    /**
+     * @brief Направления обхода из узла с учётом направления прихода
+     */
+    void collectDirections(int x, int y, uint32_t parent);
+
+    void push(uint32_t index, float g);
+    void buildPath(uint32_t goal, std::vector<TilePoint>& path);
+
+    const NavigationSnapshot* m_grid = nullptr;  ///< Снимок текущего поиска
+    int m_width = 0;                             ///< Ширина снимка
+    TilePoint m_start;                           ///< Старт текущего поиска
+    TilePoint m_goal;                            ///< Цель текущего поиска
+    PathConnectivity m_connectivity = PathConnectivity::Eight;  ///< Связность
+
+    std::vector<Node> m_nodes;          ///< Узлы по индексу тайла
+    std::vector<OpenEntry> m_open;      ///< Открытый список (куча)
+    std::vector<int> m_directions;      ///< Направления раскрытия (пары dx, dy)
+    std::vector<uint32_t> m_jumpPoints; ///< Точки прыжка пути (буфер)
+    uint32_t m_generation = 0;          ///< Номер текущего поиска
+    size_t m_expanded = 0;              ///< Раскрыто узлов
+    float m_pathCost = 0.0f;            ///< Стоимость пути
+};
+
+} // namespace core
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file MotionKernels.h
+ * @brief SIMD-ядро отсечения AABB (SoA layout) и скалярная нормализация углов
+ *
+ * cullAabbs() работает с плотными массивами границ, которые RenderSystem
+ * и так строит для прохода отсечения. Движение векторным ядром не считается:
+ * компоненты EnTT хранятся как массивы структур (AoS), и сбор Transform/Velocity
+ * в SoA с записью обратно дороже прямого обхода группы (см. UpdateSystem),
+ * поэтому для него есть только скалярный wrapDegrees().
+ *
+ * Набор инструкций выбирается при компиляции:
+ * - AVX2 (если компилятор собран с -mavx2 / /arch:AVX2) — 8 float за итерацию;
+ * - SSE2 (базовый для x86-64) — 4 float за итерацию;
+ * - скалярный fallback для остальных архитектур.
+ */
+
+namespace core {
+
+/**
+ * @brief Границы видимой области для отсечения (мировые координаты)
+ */
+struct CullRect {
+    float left;    ///< Минимальный X
+    float top;     ///< Минимальный Y
+    float right;   ///< Максимальный X
+    float bottom;  ///< Максимальный Y
+};
+
+/**
+ * @brief Нормализовать угол в диапазон [0, 360)
+ *
+ * r - 360 * floor(r / 360) вместо std::fmod: без ветвлений на знак угла.
+ */
+inline float wrapDegrees(float degrees) {
+    const float wrapped = degrees - 360.0f * std::floor(degrees * (1.0f / 360.0f));
+    // Округление может дать ровно 360 для малых отрицательных углов
+    return wrapped >= 360.0f ? wrapped - 360.0f : wrapped;
+}
+
+/**
+ * @brief Отсечь AABB по видимой области
+ *
+ * Прямоугольник i видим, если строго пересекается с view
+ * (та же семантика, что sf::Rect::findIntersection).
+ *
+ * @param minX, minY, maxX, maxY Границы прямоугольников
+ * @param count Количество прямоугольников
+ * @param view Видимая область
+ * @param visible Выходная маска (1 — видим, 0 — отсечён), размер >= count
+ * @return Количество видимых прямоугольников
+ */
+size_t cullAabbs(const float* minX, const float* minY, const float* maxX, const float* maxY,
+                 size_t count, const CullRect& view, uint8_t* visible);
+
+/**
+ * @brief Имя набора инструкций, с которым собраны ядра ("AVX2", "SSE2", "Scalar")
+ */
+const char* motionKernelInstructionSet();
+
+} // namespace core
@@ -0,0 +1,260 @@
+#pragma once
+
+#include "core/Components.h"
+#include "core/TileOccupancyGrid.h"
+#include <entt/entt.hpp>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+/**
+ * @file NavigationGrid.h
+ * @brief Сетка проходимости тайловой карты для поиска путей
+ */
+
+namespace core {
+
+/**
+ * @brief Координаты тайла
+ */
+struct TilePoint {
+    int x = 0;  ///< X в тайлах
+    int y = 0;  ///< Y в тайлах
+
+    bool operator==(const TilePoint&) const = default;
+};
+
+/**
+ * @brief Неизменяемый снимок проходимости для фоновых потоков
+ *
+ * Хранит проходимость чанками CHUNK_SIZE × CHUNK_SIZE через shared_ptr:
+ * соседние снимки разделяют все чанки, кроме изменённых, поэтому публикация
+ * после размещения объекта стоит O(число чанков), а не O(размер карты).
+ * Снимок можно читать из любого потока без блокировок.
+ *
+ * Чанк — битовые маски строк и столбцов (бит i — тайл со смещением i), так
+ * что поиск пути проверяет 32 тайла линии одной операцией.
+ */
+class NavigationSnapshot {
+public:
+    static constexpr int CHUNK_SIZE = 32;  ///< Сторона чанка (тайлов) = ширина маски
+
+    /// Проходимость тайлов чанка (1 — проходим)
+    struct Chunk {
+        std::array<uint32_t, CHUNK_SIZE> rows{};     ///< rows[y]: бит x
+        std::array<uint32_t, CHUNK_SIZE> columns{};  ///< columns[x]: бит y
+    };
+
+    /**
+     * @brief Проходим ли тайл (за пределами карты — нет)
+     */
+    bool isWalkable(int x, int y) const {
+        if (x < 0 || y < 0 || x >= m_width || y >= m_height) {
+            return false;
+        }
+        return (chunkAt(x, y).rows[static_cast<size_t>(y % CHUNK_SIZE)] >>
+                (x % CHUNK_SIZE)) & 1u;
+    }
+
+    /**
+     * @brief Маска проходимости 32 тайлов строки y начиная с x0 (x0 кратно CHUNK_SIZE)
+     */
+    uint32_t rowBits(int x0, int y) const {
+        if (x0 < 0 || y < 0 || x0 >= m_width || y >= m_height) {
+            return 0;
+        }
+        return chunkAt(x0, y).rows[static_cast<size_t>(y % CHUNK_SIZE)];
+    }
+
+    /**
+     * @brief Маска проходимости 32 тайлов столбца x начиная с y0 (y0 кратно CHUNK_SIZE)
+     */
+    uint32_t columnBits(int x, int y0) const {
+        if (x < 0 || y0 < 0 || x >= m_width || y0 >= m_height) {
+            return 0;
+        }
+        return chunkAt(x, y0).columns[static_cast<size_t>(x % CHUNK_SIZE)];
+    }
+
+    bool contains(TilePoint point) const {
+        return point.x >= 0 && point.y >= 0 && point.x < m_width && point.y < m_height;
+    }
+
+    int getWidth() const { return m_width; }
+    int getHeight() const { return m_height; }
+    size_t getChunksX() const { return m_chunksX; }
+    size_t getChunkCount() const { return m_chunks.size(); }
+
+    /**
+     * @brief Версия сетки на момент снимка (растёт при каждом изменении проходимости)
+     */
+    uint64_t getVersion() const { return m_version; }
+
+    /**
+     * @brief Чанки, изменившиеся относительно более старого снимка
+     *
+     * Сравнивает указатели чанков (копирование при записи), O(число чанков).
+     *
+     * @param older Более старый снимок той же сетки
+     * @param out Индексы изменённых чанков (дополняется)
+     * @return false если размеры карт различаются (изменилось всё)
+     */
+    bool diffChunks(const NavigationSnapshot& older, std::vector<uint32_t>& out) const;
+
+private:
+    friend class NavigationGrid;
+
+    const Chunk& chunkAt(int x, int y) const {
+        return *m_chunks[static_cast<size_t>(y / CHUNK_SIZE) * m_chunksX +
+                         static_cast<size_t>(x / CHUNK_SIZE)];
+    }
+
+    int m_width = 0;                                   ///< Ширина карты (тайлов)
+    int m_height = 0;                                  ///< Высота карты (тайлов)
+    size_t m_chunksX = 0;                              ///< Чанков по горизонтали
+    uint64_t m_version = 0;                            ///< Версия сетки
+    std::vector<std::shared_ptr<const Chunk>> m_chunks; ///< Чанки построчно
+};
+
+/**
+ * @brief Сетка проходимости: рельеф карты + занятость размещёнными объектами
+ *
+ * Тайл непроходим, если он заблокирован рельефом (стены карты, вода) или на
+ * нём стоит хотя бы один статичный объект слоя OccupancyLayer::Object.
+ * Объекты учитываются счётчиком на тайл, поэтому перекрытия и удаление в
+ * любом порядке корректны. Динамические сущности (autoSync = false —
+ * погрузчики, AGV) тайлы не блокируют: их конфликты решаются резервированием,
+ * а не картой.
+ *
+ * Объекты сетка получает от TileOccupancyGrid (ITileOccupancyListener): сигналы
+ * registry и footprint'ы сущностей хранит только индекс занятости. Изменения
+ * помечают чанки грязными; snapshot() публикует новый неизменяемый снимок,
+ * пересобирая только грязные чанки.
+ *
+ * @code
+ * NavigationGrid grid(mapWidth, mapHeight);
+ * grid.setTerrain(blockedMask);
+ * grid.init(occupancyGrid);
+ *
+ * auto snapshot = grid.snapshot();   // Для PathfindingService / JumpPointSearch
+ * @endcode
+ *
+ * @note Все методы, кроме чтения снимков, вызываются из главного потока.
+ */
+class NavigationGrid : public ITileOccupancyListener {
+public:
+    static constexpr int CHUNK_SIZE = NavigationSnapshot::CHUNK_SIZE;
+
+    NavigationGrid();
+
+    /**
+     * @brief Сетка под карту заданного размера (весь рельеф проходим)
+     */
+    NavigationGrid(int width, int height);
+
+    /**
+     * @brief Отписывается от индекса занятости (если был подключен)
+     */
+    ~NavigationGrid() override;
+
+    NavigationGrid(const NavigationGrid&) = delete;
+    NavigationGrid& operator=(const NavigationGrid&) = delete;
+
+    /**
+     * @brief Учесть объекты индекса занятости и подписаться на его изменения
+     *
+     * Индекс должен жить дольше сетки (или вызвать shutdown() раньше).
+     *
+     * @param occupancy Индекс занятости тайлов
+     */
+    void init(TileOccupancyGrid& occupancy);
+
+    /**
+     * @brief Отписаться от индекса занятости и забыть объекты
+     */
+    void shutdown();
+
+    /**
+     * @brief Изменить размер карты (рельеф сбрасывается, объекты сохраняются)
+     */
+    void resize(int width, int height);
+
+    /**
+     * @brief Задать рельеф всей карты
+     *
+     * @param blocked Маска width × height построчно (не 0 — непроходимо)
+     */
+    void setTerrain(std::span<const uint8_t> blocked);
+
+    /**
+     * @brief Заблокировать или освободить тайл рельефа
+     */
+    void setTerrainBlocked(int x, int y, bool blocked);
+
+    /**
+     * @brief Проходим ли тайл в текущем (неопубликованном) состоянии
+     */
+    bool isWalkable(int x, int y) const;
+
+    /**
+     * @brief Опубликовать снимок проходимости
+     *
+     * Без изменений возвращает предыдущий снимок; иначе пересобирает
+     * только грязные чанки, разделяя остальные с предыдущим снимком.
+     */
+    std::shared_ptr<const NavigationSnapshot> snapshot();
+
+    /**
+     * @brief Блокирует ли объект с таким footprint'ом тайлы
+     */
+    static bool blocksTiles(const TileFootprint& footprint);
+
+    void onFootprintAdded(entt::entity entity, const TileFootprint& footprint) override;
+    void onFootprintRemoved(entt::entity entity, const TileFootprint& footprint) override;
+
+    int getWidth() const { return m_width; }
+    int getHeight() const { return m_height; }
+    uint64_t getVersion() const { return m_version; }
+    size_t getDirtyChunkCount() const { return m_dirtyChunks.size(); }
+    size_t getObjectCount() const { return m_objectCount; }
+
+private:
+    /**
+     * @brief Изменить счётчик объектов на тайлах footprint'а (+1 / -1)
+     */
+    void applyFootprint(const TileFootprint& footprint, int delta);
+
+    /**
+     * @brief Учесть возможное изменение проходимости тайла
+     */
+    void onCellChanged(size_t index, bool wasWalkable);
+
+    bool walkableAt(size_t index) const {
+        return m_terrain[index] == 0 && m_objects[index] == 0;
+    }
+
+    void markAllDirty();
+    std::shared_ptr<const NavigationSnapshot::Chunk> buildChunk(size_t chunkIndex) const;
+
+    int m_width = 0;                  ///< Ширина карты (тайлов)
+    int m_height = 0;                 ///< Высота карты (тайлов)
+    size_t m_chunksX = 0;             ///< Чанков по горизонтали
+    size_t m_chunksY = 0;             ///< Чанков по вертикали
+    uint64_t m_version = 0;           ///< Счётчик изменений проходимости
+    size_t m_objectCount = 0;         ///< Учтённых блокирующих объектов
+
+    std::vector<uint8_t> m_terrain;   ///< Рельеф: 1 — непроходимо
+    std::vector<uint16_t> m_objects;  ///< Количество объектов на тайле
+    std::vector<uint8_t> m_dirtyFlags;    ///< Грязные чанки (флаги)
+    std::vector<uint32_t> m_dirtyChunks;  ///< Грязные чанки (список)
+
+    std::shared_ptr<const NavigationSnapshot> m_snapshot;      ///< Последний снимок
+    std::shared_ptr<const NavigationSnapshot::Chunk> m_openChunk;  ///< Общий пустой чанк
+
+    TileOccupancyGrid* m_occupancy = nullptr;  ///< Индекс занятости, на который подписаны
+};
+
+} // namespace core
@@ -0,0 +1,293 @@
+#pragma once
+
+#include "core/StringId.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file ObjectiveEvaluator.h
+ * @brief Инкрементальная проверка целей сценария по графу зависимостей
+ */
+
+namespace core {
+
+/// Узел графа условий
+using ObjectiveNode = uint32_t;
+
+/// Идентификатор цели
+using ObjectiveId = uint32_t;
+
+/**
+ * @brief Оператор сравнения
+ */
+enum class CompareOp : uint8_t {
+    Less,          ///< a < b
+    LessEqual,     ///< a <= b
+    Greater,       ///< a > b
+    GreaterEqual,  ///< a >= b
+    Equal,         ///< a == b
+    NotEqual       ///< a != b
+};
+
+/**
+ * @brief Состояние цели
+ */
+enum class ObjectiveStatus : uint8_t {
+    Pending,    ///< Ещё не выполнена
+    Completed,  ///< Выполнена (окончательно)
+    Failed      ///< Провалена (окончательно)
+};
+
+/**
+ * @brief Изменение состояния цели
+ */
+struct ObjectiveChange {
+    ObjectiveId objective = 0;                          ///< Цель
+    ObjectiveStatus status = ObjectiveStatus::Pending;  ///< Новое состояние
+    double time = 0.0;                                  ///< Время изменения
+};
+
+/**
+ * @brief Граф условий целей сценария с инкрементальным пересчётом
+ *
+ * Условие («уровень бака 40–60 % в течение 10 минут», «500 деталей и
+ * меньше 3 браков») собирается из узлов: входы (теги и показатели
+ * статистики), константы, сравнения, логика и временные узлы. Узлы
+ * создаются только из уже существующих, поэтому порядок создания —
+ * топологический, а одинаковые входы разделяются всеми целями.
+ *
+ * setInput() меняет значение входа и помечает зависимые узлы; update()
+ * пересчитывает только помеченные узлы по возрастанию индекса (каждый не
+ * больше раза) и распространяет дальше лишь реально изменившиеся
+ * значения. Временные узлы не опрашиваются каждый такт: holdsFor() ставит
+ * таймер на момент, когда условие станет выполненным, и узел пересчитается
+ * только по таймеру или при смене условия. Такт без изменений входов стоит
+ * одну проверку вершины кучи таймеров.
+ *
+ * @code
+ * ObjectiveEvaluator objectives;
+ * auto level = objectives.input("tank1.level");
+ * objectives.addObjective("keep_level",
+ *     objectives.holdsFor(objectives.between(level, 40.0, 60.0), 600.0));
+ *
+ * auto good = objectives.input("line_A.good");
+ * auto scrap = objectives.input("line_A.scrap");
+ * objectives.addObjective("produce_500",
+ *     objectives.compare(good, CompareOp::GreaterEqual, 500.0),
+ *     objectives.compare(scrap, CompareOp::GreaterEqual, 3.0));  // Условие провала
+ *
+ * // Каждый такт
+ * objectives.setInput("tank1.level", tankLevel);
+ * objectives.update(simTime);
+ * objectives.collectChanges(changes);
+ * @endcode
+ *
+ * @note Не потокобезопасен; не зависит от рендеринга (работает в headless-прогонах).
+ */
+class ObjectiveEvaluator {
+public:
+    static constexpr ObjectiveNode NO_NODE = std::numeric_limits<ObjectiveNode>::max();
+
+    // ---- Построение графа ----
+
+    /**
+     * @brief Вход (тег или показатель); один узел на тег
+     *
+     * Значение до первого setInput() — 0.
+     */
+    ObjectiveNode input(StringId tag);
+
+    /**
+     * @brief Константа
+     */
+    ObjectiveNode constant(double value);
+
+    /**
+     * @brief Сравнение двух узлов (1 — истина, 0 — ложь)
+     */
+    ObjectiveNode compare(ObjectiveNode a, CompareOp op, ObjectiveNode b);
+
+    /**
+     * @brief Сравнение узла с константой
+     */
+    ObjectiveNode compare(ObjectiveNode a, CompareOp op, double b) {
+        return compare(a, op, constant(b));
+    }
+
+    /**
+     * @brief low <= value <= high
+     */
+    ObjectiveNode between(ObjectiveNode value, double low, double high);
+
+    /**
+     * @brief Все условия истинны (пустой список — истина)
+     */
+    ObjectiveNode allOf(std::span<const ObjectiveNode> conditions);
+    ObjectiveNode allOf(std::initializer_list<ObjectiveNode> conditions) {
+        return allOf(std::span<const ObjectiveNode>(conditions.begin(), conditions.size()));
+    }
+
+    /**
+     * @brief Хотя бы одно условие истинно (пустой список — ложь)
+     */
+    ObjectiveNode anyOf(std::span<const ObjectiveNode> conditions);
+    ObjectiveNode anyOf(std::initializer_list<ObjectiveNode> conditions) {
+        return anyOf(std::span<const ObjectiveNode>(conditions.begin(), conditions.size()));
+    }
+
+    /**
+     * @brief Отрицание условия
+     */
+    ObjectiveNode negate(ObjectiveNode condition);
+
+    /**
+     * @brief Условие непрерывно истинно не меньше seconds
+     *
+     * Отсчёт начинается с update(), в котором условие стало истинным, и
+     * сбрасывается, как только оно становится ложным.
+     */
+    ObjectiveNode holdsFor(ObjectiveNode condition, double seconds);
+
+    /**
+     * @brief Условие хоть раз было истинным (защёлка)
+     */
+    ObjectiveNode latch(ObjectiveNode condition);
+
+    /**
+     * @brief Зарегистрировать цель
+     *
+     * @param name Имя цели (для UI и отчёта)
+     * @param success Условие выполнения
+     * @param failure Условие провала (NO_NODE — нет)
+     * @return Идентификатор цели
+     */
+    ObjectiveId addObjective(StringId name, ObjectiveNode success,
+                             ObjectiveNode failure = NO_NODE);
+
+    // ---- Вычисление ----
+
+    /**
+     * @brief Задать значение входа
+     *
+     * Неизвестный тег игнорируется; то же значение не вызывает пересчёта.
+     *
+     * @return false если тег не используется ни одной целью
+     */
+    bool setInput(StringId tag, double value);
+
+    /**
+     * @brief Пересчитать изменившиеся узлы и сработавшие таймеры
+     *
+     * @param time Текущее время симуляции (секунды, не убывает)
+     * @return Количество целей, изменивших состояние
+     */
+    size_t update(double time);
+
+    /**
+     * @brief Забрать накопленные изменения состояний целей
+     *
+     * @param out Изменения (дополняется)
+     * @return Количество добавленных изменений
+     */
+    size_t collectChanges(std::vector<ObjectiveChange>& out);
+
+    // ---- Состояние ----
+
+    double getValue(ObjectiveNode node) const { return m_nodes[node].value; }
+    bool isTrue(ObjectiveNode node) const { return m_nodes[node].value != 0.0; }
+
+    ObjectiveStatus getStatus(ObjectiveId objective) const {
+        return m_objectives[objective].status;
+    }
+    StringId getName(ObjectiveId objective) const { return m_objectives[objective].name; }
+
+    /**
+     * @brief Время, когда цель получила окончательное состояние
+     */
+    double getStatusTime(ObjectiveId objective) const { return m_objectives[objective].statusTime; }
+
+    size_t getObjectiveCount() const { return m_objectives.size(); }
+    size_t getNodeCount() const { return m_nodes.size(); }
+
+    /**
+     * @brief Сколько узлов пересчитано в последнем update()
+     */
+    size_t getEvaluatedCount() const { return m_evaluated; }
+
+    /**
+     * @brief Все ли цели выполнены
+     */
+    bool allCompleted() const { return m_completed == m_objectives.size(); }
+
+private:
+    /// Вид узла
+    enum class Kind : uint8_t {
+        Input,
+        Constant,
+        Compare,
+        All,
+        Any,
+        Not,
+        HoldsFor,
+        Latch
+    };
+
+    /// Узел графа
+    struct Node {
+        Kind kind = Kind::Constant;         ///< Вид
+        CompareOp op = CompareOp::Equal;    ///< Оператор (Compare)
+        bool queued = false;                ///< Помечен для пересчёта
+        uint32_t firstChild = 0;            ///< Первый аргумент в m_children
+        uint32_t childCount = 0;            ///< Количество аргументов
+        double param = 0.0;                 ///< Длительность (HoldsFor)
+        double value = 0.0;                 ///< Текущее значение
+        double since = -1.0;                ///< Начало истинности условия (HoldsFor)
+    };
+
+    /// Цель
+    struct Objective {
+        StringId name;                                    ///< Имя
+        ObjectiveNode success = NO_NODE;                  ///< Условие выполнения
+        ObjectiveNode failure = NO_NODE;                  ///< Условие провала
+        ObjectiveStatus status = ObjectiveStatus::Pending;  ///< Состояние
+        double statusTime = 0.0;                          ///< Время окончательного состояния
+    };
+
+    /// Таймер временного узла
+    struct Timer {
+        double deadline;     ///< Момент пересчёта
+        ObjectiveNode node;  ///< Узел HoldsFor
+
+        bool operator>(const Timer& other) const { return deadline > other.deadline; }
+    };
+
+    ObjectiveNode addNode(Kind kind, std::span<const ObjectiveNode> children, double param = 0.0,
+                          CompareOp op = CompareOp::Equal);
+    double evaluate(ObjectiveNode node);
+    void markDirty(ObjectiveNode node);
+    void checkObjective(ObjectiveId objective);
+
+    std::vector<Node> m_nodes;                            ///< Узлы (топологический порядок)
+    std::vector<ObjectiveNode> m_children;                ///< Аргументы узлов подряд
+    std::vector<std::vector<ObjectiveNode>> m_dependents; ///< Узлы, зависящие от узла
+    std::vector<std::vector<ObjectiveId>> m_watchers;     ///< Цели, зависящие от узла
+    std::unordered_map<StringId, ObjectiveNode> m_inputs; ///< Тег → узел входа
+
+    std::vector<Objective> m_objectives;                  ///< Цели
+    std::vector<ObjectiveChange> m_changes;               ///< Изменения для collectChanges()
+    std::vector<ObjectiveId> m_checks;                    ///< Цели к проверке в update()
+    std::vector<ObjectiveNode> m_dirty;                   ///< Куча помеченных узлов (по индексу)
+    std::vector<Timer> m_timers;                          ///< Куча таймеров (min по времени)
+
+    double m_time = 0.0;      ///< Время последнего update()
+    size_t m_evaluated = 0;   ///< Пересчитано узлов в последнем update()
+    size_t m_completed = 0;   ///< Выполненных целей
+};
+
+} // namespace core
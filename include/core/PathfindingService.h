@@ -0,0 +1,173 @@
+#pragma once
+
+#include "core/JumpPointSearch.h"
+#include "core/NavigationGrid.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @file PathfindingService.h
+ * @brief Асинхронный поиск путей в пуле рабочих потоков
+ */
+
+namespace core {
+
+/**
+ * @brief Параметры сервиса поиска путей
+ */
+struct PathfindingSettings {
+    int workerThreads = 2;        ///< Рабочих потоков (0 — запросы выполняются в collectResults)
+    int batchSize = 16;           ///< Максимум запросов, забираемых потоком за раз
+    int maxExpandedNodes = 0;     ///< Лимит раскрытых узлов по умолчанию (0 — без лимита)
+
+    /**
+     * @brief Загрузить параметры из секции pathfinding конфигурации
+     * @return Параметры с дефолтами для отсутствующих ключей
+     */
+    static PathfindingSettings fromConfig();
+};
+
+/// Идентификатор запроса пути (0 — недействительный)
+using PathRequestId = uint64_t;
+
+/**
+ * @brief Результат асинхронного запроса пути
+ */
+struct PathResult {
+    PathRequestId id = 0;                   ///< Идентификатор запроса
+    PathStatus status = PathStatus::NoPath; ///< Статус поиска
+    std::vector<TilePoint> path;            ///< Тайлы пути (пусто, если не найден)
+    float cost = 0.0f;                      ///< Стоимость пути
+    uint64_t gridVersion = 0;               ///< Версия сетки, на которой искали
+};
+
+/**
+ * @brief Сервис поиска путей: пакетная обработка запросов в рабочих потоках
+ *
+ * Запрос захватывает текущий снимок NavigationGrid (копирование при записи
+ * по чанкам), поэтому рабочие потоки ищут без блокировок, а главный поток
+ * тем временем свободно размещает объекты. Потоки забирают запросы пакетами
+ * до batchSize и публикуют результаты одним захватом мьютекса на пакет —
+ * флот агентов не упирается в очередь и не тормозит кадр.
+ *
+ * Результат содержит gridVersion: если сетка с тех пор изменилась, агент
+ * может перезапросить путь.
+ *
+ * Для интерактивной трассировки в редакторе есть синхронный findPathNow():
+ * JPS на одном потоке укладывается в доли миллисекунды на типичном цехе.
+ *
+ * @code
+ * PathfindingService pathfinding(grid);
+ * pathfinding.start();
+ *
+ * auto id = pathfinding.requestPath({agentTile, dockTile});
+ *
+ * // Каждый кадр в главном потоке:
+ * results.clear();
+ * pathfinding.collectResults(results);
+ * @endcode
+ *
+ * @note requestPath(), cancel(), collectResults() и findPathNow() вызываются
+ *       из главного потока (того же, что изменяет NavigationGrid).
+ */
+class PathfindingService {
+public:
+    explicit PathfindingService(
+        NavigationGrid& grid,
+        const PathfindingSettings& settings = PathfindingSettings::fromConfig());
+
+    /**
+     * @brief Останавливает рабочие потоки
+     */
+    ~PathfindingService();
+
+    PathfindingService(const PathfindingService&) = delete;
+    PathfindingService& operator=(const PathfindingService&) = delete;
+
+    /**
+     * @brief Запустить рабочие потоки
+     * @return false если уже запущены
+     */
+    bool start();
+
+    /**
+     * @brief Остановить рабочие потоки (невыполненные запросы остаются в очереди)
+     */
+    void stop();
+
+    bool isRunning() const { return m_running.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Поставить запрос в очередь
+     *
+     * @param query Параметры (maxExpanded = 0 — лимит из настроек)
+     * @return Идентификатор запроса
+     */
+    PathRequestId requestPath(const PathQuery& query);
+
+    /**
+     * @brief Отменить запрос
+     * @return true если запрос ещё не был выдан через collectResults()
+     */
+    bool cancel(PathRequestId id);
+
+    /**
+     * @brief Забрать готовые результаты
+     *
+     * Без рабочих потоков (workerThreads = 0 или сервис не запущен)
+     * выполняет очередь на вызывающем потоке.
+     *
+     * @param out Выходной вектор (дополняется, не очищается)
+     * @return Количество добавленных результатов
+     */
+    size_t collectResults(std::vector<PathResult>& out);
+
+    /**
+     * @brief Синхронный поиск на вызывающем потоке (трассировка в редакторе)
+     */
+    PathStatus findPathNow(const PathQuery& query, std::vector<TilePoint>& path);
+
+    /**
+     * @brief Запросов в очереди и в работе
+     */
+    size_t getPendingCount() const;
+
+    const PathfindingSettings& getSettings() const { return m_settings; }
+
+private:
+    /// Запрос в очереди
+    struct PendingRequest {
+        PathRequestId id;
+        PathQuery query;
+        std::shared_ptr<const NavigationSnapshot> grid;  ///< Снимок на момент запроса
+    };
+
+    void workerLoop();
+    static PathResult execute(JumpPointSearch& search, const PendingRequest& request);
+
+    NavigationGrid& m_grid;             ///< Сетка проходимости
+    PathfindingSettings m_settings;     ///< Параметры
+    JumpPointSearch m_search;           ///< Поиск для findPathNow() и режима без потоков
+
+    std::vector<std::thread> m_workers;    ///< Рабочие потоки
+    std::atomic<bool> m_running{false};    ///< Потоки запущены
+    bool m_stopping = false;               ///< Сигнал остановки (под m_mutex)
+
+    mutable std::mutex m_mutex;                 ///< Защищает очередь и результаты
+    std::condition_variable m_condition;        ///< Пробуждение рабочих потоков
+    std::deque<PendingRequest> m_queue;         ///< Очередь запросов
+    std::vector<PathResult> m_results;          ///< Готовые результаты
+    std::unordered_set<PathRequestId> m_inFlight;   ///< Выполняются потоками
+    std::unordered_set<PathRequestId> m_cancelled;  ///< Отменены во время выполнения
+    PathRequestId m_nextId = 1;                 ///< Следующий идентификатор
+};
+
+} // namespace core
@@ -0,0 +1,296 @@
+#pragma once
+
+#include "core/StringId.h"
+
+#include <entt/entt.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file ProductionStatistics.h
+ * @brief Потоковая статистика производства: наработка, простои, OEE, заполнение буферов
+ */
+
+namespace core {
+
+/**
+ * @brief Состояние станка для учёта времени (классификация OEE)
+ */
+enum class MachineState : uint8_t {
+    Running,      ///< Производит
+    Idle,         ///< Ждёт заготовку (голодание)
+    Blocked,      ///< Выход занят (блокировка следующим участком)
+    Down,         ///< Авария
+    Setup,        ///< Переналадка
+    PlannedStop,  ///< Плановый останов (не входит в плановое время)
+    Count
+};
+
+/// Количество состояний станка
+inline constexpr size_t MACHINE_STATE_COUNT = static_cast<size_t>(MachineState::Count);
+
+/**
+ * @brief Параметры агрегации статистики
+ */
+struct ProductionSettings {
+    double windowSeconds = 3600.0;  ///< Длина скользящего окна (секунды симуляции)
+    int windowBuckets = 60;         ///< Корзин в окне (разрешение окна)
+    double cycleSmoothing = 0.1;    ///< Коэффициент EWMA времени цикла (0..1]
+
+    /**
+     * @brief Загрузить параметры из секции production конфигурации
+     * @return Параметры с дефолтами для отсутствующих ключей
+     */
+    static ProductionSettings fromConfig();
+};
+
+/**
+ * @brief Составляющие OEE
+ */
+struct OeeBreakdown {
+    double availability = 0.0;  ///< Наработка / плановое время
+    double performance = 0.0;   ///< Идеальное время выпуска / наработка
+    double quality = 0.0;       ///< Годные / всего
+    double oee = 0.0;           ///< availability × performance × quality
+};
+
+/**
+ * @brief Статистика станка на момент снимка
+ */
+struct MachineStats {
+    entt::entity machine = entt::null;     ///< Станок
+    StringId line;                         ///< Линия
+    MachineState state = MachineState::Idle;  ///< Текущее состояние
+    double timeInState = 0.0;              ///< Секунд в текущем состоянии
+    std::array<double, MACHINE_STATE_COUNT> stateSeconds{};  ///< Всего секунд по состояниям
+    uint64_t goodCount = 0;                ///< Годных изделий
+    uint64_t scrapCount = 0;               ///< Брака
+    uint32_t failureCount = 0;             ///< Переходов в Down
+    double meanCycleSeconds = 0.0;         ///< Сглаженное (EWMA) время цикла
+    double throughputPerHour = 0.0;        ///< Годных в час за окно
+    OeeBreakdown oee;                      ///< OEE с начала учёта
+    OeeBreakdown windowOee;                ///< OEE за скользящее окно
+};
+
+/**
+ * @brief Статистика линии (сумма по станкам)
+ */
+struct LineStats {
+    StringId line;                ///< Линия
+    size_t machineCount = 0;      ///< Станков
+    size_t machinesDown = 0;      ///< Станков в аварии сейчас
+    uint64_t goodCount = 0;       ///< Годных на выходе линии
+    uint64_t scrapCount = 0;      ///< Брака по всем станкам
+    double throughputPerHour = 0.0;  ///< Годных в час на выходе линии за окно
+    OeeBreakdown oee;             ///< OEE линии с начала учёта
+    OeeBreakdown windowOee;       ///< OEE линии за окно
+};
+
+/**
+ * @brief Статистика буфера (накопителя между станками)
+ */
+struct BufferStats {
+    entt::entity buffer = entt::null;  ///< Буфер
+    StringId line;                     ///< Линия
+    uint32_t level = 0;                ///< Текущее заполнение (шт.)
+    uint32_t capacity = 0;             ///< Ёмкость (шт.)
+    double averageFill = 0.0;          ///< Среднее по времени заполнение (0..1)
+    double fullSeconds = 0.0;          ///< Секунд полным
+    double emptySeconds = 0.0;         ///< Секунд пустым
+};
+
+/**
+ * @brief Снимок всей статистики для UI и проверок сценариев
+ */
+struct ProductionSnapshot {
+    double time = 0.0;                  ///< Время снимка
+    std::vector<MachineStats> machines; ///< Станки
+    std::vector<LineStats> lines;       ///< Линии (в порядке появления)
+    std::vector<BufferStats> buffers;   ///< Буферы
+};
+
+/**
+ * @brief Инкрементальная статистика производства
+ *
+ * История не хранится: каждое событие станка (смена состояния, выпуск,
+ * изменение уровня буфера) за O(1) добавляет закрытый интервал к счётчикам
+ * и к кольцу корзин скользящего окна. Время в текущем состоянии
+ * достраивается только при чтении, поэтому простаивающий станок не стоит
+ * ничего между событиями.
+ *
+ * OEE считается по классической схеме: плановое время — всё, кроме
+ * PlannedStop; доступность — доля Running; производительность — идеальное
+ * время цикла × выпуск / наработка; качество — доля годных. OEE линии
+ * взвешивается суммами по станкам, выпуск линии — по станкам её выхода.
+ *
+ * Время — секунды симуляции (например, DiscreteEventSystem::toSeconds()).
+ * События станка должны идти с неубывающим временем; более ранние
+ * приводятся к времени последнего события.
+ *
+ * @code
+ * ProductionStatistics stats;
+ * stats.addMachine(press, "line_A", 30.0);
+ * stats.addMachine(packer, "line_A", 12.0, true);  // Выход линии
+ *
+ * stats.setState(press, MachineState::Running, now);
+ * stats.addOutput(press, 1, 0, now);
+ *
+ * stats.snapshot(now, snapshot);  // Для панели UI
+ * @endcode
+ *
+ * @note Не потокобезопасен: события и снимки из главного потока.
+ */
+class ProductionStatistics {
+public:
+    explicit ProductionStatistics(
+        const ProductionSettings& settings = ProductionSettings::fromConfig());
+
+    /**
+     * @brief Начать учёт станка
+     *
+     * @param machine Сущность станка
+     * @param line Линия
+     * @param idealCycleSeconds Паспортное время цикла (для производительности)
+     * @param lineOutput Выпуск станка считается выпуском линии
+     * @param time Момент начала учёта (станок в состоянии Idle)
+     * @return false если станок уже учитывается
+     */
+    bool addMachine(entt::entity machine, StringId line, double idealCycleSeconds,
+                    bool lineOutput = false, double time = 0.0);
+
+    /**
+     * @brief Прекратить учёт станка (сущность удалена)
+     */
+    bool removeMachine(entt::entity machine);
+
+    /**
+     * @brief Начать учёт буфера
+     * @return false если буфер уже учитывается
+     */
+    bool addBuffer(entt::entity buffer, StringId line, uint32_t capacity, double time = 0.0);
+
+    /**
+     * @brief Прекратить учёт буфера
+     */
+    bool removeBuffer(entt::entity buffer);
+
+    /**
+     * @brief Событие смены состояния станка
+     * @return false если станок не учитывается
+     */
+    bool setState(entt::entity machine, MachineState state, double time);
+
+    /**
+     * @brief Событие выпуска изделий
+     * @return false если станок не учитывается
+     */
+    bool addOutput(entt::entity machine, uint32_t good, uint32_t scrap, double time);
+
+    /**
+     * @brief Событие изменения уровня буфера
+     * @return false если буфер не учитывается
+     */
+    bool setBufferLevel(entt::entity buffer, uint32_t level, double time);
+
+    /**
+     * @brief Статистика станка на момент time
+     * @return false если станок не учитывается
+     */
+    bool getMachineStats(entt::entity machine, double time, MachineStats& out) const;
+
+    /**
+     * @brief Статистика линии на момент time
+     * @return false если на линии нет станков
+     */
+    bool getLineStats(StringId line, double time, LineStats& out) const;
+
+    /**
+     * @brief Снимок всей статистики на момент time
+     *
+     * @param out Снимок (перезаписывается; векторы переиспользуются)
+     */
+    void snapshot(double time, ProductionSnapshot& out) const;
+
+    size_t getMachineCount() const { return m_machines.size(); }
+    size_t getBufferCount() const { return m_buffers.size(); }
+    const ProductionSettings& getSettings() const { return m_settings; }
+
+private:
+    /// Корзина скользящего окна
+    struct WindowBucket {
+        uint64_t index = UINT64_MAX;  ///< Абсолютный номер корзины (floor(t / ширина))
+        std::array<double, MACHINE_STATE_COUNT> stateSeconds{};  ///< Секунд по состояниям
+        uint64_t good = 0;            ///< Годных
+        uint64_t scrap = 0;           ///< Брака
+    };
+
+    /// Учитываемый станок
+    struct Machine {
+        entt::entity entity = entt::null;  ///< Сущность
+        uint32_t line = 0;                 ///< Индекс в m_lines
+        double idealCycleSeconds = 0.0;    ///< Паспортное время цикла
+        bool lineOutput = false;           ///< Выход линии
+        double startTime = 0.0;            ///< Начало учёта
+        MachineState state = MachineState::Idle;  ///< Текущее состояние
+        double stateSince = 0.0;           ///< Начало текущего состояния
+        std::array<double, MACHINE_STATE_COUNT> stateSeconds{};  ///< Закрытые интервалы
+        uint64_t good = 0;                 ///< Годных
+        uint64_t scrap = 0;                ///< Брака
+        uint32_t failures = 0;             ///< Переходов в Down
+        double lastOutputTime = -1.0;      ///< Время последнего выпуска (< 0 — не было)
+        double meanCycleSeconds = 0.0;     ///< EWMA времени цикла
+        std::vector<WindowBucket> window;  ///< Кольцо корзин окна
+    };
+
+    /// Учитываемый буфер
+    struct Buffer {
+        entt::entity entity = entt::null;  ///< Сущность
+        uint32_t line = 0;                 ///< Индекс в m_lines
+        uint32_t capacity = 0;             ///< Ёмкость
+        uint32_t level = 0;                ///< Текущий уровень
+        double startTime = 0.0;            ///< Начало учёта
+        double levelSince = 0.0;           ///< Начало текущего уровня
+        double levelSeconds = 0.0;         ///< ∫ уровень dt по закрытым интервалам
+        double fullSeconds = 0.0;          ///< Секунд полным (закрытые интервалы)
+        double emptySeconds = 0.0;         ///< Секунд пустым (закрытые интервалы)
+    };
+
+    /// Суммы для расчёта OEE
+    struct OeeTotals {
+        double planned = 0.0;      ///< Плановое время
+        double running = 0.0;      ///< Наработка
+        double idealOutput = 0.0;  ///< Идеальное время выпуска (цикл × штук)
+        uint64_t good = 0;         ///< Годных
+        uint64_t total = 0;        ///< Всего изделий
+    };
+
+    double bucketSeconds() const {
+        return m_settings.windowSeconds / static_cast<double>(m_settings.windowBuckets);
+    }
+    WindowBucket& bucketAt(Machine& machine, uint64_t index);
+    void addInterval(Machine& machine, MachineState state, double from, double to);
+    uint32_t lineIndex(StringId line);
+
+    /**
+     * @brief Собрать статистику станка (с открытым интервалом текущего состояния)
+     *
+     * @param total Суммы OEE с начала учёта (дополняются — для линии)
+     * @param window Суммы OEE за окно (дополняются — для линии)
+     */
+    void collect(const Machine& machine, double time, MachineStats& out, OeeTotals& total,
+                 OeeTotals& window) const;
+    void collectBuffer(const Buffer& buffer, double time, BufferStats& out) const;
+    static OeeBreakdown computeOee(const OeeTotals& totals);
+
+    ProductionSettings m_settings;                               ///< Параметры
+    std::vector<Machine> m_machines;                             ///< Станки
+    std::unordered_map<entt::entity, uint32_t> m_machineIndex;   ///< Сущность → индекс станка
+    std::vector<Buffer> m_buffers;                               ///< Буферы
+    std::unordered_map<entt::entity, uint32_t> m_bufferIndex;    ///< Сущность → индекс буфера
+    std::vector<StringId> m_lines;                               ///< Известные линии
+};
+
+} // namespace core
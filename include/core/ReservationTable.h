@@ -0,0 +1,131 @@
+#pragma once
+
+#include "core/NavigationGrid.h"
+
+#include <entt/entt.hpp>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file ReservationTable.h
+ * @brief Резервирование тайлов по тактам для движения флота агентов без столкновений
+ */
+
+namespace core {
+
+class FlowField;
+
+/**
+ * @brief Таблица резервирования (тайл, такт) → агент
+ *
+ * Агенты, идущие по общему полю потока, не знают друг о друге; таблица
+ * разрешает конфликты: агент шагает на тайл, только если тот свободен и в
+ * текущем такте, и в следующем. Это исключает как встречу на одном тайле,
+ * так и обмен местами, и даёт движение «полосой» с зазором в один тайл.
+ * Диагональный шаг дополнительно требует свободных соседних по осям тайлов,
+ * чтобы два агента не пересекались на углу.
+ *
+ * Протокол на каждом такте t: агент уже держит свой тайл в такте t и
+ * вызывает tryMove() / followField(), что резервирует тайл такта t + 1.
+ * Затем advance(t + 1) выбрасывает прошедшие такты.
+ *
+ * @code
+ * ReservationTable lanes;
+ * for (auto agent : agents) {
+ *     lanes.reserve(tileOf(agent), tick, agent);
+ * }
+ * for (auto agent : agents) {
+ *     moveTo(agent, lanes.followField(*field, agent, tileOf(agent), tick));
+ * }
+ * lanes.advance(++tick);
+ * @endcode
+ */
+class ReservationTable {
+public:
+    /**
+     * @brief Зарезервировать тайл на такт
+     * @return false, если тайл уже занят другим агентом
+     */
+    bool reserve(TilePoint tile, uint64_t tick, entt::entity agent);
+
+    /**
+     * @brief Агент, зарезервировавший тайл на такт
+     * @return entt::null если свободен
+     */
+    entt::entity ownerAt(TilePoint tile, uint64_t tick) const;
+
+    /**
+     * @brief Свободен ли тайл в такте (собственная резервация agent не мешает)
+     */
+    bool isFree(TilePoint tile, uint64_t tick, entt::entity agent = entt::null) const {
+        const entt::entity owner = ownerAt(tile, tick);
+        return owner == entt::null || owner == agent;
+    }
+
+    /**
+     * @brief Попытаться шагнуть с from на to между тактами tick и tick + 1
+     *
+     * При успехе резервирует (to, tick + 1). from == to — ожидание на месте.
+     *
+     * @return false, если шаг привёл бы к столкновению
+     */
+    bool tryMove(entt::entity agent, TilePoint from, TilePoint to, uint64_t tick);
+
+    /**
+     * @brief Зарезервировать весь путь: path[i] на такт startTick + i
+     *
+     * Всё или ничего: при конфликте ни один тайл не резервируется.
+     */
+    bool reservePath(entt::entity agent, std::span<const TilePoint> path, uint64_t startTick);
+
+    /**
+     * @brief Сделать шаг по полю потока
+     *
+     * Если следующий тайл поля занят — агент ждёт на месте (тайл
+     * резервируется на следующий такт).
+     *
+     * @return Тайл агента в такте tick + 1
+     */
+    TilePoint followField(const FlowField& field, entt::entity agent, TilePoint position,
+                          uint64_t tick);
+
+    /**
+     * @brief Снять все резервации агента (агент удалён или сменил задачу)
+     */
+    void release(entt::entity agent);
+
+    /**
+     * @brief Выбросить резервации тактов раньше tick
+     */
+    void advance(uint64_t tick);
+
+    /**
+     * @brief Снять все резервации
+     */
+    void clear();
+
+    /**
+     * @brief Количество резерваций
+     */
+    size_t size() const { return m_owners.size(); }
+
+private:
+    /// Резервация: тайл на такт
+    struct Slot {
+        TilePoint tile;  ///< Тайл
+        uint64_t tick;   ///< Такт
+
+        bool operator==(const Slot&) const = default;
+    };
+
+    struct SlotHash {
+        size_t operator()(const Slot& slot) const;
+    };
+
+    std::unordered_map<Slot, entt::entity, SlotHash> m_owners;         ///< Владельцы слотов
+    std::unordered_map<entt::entity, std::vector<Slot>> m_agentSlots;  ///< Слоты агента
+};
+
+} // namespace core
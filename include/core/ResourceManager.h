@@ -12,6 +12,7 @@
 #include <future>
 #include <mutex>
 #include <atomic>
+#include <cstdint>
 
 namespace core {
 
@@ -201,6 +202,16 @@ public:
      */
     size_t getTextureCount() const { return m_textures.size(); }
 
+    /**
+     * @brief Поколение набора текстур
+     *
+     * Меняется при каждой загрузке, выгрузке и очистке текстур. Кто кеширует
+     * указатели на текстуры (RenderSystem), сбрасывает кеш при смене поколения.
+     */
+    uint64_t getTextureGeneration() const {
+        return m_textureGeneration.load(std::memory_order_acquire);
+    }
+
     /**
      * @brief Возвращает количество загруженных звуков
      */
@@ -473,6 +484,7 @@ private:
 
     std::vector<std::future<void>> m_activeFutures; ///< Активные асинхронные операции
     std::atomic<int> m_activeLoads{0};               ///< Счетчик активных загрузок
+    std::atomic<uint64_t> m_textureGeneration{0};    ///< Поколение набора текстур
 };
 
 } // namespace core
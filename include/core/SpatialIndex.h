@@ -0,0 +1,200 @@
+#pragma once
+
+#include "core/StringId.h"
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <entt/entt.hpp>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace core {
+
+/**
+ * @brief Фильтр пространственного запроса
+ *
+ * Слой — SpriteComponent::layer (сущности без спрайта не проходят фильтр
+ * по слою). Тег — TagComponent (пустой StringId — без фильтра).
+ */
+struct SpatialQueryFilter {
+    int minLayer = std::numeric_limits<int>::min();  ///< Минимальный слой (включительно)
+    int maxLayer = std::numeric_limits<int>::max();  ///< Максимальный слой (включительно)
+    StringId tag;                                    ///< Требуемый тег
+
+    bool hasLayerFilter() const {
+        return minLayer != std::numeric_limits<int>::min() ||
+               maxLayer != std::numeric_limits<int>::max();
+    }
+};
+
+/**
+ * @brief Пространственный индекс ECS-сущностей для picking и выделения рамкой
+ *
+ * Свободная (loose) сетка: сущность хранится в ячейке, содержащей центр её
+ * AABB, а запрос расширяется на половину ячейки. Объекты крупнее ячейки
+ * хранятся в отдельном списке и проверяются линейно. Каждая сущность лежит
+ * ровно в одном месте, поэтому дедупликация результатов не нужна.
+ *
+ * Индексируются сущности с TransformComponent без simulation::RigidbodyComponent
+ * (физические тела запрашиваются через Box2D). Границы берутся из:
+ * 1. CollisionComponent (getWorldBounds);
+ * 2. TilePositionComponent (footprint в пикселях);
+ * 3. SpriteComponent::textureRect × scale;
+ * 4. иначе — один тайл с левым нижним углом в Transform.
+ *
+ * Обновление инкрементальное: сигналы EnTT добавляют/удаляют сущности и
+ * помечают их изменёнными, а update() пересчитывает только изменённые и
+ * движущиеся (с VelocityComponent) сущности. Transform, изменённый напрямую
+ * у неподвижной сущности, нужно отметить через markDirty() или patch().
+ *
+ * @code
+ * SpatialIndex index(128.0f);
+ * index.init(registry);
+ *
+ * // каждый кадр после систем движения
+ * index.update();
+ *
+ * entt::entity hovered = index.pickTop(mouseWorldPos);
+ * index.queryRect(selectionRect, selected, {.tag = "machine"});
+ * @endcode
+ */
+class SpatialIndex {
+public:
+    static constexpr float DEFAULT_CELL_SIZE = 128.0f;  ///< Сторона ячейки по умолчанию (4 тайла)
+
+    /**
+     * @brief Конструктор
+     * @param cellSize Сторона ячейки сетки в пикселях
+     */
+    explicit SpatialIndex(float cellSize = DEFAULT_CELL_SIZE);
+
+    /**
+     * @brief Отключается от сигналов registry (если был подключен)
+     */
+    ~SpatialIndex();
+
+    SpatialIndex(const SpatialIndex&) = delete;
+    SpatialIndex& operator=(const SpatialIndex&) = delete;
+
+    /**
+     * @brief Заполнить индекс существующими сущностями и подписаться на сигналы
+     *
+     * Registry должен жить дольше индекса (или вызвать shutdown() раньше).
+     */
+    void init(entt::registry& registry);
+
+    /**
+     * @brief Отписаться от сигналов registry и очистить индекс
+     */
+    void shutdown();
+
+    /**
+     * @brief Пересчитать границы изменённых и движущихся сущностей
+     *
+     * Вызывается раз в кадр после систем, двигающих объекты.
+     */
+    void update();
+
+    /**
+     * @brief Отметить сущность для пересчёта границ в следующем update()
+     */
+    void markDirty(entt::entity entity);
+
+    /**
+     * @brief Сущности, AABB которых содержит точку
+     * @param out Выходной вектор (дополняется, не очищается)
+     */
+    void queryPoint(sf::Vector2f point, std::vector<entt::entity>& out,
+                    const SpatialQueryFilter& filter = {}) const;
+
+    /**
+     * @brief Сущности, AABB которых пересекает прямоугольник (выделение рамкой)
+     * @param out Выходной вектор (дополняется, не очищается)
+     */
+    void queryRect(const sf::FloatRect& rect, std::vector<entt::entity>& out,
+                   const SpatialQueryFilter& filter = {}) const;
+
+    /**
+     * @brief Сущности, AABB которых пересекает круг
+     * @param out Выходной вектор (дополняется, не очищается)
+     */
+    void queryRadius(sf::Vector2f center, float radius, std::vector<entt::entity>& out,
+                     const SpatialQueryFilter& filter = {}) const;
+
+    /**
+     * @brief Верхняя (по SpriteComponent::layer) сущность под точкой
+     * @return entt::null если под точкой ничего нет
+     */
+    entt::entity pickTop(sf::Vector2f point, const SpatialQueryFilter& filter = {}) const;
+
+    /**
+     * @brief Текущие границы сущности в индексе
+     * @return Пустой прямоугольник если сущность не проиндексирована
+     */
+    sf::FloatRect getBounds(entt::entity entity) const;
+
+    bool contains(entt::entity entity) const { return m_locations.contains(entity); }
+    size_t getEntityCount() const { return m_locations.size(); }
+    size_t getCellCount() const { return m_cells.size(); }
+    size_t getOversizedCount() const { return m_oversized.size(); }
+    float getCellSize() const { return m_cellSize; }
+
+private:
+    /// AABB в мировых координатах
+    struct Aabb {
+        float minX;
+        float minY;
+        float maxX;
+        float maxY;
+    };
+
+    /// Запись ячейки: сущность и её границы (хранятся рядом для быстрого перебора)
+    struct Entry {
+        entt::entity entity;
+        Aabb bounds;
+    };
+
+    /// Положение сущности в индексе
+    struct Location {
+        uint64_t cellKey;  ///< Ключ ячейки или OVERSIZED_KEY
+        size_t position;   ///< Индекс в векторе ячейки
+    };
+
+    static constexpr uint64_t OVERSIZED_KEY = std::numeric_limits<uint64_t>::max();
+
+    void onTransformConstruct(entt::registry& registry, entt::entity entity);
+    void onTransformDestroy(entt::registry& registry, entt::entity entity);
+    void onBoundsChanged(entt::registry& registry, entt::entity entity);
+    void onRigidbodyConstruct(entt::registry& registry, entt::entity entity);
+    void onRigidbodyDestroy(entt::registry& registry, entt::entity entity);
+
+    /**
+     * @brief Вставить или переместить сущность по текущим компонентам
+     */
+    void refresh(entt::entity entity);
+    void insert(entt::entity entity, const Aabb& bounds);
+    void remove(entt::entity entity);
+
+    Aabb computeBounds(entt::entity entity) const;
+    uint64_t keyFor(const Aabb& bounds) const;
+    bool passes(entt::entity entity, const SpatialQueryFilter& filter) const;
+
+    /**
+     * @brief Перебрать записи, которые могут пересекать область
+     */
+    template <typename Func>
+    void forEachCandidate(const Aabb& area, Func&& func) const;
+
+    float m_cellSize;     ///< Сторона ячейки (пиксели)
+    float m_maxEntrySize; ///< Крупнее — в список m_oversized
+
+    std::unordered_map<uint64_t, std::vector<Entry>> m_cells;  ///< Ячейка → записи
+    std::vector<Entry> m_oversized;                             ///< Объекты крупнее ячейки
+    std::unordered_map<entt::entity, Location> m_locations;     ///< Сущность → положение
+    std::vector<entt::entity> m_dirty;                          ///< Ждут пересчёта в update()
+
+    entt::registry* m_registry = nullptr;  ///< Registry, к сигналам которого подключены
+};
+
+} // namespace core
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace core {
+
+/**
+ * @brief Интернированная строка (4 байта вместо std::string в компонентах)
+ *
+ * Все строки хранятся в глобальной потокобезопасной таблице, компонент хранит
+ * только индекс. Сравнение двух StringId — сравнение целых, копирование
+ * тривиально. Строки из таблицы никогда не удаляются, поэтому подходит для
+ * ограниченного набора имён: текстуры, слои коллизий, состояния FSM.
+ *
+ * Неявно конструируется из строк, чтобы сохранить привычный синтаксис:
+ * @code
+ * sprite.textureName = "tile_brown";
+ * if (collision.layer == "wall") { ... }
+ * @endcode
+ *
+ * Интернирование берёт блокировку и ищет в хеш-таблице — в горячих циклах
+ * сравнивайте с заранее созданным StringId, а не со строковым литералом.
+ */
+class StringId {
+public:
+    using ValueType = uint32_t;
+
+    /**
+     * @brief Пустая строка (id = 0)
+     */
+    constexpr StringId() noexcept = default;
+
+    StringId(const char* str) : m_id(intern(str ? std::string_view(str) : std::string_view())) {}
+    StringId(const std::string& str) : m_id(intern(str)) {}
+    StringId(std::string_view str) : m_id(intern(str)) {}
+
+    /**
+     * @brief Получить строку
+     * @return Ссылка на строку в таблице (валидна до завершения программы)
+     */
+    const std::string& str() const;
+
+    /**
+     * @brief Числовой идентификатор (0 — пустая строка)
+     */
+    ValueType value() const noexcept { return m_id; }
+
+    /**
+     * @brief Пустая ли строка
+     */
+    bool empty() const noexcept { return m_id == 0; }
+
+    bool operator==(const StringId& other) const noexcept = default;
+
+    /**
+     * @brief Количество уникальных строк в таблице (для отладки)
+     */
+    static size_t internedCount();
+
+private:
+    static ValueType intern(std::string_view str);
+
+    ValueType m_id = 0;  ///< Индекс в глобальной таблице
+};
+
+inline bool operator==(const StringId& id, std::string_view str) {
+    return std::string_view(id.str()) == str;
+}
+
+inline bool operator==(const StringId& id, const char* str) {
+    return id == std::string_view(str ? str : "");
+}
+
+inline bool operator==(const StringId& id, const std::string& str) {
+    return id == std::string_view(str);
+}
+
+} // namespace core
+
+template <>
+struct std::hash<core::StringId> {
+    size_t operator()(const core::StringId& id) const noexcept {
+        return std::hash<core::StringId::ValueType>{}(id.value());
+    }
+};
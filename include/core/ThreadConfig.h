@@ -0,0 +1,77 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace core {
+
+/**
+ * @brief Политика планирования потока
+ */
+enum class ThreadPolicy {
+    Default,  ///< Не менять политику ОС
+    Nice,     ///< Обычный планировщик с заданным nice (Linux) / относительным приоритетом
+    Fifo      ///< Реальное время: SCHED_FIFO (Linux), TIME_CRITICAL (Windows)
+};
+
+/**
+ * @brief Параметры планирования потока: имя, привязка к ядрам, приоритет
+ *
+ * Загружается из секции threads файла config.yaml по префиксу потока:
+ *
+ * @code{.yaml}
+ * threads:
+ *   physicsName: "opc-physics"
+ *   physicsAffinity: [2]        # Список индексов CPU (пусто — без привязки)
+ *   physicsPolicy: "fifo"       # default | nice | fifo
+ *   physicsPriority: 20         # Приоритет SCHED_FIFO (1-99)
+ *   physicsNice: -5             # nice для политики nice (и fallback для fifo)
+ * @endcode
+ *
+ * SCHED_FIFO требует CAP_SYS_NICE (или соответствующего rtprio в limits.conf).
+ * При отказе ОС политика откатывается на nice, а поток продолжает работу —
+ * настройки планирования никогда не являются фатальными.
+ *
+ * @code
+ * auto config = ThreadSchedulingConfig::fromConfig("physics", "opc-physics");
+ * // В начале функции потока:
+ * config.applyToCurrentThread();
+ * @endcode
+ */
+struct ThreadSchedulingConfig {
+    std::string name;                  ///< Имя потока (Linux обрезает до 15 символов)
+    std::vector<int> cpuAffinity;      ///< Индексы CPU (пусто — любые)
+    ThreadPolicy policy = ThreadPolicy::Default;  ///< Политика планирования
+    int priority = 0;                  ///< Приоритет реального времени (для Fifo)
+    int niceValue = 0;                 ///< Значение nice (для Nice и fallback Fifo)
+
+    /**
+     * @brief Загрузить параметры потока из секции threads конфигурации
+     *
+     * @param prefix Префикс ключей потока ("physics", "worker")
+     * @param defaultName Имя потока, если не задано в конфигурации
+     * @return Параметры потока
+     */
+    static ThreadSchedulingConfig fromConfig(const std::string& prefix,
+                                             const std::string& defaultName);
+
+    /**
+     * @brief Преобразовать строку в политику ("default", "nice", "fifo")
+     *
+     * @param value Строковое значение (регистр не важен)
+     * @return Политика (Default для неизвестных значений)
+     */
+    static ThreadPolicy parsePolicy(const std::string& value);
+
+    /**
+     * @brief Применить параметры к вызывающему потоку
+     *
+     * Вызывается из самого настраиваемого потока (в начале его функции).
+     *
+     * @return true если все параметры применены, false если что-то отклонено ОС
+     *         (ошибки логируются как предупреждения)
+     */
+    bool applyToCurrentThread() const;
+};
+
+} // namespace core
@@ -0,0 +1,249 @@
+#pragma once
+
+#include "core/Components.h"
+#include <entt/entt.hpp>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace core {
+
+/**
+ * @brief Прямоугольник тайлов, занятый сущностью в TileOccupancyGrid
+ */
+struct TileFootprint {
+    int tileX;
+    int tileY;
+    int widthTiles;
+    int heightTiles;
+    OccupancyLayer layer;
+    bool autoSync;  ///< Копия TilePositionComponent::autoSync (false — движущаяся сущность)
+};
+
+/**
+ * @brief Наблюдатель изменений TileOccupancyGrid
+ *
+ * Получает footprint'ы сущностей по мере их появления и исчезновения, чтобы
+ * производные индексы (NavigationGrid) не подписывались на сигналы registry
+ * повторно. Смена позиции приходит как onFootprintRemoved + onFootprintAdded.
+ */
+class ITileOccupancyListener {
+public:
+    virtual ~ITileOccupancyListener() = default;
+
+    virtual void onFootprintAdded(entt::entity entity, const TileFootprint& footprint) = 0;
+    virtual void onFootprintRemoved(entt::entity entity, const TileFootprint& footprint) = 0;
+};
+
+/**
+ * @brief Индекс занятости тайлов: "какая сущность стоит на тайле (x, y)" за O(1)
+ *
+ * Хранит для каждого тайла и каждого OccupancyLayer сущность-владельца.
+ * Многотайловые объекты (widthTiles × heightTiles) занимают все тайлы своего
+ * footprint'а.
+ *
+ * Хранилище:
+ * - плотный массив для прямоугольника карты [0, width) × [0, height);
+ * - разреженные чанки CHUNK_SIZE × CHUNK_SIZE для тайлов за пределами карты
+ *   и для огромных карт (больше MAX_DENSE_CELLS тайлов) — память выделяется
+ *   только под чанки, где реально есть объекты.
+ *
+ * Индекс поддерживается инкрементально через сигналы EnTT для
+ * TilePositionComponent (on_construct / on_update / on_destroy). Изменения
+ * позиции должны идти через registry.patch() / replace(), иначе on_update
+ * не сработает:
+ *
+ * @code
+ * TileOccupancyGrid grid(mapWidth, mapHeight);
+ * grid.init(registry);
+ *
+ * registry.patch<TilePositionComponent>(entity, [](auto& pos) { pos.tileX += 1; });
+ *
+ * if (grid.isAreaFree(x, y, 2, 2, OccupancyLayer::Object)) { ... }
+ * entt::entity ground = grid.at(x, y, OccupancyLayer::Ground);
+ * @endcode
+ *
+ * Если на один тайл одного слоя претендуют несколько сущностей, at() вернёт
+ * первую, а остальные хранятся в списке перекрытий и займут тайл после её ухода.
+ *
+ * Наблюдатели (addListener()) получают каждое изменение footprint'а, в том числе
+ * очистку индекса в shutdown(). Наблюдатель должен отписаться до уничтожения индекса.
+ */
+class TileOccupancyGrid {
+public:
+    static constexpr int CHUNK_SIZE = 32;                 ///< Сторона разреженного чанка (тайлов)
+    static constexpr size_t MAX_DENSE_CELLS = 1024 * 1024; ///< Предел плотного хранилища (~12 МБ)
+
+    /**
+     * @brief Пустой индекс без плотной области (только разреженные чанки)
+     */
+    TileOccupancyGrid();
+
+    /**
+     * @brief Индекс под карту заданного размера
+     * @param width Ширина карты в тайлах
+     * @param height Высота карты в тайлах
+     */
+    TileOccupancyGrid(int width, int height);
+
+    /**
+     * @brief Отключается от сигналов registry (если был подключен)
+     */
+    ~TileOccupancyGrid();
+
+    TileOccupancyGrid(const TileOccupancyGrid&) = delete;
+    TileOccupancyGrid& operator=(const TileOccupancyGrid&) = delete;
+
+    /**
+     * @brief Заполнить индекс существующими сущностями и подписаться на сигналы
+     *
+     * Registry должен жить дольше индекса (или вызвать shutdown() раньше).
+     *
+     * @param registry EnTT registry
+     */
+    void init(entt::registry& registry);
+
+    /**
+     * @brief Отписаться от сигналов registry и очистить индекс
+     */
+    void shutdown();
+
+    /**
+     * @brief Изменить размер плотной области (например, после загрузки карты)
+     *
+     * Все занятые тайлы переносятся в новое хранилище.
+     *
+     * @param width Ширина карты в тайлах
+     * @param height Высота карты в тайлах
+     */
+    void resize(int width, int height);
+
+    /**
+     * @brief Добавить сущность в индекс (вызывается сигналом on_construct)
+     */
+    void insert(entt::entity entity, const TilePositionComponent& position);
+
+    /**
+     * @brief Удалить сущность из индекса (вызывается сигналом on_destroy)
+     */
+    void remove(entt::entity entity);
+
+    /**
+     * @brief Сущность на тайле в указанном слое
+     * @return entt::null если тайл свободен
+     */
+    entt::entity at(int tileX, int tileY, OccupancyLayer layer = OccupancyLayer::Object) const;
+
+    /**
+     * @brief Сущность в самом верхнем занятом слое тайла (Overlay > Object > Ground)
+     * @return entt::null если тайл свободен во всех слоях
+     */
+    entt::entity topAt(int tileX, int tileY) const;
+
+    /**
+     * @brief Занят ли тайл в указанном слое
+     */
+    bool isOccupied(int tileX, int tileY, OccupancyLayer layer = OccupancyLayer::Object) const {
+        return at(tileX, tileY, layer) != entt::null;
+    }
+
+    /**
+     * @brief Свободна ли прямоугольная область в слое (проверка размещения)
+     *
+     * @param ignore Сущность, которую не считать препятствием (перемещаемый объект)
+     */
+    bool isAreaFree(int tileX, int tileY, int widthTiles, int heightTiles,
+                    OccupancyLayer layer = OccupancyLayer::Object,
+                    entt::entity ignore = entt::null) const;
+
+    /**
+     * @brief Собрать уникальные сущности, пересекающие область
+     *
+     * @param out Выходной вектор (дополняется, не очищается)
+     */
+    void queryArea(int tileX, int tileY, int widthTiles, int heightTiles, OccupancyLayer layer,
+                   std::vector<entt::entity>& out) const;
+
+    /**
+     * @brief Находится ли сущность в индексе
+     */
+    bool contains(entt::entity entity) const { return m_footprints.contains(entity); }
+
+    /**
+     * @brief Текущие footprint'ы всех сущностей индекса
+     */
+    const std::unordered_map<entt::entity, TileFootprint>& getFootprints() const {
+        return m_footprints;
+    }
+
+    /**
+     * @brief Подписать наблюдателя на изменения footprint'ов
+     *
+     * Уже учтённые сущности наблюдатель забирает сам через getFootprints().
+     */
+    void addListener(ITileOccupancyListener* listener);
+
+    /**
+     * @brief Отписать наблюдателя
+     */
+    void removeListener(ITileOccupancyListener* listener);
+
+    int getWidth() const { return m_width; }
+    int getHeight() const { return m_height; }
+
+    /**
+     * @brief Используется ли плотное хранилище
+     */
+    bool isDense() const { return !m_dense.empty(); }
+
+    /**
+     * @brief Количество выделенных разреженных чанков
+     */
+    size_t getChunkCount() const { return m_chunks.size(); }
+
+    /**
+     * @brief Количество сущностей в индексе
+     */
+    size_t getEntityCount() const { return m_footprints.size(); }
+
+private:
+    static constexpr size_t LAYER_COUNT = static_cast<size_t>(OccupancyLayer::Count);
+
+    /// Ячейка: владелец тайла в каждом слое
+    using Cell = std::array<entt::entity, LAYER_COUNT>;
+    /// Разреженный чанк CHUNK_SIZE × CHUNK_SIZE
+    using Chunk = std::array<Cell, CHUNK_SIZE * CHUNK_SIZE>;
+
+    /// Запомненный footprint сущности (нужен для удаления после изменения позиции)
+    using Footprint = TileFootprint;
+
+    void onConstruct(entt::registry& registry, entt::entity entity);
+    void onUpdate(entt::registry& registry, entt::entity entity);
+    void onDestroy(entt::registry& registry, entt::entity entity);
+
+    void occupy(entt::entity entity, const Footprint& footprint);
+    void vacate(entt::entity entity, const Footprint& footprint);
+
+    Cell* findCell(int tileX, int tileY);
+    const Cell* findCell(int tileX, int tileY) const;
+    Cell& cellAt(int tileX, int tileY);
+
+    static uint64_t packKey(int a, int b);
+    static Footprint footprintOf(const TilePositionComponent& position);
+    static Cell emptyCell();
+
+    int m_width = 0;                ///< Ширина плотной области (тайлов)
+    int m_height = 0;               ///< Высота плотной области (тайлов)
+    std::vector<Cell> m_dense;      ///< Плотная область (пусто — только чанки)
+
+    std::unordered_map<uint64_t, std::unique_ptr<Chunk>> m_chunks;  ///< Разреженные чанки
+    std::unordered_map<entt::entity, Footprint> m_footprints;       ///< Текущие footprint'ы
+    std::unordered_multimap<uint64_t, entt::entity> m_overlaps;      ///< Тайл → ожидающие владельцы
+    std::vector<ITileOccupancyListener*> m_listeners;               ///< Наблюдатели изменений
+
+    entt::registry* m_registry = nullptr;  ///< Registry, к сигналам которого подключены
+};
+
+} // namespace core
@@ -0,0 +1,287 @@
+#pragma once
+
+#include "core/StringId.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file TrendSeries.h
+ * @brief Хранилище трендов технологических величин с многоуровневой агрегацией
+ */
+
+namespace core {
+
+/**
+ * @brief Точка тренда (формат, пригодный для ImPlot с шагом sizeof(TrendPoint))
+ */
+struct TrendPoint {
+    double time = 0.0;   ///< Время (секунды симуляции)
+    double value = 0.0;  ///< Значение
+};
+
+/**
+ * @brief Параметры хранения трендов
+ */
+struct TrendSettings {
+    size_t rawCapacity = 65536;     ///< Сырых отсчётов на серию (кольцевой буфер)
+    size_t levelCapacity = 16384;   ///< Агрегатов на уровень пирамиды
+    double pointsPerPixel = 2.0;    ///< Предел точек на пиксель ширины графика
+
+    /**
+     * @brief Загрузить параметры из секции trends конфигурации
+     * @return Параметры с дефолтами для отсутствующих ключей
+     */
+    static TrendSettings fromConfig();
+};
+
+/**
+ * @brief Ряд значений одного тега с пирамидой min/max
+ *
+ * Сырые отсчёты хранятся в кольцевом буфере. Параллельно поддерживается
+ * пирамида из LEVEL_COUNT уровней: каждый агрегат уровня L покрывает
+ * LEVEL_FACTOR агрегатов уровня L-1 (уровень 0 — LEVEL_FACTOR сырых
+ * отсчётов) и хранит min/max с моментами их достижения. Пирамида
+ * обновляется инкрементально при append() — O(1) амортизированно.
+ *
+ * Каждый уровень — тоже кольцевой буфер, поэтому грубые уровни хранят
+ * историю в LEVEL_FACTOR раз дольше предыдущих: последние минуты доступны
+ * с полным разрешением, часы — с уменьшенным.
+ *
+ * query() выбирает самый подробный источник, у которого в окне не больше
+ * LTTB_INPUT_FACTOR × (ширина × pointsPerPixel) точек, и прореживает его
+ * алгоритмом Largest-Triangle-Three-Buckets до ширины × pointsPerPixel.
+ * Стоимость запроса ограничена шириной графика, а не длиной истории.
+ *
+ * @note Не потокобезопасен: запись и чтение из одного (главного) потока.
+ */
+class TrendSeries {
+public:
+    static constexpr size_t LEVEL_COUNT = 6;        ///< Уровней пирамиды
+    static constexpr size_t LEVEL_FACTOR = 8;       ///< Агрегатов предыдущего уровня в одном
+    static constexpr size_t LTTB_INPUT_FACTOR = 4;  ///< Запас входа LTTB относительно выхода
+
+    /**
+     * @brief Конструктор
+     * @param settings Ёмкости буферов и плотность точек
+     */
+    explicit TrendSeries(const TrendSettings& settings = TrendSettings{});
+
+    /**
+     * @brief Добавить отсчёт
+     *
+     * Время должно не убывать; более ранние отсчёты отбрасываются.
+     *
+     * @param time Время (секунды)
+     * @param value Значение
+     */
+    void append(double time, double value);
+
+    /**
+     * @brief Прореженное представление окна времени для графика
+     *
+     * В результат входят по одной точке до и после окна (если есть), чтобы
+     * линия доходила до краёв графика.
+     *
+     * @param begin Начало окна (секунды)
+     * @param end Конец окна (секунды)
+     * @param pixelWidth Ширина области графика в пикселях
+     * @param out Результат (перезаписывается), упорядочен по времени
+     */
+    void query(double begin, double end, size_t pixelWidth, std::vector<TrendPoint>& out) const;
+
+    /**
+     * @brief Очистить ряд
+     */
+    void clear();
+
+    /**
+     * @brief Количество сырых отсчётов в буфере
+     */
+    size_t getRawCount() const { return m_raw.size(); }
+
+    /**
+     * @brief Всего принятых отсчётов (включая вытесненные из буфера)
+     */
+    uint64_t getTotalCount() const { return m_totalCount; }
+
+    /**
+     * @brief Количество закрытых агрегатов уровня
+     */
+    size_t getLevelCount(size_t level) const { return m_levels[level].closed.size(); }
+
+    /**
+     * @brief Версия данных (растёт с каждым append()) — для кэширования запросов
+     */
+    uint64_t getVersion() const { return m_totalCount; }
+
+    /**
+     * @brief Последний отсчёт (время и значение), если есть
+     */
+    const TrendPoint* last() const { return m_hasLast ? &m_last : nullptr; }
+
+    /**
+     * @brief Прореживание Largest-Triangle-Three-Buckets
+     *
+     * Сохраняет первую и последнюю точки; из каждой внутренней корзины
+     * выбирается точка, образующая наибольший треугольник с выбранной
+     * точкой предыдущей корзины и средним следующей.
+     *
+     * @param input Точки, упорядоченные по времени
+     * @param threshold Число точек результата (меньше 3 — без прореживания)
+     * @param out Результат (перезаписывается)
+     */
+    static void downsampleLttb(std::span<const TrendPoint> input, size_t threshold,
+                               std::vector<TrendPoint>& out);
+
+private:
+    /// Агрегат пирамиды
+    struct Bucket {
+        double firstTime = 0.0;  ///< Время первого отсчёта
+        double lastTime = 0.0;   ///< Время последнего отсчёта
+        double minTime = 0.0;    ///< Время минимума
+        double maxTime = 0.0;    ///< Время максимума
+        double min = 0.0;        ///< Минимум
+        double max = 0.0;        ///< Максимум
+        uint32_t count = 0;      ///< Сырых отсчётов в агрегате
+
+        void addSample(double time, double value);
+    };
+
+    /**
+     * @brief Кольцевой буфер ограниченной ёмкости (логический индекс 0 — самый старый)
+     *
+     * Память выделяется по мере заполнения (удвоением до capacity), а не сразу:
+     * полная ёмкость ряда с пирамидой — несколько мегабайт, а большинство тегов
+     * не успевает её заполнить. Пока буфер не заполнен, m_head == 0.
+     */
+    template<typename T>
+    class Ring {
+    public:
+        void reset(size_t capacity) {
+            m_data.clear();
+            m_capacity = capacity;
+            m_head = 0;
+            m_size = 0;
+            m_evicted = false;
+        }
+        void push(const T& item) {
+            if (m_capacity == 0) {
+                return;
+            }
+            if (m_size < m_capacity) {
+                if (m_data.size() == m_data.capacity()) {
+                    m_data.reserve(std::min(m_capacity, std::max<size_t>(m_data.size() * 2, 64)));
+                }
+                m_data.push_back(item);
+                ++m_size;
+                return;
+            }
+            m_data[m_head] = item;
+            m_head = (m_head + 1) % m_capacity;
+            m_evicted = true;
+        }
+        const T& operator[](size_t index) const { return m_data[(m_head + index) % m_data.size()]; }
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+        bool evicted() const { return m_evicted; }  ///< Были ли вытеснены старые элементы
+
+    private:
+        std::vector<T> m_data;
+        size_t m_capacity = 0;
+        size_t m_head = 0;
+        size_t m_size = 0;
+        bool m_evicted = false;
+    };
+
+    /**
+     * @brief Уровень пирамиды: закрытые агрегаты и текущий (открытый)
+     *
+     * Открытый агрегат получает каждый сырой отсчёт сразу, поэтому любой
+     * уровень содержит самые свежие данные без обращения к нижним.
+     */
+    struct Level {
+        Ring<Bucket> closed;     ///< Закрытые агрегаты
+        Bucket open;             ///< Накапливаемый агрегат (count == 0 — пуст)
+        uint32_t children = 0;   ///< Закрытых единиц предыдущего уровня в open
+    };
+
+    /**
+     * @brief Закрыть открытый агрегат уровня (с каскадом на уровни выше)
+     */
+    void closeLevel(size_t level);
+
+    /**
+     * @brief Собрать точки-кандидаты из сырых отсчётов
+     * @return false если буфер не покрывает начало окна или точек больше limit
+     */
+    bool collectRaw(double begin, double end, size_t limit, std::vector<TrendPoint>& out) const;
+
+    /**
+     * @brief Собрать точки-кандидаты (min и max агрегатов) из уровня пирамиды
+     *
+     * @param force Собрать независимо от покрытия и limit (самый грубый уровень)
+     * @return false если уровень не покрывает начало окна или точек больше limit
+     */
+    bool collectFromLevel(size_t level, double begin, double end, size_t limit, bool force,
+                          std::vector<TrendPoint>& out) const;
+
+    TrendSettings m_settings;                       ///< Параметры
+    Ring<TrendPoint> m_raw;                         ///< Сырые отсчёты
+    std::array<Level, LEVEL_COUNT> m_levels;        ///< Пирамида min/max
+    uint64_t m_totalCount = 0;                      ///< Всего принятых отсчётов
+    TrendPoint m_last;                              ///< Последний отсчёт
+    bool m_hasLast = false;                         ///< Есть ли отсчёты
+
+    mutable std::vector<TrendPoint> m_candidates;   ///< Вход LTTB (переиспользуется)
+};
+
+/**
+ * @brief Набор трендов по тегам
+ *
+ * @code
+ * TrendStore trends;
+ * trends.append("Tank1.Level", simTime, level);
+ * trends.find("Tank1.Level")->query(t0, t1, plotWidth, points);
+ * @endcode
+ */
+class TrendStore {
+public:
+    explicit TrendStore(const TrendSettings& settings = TrendSettings{})
+        : m_settings(settings) {}
+
+    /**
+     * @brief Добавить отсчёт тега (ряд создаётся при первом отсчёте)
+     */
+    void append(StringId tag, double time, double value);
+
+    /**
+     * @brief Ряд тега
+     * @return nullptr если у тега ещё нет отсчётов
+     */
+    TrendSeries* find(StringId tag);
+    const TrendSeries* find(StringId tag) const;
+
+    /**
+     * @brief Теги в порядке появления
+     */
+    const std::vector<StringId>& tags() const { return m_tags; }
+
+    /**
+     * @brief Удалить все ряды
+     */
+    void clear();
+
+private:
+    TrendSettings m_settings;                                           ///< Параметры новых рядов
+    std::unordered_map<StringId, std::unique_ptr<TrendSeries>> m_series;  ///< Ряды по тегу
+    std::vector<StringId> m_tags;                                         ///< Порядок появления
+};
+
+} // namespace core
@@ -5,6 +5,7 @@
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/View.hpp>
 #include <entt/entt.hpp>
+#include <chrono>
 #include <memory>
 #include <future>
 
@@ -16,16 +17,25 @@ class UpdateSystem;
 class LifetimeSystem;
 class CollisionSystem;
 class FSMSystem;
+class DiscreteEventSystem;
 class TilePositionSystem;
 class AnimationSystem;
 class AnimationSystemV2;
 class OverlaySystem;
+class TileOccupancyGrid;
+class NavigationGrid;
+class PathfindingService;
+class EntityIndex;
+class SpatialIndex;
+class TrendStore;
 }
 
 namespace simulation {
 class PhysicsWorld;
 class PhysicsSystem;
 class PhysicsThread;
+class PhysicsLod;
+class CollisionSensorBridge;
 }
 
 namespace rendering {
@@ -66,6 +76,16 @@ public:
     void onWindowResize(const sf::Vector2u& newSize) override;
     std::string getName() const override { return "GameState"; }
 
+    /**
+     * @brief Тренды показателей сцены (nullptr до инициализации сцены)
+     */
+    const TrendStore* getTrends() const { return m_trends.get(); }
+
+    /**
+     * @brief Поиск путей по тайлам сцены (nullptr до инициализации сцены)
+     */
+    PathfindingService* getPathfinding() { return m_pathfinding.get(); }
+
     // GameState должно рендериться под паузой
     bool renderBelow() const override { return true; }
 
@@ -105,6 +125,7 @@ private:
 
     // Временные переменные для демонстрации
     double m_elapsedTime;                      ///< Время с начала игры
+    std::chrono::steady_clock::time_point m_lastFrameStart{};  ///< Начало предыдущего кадра (тренд времени кадра)
     int m_updateCount;                         ///< Счетчик обновлений
 
     // ECS
@@ -112,8 +133,9 @@ private:
     std::unique_ptr<RenderSystem> m_renderSystem;  ///< Система рендеринга
     std::unique_ptr<UpdateSystem> m_updateSystem;  ///< Система обновления
     std::unique_ptr<LifetimeSystem> m_lifetimeSystem;  ///< Система времени жизни
-    std::unique_ptr<CollisionSystem> m_collisionSystem;  ///< Система коллизий (AABB)
+    std::unique_ptr<CollisionSystem> m_collisionSystem;  ///< Система коллизий (AABB или сенсоры Box2D)
     std::unique_ptr<FSMSystem> m_fsmSystem;        ///< Система конечных автоматов (FSM)
+    std::unique_ptr<DiscreteEventSystem> m_discreteEventSystem;  ///< События процессов (рецепты, логистика)
 
     // Tile System (Milestone 1.3)
     std::unique_ptr<TilePositionSystem> m_tilePositionSystem;  ///< Система синхронизации тайловых позиций
@@ -121,6 +143,12 @@ private:
     std::unique_ptr<AnimationSystemV2> m_animationSystemV2;    ///< Система анимации спрайтов V2 (JSON метаданные)
     std::unique_ptr<OverlaySystem> m_overlaySystem;            ///< Система синхронизации оверлеев
     std::unique_ptr<rendering::TileMapSystem> m_tileMapSystem; ///< Система рендеринга тайловых карт (TMX)
+    std::unique_ptr<TileOccupancyGrid> m_occupancyGrid;        ///< Индекс занятости тайлов
+    std::unique_ptr<NavigationGrid> m_navigationGrid;          ///< Проходимость тайлов (поверх m_occupancyGrid)
+    std::unique_ptr<PathfindingService> m_pathfinding;         ///< Фоновый поиск путей по m_navigationGrid
+    std::unique_ptr<EntityIndex> m_entityIndex;                ///< Индекс сущностей по имени и тегу
+    std::unique_ptr<SpatialIndex> m_spatialIndex;              ///< Пространственный индекс для picking
+    std::unique_ptr<TrendStore> m_trends;                      ///< Тренды показателей (секция trends)
 
     // Views для рендеринга
     sf::View m_worldView;                      ///< View для игрового мира (расширяется с окном)
@@ -131,7 +159,9 @@ private:
 
     // Physics (Milestone 2.1)
     std::unique_ptr<simulation::PhysicsWorld> m_physicsWorld;    ///< Физический мир Box2D
+    std::unique_ptr<simulation::CollisionSensorBridge> m_collisionSensorBridge;  ///< Пересечения CollisionComponent на сенсорах Box2D
     std::unique_ptr<simulation::PhysicsSystem> m_physicsSystem;  ///< Система физики
+    std::unique_ptr<simulation::PhysicsLod> m_physicsLod;        ///< LOD физики для дальних регионов
     std::unique_ptr<simulation::PhysicsThread> m_physicsThread;  ///< Поток физики (Task 6)
 
     // Отладочная визуализация
@@ -146,6 +176,10 @@ private:
     static constexpr unsigned int INFO_TEXT_FONT_SIZE = 24;
     static constexpr float INFO_TEXT_X = 20.0f;
     static constexpr float INFO_TEXT_Y = 20.0f;
+
+    // Размер тестовой сцены в тайлах (пока не загружена TMX карта)
+    static constexpr int TEST_SCENE_WIDTH_TILES = 12;
+    static constexpr int TEST_SCENE_HEIGHT_TILES = 8;
 };
 
 } // namespace core
@@ -1,10 +1,11 @@
 #pragma once
 
+#include "core/systems/ICollisionBroadphase.h"
 #include "core/systems/ISystem.h"
 #include <SFML/Graphics/Rect.hpp>
 #include <entt/entt.hpp>
-#include <set>
 #include <utility>
+#include <vector>
 
 namespace core {
 
@@ -13,7 +14,12 @@ namespace core {
  *
  * Проверяет AABB коллизии между сущностями с CollisionComponent.
  * Поддерживает solid коллизии (блокирующие движение) и trigger коллизии (только детекция).
- * Вызывает коллбеки onCollisionEnter/Stay/Exit для событий коллизий.
+ * Вызывает коллбеки onCollisionEnter/Stay/Exit из CollisionCallbacksComponent.
+ *
+ * Пересечения по умолчанию ищутся попарной проверкой AABB (O(n²)). Если задан
+ * внешний broadphase (setBroadphase()), система только применяет его изменения
+ * пар: коллбеки и CollisionEvent остаются теми же, а второй конвейер поиска
+ * пересечений не нужен.
  *
  * Приоритет: 100 (после UpdateSystem, до TilePositionSystem)
  */
@@ -52,6 +58,22 @@ public:
      */
     const char* getName() const override { return "CollisionSystem"; }
 
+    /**
+     * @brief Задать внешний источник пересечений
+     *
+     * Активные пары, найденные до переключения, сохраняются: внешний
+     * broadphase должен сообщить о них заново или о их завершении.
+     *
+     * @param broadphase Источник изменений пар (nullptr — встроенная проверка AABB);
+     *                   должен жить дольше системы или быть сброшен раньше
+     */
+    void setBroadphase(ICollisionBroadphase* broadphase) { m_broadphase = broadphase; }
+
+    /**
+     * @brief Текущий внешний источник пересечений (nullptr — встроенная проверка AABB)
+     */
+    ICollisionBroadphase* getBroadphase() const { return m_broadphase; }
+
 private:
     /**
      * @brief Пара сущностей для отслеживания коллизий
@@ -79,11 +101,32 @@ private:
     };
 
     /**
-     * @brief Активные коллизии с предыдущего кадра
+     * @brief Активные коллизии с предыдущего кадра (отсортированы)
      *
      * Используется для определения onCollisionEnter и onCollisionExit.
      */
-    std::set<EntityPair> m_previousCollisions;
+    std::vector<EntityPair> m_previousCollisions;
+
+    /**
+     * @brief Коллизии текущего кадра (буфер переиспользуется между кадрами)
+     *
+     * Меняется местами с m_previousCollisions в конце update(), поэтому
+     * в установившемся режиме выделений памяти нет.
+     */
+    std::vector<EntityPair> m_currentCollisions;
+
+    ICollisionBroadphase* m_broadphase = nullptr;       ///< Внешний broadphase (не владеет)
+    std::vector<CollisionPairChange> m_pairChanges;     ///< Буфер изменений пар от broadphase
+
+    /**
+     * @brief Поиск пересечений попарной проверкой AABB
+     */
+    void updateBruteForce(entt::registry& registry);
+
+    /**
+     * @brief Применить изменения пар от внешнего broadphase
+     */
+    void updateFromBroadphase(entt::registry& registry);
 
     /**
      * @brief Проверить AABB пересечение двух прямоугольников
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "core/systems/ISystem.h"
+#include "core/StringId.h"
+#include <entt/entt.hpp>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace core {
+
+/// Такт симуляции (номер фиксированного шага с начала игры)
+using SimTick = uint64_t;
+
+/// Идентификатор запланированного события (0 — недействительный)
+using SimEventId = uint64_t;
+
+/**
+ * @brief Запланированное событие симуляции
+ *
+ * Событие описывается данными, а не замыканием (вид + сущность + число),
+ * поэтому очередь можно сохранить вместе со сценой.
+ */
+struct SimEvent {
+    SimEventId id = 0;                    ///< Идентификатор (для cancel())
+    SimTick tick = 0;                     ///< Такт срабатывания
+    StringId kind;                        ///< Вид события ("recipe_done", "truck_arrived")
+    entt::entity entity = entt::null;     ///< Сущность-владелец (станок, склад)
+    uint64_t data = 0;                    ///< Произвольные данные (индекс рецепта и т.п.)
+};
+
+/// Обработчик вида событий
+using SimEventHandler = std::function<void(entt::registry&, const SimEvent&)>;
+
+/**
+ * @brief Дискретно-событийная симуляция на фиксированном шаге
+ *
+ * Процессы вида «рецепт закончится через 37.5 с» не опрашиваются каждый
+ * кадр: станок планирует событие завершения, и до него не стоит ничего.
+ * События лежат в двоичной куче по (такт, порядковый номер) — срабатывают
+ * точно на своём такте фиксированного шага, при равных тактах в порядке
+ * планирования (детерминированно).
+ *
+ * update() переводит dt фиксированного шага в такты, поэтому события
+ * синхронны с остальными ECS системами. fastForward() проматывает смену
+ * за O(число событий · log N), а не за число тактов.
+ *
+ * @code
+ * DiscreteEventSystem events(fixedTimestep);
+ * events.setHandler("recipe_done", [&](entt::registry& registry, const SimEvent& event) {
+ *     finishRecipe(registry, event.entity);
+ *     events.scheduleAfter(recipeSeconds, "recipe_done", event.entity);  // Следующий цикл
+ * });
+ * events.scheduleAfter(37.5, "recipe_done", machine);
+ * @endcode
+ *
+ * Приоритет: 60 (игровая логика, после LifetimeSystem)
+ */
+class DiscreteEventSystem : public ISystem {
+public:
+    static constexpr SimTick NO_EVENT = std::numeric_limits<SimTick>::max();  ///< Очередь пуста
+
+    /**
+     * @brief Конструктор
+     * @param tickSeconds Длительность такта (фиксированный шаг, секунды)
+     */
+    explicit DiscreteEventSystem(double tickSeconds);
+
+    /**
+     * @brief Назначить обработчик вида событий (заменяет прежний)
+     */
+    void setHandler(StringId kind, SimEventHandler handler);
+
+    /**
+     * @brief Запланировать событие на такт
+     *
+     * Такт в прошлом заменяется текущим: событие сработает при ближайшей
+     * обработке очереди (из обработчика — в том же такте, после текущего).
+     *
+     * @return Идентификатор события
+     */
+    SimEventId scheduleAt(SimTick tick, StringId kind, entt::entity entity = entt::null,
+                          uint64_t data = 0);
+
+    /**
+     * @brief Запланировать событие через заданное время от текущего такта
+     *
+     * Время округляется вверх до целого такта.
+     */
+    SimEventId scheduleAfter(double seconds, StringId kind, entt::entity entity = entt::null,
+                             uint64_t data = 0);
+
+    /**
+     * @brief Отменить событие
+     * @return false если событие уже сработало или отменено
+     */
+    bool cancel(SimEventId id);
+
+    /**
+     * @brief Ожидает ли событие срабатывания
+     */
+    bool isPending(SimEventId id) const;
+
+    /**
+     * @brief Продвинуть время на dt (целое число тактов, остаток накапливается)
+     *
+     * @param registry EnTT registry для обработчиков
+     * @param dt Время с последнего обновления (секунды)
+     */
+    void update(entt::registry& registry, double dt) override;
+
+    /**
+     * @brief Обработать все события до такта tick включительно
+     *
+     * @return Количество сработавших событий
+     */
+    size_t advanceTo(entt::registry& registry, SimTick tick);
+
+    /**
+     * @brief Промотать время вперёд (ускорение смены, пропуск ночи)
+     *
+     * @return Количество сработавших событий
+     */
+    size_t fastForward(entt::registry& registry, double seconds) {
+        return advanceTo(registry, m_now + toTicks(seconds));
+    }
+
+    /**
+     * @brief Перевести секунды в такты (с округлением вверх)
+     */
+    SimTick toTicks(double seconds) const;
+
+    /**
+     * @brief Перевести такты в секунды
+     */
+    double toSeconds(SimTick ticks) const { return static_cast<double>(ticks) * m_tickSeconds; }
+
+    /**
+     * @brief Текущий такт
+     */
+    SimTick getNow() const { return m_now; }
+
+    /**
+     * @brief Такт ближайшего события (NO_EVENT если очередь пуста)
+     */
+    SimTick getNextEventTick() const { return m_heap.empty() ? NO_EVENT : m_heap.front().tick; }
+
+    /**
+     * @brief Количество ожидающих событий
+     */
+    size_t getPendingCount() const { return m_pendingCount; }
+
+    /**
+     * @brief Количество сработавших событий с начала симуляции
+     */
+    uint64_t getDispatchedCount() const { return m_dispatchedCount; }
+
+    int getPriority() const override { return 60; }
+    const char* getName() const override { return "DiscreteEventSystem"; }
+
+private:
+    /// Ячейка пула событий (переиспользуется, generation отличает старые id)
+    struct Slot {
+        SimEvent event;           ///< Данные события
+        uint32_t generation = 1;  ///< Поколение ячейки
+        bool pending = false;     ///< Событие ожидает срабатывания
+    };
+
+    /// Элемент кучи (отменённые события удаляются лениво)
+    struct HeapEntry {
+        SimTick tick;         ///< Такт срабатывания
+        uint64_t sequence;    ///< Порядок планирования (FIFO внутри такта)
+        uint32_t slot;        ///< Индекс ячейки пула
+        uint32_t generation;  ///< Поколение ячейки при планировании
+    };
+
+    static bool later(const HeapEntry& a, const HeapEntry& b) {
+        return a.tick != b.tick ? a.tick > b.tick : a.sequence > b.sequence;
+    }
+
+    const Slot* findSlot(SimEventId id) const;
+    void releaseSlot(uint32_t slot);
+
+    /**
+     * @brief Снять с вершины кучи отменённые события
+     *
+     * После вызова вершина кучи — ожидающее событие (или куча пуста).
+     */
+    void dropCancelled();
+
+    double m_tickSeconds;                    ///< Длительность такта
+    double m_accumulator = 0.0;              ///< Остаток dt меньше такта
+    SimTick m_now = 0;                       ///< Текущий такт
+    uint64_t m_nextSequence = 0;             ///< Следующий порядковый номер
+    size_t m_pendingCount = 0;               ///< Ожидающих событий
+    uint64_t m_dispatchedCount = 0;          ///< Сработавших событий всего
+
+    std::vector<HeapEntry> m_heap;           ///< Очередь (min-куча по такту)
+    std::vector<Slot> m_slots;               ///< Пул событий
+    std::vector<uint32_t> m_freeSlots;       ///< Свободные ячейки пула
+    std::unordered_map<StringId, SimEventHandler> m_handlers;  ///< Обработчики по виду
+};
+
+} // namespace core
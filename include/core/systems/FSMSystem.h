@@ -1,6 +1,7 @@
 #pragma once
 
 #include "core/systems/ISystem.h"
+#include "core/StringId.h"
 #include <entt/entt.hpp>
 
 namespace core {
@@ -9,7 +10,7 @@ namespace core {
  * @brief Система управления конечными автоматами (FSM)
  *
  * Обновляет EntityStateComponent, отслеживая время в состоянии.
- * Вызывает коллбеки при переходах между состояниями.
+ * Вызывает коллбеки StateCallbacksComponent при переходах между состояниями.
  *
  * Приоритет: 150 (после CollisionSystem, до OverlaySystem)
  */
@@ -35,6 +36,19 @@ public:
      */
     void update(entt::registry& registry, double dt) override;
 
+    /**
+     * @brief Перевести сущность в новое состояние
+     *
+     * Вызывает коллбеки из StateCallbacksComponent (если есть) и публикует
+     * StateChangedEvent.
+     *
+     * @param registry EnTT registry
+     * @param entity Сущность с EntityStateComponent
+     * @param newState Новое состояние
+     * @return false если у сущности нет EntityStateComponent
+     */
+    static bool setState(entt::registry& registry, entt::entity entity, StringId newState);
+
     /**
      * @brief Получить приоритет системы
      * @return Приоритет (150 - после CollisionSystem, до OverlaySystem)
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <entt/entt.hpp>
+#include <vector>
+
+namespace core {
+
+/**
+ * @brief Изменение пересечения пары сущностей с CollisionComponent
+ */
+struct CollisionPairChange {
+    entt::entity entityA = entt::null;  ///< Первая сущность
+    entt::entity entityB = entt::null;  ///< Вторая сущность
+    bool began = true;                  ///< true — пересечение началось, false — закончилось
+};
+
+/**
+ * @brief Внешний источник пересечений для CollisionSystem
+ *
+ * Позволяет заменить встроенную O(n²) проверку AABB чужим broadphase
+ * (например, сенсорами Box2D, см. simulation::CollisionSensorBridge).
+ * CollisionSystem забирает изменения пар раз в кадр и сама вызывает
+ * коллбеки и публикует CollisionEvent (Enter/Stay/Exit).
+ */
+class ICollisionBroadphase {
+public:
+    virtual ~ICollisionBroadphase() = default;
+
+    /**
+     * @brief Забрать накопленные изменения пар в порядке их возникновения
+     *
+     * Вызывается из главного потока. Повторные начала и концы одной пары
+     * допустимы — CollisionSystem их отфильтрует.
+     *
+     * @param changes Вектор, в конец которого добавляются изменения
+     */
+    virtual void drainPairChanges(std::vector<CollisionPairChange>& changes) = 0;
+};
+
+} // namespace core
@@ -44,7 +44,8 @@ private:
      * @brief Синхронизирует позицию оверлея с родителем
      *
      * Копирует позицию родителя в TransformComponent оверлея
-     * и добавляет localOffset.
+     * и добавляет localOffset. Изменённый Transform записывается через
+     * registry.patch(), чтобы его увидели наблюдатели (SpatialIndex).
      *
      * @param registry EnTT registry
      */
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "core/systems/ISystem.h"
+#include <entt/entt.hpp>
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+namespace core {
+
+/**
+ * @brief Тип, пригодный для статического конвейера: update(registry, dt)
+ */
+template<typename T>
+concept PipelineStage = requires(T& system, entt::registry& registry, double dt) {
+    system.update(registry, dt);
+};
+
+/**
+ * @brief Статически собранный конвейер систем
+ *
+ * Хранит системы по значению и вызывает их в порядке перечисления в
+ * параметрах шаблона (приоритеты getPriority() не учитываются). Вызовы
+ * update()/isActive() квалифицированы типом системы, поэтому виртуальная
+ * диспетчеризация не используется и компилятор может встроить всю цепочку.
+ * get<T>() — обращение к элементу std::tuple, без поиска и dynamic_cast.
+ *
+ * Сам конвейер — ISystem, так что его можно добавить в SystemScheduler
+ * одной записью рядом с динамическими (плагинными) системами: на тик
+ * приходится один виртуальный вызов на весь конвейер.
+ *
+ * @code
+ * Pipeline<UpdateSystem, LifetimeSystem, CollisionSystem, FSMSystem> pipeline;
+ * pipeline.update(registry, dt);                  // без виртуальных вызовов
+ * pipeline.get<FSMSystem>().setActive(false);
+ *
+ * // Системы с аргументами конструктора: по одному аргументу на систему
+ * Pipeline<UpdateSystem, RenderSystem> withRender(UpdateSystem{}, &resourceManager);
+ *
+ * // Совместно с динамическими системами
+ * using CorePipeline = Pipeline<UpdateSystem, LifetimeSystem>;
+ * scheduler.addSystem(std::make_unique<CorePipeline>());
+ * scheduler.addSystem(std::move(pluginSystem));
+ * scheduler.getSystem<CorePipeline>()->get<UpdateSystem>();
+ * @endcode
+ *
+ * @tparam Systems Типы систем (различные, с методом update(registry, dt))
+ */
+template<PipelineStage... Systems>
+class Pipeline final : public ISystem {
+public:
+    /**
+     * @brief Все системы конструируются по умолчанию
+     */
+    Pipeline() = default;
+
+    /**
+     * @brief Конструирование систем из аргументов (по одному на систему, как у std::tuple)
+     */
+    template<typename... Args>
+        requires(sizeof...(Args) == sizeof...(Systems) && sizeof...(Args) > 0 &&
+                 (std::is_constructible_v<Systems, Args&&> && ...))
+    explicit Pipeline(Args&&... args) : m_systems(std::forward<Args>(args)...) {}
+
+    Pipeline(const Pipeline&) = delete;
+    Pipeline& operator=(const Pipeline&) = delete;
+
+    /**
+     * @brief Количество систем в конвейере
+     */
+    static constexpr size_t size() { return sizeof...(Systems); }
+
+    /**
+     * @brief Содержит ли конвейер систему типа T
+     */
+    template<typename T>
+    static constexpr bool contains() {
+        return (std::is_same_v<T, Systems> || ...);
+    }
+
+    /**
+     * @brief Доступ к системе по типу (проверяется при компиляции)
+     */
+    template<typename T>
+        requires(contains<T>())
+    T& get() {
+        return std::get<T>(m_systems);
+    }
+
+    template<typename T>
+        requires(contains<T>())
+    const T& get() const {
+        return std::get<T>(m_systems);
+    }
+
+    /**
+     * @brief Обновить все активные системы в порядке перечисления
+     */
+    void update(entt::registry& registry, double dt) override {
+        std::apply([&](Systems&... systems) { (updateStage(systems, registry, dt), ...); },
+                   m_systems);
+    }
+
+    int getPriority() const override { return m_priority; }
+    const char* getName() const override { return m_name; }
+    bool isActive() const override { return m_active; }
+    void setActive(bool active) override { m_active = active; }
+
+    /**
+     * @brief Приоритет конвейера в SystemScheduler
+     */
+    void setPriority(int priority) { m_priority = priority; }
+
+    /**
+     * @brief Имя конвейера для отладки (строка должна жить дольше конвейера)
+     */
+    void setName(const char* name) { m_name = name; }
+
+private:
+    template<typename T>
+    static void updateStage(T& system, entt::registry& registry, double dt) {
+        // Квалифицированные вызовы T::... не диспетчеризуются через vtable
+        if constexpr (requires { system.isActive(); }) {
+            if (!system.T::isActive()) {
+                return;
+            }
+        }
+        system.T::update(registry, dt);
+    }
+
+    std::tuple<Systems...> m_systems;   ///< Системы по значению
+    const char* m_name = "Pipeline";    ///< Имя для отладки
+    int m_priority = 0;                 ///< Приоритет в SystemScheduler
+    bool m_active = true;               ///< Флаг активности
+};
+
+} // namespace core
@@ -1,10 +1,16 @@
 #pragma once
 
 #include "core/systems/ISystem.h"
+#include "core/EntityHandleTable.h"
+#include "core/StringId.h"
 #include <entt/entt.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Sprite.hpp>
+#include <cstdint>
+#include <optional>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace core {
 
@@ -22,6 +28,20 @@ class ResourceManager;
  * 1. update() - подготовка данных (culling, сортировка, кеширование)
  * 2. render() - отрисовка подготовленных спрайтов
  *
+ * Обход идёт по partial-owning группе
+ * registry.group<SpriteComponent>(get<TransformComponent>): первые group.size()
+ * элементов пула спрайтов — участники группы, Transform берётся по сущности.
+ *
+ * Порядок отрисовки хранится в самой группе: при изменении слоёв
+ * (markLayersDirty(), вход/выход сущности из группы) группа сортируется
+ * group.sort() по слою, а при равных слоях — по id сущности; в остальных
+ * кадрах обход идёт без сортировки.
+ *
+ * @note Группа владеет только пулом SpriteComponent (registry.sort() для него
+ *       недоступен). Пул TransformComponent не переставляется: поток физики
+ *       пишет в него под PhysicsThread::getRegistryMutex(), а update()
+ *       выполняется в главном потоке без этой блокировки.
+ *
  * @note Требует вызова setViewBounds() перед update() для frustum culling
  */
 class RenderSystem : public ISystem {
@@ -32,6 +52,14 @@ public:
      */
     explicit RenderSystem(ResourceManager* resourceManager);
 
+    /**
+     * @brief Деструктор (отписывается от сигналов registry)
+     */
+    ~RenderSystem() override;
+
+    RenderSystem(const RenderSystem&) = delete;
+    RenderSystem& operator=(const RenderSystem&) = delete;
+
     /**
      * @brief Обновление системы (подготовка данных для рендеринга)
      *
@@ -74,9 +102,17 @@ public:
 
     /**
      * @brief Помечает слои как измененные (требуется пересортировка)
+     *
+     * Вызывается, когда SpriteComponent::layer изменён напрямую
+     * (например, по результату TilePositionSystem::layersChanged()).
      */
     void markLayersDirty();
 
+    /**
+     * @brief Количество пересортировок группы спрайтов (для отладки/тестов)
+     */
+    size_t getSortCount() const { return m_sortCount; }
+
     int getPriority() const override { return 500; }
     const char* getName() const override { return "RenderSystem"; }
 
@@ -85,25 +121,86 @@ private:
      * @brief Данные для рендеринга одной сущности
      */
     struct RenderData {
-        entt::entity entity;
-        int layer;
+        uint32_t cacheIndex;  ///< Индекс в m_spriteCache
     };
 
+    /**
+     * @brief Кешированный спрайт сущности
+     */
+    struct CachedSprite {
+        EntityHandle handle;               ///< Хэндл сущности, для которой создан спрайт
+        std::optional<sf::Sprite> sprite;  ///< Спрайт (sf::Sprite не конструируется без текстуры)
+    };
+
+    /**
+     * @brief Текстура по имени через кеш StringId → указатель
+     *
+     * ResourceManager ищет по std::string под мьютексом, а StringId::str() —
+     * под shared_mutex таблицы строк; кеш обращается к ним один раз на имя.
+     * @return nullptr, если текстура не найдена (предупреждение — один раз на имя)
+     */
+    const sf::Texture* findTexture(StringId name);
+
+    /**
+     * @brief Подписаться на сигналы SpriteComponent (при первом update)
+     */
+    void connect(entt::registry& registry);
+
+    /**
+     * @brief Отписаться от сигналов registry
+     */
+    void disconnect();
+
+    void onSpriteConstruct(entt::registry& registry, entt::entity entity);
+    void onSpriteDestroy(entt::registry& registry, entt::entity entity);
+    void onTransformChanged(entt::registry& registry, entt::entity entity);
+
+    /**
+     * @brief Удалить спрайт сущности из кеша (если он есть)
+     */
+    void releaseCachedSprite(entt::entity entity);
+
     ResourceManager* m_resourceManager;  ///< Менеджер ресурсов для текстур
     sf::FloatRect m_viewBounds;          ///< Границы видимой области для frustum culling
     bool m_layersDirty = true;           ///< Флаг необходимости пересортировки слоев
+    size_t m_sortCount = 0;              ///< Количество пересортировок группы
+    entt::registry* m_registry = nullptr;  ///< Registry, к сигналам которого подключены
+    EntityHandleTable* m_handles = nullptr;  ///< Хэндлы сущностей registry (ключи кеша)
+    std::unordered_set<StringId> m_missingTextures;  ///< Текстуры, о которых уже предупредили
+
+    /// Имя текстуры → текстура (nullptr — не найдена). Сбрасывается при смене
+    /// ResourceManager::getTextureGeneration(): указатели могли устареть
+    std::unordered_map<StringId, const sf::Texture*> m_textureCache;
+    uint64_t m_textureGeneration = 0;  ///< Поколение текстур, для которого заполнен кеш
 
     /**
      * @brief Кеш sf::Sprite объектов для избежания создания каждый кадр
-     * Ключ - entity ID, значение - кешированный спрайт
+     * Индекс - EntityHandle::index(); слот с другим поколением хэндла
+     * принадлежал удалённой сущности и пересоздаётся
      */
-    std::unordered_map<entt::entity, sf::Sprite> m_spriteCache;
+    std::vector<CachedSprite> m_spriteCache;
 
     /**
      * @brief Очередь подготовленных сущностей для рендеринга
      * Заполняется в update(), используется в render()
      */
     std::vector<RenderData> m_renderQueue;
+
+    /**
+     * @brief Кандидат на отрисовку (прошёл проверки видимости и текстуры)
+     */
+    struct CullCandidate {
+        entt::entity entity;           ///< Сущность
+        const sf::Texture* texture;    ///< Текстура (найдена в проходе сбора)
+    };
+
+    // SoA буферы для векторного frustum culling (переиспользуются между кадрами)
+    std::vector<CullCandidate> m_cullCandidates;  ///< Кандидаты в порядке SoA массивов
+    std::vector<float> m_cullMinX;                ///< Левая граница спрайта
+    std::vector<float> m_cullMinY;                ///< Верхняя граница спрайта
+    std::vector<float> m_cullMaxX;                ///< Правая граница спрайта
+    std::vector<float> m_cullMaxY;                ///< Нижняя граница спрайта
+    std::vector<uint8_t> m_cullVisible;           ///< Маска видимости (результат cullAabbs)
 };
 
 } // namespace core
@@ -2,7 +2,12 @@
 
 #include "core/systems/ISystem.h"
 #include <entt/entt.hpp>
+#include <functional>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <typeindex>
+#include <unordered_map>
 #include <vector>
 #include <algorithm>
 
@@ -21,6 +26,9 @@ namespace core {
  * scheduler.addSystem(std::make_unique<TilePositionSystem>());
  * scheduler.update(registry, dt);
  * @endcode
+ *
+ * Для фиксированного набора систем без виртуальных вызовов см. Pipeline;
+ * конвейер добавляется в планировщик как одна система.
  */
 class SystemScheduler {
 public:
@@ -58,6 +66,14 @@ public:
     /**
      * @brief Получить систему по имени
      *
+     * Поиск по хэш-таблице имён. Как и раньше, при совпадении имён возвращается
+     * первая система в порядке приоритета. Индекс строится после addSystem();
+     * промах по нему возвращает nullptr без перестроения. Имя может смениться
+     * после addSystem() (Pipeline::setName()), поэтому найденная запись
+     * сверяется с getName() и устаревшая перестраивает индекс. Новое имя
+     * находится после такого перестроения или следующего addSystem(), поэтому
+     * имя лучше задавать до добавления системы.
+     *
      * @param name Имя системы
      * @return Указатель на систему или nullptr если не найдена
      */
@@ -66,17 +82,33 @@ public:
     /**
      * @brief Получить систему по типу
      *
+     * Первый запрос типа ищет систему через dynamic_cast (первую в порядке
+     * приоритета), результат (в том числе отсутствие) кешируется до
+     * следующего addSystem()/clear().
+     *
      * @tparam T Тип системы
      * @return Указатель на систему или nullptr если не найдена
      */
     template<typename T>
     T* getSystem() {
+        if (m_needsSort) {
+            sortSystems();
+        }
+
+        const std::type_index key(typeid(T));
+        if (auto it = m_typeCache.find(key); it != m_typeCache.end()) {
+            return static_cast<T*>(it->second);
+        }
+
+        T* found = nullptr;
         for (auto& sys : m_systems) {
             if (auto* casted = dynamic_cast<T*>(sys.get())) {
-                return casted;
+                found = casted;
+                break;
             }
         }
-        return nullptr;
+        m_typeCache.emplace(key, found);
+        return found;
     }
 
     /**
@@ -94,10 +126,30 @@ private:
     std::vector<std::unique_ptr<ISystem>> m_systems;  ///< Список систем
     bool m_needsSort = false;  ///< Флаг необходимости пересортировки
 
+    /// Хеш строк с поиском по std::string_view без создания std::string
+    struct NameHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view name) const noexcept {
+            return std::hash<std::string_view>{}(name);
+        }
+    };
+
+    std::unordered_map<std::type_index, ISystem*> m_typeCache;  ///< Тип -> система (или nullptr)
+
+    /// Имя -> первая по приоритету система. Ключи — копии имён: getName()
+    /// может вернуть другой указатель после переименования системы
+    std::unordered_map<std::string, ISystem*, NameHash, std::equal_to<>> m_nameIndex;
+    bool m_nameIndexDirty = false;  ///< Индекс имён нужно перестроить
+
     /**
      * @brief Сортировать системы по приоритету
      */
     void sortSystems();
+
+    /**
+     * @brief Перестроить индекс имён по текущему порядку систем
+     */
+    void rebuildNameIndex();
 };
 
 } // namespace core
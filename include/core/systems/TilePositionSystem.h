@@ -2,9 +2,14 @@
 
 #include "core/systems/ISystem.h"
 #include <entt/entt.hpp>
+#include <vector>
 
 namespace core {
 
+struct TilePositionComponent;
+struct TransformComponent;
+struct SpriteComponent;
+
 /**
  * @brief Система синхронизации тайловых и пиксельных координат
  *
@@ -12,9 +17,16 @@ namespace core {
  * обеспечивая корректное позиционирование объектов на тайловой сетке.
  * Также вычисляет layer для Y-sorting (перспектива 3/4).
  *
- * Использует EnTT observers для реактивного обновления только измененных
- * объектов, что значительно повышает производительность при большом
- * количестве статичных объектов.
+ * Реактивная: при первом update() обрабатывает все сущности и подписывается
+ * на сигналы EnTT (on_construct/on_update TilePositionComponent, on_construct
+ * TransformComponent/SpriteComponent). Дальше обрабатываются только
+ * изменённые сущности — статичное оборудование не стоит ничего.
+ *
+ * Изменения тайловой позиции должны идти через registry.patch() / replace():
+ * @code
+ * registry.patch<TilePositionComponent>(entity, [](auto& pos) { pos.tileY += 1; });
+ * @endcode
+ * Для прямых изменений по ссылке вызовите markAllDirty().
  */
 class TilePositionSystem : public ISystem {
 public:
@@ -24,11 +36,19 @@ public:
     TilePositionSystem();
 
     /**
-     * @brief Обновление позиций всех тайловых объектов
+     * @brief Деструктор (отписывается от сигналов registry)
+     */
+    ~TilePositionSystem() override;
+
+    TilePositionSystem(const TilePositionSystem&) = delete;
+    TilePositionSystem& operator=(const TilePositionSystem&) = delete;
+
+    /**
+     * @brief Обновление позиций изменённых тайловых объектов
      *
      * Синхронизирует тайловые координаты с пиксельными координатами
      * в TransformComponent и вычисляет layer для корректного Z-ordering.
-     * Обрабатывает только измененные объекты благодаря observers.
+     * Обрабатывает только сущности, изменённые с прошлого вызова.
      *
      * @param registry EnTT registry с сущностями
      * @param dt Время с последнего обновления (не используется)
@@ -36,36 +56,77 @@ public:
     void update(entt::registry& registry, double dt) override;
 
     /**
-     * @brief Обновление позиций всех тайловых объектов (старый API)
+     * @brief Обновление позиций изменённых тайловых объектов (старый API)
      * @param registry EnTT registry с сущностями
      */
     void update(entt::registry& registry);
 
+    /**
+     * @brief Изменился ли SpriteComponent::layer хотя бы у одной сущности в последнем update()
+     *
+     * Используется для пересортировки RenderSystem только при необходимости.
+     */
+    bool layersChanged() const { return m_layersChanged; }
+
+    /**
+     * @brief Обработать все сущности при следующем update()
+     */
+    void markAllDirty() { m_needsFullPass = true; }
+
+    /**
+     * @brief Количество сущностей, обработанных в последнем update()
+     */
+    size_t getLastProcessedCount() const { return m_lastProcessedCount; }
+
     int getPriority() const override { return 200; }
     const char* getName() const override { return "TilePositionSystem"; }
 
 private:
     /**
-     * @brief Синхронизирует тайловую позицию с трансформом
+     * @brief Подписаться на сигналы registry (при первом update или смене registry)
+     */
+    void connect(entt::registry& registry);
+
+    /**
+     * @brief Отписаться от сигналов текущего registry
+     */
+    void disconnect();
+
+    /**
+     * @brief Запомнить изменённую сущность (слот сигналов EnTT)
+     */
+    void markDirty(entt::registry& registry, entt::entity entity);
+
+    /**
+     * @brief Синхронизирует тайловую позицию с трансформом одной сущности
      *
      * Конвертирует тайловые координаты в пиксельные и обновляет
-     * TransformComponent. Обрабатывает только измененные сущности
-     * из observer.
-     *
-     * @param registry EnTT registry
+     * TransformComponent через registry.patch(), чтобы on_update увидели
+     * наблюдатели Transform (SpatialIndex). Неизменённая позиция не патчится.
      */
-    void syncPositions(entt::registry& registry);
+    void syncPosition(entt::registry& registry, entt::entity entity,
+                      const TilePositionComponent& tilePos);
 
     /**
-     * @brief Вычисляет layer для Y-sorting
+     * @brief Вычисляет layer для Y-sorting одной сущности
      *
      * Объекты на слое Objects сортируются по Y-координате
      * для создания эффекта перспективы 3/4.
-     * Обрабатывает только измененные сущности из observer.
      *
-     * @param registry EnTT registry
+     * @return true если layer изменился
      */
-    void updateLayers(entt::registry& registry);
+    bool updateLayer(const TilePositionComponent& tilePos, SpriteComponent& sprite);
+
+    /**
+     * @brief Обработать одну сущность (позиция + слой)
+     */
+    void processEntity(entt::registry& registry, entt::entity entity);
+
+    entt::registry* m_registry = nullptr;  ///< Registry, к сигналам которого подключены
+    std::vector<entt::entity> m_dirty;     ///< Изменённые сущности (могут повторяться)
+    bool m_needsFullPass = true;           ///< Обработать все сущности при следующем update
+    bool m_layersChanged = false;          ///< Результат последнего update()
+    size_t m_lastProcessedCount = 0;       ///< Статистика последнего update()
 };
 
 } // namespace core
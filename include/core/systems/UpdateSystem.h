@@ -10,6 +10,10 @@ namespace core {
  *
  * Обновляет позиции сущностей на основе их скорости
  * Применяет простую физику (без коллизий)
+ *
+ * Сущности обходятся напрямую в partial-owning группе
+ * group<VelocityComponent>(get<TransformComponent>): скорости лежат плотно,
+ * угол нормализуется скалярным wrapDegrees() без std::fmod.
  */
 class UpdateSystem : public ISystem {
 public:
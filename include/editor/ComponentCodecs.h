@@ -0,0 +1,131 @@
+#pragma once
+
+#include <entt/entt.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file ComponentCodecs.h
+ * @brief Побайтовая сериализация компонентов для журнала команд редактора
+ */
+
+namespace editor {
+
+/**
+ * @brief Сериализатор одного типа компонента
+ *
+ * Функции генерируются один раз при регистрации типа. Байтовое
+ * представление используется только внутри процесса (журнал undo/redo),
+ * поэтому StringId и entt::entity хранятся как есть.
+ */
+struct ComponentCodec {
+    const char* name = "";      ///< Имя компонента (для логов)
+    entt::id_type typeId = 0;   ///< entt::type_hash<T>
+
+    /// Дописать байты компонента в out; false если компонента у сущности нет
+    bool (*save)(const entt::registry&, entt::entity, std::vector<uint8_t>& out) = nullptr;
+    /// Установить компонент из байтов (emplace_or_replace); false если размер не подходит
+    bool (*load)(entt::registry&, entt::entity, std::span<const uint8_t> bytes) = nullptr;
+    /// Удалить компонент (если есть)
+    void (*remove)(entt::registry&, entt::entity) = nullptr;
+};
+
+/**
+ * @brief Реестр сериализаторов компонентов, которые отслеживает редактор
+ *
+ * Горячие компоненты (isHotComponent: тривиально копируемые, ≤ 32 байт)
+ * сериализуются memcpy, поэтому diff перемещения Transform — это 8 байт
+ * x/y, а не копия сущности. Для компонентов со строками регистрируются
+ * собственные функции.
+ *
+ * @code
+ * ComponentCodecs codecs;
+ * codecs.registerCoreComponents();
+ * codecs.registerTrivial<MyHotComponent>("MyHot");
+ * @endcode
+ *
+ * Компоненты без сериализатора журналом не отслеживаются: при отмене
+ * удаления сущности они не восстанавливаются.
+ */
+class ComponentCodecs {
+public:
+    /**
+     * @brief Зарегистрировать тривиально копируемый компонент
+     *
+     * @param name Имя (строка должна жить дольше реестра)
+     */
+    template<typename T>
+    void registerTrivial(const char* name) {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "registerTrivial requires a trivially copyable component");
+
+        ComponentCodec codec;
+        codec.name = name;
+        codec.typeId = entt::type_hash<T>::value();
+        codec.save = +[](const entt::registry& registry, entt::entity entity,
+                         std::vector<uint8_t>& out) {
+            const T* component = registry.try_get<T>(entity);
+            if (!component) {
+                return false;
+            }
+            const auto* bytes = reinterpret_cast<const uint8_t*>(component);
+            out.insert(out.end(), bytes, bytes + sizeof(T));
+            return true;
+        };
+        codec.load = +[](entt::registry& registry, entt::entity entity,
+                         std::span<const uint8_t> bytes) {
+            if (bytes.size() != sizeof(T)) {
+                return false;
+            }
+            T value;
+            std::memcpy(&value, bytes.data(), sizeof(T));
+            registry.emplace_or_replace<T>(entity, value);
+            return true;
+        };
+        codec.remove = +[](entt::registry& registry, entt::entity entity) {
+            registry.remove<T>(entity);
+        };
+        registerCodec(codec);
+    }
+
+    /**
+     * @brief Зарегистрировать сериализатор (повторная регистрация типа заменяет его)
+     */
+    void registerCodec(const ComponentCodec& codec);
+
+    /**
+     * @brief Сериализатор по id типа
+     * @return nullptr если тип не зарегистрирован
+     */
+    const ComponentCodec* find(entt::id_type typeId) const;
+
+    template<typename T>
+    const ComponentCodec* find() const {
+        return find(entt::type_hash<T>::value());
+    }
+
+    /**
+     * @brief Все сериализаторы в порядке регистрации
+     */
+    const std::vector<ComponentCodec>& codecs() const { return m_codecs; }
+
+    /**
+     * @brief Зарегистрировать компоненты core, редактируемые в редакторе уровней
+     *
+     * Transform, Sprite, Velocity, Collision, TilePosition, Parent — memcpy;
+     * Name и Tag — длина строки и символы. ChildrenComponent не регистрируется:
+     * он производный от ParentComponent.
+     */
+    void registerCoreComponents();
+
+private:
+    std::vector<ComponentCodec> m_codecs;                    ///< Сериализаторы
+    std::unordered_map<entt::id_type, size_t> m_byType;      ///< id типа -> индекс
+};
+
+} // namespace editor
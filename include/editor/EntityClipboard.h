@@ -0,0 +1,82 @@
+#pragma once
+
+#include <editor/EntityCloner.h>
+#include <entt/entt.hpp>
+
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @file EntityClipboard.h
+ * @brief Буфер обмена и шаблоны групп сущностей редактора
+ */
+
+namespace editor {
+
+/**
+ * @brief Отсоединённая копия группы сущностей
+ *
+ * Хранит копию в собственном registry (без систем и сигналов сцены),
+ * поэтому оригинал можно менять или удалять после copy(). Одна и та же
+ * группа вставляется сколько угодно раз — буфер обмена и шаблон группы
+ * («линия розлива») — одно и то же.
+ *
+ * @code
+ * EntityClipboard clipboard(cloner);
+ * clipboard.copy(registry, selection);         // Ctrl+C (вместе с потомками)
+ * clipboard.paste(registry, pasted);           // Ctrl+V
+ * @endcode
+ *
+ * Ссылки на родителей вне группы хранятся отдельной таблицей по исходной
+ * сущности, а не в m_storage: id сцены там может совпасть с id копии. При
+ * вставке копия подключается к тому же родителю, если он существовал в
+ * registry до вставки.
+ */
+class EntityClipboard {
+public:
+    /**
+     * @brief Конструктор
+     * @param cloner Клонировщик с зарегистрированными типами (должен пережить буфер)
+     */
+    explicit EntityClipboard(EntityCloner& cloner) : m_cloner(cloner) {}
+
+    /**
+     * @brief Скопировать выделение вместе с потомками
+     *
+     * @param registry Registry сцены
+     * @param selection Выделенные сущности
+     * @return Количество скопированных сущностей
+     */
+    size_t copy(const entt::registry& registry, std::span<const entt::entity> selection);
+
+    /**
+     * @brief Вставить копию группы
+     *
+     * @param registry Registry сцены
+     * @param out Новые сущности (перезаписывается)
+     * @return Количество вставленных сущностей
+     */
+    size_t paste(entt::registry& registry, std::vector<entt::entity>& out);
+
+    /**
+     * @brief Очистить буфер
+     */
+    void clear();
+
+    bool empty() const { return m_entities.empty(); }
+    size_t size() const { return m_entities.size(); }
+
+private:
+    EntityCloner& m_cloner;                ///< Клонировщик
+    entt::registry m_storage;              ///< Отсоединённая копия
+    std::vector<entt::entity> m_entities;  ///< Сущности группы в m_storage
+    std::vector<entt::entity> m_sources;   ///< Исходные сущности (m_sources[i] -> m_entities[i])
+
+    /// Исходная сущность -> родитель вне группы (id сцены, не m_storage)
+    std::unordered_map<entt::entity, entt::entity> m_externalParents;
+    std::vector<std::pair<size_t, entt::entity>> m_links;  ///< {индекс копии, родитель} (буфер)
+};
+
+} // namespace editor
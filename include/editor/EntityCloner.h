@@ -0,0 +1,240 @@
+#pragma once
+
+#include <entt/entt.hpp>
+
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file EntityCloner.h
+ * @brief Массовое клонирование сущностей по колонкам компонентов
+ */
+
+namespace simulation {
+class PhysicsSystem;
+}
+
+namespace editor {
+
+/**
+ * @brief Соответствие исходных сущностей их копиям в одной операции клонирования
+ */
+class EntityRemap {
+public:
+    void reserve(size_t count) { m_map.reserve(count); }
+    void clear() { m_map.clear(); }
+
+    /**
+     * @brief Добавить пару исходная -> копия
+     * @return false если исходная уже есть (повтор в выделении)
+     */
+    bool add(entt::entity source, entt::entity clone) {
+        return m_map.try_emplace(source, clone).second;
+    }
+
+    /**
+     * @brief Копия сущности
+     * @return entt::null если сущность не входит в выделение (внешняя ссылка)
+     */
+    entt::entity find(entt::entity source) const {
+        auto it = m_map.find(source);
+        return it != m_map.end() ? it->second : entt::null;
+    }
+
+    /**
+     * @brief Копия сущности, а для внешних ссылок — сама сущность
+     */
+    entt::entity operator()(entt::entity source) const {
+        const entt::entity clone = find(source);
+        return clone != entt::null ? clone : source;
+    }
+
+    bool contains(entt::entity source) const { return m_map.contains(source); }
+    size_t size() const { return m_map.size(); }
+
+private:
+    std::unordered_map<entt::entity, entt::entity> m_map;  ///< Исходная -> копия
+};
+
+/**
+ * @brief Копирование колонки одного типа компонента
+ *
+ * @param src Исходный registry
+ * @param sources Исходные сущности
+ * @param targets Копии (targets[i] — копия sources[i])
+ * @param dst Registry назначения
+ * @param remap Соответствие сущностей (для ссылок внутри компонента)
+ */
+using ColumnCloneFn = void (*)(const entt::registry& src, std::span<const entt::entity> sources,
+                               std::span<const entt::entity> targets, entt::registry& dst,
+                               const EntityRemap& remap);
+
+/**
+ * @brief Клонирование выделения (дублирование, копирование, вставка, шаблоны групп)
+ *
+ * Копия строится по колонкам: для каждого зарегистрированного типа
+ * компонента значения выделения собираются из хранилища в плотный массив,
+ * ссылки на сущности переназначаются за один проход и массив вставляется
+ * одним registry.insert(). Сущности создаются одним registry.create(first, last).
+ * Стоимость — O(выделение × типы) без поштучных emplace и поиска по сцене.
+ *
+ * Ссылки на сущности внутри выделения указывают на копии; ссылки наружу
+ * сохраняются (копия подключается к тому же родителю, что и оригинал).
+ * ParentComponent/ChildrenComponent обрабатываются отдельным проходом:
+ * ChildrenComponent копии содержит только скопированных детей, а внешний
+ * родитель получает копию в свой ChildrenComponent.
+ *
+ * Если подключена PhysicsSystem, Box2D тела копий создаются одним пакетом
+ * после вставки всех колонок (beginBodyBatch/endBodyBatch).
+ *
+ * @code
+ * EntityCloner cloner;
+ * cloner.registerCoreComponents();
+ * cloner.setPhysicsSystem(&physicsSystem);
+ *
+ * std::vector<entt::entity> clones;
+ * cloner.clone(registry, selection, registry, clones);   // Дублирование
+ * @endcode
+ *
+ * @note Registry назначения изменяется: при работающем PhysicsThread вызывать
+ *       под его getRegistryMutex().
+ */
+class EntityCloner {
+public:
+    /**
+     * @brief Параметры клонирования
+     */
+    struct Options {
+        /**
+         * @brief Подключать копии к внешним родителям
+         *
+         * false — для отсоединённого хранилища (буфер обмена, шаблон группы):
+         * ParentComponent с внешним родителем у копии снимается. id сцены в
+         * другом registry может совпасть с id копии, поэтому внешние ссылки
+         * вызывающий хранит сам и разрешает при вставке.
+         */
+        bool linkExternal = true;
+    };
+
+    /**
+     * @brief Зарегистрировать копируемый тип компонента
+     *
+     * @tparam T Тип компонента (не пустой, копируемый)
+     * @tparam Fixup Функция void(T&, const EntityRemap&) для переназначения
+     *         ссылок и сброса runtime-полей копии, или nullptr
+     * @param name Имя (для логов)
+     */
+    template<typename T, auto Fixup = nullptr>
+    void registerComponent(const char* name) {
+        static_assert(!std::is_empty_v<T>, "Empty (tag) components are not cloned by value");
+        static_assert(std::is_copy_constructible_v<T>, "Cloned components must be copyable");
+        registerColumn(entt::type_hash<T>::value(), name, &cloneColumn<T, Fixup>);
+    }
+
+    /**
+     * @brief Зарегистрировать компоненты core и физики
+     *
+     * Горячие компоненты, Name/Tag, анимации, иерархия, Rigidbody (с
+     * обнулённым b2BodyId) и Collider. Коллбеки (std::function) не
+     * копируются: они привязаны к конкретной сущности.
+     */
+    void registerCoreComponents();
+
+    /**
+     * @brief Подключить физику для пакетного создания тел (nullptr — отключить)
+     */
+    void setPhysicsSystem(simulation::PhysicsSystem* physics) { m_physics = physics; }
+
+    /**
+     * @brief Клонировать сущности
+     *
+     * @param src Исходный registry
+     * @param selection Исходные сущности (недействительные и повторы пропускаются)
+     * @param dst Registry назначения (может совпадать с src)
+     * @param out Копии в порядке выделения (перезаписывается)
+     * @param options Параметры
+     * @return Количество копий
+     */
+    size_t clone(const entt::registry& src, std::span<const entt::entity> selection,
+                 entt::registry& dst, std::vector<entt::entity>& out, const Options& options);
+
+    size_t clone(const entt::registry& src, std::span<const entt::entity> selection,
+                 entt::registry& dst, std::vector<entt::entity>& out) {
+        return clone(src, selection, dst, out, Options{});
+    }
+
+    /**
+     * @brief Дополнить выделение всеми потомками (по ParentComponent)
+     *
+     * @param registry Registry сцены
+     * @param selection Выделение (дополняется на месте, без повторов)
+     */
+    static void appendDescendants(const entt::registry& registry,
+                                  std::vector<entt::entity>& selection);
+
+    /**
+     * @brief Количество зарегистрированных типов
+     */
+    size_t getComponentCount() const { return m_columns.size(); }
+
+private:
+    /// Зарегистрированная колонка
+    struct Column {
+        entt::id_type typeId = 0;      ///< entt::type_hash<T>
+        const char* name = "";         ///< Имя компонента
+        ColumnCloneFn clone = nullptr; ///< Копирование колонки
+    };
+
+    template<typename T, auto Fixup>
+    static void cloneColumn(const entt::registry& src, std::span<const entt::entity> sources,
+                            std::span<const entt::entity> targets, entt::registry& dst,
+                            const EntityRemap& remap) {
+        const auto* storage = src.storage<T>();
+        if (!storage || storage->empty()) {
+            return;
+        }
+
+        std::vector<entt::entity> entities;
+        std::vector<T> values;
+        for (size_t i = 0; i < sources.size(); ++i) {
+            if (storage->contains(sources[i])) {
+                entities.push_back(targets[i]);
+                values.push_back(storage->get(sources[i]));
+            }
+        }
+        if (entities.empty()) {
+            return;
+        }
+
+        if constexpr (!std::is_same_v<decltype(Fixup), std::nullptr_t>) {
+            for (T& value : values) {
+                Fixup(value, remap);
+            }
+        }
+        dst.insert<T>(entities.begin(), entities.end(), values.begin());
+    }
+
+    /**
+     * @brief Добавить (или заменить) колонку
+     */
+    void registerColumn(entt::id_type typeId, const char* name, ColumnCloneFn clone);
+
+    /**
+     * @brief Проход иерархии: подключить копии к внешним родителям
+     *
+     * Внешний родитель определяется по исходной сущности (родитель не входит
+     * в m_remap), а не по id в dst: в другом registry id может совпасть с копией.
+     */
+    void linkHierarchy(const entt::registry& src, entt::registry& dst,
+                       std::span<const entt::entity> clones, const Options& options) const;
+
+    std::vector<Column> m_columns;                  ///< Колонки в порядке регистрации
+    simulation::PhysicsSystem* m_physics = nullptr; ///< Пакетное создание тел (опционально)
+    EntityRemap m_remap;                            ///< Соответствие текущей операции
+    std::vector<entt::entity> m_sources;            ///< Выделение без повторов
+};
+
+} // namespace editor
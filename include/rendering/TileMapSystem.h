@@ -5,6 +5,7 @@
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/VertexArray.hpp>
 #include <SFML/Graphics/View.hpp>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -72,6 +73,16 @@ public:
      */
     bool isLoaded() const { return m_loaded; }
 
+    /**
+     * @brief Маска непроходимых тайлов карты (для NavigationGrid::setTerrain)
+     *
+     * Тайл непроходим, если он непуст хотя бы в одном слое с bool-свойством
+     * "blocked" = true (стены, вода).
+     *
+     * @return Маска getMapWidth() × getMapHeight() построчно (1 — непроходимо)
+     */
+    std::vector<uint8_t> buildBlockedMask() const;
+
 private:
     /**
      * @brief Структура тайлсета
@@ -101,6 +112,7 @@ private:
         int height;                           ///< Высота слоя в тайлах
         float opacity;                        ///< Прозрачность слоя (0.0 - 1.0)
         bool visible;                         ///< Видимость слоя
+        bool blocked;                         ///< Непустые тайлы слоя непроходимы
     };
 
     /**
@@ -0,0 +1,201 @@
+#pragma once
+
+#include <core/EntityHandleTable.h>
+#include <core/systems/ICollisionBroadphase.h>
+#include <simulation/PhysicsWorld.h>
+#include <simulation/systems/PhysicsSystem.h>
+#include <SFML/Graphics/Rect.hpp>
+#include <box2d/box2d.h>
+#include <entt/entt.hpp>
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/**
+ * @file CollisionSensorBridge.h
+ * @brief Пересечения CollisionComponent через broadphase Box2D
+ */
+
+namespace simulation {
+
+/**
+ * @brief Broadphase для CollisionSystem на сенсорах Box2D
+ *
+ * Каждая сущность с TransformComponent + CollisionComponent получает
+ * кинематическое тело Box2D с двумя прямоугольными shape по
+ * CollisionComponent::getWorldBounds():
+ * - сенсор (isSensor) — обнаруживает чужие прокси;
+ * - прокси (не сенсор) — то, что обнаруживают чужие сенсоры.
+ *
+ * Оба shape в категории PROXY_CATEGORY с маской PROXY_CATEGORY: физические
+ * тела (ColliderComponent) их не видят и не сталкиваются с ними, а контакты
+ * между кинематическими телами Box2D не создаёт. Пересечения вычисляет
+ * broadphase Box2D, поэтому квадратичная проверка CollisionSystem не нужна.
+ *
+ * Отличие от CollisionSystem::checkAABB(): тот считает пересечением и касание
+ * краями (нестрогое сравнение), а Box2D проверяет перекрытие сенсоров по своей
+ * геометрии с допусками в метрах. Для границ, касающихся краями или стоящих
+ * вплотную, результаты режимов могут отличаться, поэтому режим по умолчанию —
+ * "aabb", а мост включается явно (collision.broadphase: box2d).
+ *
+ * Потоки:
+ * - сигналы registry (главный поток) выдают хэндлы и только ставят сущности
+ *   в очередь;
+ * - onPhysicsStep() (поток физики) создаёт/удаляет тела, переносит позиции
+ *   из TransformComponent и собирает события сенсоров шага. Таблицу хэндлов
+ *   он не читает (она не потокобезопасна): сущность берётся из очереди и
+ *   прокси, устаревшие отсекает registry.valid();
+ * - drainPairChanges() (главный поток, из CollisionSystem::update()) забирает
+ *   накопленные изменения пар.
+ *
+ * @code
+ * auto bridge = std::make_unique<CollisionSensorBridge>(physicsWorld);
+ * bridge->init(registry);
+ * physicsSystem.addStepListener(bridge.get());
+ * collisionSystem.setBroadphase(bridge.get());
+ * @endcode
+ */
+class CollisionSensorBridge : public core::ICollisionBroadphase, public IPhysicsStepListener {
+public:
+    /// Категория фильтра Box2D для shape коллизий CollisionComponent
+    static constexpr uint64_t PROXY_CATEGORY = 0x8000;
+
+    /**
+     * @brief Конструктор
+     * @param world Физический мир (должен пережить мост)
+     */
+    explicit CollisionSensorBridge(PhysicsWorld& world);
+
+    /**
+     * @brief Отключается от сигналов registry (тела Box2D удаляет shutdown())
+     */
+    ~CollisionSensorBridge() override;
+
+    CollisionSensorBridge(const CollisionSensorBridge&) = delete;
+    CollisionSensorBridge& operator=(const CollisionSensorBridge&) = delete;
+
+    /**
+     * @brief Поставить существующие сущности в очередь и подписаться на сигналы
+     *
+     * @param registry EnTT registry (должен пережить мост или вызвать shutdown() раньше)
+     */
+    void init(entt::registry& registry);
+
+    /**
+     * @brief Отписаться от сигналов и удалить все тела
+     *
+     * @note Вызывать, когда поток физики остановлен.
+     */
+    void shutdown();
+
+    /**
+     * @brief Обработать шаг физики (поток физики)
+     */
+    void onPhysicsStep(entt::registry& registry, float dt) override;
+
+    /**
+     * @brief Забрать изменения пар для CollisionSystem (главный поток)
+     */
+    void drainPairChanges(std::vector<core::CollisionPairChange>& changes) override;
+
+    /**
+     * @brief Количество созданных тел-прокси (читать из потока физики или после его остановки)
+     */
+    size_t getProxyCount() const { return m_proxies.size(); }
+
+private:
+    static constexpr uint32_t NO_PROXY = UINT32_MAX;  ///< Слот без прокси
+
+    /// Тело Box2D одной сущности
+    struct Proxy {
+        core::EntityHandle handle;         ///< Хэндл сущности (он же userData тела)
+        entt::entity entity = entt::null;  ///< Сущность (с версией)
+        b2BodyId body = b2_nullBodyId;     ///< Кинематическое тело с сенсором и прокси
+        sf::FloatRect bounds;              ///< Мировые границы, под которые выставлено тело
+    };
+
+    /// Сущность в очереди на создание тела (хэндл выдан в главном потоке)
+    struct PendingProxy {
+        core::EntityHandle handle;         ///< Хэндл сущности
+        entt::entity entity = entt::null;  ///< Сущность (с версией)
+    };
+
+    /// Пара сущностей (меньшая первой)
+    struct EntityPair {
+        entt::entity first;
+        entt::entity second;
+
+        EntityPair(entt::entity a, entt::entity b)
+            : first(a < b ? a : b)
+            , second(a < b ? b : a) {
+        }
+
+        bool operator<(const EntityPair& other) const {
+            if (first != other.first)
+                return first < other.first;
+            return second < other.second;
+        }
+
+        bool operator==(const EntityPair& other) const = default;
+    };
+
+    void onCollisionChanged(entt::registry& registry, entt::entity entity);
+    void onCollisionDestroy(entt::registry& registry, entt::entity entity);
+
+    /**
+     * @brief Создать/удалить тела по очереди из главного потока
+     */
+    void applyPendingProxies(entt::registry& registry);
+
+    /**
+     * @brief Создать тело для сущности (пересоздать, если уже есть)
+     */
+    void createProxy(entt::registry& registry, const PendingProxy& pending);
+
+    /**
+     * @brief Удалить тело по хэндлу и завершить все его активные пары
+     */
+    void destroyProxy(core::EntityHandle handle);
+
+    /**
+     * @brief Преобразовать события сенсоров шага в изменения пар
+     */
+    void collectSensorEvents(const entt::registry& registry);
+
+    /**
+     * @brief Перенести позиции из TransformComponent в тела (для следующего шага)
+     */
+    void syncProxies(entt::registry& registry);
+
+    /**
+     * @brief Сущность тела shape, если shape — наш сенсор или прокси
+     * @return entt::null, если сущность уже удалена
+     */
+    entt::entity entityFromShape(const entt::registry& registry, b2ShapeId shapeId) const;
+
+    /**
+     * @brief Записать изменение пары (с фильтрацией повторов)
+     */
+    void recordChange(entt::entity a, entt::entity b, bool began);
+
+    PhysicsWorld& m_world;                              ///< Физический мир
+    entt::registry* m_registry = nullptr;               ///< Registry, к сигналам которого подключены
+    core::EntityHandleTable* m_handles = nullptr;       ///< Хэндлы (только главный поток)
+
+    // Данные потока физики
+    std::vector<Proxy> m_proxies;                       ///< Плотный массив прокси
+    std::vector<uint32_t> m_proxyBySlot;                ///< Индекс хэндла -> позиция в m_proxies
+    std::vector<EntityPair> m_activePairs;              ///< Пересекающиеся пары (отсортированы)
+
+    // Очередь главный поток -> поток физики
+    std::mutex m_pendingMutex;                          ///< Защищает очереди ниже
+    std::vector<PendingProxy> m_pendingCreates;         ///< Создать/пересоздать тело
+    std::vector<core::EntityHandle> m_pendingDestroys;  ///< Удалить тело
+
+    // Очередь поток физики -> главный поток
+    std::mutex m_changesMutex;                          ///< Защищает m_changes
+    std::vector<core::CollisionPairChange> m_changes;   ///< Изменения пар с последнего drain
+};
+
+} // namespace simulation
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <core/EntityHandleTable.h>
 #include <box2d/box2d.h>
 #include <SFML/System/Vector2.hpp>
 #include <vector>
@@ -193,6 +194,10 @@ struct RigidbodyComponent {
     // === Интеграция с Box2D 3.x ===
     b2BodyId box2dBodyId = b2_nullBodyId;   ///< ID Box2D тела (b2_nullBodyId до создания)
 
+    /// Хэндл сущности (userData тела, ключ буфера трансформаций). Выдаётся в
+    /// главном потоке при создании тела: поток физики таблицу хэндлов не трогает
+    core::EntityHandle handle;
+
     /**
      * @brief Конструктор по умолчанию (динамическое тело с массой 1 кг)
      */
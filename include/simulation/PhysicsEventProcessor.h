@@ -2,8 +2,10 @@
 
 #include "events/CollisionEvents.h"
 #include "PhysicsWorld.h"
+#include "core/EntityHandleTable.h"
 #include <entt/entt.hpp>
 #include <box2d/box2d.h>
+#include <cstdint>
 
 /**
  * @file PhysicsEventProcessor.h
@@ -15,11 +17,14 @@
  * Box2D 3.x использует event-based подход: события накапливаются во время
  * симуляции и доступны для обработки после вызова b2World_Step().
  *
- * @note Для связи Box2D shape с entt::entity используется userData в b2BodyDef.
+ * @note Для связи Box2D shape с entt::entity в userData b2BodyDef хранится
+ *       core::EntityHandle (см. core::EntityHandleTable).
  */
 
 namespace simulation {
 
+class PhysicsLod;
+
 /**
  * @brief Обработчик событий физики Box2D 3.x
  *
@@ -88,6 +93,16 @@ public:
      */
     void processEvents();
 
+    /**
+     * @brief Подключить дальний мир PhysicsLod
+     *
+     * processEvents() дополнительно разбирает события дальнего мира, если он
+     * шагнул с прошлого вызова, и отправляет их через те же сигналы.
+     *
+     * @param lod Менеджер LOD (nullptr — отключить). Должен пережить процессор.
+     */
+    void setLod(const PhysicsLod* lod);
+
     /**
      * @brief Получить доступ к сигналам событий
      *
@@ -119,23 +134,28 @@ public:
 private:
     PhysicsWorld& m_world;          ///< Ссылка на физический мир
     entt::registry& m_registry;     ///< Ссылка на ECS registry
+    core::EntityHandleTable& m_handles;  ///< Хэндлы сущностей из userData тел
     CollisionSignals m_signals;     ///< Сигналы для отправки событий
     float m_hitSpeedThreshold;      ///< Порог скорости для HitEvent
+    const PhysicsLod* m_lod = nullptr;  ///< LOD физики (события дальнего мира)
+    uint64_t m_farStepCount = 0;    ///< Шаг дальнего мира, события которого разобраны
 
     /**
      * @brief Обработать события контактов (touch begin/end)
+     * @param worldId Мир, события которого разбираются
      */
-    void processContactEvents();
+    void processContactEvents(b2WorldId worldId);
 
     /**
      * @brief Обработать события сенсоров (sensor overlap begin/end)
+     * @param worldId Мир, события которого разбираются
      */
-    void processSensorEvents();
+    void processSensorEvents(b2WorldId worldId);
 
     /**
      * @brief Получить entt::entity из Box2D body
      *
-     * Извлекает entity из userData, установленного при создании тела.
+     * Разрешает EntityHandle из userData, установленного при создании тела.
      *
      * @param bodyId ID Box2D тела
      * @return entt::entity или entt::null если не найден
@@ -150,6 +170,11 @@ private:
      */
     entt::entity getEntityFromShape(b2ShapeId shapeId) const;
 
+    /**
+     * @brief Shape относится к CollisionSensorBridge (не триггер физики)
+     */
+    bool isCollisionProxy(b2ShapeId shapeId) const;
+
     /**
      * @brief Конвертировать Box2D точку в пиксельные координаты
      *
@@ -0,0 +1,246 @@
+#pragma once
+
+#include <simulation/PhysicsWorld.h>
+#include <SFML/Graphics/Rect.hpp>
+#include <entt/entt.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @file PhysicsLod.h
+ * @brief Уровни детализации (LOD) физической симуляции
+ *
+ * PhysicsLod снижает стоимость шага физики для удалённых от камеры регионов:
+ * тела вне зон интереса переносятся в отдельный "дальний" Box2D мир, который
+ * шагает реже и с меньшим количеством sub-steps.
+ */
+
+namespace simulation {
+
+class PhysicsSystem;
+
+/**
+ * @brief Параметры LOD физики
+ *
+ * Все размеры указаны в пикселях (как TransformComponent).
+ */
+struct PhysicsLodSettings {
+    bool enabled = true;               ///< Включён ли LOD
+    float regionSize = 512.0f;         ///< Размер квадратного региона сетки (пиксели)
+    float focusMargin = 256.0f;        ///< Гистерезис: запас вокруг зон интереса (пиксели)
+    int farStepDivisor = 4;            ///< Дальний мир шагает раз в N физических тиков
+    int farSubSteps = 1;               ///< Sub-steps дальнего мира
+    int reclassifyInterval = 15;       ///< Период переклассификации тел (в тиках)
+
+    /**
+     * @brief Загрузить параметры из секции physics конфигурации
+     * @return Параметры с дефолтами для отсутствующих ключей
+     */
+    static PhysicsLodSettings fromConfig();
+};
+
+/**
+ * @brief Менеджер LOD физической симуляции
+ *
+ * Делит мир на регулярную сетку регионов. Регион считается "ближним", если он
+ * пересекается хотя бы с одной зоной интереса (видимая область камеры, активные
+ * зоны сценария). Динамические и кинематические тела из дальних регионов
+ * переносятся в дальний мир, который:
+ * - выполняет шаг раз в farStepDivisor тиков с суммарным накопленным dt;
+ * - использует farSubSteps sub-steps вместо DEFAULT_SUB_STEP_COUNT.
+ *
+ * Статические тела, чьи границы (с запасом focusMargin) выходят за ближние
+ * регионы, зеркалируются в дальний мир, поэтому удалённые объекты продолжают
+ * лежать на полу и упираться в стены. Статика целиком внутри ближних регионов
+ * не копируется, а её зеркало удаляется, когда камера к ней подходит.
+ *
+ * **Гарантированный догон:** перед возвратом тела в ближний мир дальний мир
+ * "доплачивает" всё накопленное время, поэтому тело возвращается в актуальном
+ * состоянии, а не с отставанием на несколько тиков.
+ *
+ * **Гистерезис:** ближнее тело уходит в дальний мир только когда его регион
+ * не пересекается с зоной интереса, расширенной на focusMargin. Это исключает
+ * "дребезг" тел на границе видимой области.
+ *
+ * **Граница миров:** ближние и дальние тела находятся в разных Box2D мирах и
+ * друг с другом не сталкиваются. Тело уходит в дальний мир только за пределами
+ * зоны интереса, расширенной на focusMargin, а возвращается, как только его
+ * регион снова в фокусе, поэтому встреча "через границу" возможна лишь вне
+ * видимой области. focusMargin должен превышать размер крупнейшего динамического
+ * тела плюс путь, который оно проходит за reclassifyInterval тиков.
+ *
+ * **События:** контакты и сенсоры дальнего мира доступны после его шага
+ * (см. getFarStepCount()); PhysicsEventProcessor::setLod() подключает их к тем же
+ * сигналам, что и события ближнего мира.
+ *
+ * **Потокобезопасность:** setFocusAreas() можно вызывать из главного потока,
+ * onFixedStep() вызывается PhysicsSystem из потока физики.
+ *
+ * @code
+ * PhysicsLod lod(world, PhysicsLodSettings::fromConfig());
+ * physicsSystem.setLod(&lod);
+ *
+ * // Каждый кадр (главный поток)
+ * lod.setFocusAreas({cameraBounds});
+ * @endcode
+ */
+class PhysicsLod {
+public:
+    /**
+     * @brief Конструктор
+     * @param nearWorld Основной (ближний) физический мир
+     * @param settings Параметры LOD
+     */
+    explicit PhysicsLod(PhysicsWorld& nearWorld, const PhysicsLodSettings& settings = {});
+
+    /**
+     * @brief Деструктор
+     *
+     * Уничтожает дальний мир вместе со всеми его телами.
+     */
+    ~PhysicsLod() = default;
+
+    PhysicsLod(const PhysicsLod&) = delete;
+    PhysicsLod& operator=(const PhysicsLod&) = delete;
+
+    /**
+     * @brief Установить зоны интереса (потокобезопасно)
+     *
+     * @param areas Прямоугольники в пикселях (камера, активные зоны сценария)
+     *
+     * @note Пустой список означает "всё ближнее": при следующей
+     *       переклассификации все тела вернутся в основной мир.
+     */
+    void setFocusAreas(std::vector<sf::FloatRect> areas);
+
+    /**
+     * @brief Обработать один фиксированный шаг физики
+     *
+     * Вызывается PhysicsSystem после каждого шага ближнего мира.
+     * Накапливает время дальнего мира, шагает его раз в farStepDivisor тиков
+     * и периодически переклассифицирует тела.
+     *
+     * @param registry EnTT registry
+     * @param system Система физики (для пересоздания тел)
+     * @param dt Фиксированный timestep ближнего мира (секунды)
+     */
+    void onFixedStep(entt::registry& registry, PhysicsSystem& system, float dt);
+
+    /**
+     * @brief Уведомление об уничтожении тела сущности
+     *
+     * Удаляет зеркало статического тела и вычёркивает сущность из дальнего мира.
+     *
+     * @param entity Сущность, чьё тело уничтожено
+     */
+    void onBodyDestroyed(entt::entity entity);
+
+    /**
+     * @brief Находится ли тело сущности в дальнем мире
+     * @param entity Сущность
+     * @return true если тело симулируется с пониженной детализацией
+     *
+     * @note Вызывать из потока физики (или под мьютексом registry).
+     */
+    bool isFar(entt::entity entity) const;
+
+    /**
+     * @brief Количество тел в дальнем мире (без зеркал статики)
+     */
+    size_t getFarBodyCount() const { return m_farBodyCount.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Количество шагов дальнего мира
+     *
+     * Меняется только когда дальний мир действительно шагнул: его события
+     * действительны до следующего изменения счётчика.
+     */
+    uint64_t getFarStepCount() const { return m_farStepCount; }
+
+    /**
+     * @brief Количество зеркал статических тел в дальнем мире
+     */
+    size_t getStaticMirrorCount() const { return m_staticMirrors.size(); }
+
+    /**
+     * @brief Получить дальний мир (для отладочной отрисовки)
+     */
+    PhysicsWorld& getFarWorld() { return m_farWorld; }
+
+    /**
+     * @brief Получить дальний мир (const, для чтения событий)
+     */
+    const PhysicsWorld& getFarWorld() const { return m_farWorld; }
+
+    /**
+     * @brief Получить параметры LOD
+     */
+    const PhysicsLodSettings& getSettings() const { return m_settings; }
+
+private:
+    /**
+     * @brief Выполнить шаг дальнего мира на всё накопленное время
+     */
+    void flushFarWorld();
+
+    /**
+     * @brief Переклассифицировать тела между ближним и дальним мирами
+     */
+    void reclassify(entt::registry& registry, PhysicsSystem& system);
+
+    /**
+     * @brief Перенести тело сущности в другой мир с сохранением состояния
+     */
+    void migrateBody(entt::registry& registry, PhysicsSystem& system, entt::entity entity,
+                     PhysicsWorld& target);
+
+    /**
+     * @brief Создать зеркало статического тела в дальнем мире (если его ещё нет)
+     */
+    void ensureStaticMirror(entt::registry& registry, PhysicsSystem& system, entt::entity entity);
+
+    /**
+     * @brief Удалить зеркало статического тела (если оно есть)
+     */
+    void releaseStaticMirror(entt::entity entity);
+
+    /**
+     * @brief Лежат ли границы целиком в ближних регионах одной из зон интереса
+     * @param bounds Границы тела в пикселях
+     * @param areas Зоны интереса
+     */
+    bool isBoundsInFocus(const sf::FloatRect& bounds,
+                         const std::vector<sf::FloatRect>& areas) const;
+
+    /**
+     * @brief Пересекается ли регион точки с одной из зон интереса
+     * @param position Позиция в пикселях
+     * @param areas Зоны интереса
+     * @param margin Расширение зон (гистерезис)
+     */
+    bool isRegionInFocus(const sf::Vector2f& position, const std::vector<sf::FloatRect>& areas,
+                         float margin) const;
+
+    PhysicsWorld& m_nearWorld;                                   ///< Основной мир
+    PhysicsLodSettings m_settings;                               ///< Параметры LOD
+    PhysicsWorld m_farWorld;                                     ///< Дальний мир (пониженная детализация)
+
+    std::unordered_set<entt::entity> m_farEntities;              ///< Сущности в дальнем мире
+    std::unordered_map<entt::entity, b2BodyId> m_staticMirrors;  ///< Зеркала статических тел
+    std::atomic<size_t> m_farBodyCount{0};                       ///< Число тел в дальнем мире
+
+    uint64_t m_tickCount = 0;                                    ///< Счётчик тиков ближнего мира
+    uint64_t m_farStepCount = 0;                                 ///< Счётчик шагов дальнего мира
+    float m_farPendingTime = 0.0f;                               ///< Накопленное, но не отшагнутое время
+
+    mutable std::mutex m_focusMutex;                             ///< Защита m_focusAreas
+    std::vector<sf::FloatRect> m_focusAreas;                     ///< Зоны интереса (пиксели)
+    std::vector<sf::FloatRect> m_focusSnapshot;                  ///< Копия зон для потока физики
+};
+
+} // namespace simulation
@@ -3,10 +3,12 @@
 #include <simulation/PhysicsWorld.h>
 #include <simulation/PhysicsTransformBuffer.h>
 #include <simulation/systems/PhysicsSystem.h>
+#include <core/ThreadConfig.h>
 #include <entt/entt.hpp>
 
 #include <thread>
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <condition_variable>
 #include <functional>
@@ -21,6 +23,21 @@
 
 namespace simulation {
 
+/**
+ * @brief Статистика темпа (pacing) потока физики
+ *
+ * Джиттер — отклонение фактического момента начала шага от его
+ * запланированного абсолютного дедлайна.
+ */
+struct PhysicsPacingStats {
+    double lastJitterMs = 0.0;     ///< Джиттер последнего шага (мс)
+    double meanJitterMs = 0.0;     ///< Скользящее среднее джиттера (мс)
+    double maxJitterMs = 0.0;      ///< Максимальный джиттер с момента запуска (мс)
+    uint64_t overrunCount = 0;     ///< Шагов, выполнявшихся дольше периода
+    uint64_t catchUpSteps = 0;     ///< Шагов, выполненных без ожидания (догон расписания)
+    uint64_t droppedTicks = 0;     ///< Тиков, отброшенных при сбросе расписания
+};
+
 /**
  * @brief Поток физической симуляции
  *
@@ -70,6 +87,27 @@ public:
      */
     static constexpr int PHYSICS_PERIOD_MS = 16;
 
+    /**
+     * @brief Максимум шагов догона подряд
+     *
+     * Если поток отстал от расписания больше чем на это количество периодов
+     * (долгий шаг, вытеснение ОС), лишние тики отбрасываются и расписание
+     * сдвигается к текущему моменту — вместо "пулемётной" очереди шагов.
+     */
+    static constexpr int MAX_CATCH_UP_STEPS = 3;
+
+    /**
+     * @brief Окно активного ожидания перед дедлайном по умолчанию
+     *
+     * Поток спит до (дедлайн - окно), а остаток дожидается в цикле, что
+     * скрывает грубую гранулярность sleep в ОС.
+     */
+#ifdef _WIN32
+    static constexpr std::chrono::microseconds DEFAULT_SPIN_WINDOW{2000};
+#else
+    static constexpr std::chrono::microseconds DEFAULT_SPIN_WINDOW{1000};
+#endif
+
     /**
      * @brief Конструктор
      *
@@ -205,6 +243,31 @@ public:
      */
     float getAverageStepTime() const { return m_averageStepTimeMs.load(std::memory_order_relaxed); }
 
+    /**
+     * @brief Получить статистику темпа потока (джиттер, догон, пропуски)
+     *
+     * @return Копия статистики на момент вызова (потокобезопасно)
+     */
+    PhysicsPacingStats getPacingStats() const;
+
+    /**
+     * @brief Установить окно активного ожидания перед дедлайном
+     *
+     * @param window Длительность spin-ожидания (0 — только sleep_until)
+     */
+    void setSpinWindow(std::chrono::microseconds window) {
+        m_spinWindowUs.store(window.count(), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Задать параметры планирования потока (имя, CPU, приоритет)
+     *
+     * Применяются в начале physicsLoop(), поэтому вызывать нужно до start().
+     *
+     * @param config Параметры (обычно ThreadSchedulingConfig::fromConfig("physics", ...))
+     */
+    void setThreadConfig(const core::ThreadSchedulingConfig& config) { m_threadConfig = config; }
+
     /**
      * @brief Установить callback для обработки исключений в потоке
      *
@@ -277,11 +340,20 @@ private:
     /**
      * @brief Основной цикл физического потока
      *
-     * Выполняется в отдельном потоке. Использует fixed timestep (60 Hz)
-     * с компенсацией времени сна для точного тайминга.
+     * Выполняется в отдельном потоке. Шаги привязаны к абсолютному расписанию
+     * на steady_clock (дедлайн k = старт + k * период), поэтому ошибки сна не
+     * накапливаются. Ожидание: sleep_until до (дедлайн - окно), затем spin.
+     * Отставание догоняется не более чем MAX_CATCH_UP_STEPS шагами подряд.
      */
     void physicsLoop();
 
+    /**
+     * @brief Дождаться абсолютного дедлайна (sleep_until + spin)
+     *
+     * @param deadline Момент, к которому нужно проснуться
+     */
+    void waitUntil(std::chrono::steady_clock::time_point deadline) const;
+
     /**
      * @brief Выполнить один шаг физики
      *
@@ -310,6 +382,11 @@ private:
 
     std::atomic<uint64_t> m_stepCount{0};       ///< Счётчик шагов
     std::atomic<float> m_averageStepTimeMs{0.0f}; ///< Среднее время шага (мс)
+    std::atomic<int64_t> m_spinWindowUs{DEFAULT_SPIN_WINDOW.count()}; ///< Окно spin-ожидания (мкс)
+    core::ThreadSchedulingConfig m_threadConfig{"opc-physics"}; ///< Параметры планирования потока
+
+    PhysicsPacingStats m_pacingStats;           ///< Статистика темпа
+    mutable std::mutex m_pacingStatsMutex;      ///< Мьютекс статистики темпа
 
     std::function<void(const std::exception&)> m_exceptionHandler; ///< Обработчик исключений
     std::mutex m_exceptionHandlerMutex;         ///< Мьютекс для обработчика
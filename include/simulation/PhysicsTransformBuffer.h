@@ -1,12 +1,13 @@
 #pragma once
 
 #include <core/Components.h>
+#include <core/EntityHandleTable.h>
 #include <entt/entt.hpp>
 
 #include <mutex>
 #include <atomic>
+#include <cstdint>
 #include <vector>
-#include <unordered_map>
 
 /**
  * @file PhysicsTransformBuffer.h
@@ -57,12 +58,18 @@ struct BufferedTransform {
  * - **Буфер чтения (read buffer)**: главный поток читает позиции для рендеринга
  * - **Swap**: атомарная смена буферов при синхронизации
  *
+ * Записи адресуются core::EntityHandle, а не entt::entity: если сущность
+ * удалена (и её идентификатор переиспользован) между записью и применением,
+ * applyToRegistry() пропустит устаревшую запись. Каждый буфер — плотный
+ * массив записей плюс массив позиций по индексу хэндла, без хэш-таблиц.
+ *
  * **Использование:**
  * @code
  * PhysicsTransformBuffer buffer;
  *
- * // В потоке физики (после каждого шага):
- * buffer.writeTransform(entity, x, y, rotation);
+ * // В потоке физики (после каждого шага); хэндл выдан главным потоком
+ * // при создании тела (RigidbodyComponent::handle)
+ * buffer.writeTransform(rigidbody.handle, x, y, rotation);
  *
  * // В главном потоке (перед рендерингом):
  * buffer.swapBuffers();
@@ -85,23 +92,24 @@ public:
      * @brief Записать трансформацию в буфер записи
      *
      * Вызывается из потока физики после обновления позиции тела.
+     * Повторная запись того же хэндла до swapBuffers() перезаписывает данные.
      *
-     * @param entity Сущность
+     * @param handle Хэндл сущности
      * @param x Позиция X в пикселях
      * @param y Позиция Y в пикселях
      * @param rotation Угол поворота в градусах
      *
      * @note Потокобезопасно относительно swapBuffers() (разные буферы).
      */
-    void writeTransform(entt::entity entity, float x, float y, float rotation);
+    void writeTransform(core::EntityHandle handle, float x, float y, float rotation);
 
     /**
      * @brief Записать трансформацию из TransformComponent
      *
-     * @param entity Сущность
+     * @param handle Хэндл сущности
      * @param transform Компонент трансформации
      */
-    void writeTransform(entt::entity entity, const core::TransformComponent& transform);
+    void writeTransform(core::EntityHandle handle, const core::TransformComponent& transform);
 
     /**
      * @brief Поменять буферы местами
@@ -117,6 +125,8 @@ public:
      * @brief Применить буфер чтения к registry
      *
      * Обновляет TransformComponent всех сущностей из буфера чтения.
+     * Хэндлы разрешаются через core::EntityHandleTable::of(registry);
+     * записи удалённых сущностей пропускаются.
      * Вызывается из главного потока после swapBuffers().
      *
      * @param registry EnTT registry
@@ -137,9 +147,9 @@ public:
      *
      * Вызывается при удалении физического тела.
      *
-     * @param entity Сущность для удаления
+     * @param handle Хэндл сущности
      */
-    void removeEntity(entt::entity entity);
+    void removeEntity(core::EntityHandle handle);
 
     /**
      * @brief Получить количество записей в буфере записи
@@ -165,13 +175,29 @@ public:
     void reserve(size_t capacity);
 
 private:
-    using TransformMap = std::unordered_map<entt::entity, BufferedTransform>;
+    static constexpr uint32_t NO_POSITION = UINT32_MAX;  ///< Хэндла нет в буфере
+
+    /// Запись буфера
+    struct Record {
+        core::EntityHandle handle;      ///< Хэндл сущности
+        BufferedTransform transform;    ///< Трансформация
+    };
+
+    /// Буфер трансформаций: плотные записи + позиции по индексу хэндла
+    struct TransformBuffer {
+        std::vector<Record> records;        ///< Записи в порядке добавления
+        std::vector<uint32_t> positions;    ///< Индекс хэндла -> позиция в records
+
+        void write(core::EntityHandle handle, const BufferedTransform& transform);
+        void remove(core::EntityHandle handle);
+        void clear();
+    };
 
-    TransformMap m_bufferA;     ///< Буфер A
-    TransformMap m_bufferB;     ///< Буфер B
+    TransformBuffer m_bufferA;  ///< Буфер A
+    TransformBuffer m_bufferB;  ///< Буфер B
 
-    TransformMap* m_writeBuffer = &m_bufferA;   ///< Текущий буфер записи
-    TransformMap* m_readBuffer = &m_bufferB;    ///< Текущий буфер чтения
+    TransformBuffer* m_writeBuffer = &m_bufferA;    ///< Текущий буфер записи
+    TransformBuffer* m_readBuffer = &m_bufferB;     ///< Текущий буфер чтения
 
     mutable std::mutex m_swapMutex;             ///< Мьютекс для swap операции
 };
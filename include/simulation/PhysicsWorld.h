@@ -34,12 +34,22 @@ public:
      */
     static constexpr float PIXELS_PER_METER = 32.0f;
 
+    /**
+     * @brief Количество sub-steps на один шаг симуляции по умолчанию
+     *
+     * Большее значение = более точная симуляция, но медленнее.
+     * Box2D 3.x использует sub-stepping вместо итераций velocity/position.
+     * Рекомендуемое значение: 4.
+     */
+    static constexpr int DEFAULT_SUB_STEP_COUNT = 4;
+
     /**
      * @brief Конструктор с указанием гравитации
      *
      * Создаёт новый Box2D мир с заданным вектором гравитации.
      *
      * @param gravity Вектор гравитации в м/с² (по умолчанию: 0, 9.8 - земная гравитация вниз)
+     * @param subStepCount Количество sub-steps на шаг (по умолчанию DEFAULT_SUB_STEP_COUNT)
      *
      * @code
      * // Создать мир с земной гравитацией
@@ -49,7 +59,8 @@ public:
      * PhysicsWorld world(b2Vec2{0.0f, 0.0f});
      * @endcode
      */
-    explicit PhysicsWorld(const b2Vec2& gravity = b2Vec2{0.0f, 9.8f});
+    explicit PhysicsWorld(const b2Vec2& gravity = b2Vec2{0.0f, 9.8f},
+                          int subStepCount = DEFAULT_SUB_STEP_COUNT);
 
     /**
      * @brief Деструктор
@@ -113,6 +124,22 @@ public:
      */
     b2Vec2 getGravity() const;
 
+    /**
+     * @brief Установить количество sub-steps на шаг
+     *
+     * Используется PhysicsLod для "дальнего" мира: меньше sub-steps —
+     * дешевле шаг ценой точности контактов.
+     *
+     * @param subStepCount Количество sub-steps (минимум 1)
+     */
+    void setSubStepCount(int subStepCount);
+
+    /**
+     * @brief Получить количество sub-steps на шаг
+     * @return Текущее количество sub-steps
+     */
+    int getSubStepCount() const { return m_subStepCount; }
+
     /**
      * @brief Получить ID Box2D мира
      *
@@ -180,15 +207,7 @@ public:
 
 private:
     b2WorldId m_worldId;   ///< ID Box2D физического мира
-
-    /**
-     * @brief Количество sub-steps на один шаг симуляции
-     *
-     * Большее значение = более точная симуляция, но медленнее.
-     * Box2D 3.x использует sub-stepping вместо итераций velocity/position.
-     * Рекомендуемое значение: 4.
-     */
-    static constexpr int SUB_STEP_COUNT = 4;
+    int m_subStepCount;    ///< Количество sub-steps на один шаг симуляции
 };
 
 } // namespace simulation
@@ -16,7 +16,8 @@
  * События собираются после каждого шага симуляции и обрабатываются
  * через boost::signals2.
  *
- * @note Используйте b2Shape_GetUserData() для получения entt::entity из Box2D.
+ * @note userData тела Box2D содержит core::EntityHandle — используйте
+ *       core::EntityHandleTable::resolve() для получения entt::entity.
  */
 
 namespace simulation {
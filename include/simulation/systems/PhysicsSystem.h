@@ -3,6 +3,7 @@
 #include <core/systems/ISystem.h>
 #include <simulation/PhysicsWorld.h>
 #include <entt/entt.hpp>
+#include <vector>
 
 /**
  * @file PhysicsSystem.h
@@ -16,6 +17,27 @@
 
 namespace simulation {
 
+class PhysicsLod;
+
+/**
+ * @brief Слушатель фиксированных шагов физики
+ *
+ * onPhysicsStep() вызывается после каждого b2World_Step() в потоке, который
+ * шагает мир (PhysicsThread или главный поток в fallback-режиме), пока
+ * события Box2D этого шага ещё доступны. Registry защищён тем же мьютексом,
+ * что и шаг физики.
+ */
+class IPhysicsStepListener {
+public:
+    virtual ~IPhysicsStepListener() = default;
+
+    /**
+     * @param registry EnTT registry
+     * @param dt Длительность шага (секунды)
+     */
+    virtual void onPhysicsStep(entt::registry& registry, float dt) = 0;
+};
+
 /**
  * @brief Система интеграции ECS с Box2D физическим движком
  *
@@ -145,6 +167,25 @@ public:
      */
     void createBody(entt::registry& registry, entt::entity entity);
 
+    /**
+     * @brief Начать пакетное создание тел
+     *
+     * До парного endBodyBatch() createBody() (в том числе из on_construct)
+     * только запоминает сущность. Так массовая вставка колонок компонентов
+     * (клонирование, вставка из буфера обмена) не зависит от порядка
+     * вставки Rigidbody/Collider/Transform, а тела создаются одним проходом.
+     * Вызовы могут быть вложенными.
+     */
+    void beginBodyBatch() { ++m_bodyBatchDepth; }
+
+    /**
+     * @brief Завершить пакет и создать отложенные тела
+     *
+     * @param registry EnTT registry
+     * @return Количество созданных тел (0 для вложенного вызова)
+     */
+    size_t endBodyBatch(entt::registry& registry);
+
     /**
      * @brief Удалить Box2D тело для сущности
      *
@@ -157,9 +198,54 @@ public:
      */
     void destroyBody(entt::registry& registry, entt::entity entity);
 
+    /**
+     * @brief Создать Box2D тело сущности в указанном мире
+     *
+     * В отличие от createBody() не сохраняет ID в RigidbodyComponent —
+     * используется PhysicsLod для переноса тел между мирами и зеркалирования статики.
+     * userData тела — RigidbodyComponent::handle (выдаётся в createBody()),
+     * поэтому функцию можно вызывать из потока физики.
+     *
+     * @param registry EnTT registry
+     * @param entity Сущность (требуются Transform, Rigidbody, Collider)
+     * @param world Мир, в котором создаётся тело
+     * @return ID созданного тела или b2_nullBodyId при ошибке
+     */
+    b2BodyId createBodyInWorld(entt::registry& registry, entt::entity entity, PhysicsWorld& world);
+
+    /**
+     * @brief Подключить LOD физики
+     *
+     * @param lod Менеджер LOD (nullptr — отключить). Должен пережить систему.
+     */
+    void setLod(PhysicsLod* lod) { m_lod = lod; }
+
+    /**
+     * @brief Получить подключённый LOD физики
+     * @return Указатель на PhysicsLod или nullptr
+     */
+    PhysicsLod* getLod() const { return m_lod; }
+
+    /**
+     * @brief Подписать слушателя на фиксированные шаги физики
+     *
+     * @param listener Слушатель (должен пережить систему или отписаться раньше)
+     * @note Вызывать до запуска PhysicsThread.
+     */
+    void addStepListener(IPhysicsStepListener* listener);
+
+    /**
+     * @brief Отписать слушателя
+     */
+    void removeStepListener(IPhysicsStepListener* listener);
+
 private:
     PhysicsWorld& m_physicsWorld;   ///< Ссылка на PhysicsWorld
     float m_accumulator = 0.0f;     ///< Накопитель времени для fixed timestep
+    PhysicsLod* m_lod = nullptr;    ///< LOD физики (опционально)
+    std::vector<IPhysicsStepListener*> m_stepListeners;  ///< Слушатели шагов
+    int m_bodyBatchDepth = 0;                    ///< Глубина beginBodyBatch()
+    std::vector<entt::entity> m_pendingBodies;   ///< Тела, отложенные до endBodyBatch()
 
     /**
      * @brief Создать b2ShapeDef из ColliderComponent
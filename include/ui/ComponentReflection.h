@@ -0,0 +1,225 @@
+#pragma once
+
+#include <core/StringId.h>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <entt/entt.hpp>
+
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file ComponentReflection.h
+ * @brief Описание полей компонентов для генерации редакторов инспектора
+ */
+
+namespace ui {
+
+/**
+ * @brief Тип поля, определяющий виджет редактора
+ */
+enum class FieldKind {
+    Float,      ///< float — DragFloat
+    Int,        ///< int — DragInt
+    Bool,       ///< bool — Checkbox
+    String,     ///< std::string — InputText
+    StringId,   ///< core::StringId — только чтение (интернированная строка)
+    Color,      ///< sf::Color — ColorEdit4
+    FloatRect,  ///< sf::FloatRect — позиция и размер
+    Entity      ///< entt::entity — только чтение
+};
+
+/**
+ * @brief Описание одного поля компонента
+ */
+struct FieldDescriptor {
+    const char* name = "";                    ///< Подпись в инспекторе
+    FieldKind kind = FieldKind::Float;        ///< Тип поля
+    void* (*access)(void* component) = nullptr;  ///< Адрес поля в компоненте
+    float speed = 1.0f;                       ///< Шаг перетаскивания (Float/Int/FloatRect)
+    bool readOnly = false;                    ///< Только отображение
+};
+
+/**
+ * @brief Редактор компонента: поля и типизированные операции над registry
+ *
+ * Все функции генерируются один раз при регистрации типа; в кадре
+ * инспектор только проходит по готовому списку полей.
+ */
+struct ComponentDescriptor {
+    const char* name = "";                    ///< Имя компонента
+    entt::id_type typeId = 0;                 ///< entt::type_hash<T> (совпадает с id хранилища)
+    std::vector<FieldDescriptor> fields;      ///< Поля в порядке регистрации
+
+    void* (*tryGet)(entt::registry&, entt::entity) = nullptr;  ///< registry.try_get<T>
+    void (*notifyChanged)(entt::registry&, entt::entity) = nullptr;  ///< registry.patch<T> (on_update)
+};
+
+namespace detail {
+
+template<typename>
+struct MemberPointerTraits;
+
+template<typename Class, typename Member>
+struct MemberPointerTraits<Member Class::*> {
+    using ClassType = Class;
+    using MemberType = Member;
+};
+
+template<typename T>
+constexpr FieldKind fieldKindOf() {
+    if constexpr (std::is_same_v<T, float>) {
+        return FieldKind::Float;
+    } else if constexpr (std::is_same_v<T, int>) {
+        return FieldKind::Int;
+    } else if constexpr (std::is_same_v<T, bool>) {
+        return FieldKind::Bool;
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        return FieldKind::String;
+    } else if constexpr (std::is_same_v<T, core::StringId>) {
+        return FieldKind::StringId;
+    } else if constexpr (std::is_same_v<T, sf::Color>) {
+        return FieldKind::Color;
+    } else if constexpr (std::is_same_v<T, sf::FloatRect>) {
+        return FieldKind::FloatRect;
+    } else if constexpr (std::is_same_v<T, entt::entity>) {
+        return FieldKind::Entity;
+    } else {
+        static_assert(!sizeof(T), "Unsupported field type for ComponentReflection");
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Реестр описаний компонентов для инспектора
+ *
+ * Лёгкая статическая рефлексия: поля задаются указателями на члены
+ * (параметры шаблона), из них один раз генерируются функции доступа.
+ * Тип поля выводится при компиляции, неподдерживаемый тип — ошибка сборки.
+ *
+ * @code
+ * ComponentReflection reflection;
+ * reflection.reflect<TransformComponent>("Transform")
+ *     .field<&TransformComponent::x>("X")
+ *     .field<&TransformComponent::rotation>("Rotation", 0.5f);
+ *
+ * for (const auto& component : reflection.components()) {
+ *     if (void* data = component.tryGet(registry, entity)) { ... }
+ * }
+ * @endcode
+ *
+ * Изменения через инспектор фиксируются notifyChanged() (registry.patch),
+ * поэтому индексы на сигналах on_update (EntityIndex и др.) остаются
+ * согласованными.
+ */
+class ComponentReflection {
+public:
+    /**
+     * @brief Построитель описания компонента T
+     */
+    template<typename T>
+    class Builder {
+    public:
+        Builder(ComponentReflection& reflection, size_t index)
+            : m_reflection(reflection), m_index(index) {}
+
+        /**
+         * @brief Редактируемое поле
+         *
+         * @tparam Member Указатель на член T
+         * @param name Подпись (строка должна жить дольше реестра)
+         * @param speed Шаг перетаскивания для числовых полей
+         */
+        template<auto Member>
+        Builder& field(const char* name, float speed = 1.0f) {
+            return add<Member>(name, speed, false);
+        }
+
+        /**
+         * @brief Поле только для чтения
+         */
+        template<auto Member>
+        Builder& readOnly(const char* name) {
+            return add<Member>(name, 1.0f, true);
+        }
+
+    private:
+        template<auto Member>
+        Builder& add(const char* name, float speed, bool readOnly) {
+            using Traits = detail::MemberPointerTraits<decltype(Member)>;
+            static_assert(std::is_same_v<typename Traits::ClassType, T>,
+                          "Field must be a member of the reflected component");
+            constexpr FieldKind kind = detail::fieldKindOf<typename Traits::MemberType>();
+
+            FieldDescriptor field;
+            field.name = name;
+            field.kind = kind;
+            field.access = +[](void* component) -> void* {
+                return &(static_cast<T*>(component)->*Member);
+            };
+            field.speed = speed;
+            // Сущности и интернированные строки не редактируются напрямую
+            field.readOnly = readOnly || kind == FieldKind::Entity || kind == FieldKind::StringId;
+
+            m_reflection.m_components[m_index].fields.push_back(field);
+            return *this;
+        }
+
+        ComponentReflection& m_reflection;  ///< Реестр
+        size_t m_index;                     ///< Индекс описания в реестре
+    };
+
+    /**
+     * @brief Зарегистрировать (или дополнить) описание компонента T
+     *
+     * @param name Имя для заголовка инспектора (строка должна жить дольше реестра)
+     */
+    template<typename T>
+    Builder<T> reflect(const char* name) {
+        const entt::id_type typeId = entt::type_hash<T>::value();
+        auto [it, inserted] = m_byType.try_emplace(typeId, m_components.size());
+        if (inserted) {
+            ComponentDescriptor descriptor;
+            descriptor.name = name;
+            descriptor.typeId = typeId;
+            descriptor.tryGet = +[](entt::registry& registry, entt::entity entity) -> void* {
+                return registry.try_get<T>(entity);
+            };
+            descriptor.notifyChanged = +[](entt::registry& registry, entt::entity entity) {
+                registry.patch<T>(entity);
+            };
+            m_components.push_back(std::move(descriptor));
+        }
+        return Builder<T>(*this, it->second);
+    }
+
+    /**
+     * @brief Описание компонента по id типа (id хранилища в registry)
+     * @return nullptr если тип не зарегистрирован
+     */
+    const ComponentDescriptor* find(entt::id_type typeId) const;
+
+    template<typename T>
+    const ComponentDescriptor* find() const {
+        return find(entt::type_hash<T>::value());
+    }
+
+    /**
+     * @brief Все описания в порядке регистрации
+     */
+    const std::vector<ComponentDescriptor>& components() const { return m_components; }
+
+    /**
+     * @brief Зарегистрировать компоненты core (Transform, Sprite, Name, ...)
+     */
+    void registerCoreComponents();
+
+private:
+    std::vector<ComponentDescriptor> m_components;             ///< Описания
+    std::unordered_map<entt::id_type, size_t> m_byType;        ///< id типа -> индекс
+};
+
+} // namespace ui
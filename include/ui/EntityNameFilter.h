@@ -0,0 +1,136 @@
+#pragma once
+
+#include <ui/SceneTreeCache.h>
+#include <entt/entt.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+/**
+ * @file EntityNameFilter.h
+ * @brief Фоновый фильтр сущностей по имени для панели иерархии
+ */
+
+namespace ui {
+
+/**
+ * @brief Поиск подстроки в именах сущностей в отдельном потоке
+ *
+ * Главный поток отправляет запрос (строку и снимок имён SceneTreeCache) и
+ * каждый кадр опрашивает poll(). Снимок неизменяемый и разделяемый, поэтому
+ * поток не обращается к registry и не требует блокировок сцены.
+ *
+ * Выполняется только последний запрос: если пользователь продолжает печатать,
+ * текущий проход прерывается и начинается новый — устаревшие результаты
+ * не доставляются.
+ *
+ * @code
+ * EntityNameFilter filter;
+ * filter.start();
+ *
+ * if (queryChanged) filter.request(query, tree.nameSnapshot());
+ * if (auto result = filter.poll()) tree.setFilter(result->matches);
+ * @endcode
+ */
+class EntityNameFilter {
+public:
+    /**
+     * @brief Результат фильтрации
+     */
+    struct Result {
+        uint64_t requestId = 0;              ///< Идентификатор запроса (из request())
+        std::string query;                   ///< Строка запроса
+        std::vector<entt::entity> matches;   ///< Совпавшие сущности
+    };
+
+    /// Интервал проверки отмены (записей снимка)
+    static constexpr size_t CANCEL_CHECK_INTERVAL = 1024;
+
+    EntityNameFilter() = default;
+
+    /**
+     * @brief Останавливает поток, если он запущен
+     */
+    ~EntityNameFilter();
+
+    EntityNameFilter(const EntityNameFilter&) = delete;
+    EntityNameFilter& operator=(const EntityNameFilter&) = delete;
+
+    /**
+     * @brief Запустить поток фильтра (настройки threads.worker*)
+     * @return true если поток запущен (или уже работал)
+     */
+    bool start();
+
+    /**
+     * @brief Остановить поток (текущий проход прерывается)
+     */
+    void stop();
+
+    /**
+     * @brief Запущен ли поток
+     */
+    bool isRunning() const { return m_running.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Отправить запрос (заменяет ещё не выполненный)
+     *
+     * @param query Подстрока (регистр ASCII не учитывается)
+     * @param names Снимок имён (SceneTreeCache::nameSnapshot())
+     * @return Идентификатор запроса
+     */
+    uint64_t request(std::string query, EntityNameSnapshot names);
+
+    /**
+     * @brief Забрать результат последнего запроса, если он готов
+     */
+    std::optional<Result> poll();
+
+    /**
+     * @brief Выполняется или ожидает ли запрос
+     */
+    bool isBusy() const;
+
+    /**
+     * @brief Совпадает ли имя с запросом
+     *
+     * @param name Имя сущности
+     * @param loweredQuery Запрос в нижнем регистре (ASCII)
+     */
+    static bool matches(std::string_view name, std::string_view loweredQuery);
+
+    /**
+     * @brief Синхронная фильтрация (в потоке вызывающего)
+     */
+    static std::vector<entt::entity> filter(const std::vector<EntityNameEntry>& names,
+                                            std::string_view query);
+
+private:
+    /// Ожидающий запрос
+    struct Request {
+        uint64_t id = 0;
+        std::string query;
+        EntityNameSnapshot names;
+    };
+
+    void workerLoop();
+
+    std::thread m_thread;                           ///< Поток фильтра
+    std::atomic<bool> m_running{false};             ///< Флаг работы потока
+    std::atomic<uint64_t> m_latestRequest{0};       ///< Последний отправленный запрос
+
+    mutable std::mutex m_mutex;                     ///< Защищает поля ниже
+    std::condition_variable m_condition;            ///< Пробуждение потока
+    std::optional<Request> m_pending;               ///< Запрос, ещё не взятый потоком
+    std::optional<Result> m_result;                 ///< Готовый результат
+    bool m_working = false;                         ///< Поток выполняет запрос
+};
+
+} // namespace ui
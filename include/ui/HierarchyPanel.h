@@ -0,0 +1,72 @@
+#pragma once
+
+#include <ui/EntityNameFilter.h>
+#include <ui/SceneTreeCache.h>
+#include <entt/entt.hpp>
+
+#include <cstdint>
+#include <string>
+
+/**
+ * @file HierarchyPanel.h
+ * @brief Панель иерархии сцены (ImGui)
+ */
+
+namespace ui {
+
+/**
+ * @brief Виртуализированная панель иерархии сцены
+ *
+ * Рисует строки SceneTreeCache::rows() через ImGuiListClipper: в кадре
+ * создаются виджеты только для видимых на экране строк, а имена читаются
+ * из registry только для них. Фильтр по имени выполняется в EntityNameFilter
+ * (фоновый поток); пока результат не готов, показывается прежний список.
+ */
+class HierarchyPanel {
+public:
+    /// Интервал повторной фильтрации при изменении имён (секунды)
+    static constexpr double REFILTER_INTERVAL = 0.5;
+
+    /**
+     * @brief Конструктор
+     *
+     * @param tree Кэш дерева (должен пережить панель)
+     * @param filter Фоновый фильтр (должен пережить панель)
+     */
+    HierarchyPanel(SceneTreeCache& tree, EntityNameFilter& filter);
+
+    /**
+     * @brief Нарисовать окно панели (между ImGui::NewFrame() и ImGui::Render())
+     *
+     * @param registry EnTT registry
+     * @param open Флаг видимости окна (кнопка закрытия), может быть nullptr
+     */
+    void draw(entt::registry& registry, bool* open = nullptr);
+
+    /**
+     * @brief Выбранная сущность (entt::null — нет выбора)
+     */
+    entt::entity getSelected() const { return m_selected; }
+
+    /**
+     * @brief Выбрать сущность (раскрывает предков и прокручивает к ней)
+     */
+    void setSelected(entt::entity entity);
+
+private:
+    void drawFilter();
+    void drawRow(entt::registry& registry, const SceneTreeCache::Row& row);
+
+    SceneTreeCache& m_tree;            ///< Кэш дерева
+    EntityNameFilter& m_filter;        ///< Фоновый фильтр
+
+    std::string m_query;               ///< Строка фильтра
+    uint64_t m_pendingRequest = 0;     ///< Ожидаемый запрос фильтра (0 — нет)
+    EntityNameSnapshot m_filteredNames;  ///< Снимок, по которому получен текущий фильтр
+    double m_lastFilterTime = 0.0;     ///< Время последнего запроса (ImGui::GetTime)
+
+    entt::entity m_selected = entt::null;  ///< Выбранная сущность
+    bool m_scrollToSelected = false;   ///< Прокрутить к выбранной в следующем кадре
+};
+
+} // namespace ui
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <ui/ComponentReflection.h>
+#include <entt/entt.hpp>
+
+/**
+ * @file InspectorPanel.h
+ * @brief Инспектор компонентов сущности (ImGui)
+ */
+
+namespace ui {
+
+/**
+ * @brief Инспектор компонентов выбранной сущности
+ *
+ * Редакторы берутся из ComponentReflection (сгенерированы один раз на тип),
+ * поэтому кадр инспектора — это проход по полям одной сущности, независимо
+ * от размера сцены. Компоненты без описания выводятся списком имён типов.
+ *
+ * Изменённый компонент фиксируется через registry.patch() один раз за кадр,
+ * только если какое-то поле действительно изменилось.
+ */
+class InspectorPanel {
+public:
+    /**
+     * @brief Конструктор
+     * @param reflection Описания компонентов (должны пережить панель)
+     */
+    explicit InspectorPanel(const ComponentReflection& reflection);
+
+    /**
+     * @brief Нарисовать окно инспектора
+     *
+     * @param registry EnTT registry
+     * @param entity Выбранная сущность (entt::null — пустой инспектор)
+     * @param open Флаг видимости окна, может быть nullptr
+     */
+    void draw(entt::registry& registry, entt::entity entity, bool* open = nullptr);
+
+private:
+    /**
+     * @brief Нарисовать виджет поля
+     * @return true если значение изменено
+     */
+    bool drawField(const FieldDescriptor& field, void* component);
+
+    const ComponentReflection& m_reflection;  ///< Описания компонентов
+};
+
+} // namespace ui
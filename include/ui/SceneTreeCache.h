@@ -0,0 +1,229 @@
+#pragma once
+
+#include <entt/entt.hpp>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @file SceneTreeCache.h
+ * @brief Кэш иерархии сцены для виртуализированной панели ImGui
+ */
+
+namespace ui {
+
+/**
+ * @brief Имя сущности в снимке для фонового фильтра
+ */
+struct EntityNameEntry {
+    entt::entity entity = entt::null;  ///< Сущность
+    std::string name;                  ///< Имя (NameComponent) на момент снимка
+};
+
+/// Неизменяемый снимок имён: передаётся в поток фильтра без копирования
+using EntityNameSnapshot = std::shared_ptr<const std::vector<EntityNameEntry>>;
+
+/**
+ * @brief Инкрементально поддерживаемое дерево сущностей
+ *
+ * Дерево строится по ParentComponent (ChildrenComponent — его зеркало) и
+ * обновляется через сигналы EnTT, а не обходом registry каждый кадр:
+ * - создание сущности — новый корень;
+ * - ParentComponent (construct/update/destroy) — перенос узла;
+ * - удаление сущности — её дети становятся корнями.
+ *
+ * Панель рисует плоский список видимых строк rows() через ImGuiListClipper,
+ * поэтому стоимость кадра пропорциональна числу строк на экране. Сам список
+ * перестраивается лениво и только когда изменилась видимая часть дерева:
+ * изменения внутри свёрнутых узлов его не трогают.
+ *
+ * Узлы хранятся в векторе по индексу сущности (entt::to_entity), поиск без
+ * хеширования. Порядок детей не сохраняется (удаление — swap-and-pop).
+ *
+ * @code
+ * SceneTreeCache tree;
+ * tree.init(registry);
+ *
+ * const auto& rows = tree.rows();
+ * ImGuiListClipper clipper;
+ * clipper.Begin(static_cast<int>(rows.size()));
+ * while (clipper.Step()) { ... rows[i] ... }
+ * @endcode
+ *
+ * @note Только главный поток (там же, где меняется registry).
+ */
+class SceneTreeCache {
+public:
+    /**
+     * @brief Видимая строка иерархии
+     */
+    struct Row {
+        entt::entity entity = entt::null;  ///< Сущность
+        uint32_t depth = 0;                ///< Глубина вложенности (0 — корень)
+        bool hasChildren = false;          ///< Есть ли дочерние сущности
+        bool expanded = false;             ///< Раскрыт ли узел (в режиме фильтра — всегда)
+    };
+
+    SceneTreeCache() = default;
+
+    /**
+     * @brief Отключается от сигналов registry (если был подключен)
+     */
+    ~SceneTreeCache();
+
+    SceneTreeCache(const SceneTreeCache&) = delete;
+    SceneTreeCache& operator=(const SceneTreeCache&) = delete;
+
+    /**
+     * @brief Построить дерево по существующим сущностям и подписаться на сигналы
+     *
+     * Registry должен жить дольше кэша (или вызвать shutdown() раньше).
+     *
+     * @param registry EnTT registry
+     */
+    void init(entt::registry& registry);
+
+    /**
+     * @brief Отписаться от сигналов registry и очистить дерево
+     */
+    void shutdown();
+
+    /**
+     * @brief Видимые строки (перестраиваются, если дерево изменилось)
+     *
+     * Ссылка действительна до следующего изменения registry или состояния узлов.
+     */
+    const std::vector<Row>& rows();
+
+    /**
+     * @brief Раскрыть/свернуть узел
+     */
+    void setExpanded(entt::entity entity, bool expanded);
+
+    /**
+     * @brief Раскрыт ли узел
+     */
+    bool isExpanded(entt::entity entity) const;
+
+    /**
+     * @brief Раскрыть всех предков, чтобы сущность попала в rows()
+     */
+    void expandTo(entt::entity entity);
+
+    /**
+     * @brief Показывать только совпадения фильтра и их предков
+     *
+     * @param matches Совпавшие сущности (результат EntityNameFilter)
+     */
+    void setFilter(std::span<const entt::entity> matches);
+
+    /**
+     * @brief Снять фильтр
+     */
+    void clearFilter();
+
+    /**
+     * @brief Включён ли фильтр
+     */
+    bool hasFilter() const { return m_filterActive; }
+
+    /**
+     * @brief Снимок имён для фонового фильтра
+     *
+     * Пересобирается только после изменения NameComponent или набора сущностей;
+     * иначе возвращается тот же снимок.
+     */
+    EntityNameSnapshot nameSnapshot();
+
+    /**
+     * @brief Родитель сущности в дереве
+     * @return entt::null для корня или неизвестной сущности
+     */
+    entt::entity parentOf(entt::entity entity) const;
+
+    /**
+     * @brief Дети сущности в дереве
+     */
+    std::span<const entt::entity> childrenOf(entt::entity entity) const;
+
+    /**
+     * @brief Корневые сущности
+     */
+    std::span<const entt::entity> roots() const { return m_roots; }
+
+    /**
+     * @brief Есть ли сущность в дереве
+     */
+    bool contains(entt::entity entity) const { return findNode(entity) != nullptr; }
+
+    /**
+     * @brief Количество сущностей в дереве
+     */
+    size_t getNodeCount() const { return m_nodeCount; }
+
+    /**
+     * @brief Сколько раз перестраивался список строк (для отладки и тестов)
+     */
+    uint64_t getRowsRebuildCount() const { return m_rowsRebuildCount; }
+
+private:
+    static constexpr uint32_t NO_POSITION = UINT32_MAX;  ///< Узел не в дереве
+
+    /// Узел дерева (индекс в m_nodes — entt::to_entity)
+    struct Node {
+        entt::entity entity = entt::null;    ///< Сущность (с версией) или null для пустого слота
+        entt::entity parent = entt::null;    ///< Родитель (null — корень)
+        uint32_t position = NO_POSITION;     ///< Позиция в children родителя или в m_roots
+        std::vector<entt::entity> children;  ///< Дочерние сущности
+        bool expanded = false;               ///< Раскрыт пользователем
+    };
+
+    void onEntityCreated(entt::registry& registry, entt::entity entity);
+    void onEntityDestroyed(entt::registry& registry, entt::entity entity);
+    void onParentChanged(entt::registry& registry, entt::entity entity);
+    void onParentDestroyed(entt::registry& registry, entt::entity entity);
+    void onNameChanged(entt::registry& registry, entt::entity entity);
+
+    Node* findNode(entt::entity entity);
+    const Node* findNode(entt::entity entity) const;
+
+    void addNode(entt::entity entity);
+    void removeNode(entt::entity entity);
+
+    /**
+     * @brief Перенести узел к новому родителю (null или цикл — в корни)
+     */
+    void setParent(entt::entity entity, entt::entity parent);
+
+    void attach(Node& node, entt::entity parent);
+    void detach(Node& node);
+
+    /**
+     * @brief Отметить rows() устаревшим, если узел виден (все предки раскрыты)
+     */
+    void invalidateRowsAt(entt::entity parent);
+
+    void rebuildRows();
+
+    entt::registry* m_registry = nullptr;      ///< Registry, к сигналам которого подключены
+    std::vector<Node> m_nodes;                 ///< Узлы по индексу сущности
+    std::vector<entt::entity> m_roots;         ///< Корневые сущности
+    size_t m_nodeCount = 0;                    ///< Количество живых узлов
+
+    std::vector<Row> m_rows;                   ///< Видимые строки
+    std::vector<std::pair<entt::entity, uint32_t>> m_stack;  ///< Стек обхода: сущность и глубина
+    bool m_rowsDirty = true;                   ///< rows() нужно перестроить
+    uint64_t m_rowsRebuildCount = 0;           ///< Счётчик перестроек
+
+    bool m_filterActive = false;               ///< Включён фильтр
+    std::vector<uint32_t> m_filterMarks;       ///< Метка прохода фильтра по индексу сущности
+    uint32_t m_filterStamp = 0;                ///< Текущая метка (без очистки m_filterMarks)
+
+    EntityNameSnapshot m_nameSnapshot;         ///< Последний снимок имён
+    bool m_namesDirty = true;                  ///< Снимок имён устарел
+};
+
+} // namespace ui
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <core/TrendSeries.h>
+
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file TrendPanel.h
+ * @brief Окно трендов (ImPlot)
+ */
+
+namespace ui {
+
+/**
+ * @brief Окно трендов выбранных тегов
+ *
+ * Каждый кадр для каждого ряда запрашивается прореженное представление
+ * видимого окна времени с учётом ширины графика в пикселях, поэтому число
+ * точек, передаваемых ImPlot, не зависит от длины истории. Результат
+ * кэшируется по (пределы оси X, ширина, версия ряда): при паузе или
+ * неподвижном графике запрос не повторяется.
+ *
+ * В режиме слежения ось X прокручивается за последним отсчётом; при
+ * ручном масштабировании/панорамировании слежение отключается.
+ */
+class TrendPanel {
+public:
+    /**
+     * @brief Нарисовать окно трендов
+     *
+     * @param store Хранилище трендов
+     * @param tags Отображаемые теги (пустой — все теги хранилища)
+     * @param open Флаг видимости окна, может быть nullptr
+     */
+    void draw(const core::TrendStore& store, std::span<const core::StringId> tags = {},
+              bool* open = nullptr);
+
+    /**
+     * @brief Ширина окна слежения (секунды)
+     */
+    void setFollowWindow(double seconds) { m_followWindow = seconds; }
+
+private:
+    /// Кэш прореженного ряда для последнего запроса
+    struct CachedView {
+        double begin = 0.0;                    ///< Начало окна запроса
+        double end = 0.0;                      ///< Конец окна запроса
+        size_t width = 0;                      ///< Ширина графика (пиксели)
+        uint64_t version = 0;                  ///< Версия ряда
+        std::vector<core::TrendPoint> points;  ///< Точки для ImPlot
+    };
+
+    /**
+     * @brief Получить точки ряда для окна (из кэша или новым запросом)
+     */
+    const std::vector<core::TrendPoint>& view(core::StringId tag,
+                                              const core::TrendSeries& series, double begin,
+                                              double end, size_t width);
+
+    std::unordered_map<core::StringId, CachedView> m_cache;  ///< Кэш по тегу
+    double m_followWindow = 60.0;                            ///< Окно слежения (секунды)
+    bool m_follow = true;                                    ///< Слежение за последним отсчётом
+};
+
+} // namespace ui
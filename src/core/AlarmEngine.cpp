@@ -0,0 +1,427 @@
+#include "core/AlarmEngine.h"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace core {
+
+namespace {
+
+/// Допуск сравнения времени для таймеров (накопленная ошибка шага симуляции)
+constexpr double TIME_EPSILON = 1e-9;
+
+bool isUnacknowledged(AlarmState state) {
+    return state == AlarmState::Unacknowledged || state == AlarmState::ReturnedUnack;
+}
+
+} // namespace
+
+// ============================================================================
+// Настройка и входы
+// ============================================================================
+
+AlarmId AlarmEngine::addAlarm(const AlarmDefinition& definition, double time) {
+    const auto id = static_cast<AlarmId>(m_alarms.size());
+
+    auto [it, inserted] = m_tagIndex.try_emplace(definition.tag,
+                                                  static_cast<uint32_t>(m_tags.size()));
+    if (inserted) {
+        Tag tag;
+        tag.lastUpdate = time;
+        m_tags.push_back(std::move(tag));
+    }
+    m_tags[it->second].alarms.push_back(id);
+
+    Alarm alarm;
+    alarm.definition = definition;
+    alarm.definition.deadband = std::max(definition.deadband, 0.0);
+    alarm.definition.onDelay = std::max(definition.onDelay, 0.0);
+    alarm.definition.offDelay = std::max(definition.offDelay, 0.0);
+    alarm.tag = it->second;
+    m_alarms.push_back(alarm);
+
+    if (definition.condition == AlarmCondition::Stale) {
+        scheduleStale(id);
+    } else if (m_tags[it->second].hasValue) {
+        evaluate(id, std::max(time, m_time));
+    }
+    return id;
+}
+
+bool AlarmEngine::setTag(StringId tag, double value) {
+    auto it = m_tagIndex.find(tag);
+    if (it == m_tagIndex.end()) {
+        return false;
+    }
+    Tag& entry = m_tags[it->second];
+    if (!entry.hasValue || entry.value != value) {
+        entry.value = value;
+        entry.hasValue = true;
+        entry.changed = true;
+    }
+    if (!entry.queued) {
+        entry.queued = true;
+        m_dirtyTags.push_back(it->second);
+    }
+    return true;
+}
+
+// ============================================================================
+// Обработка
+// ============================================================================
+
+size_t AlarmEngine::update(double time) {
+    m_time = std::max(m_time, time);
+    m_evaluated = 0;
+    const size_t transitionsBefore = m_transitions.size();
+
+    // Свежесть тегов отмечается до таймеров: пришедшее в этом такте
+    // значение не должно успеть вызвать тревогу потери связи
+    for (uint32_t index : m_dirtyTags) {
+        m_tags[index].lastUpdate = m_time;
+    }
+
+    // Таймеры наступили раньше новых значений: сначала они, в своём порядке
+    while (!m_timers.empty() && m_timers.front().deadline <= m_time + TIME_EPSILON) {
+        std::pop_heap(m_timers.begin(), m_timers.end(), std::greater<Timer>{});
+        const Timer timer = m_timers.back();
+        m_timers.pop_back();
+        handleTimer(timer);
+    }
+
+    for (uint32_t index : m_dirtyTags) {
+        Tag& tag = m_tags[index];
+        for (AlarmId id : tag.alarms) {
+            if (m_alarms[id].definition.condition == AlarmCondition::Stale) {
+                evaluate(id, m_time);
+                scheduleStale(id);
+            } else if (tag.changed) {
+                evaluate(id, m_time);
+            }
+        }
+        tag.changed = false;
+        tag.queued = false;
+    }
+    m_dirtyTags.clear();
+
+    return m_transitions.size() - transitionsBefore;
+}
+
+void AlarmEngine::evaluate(AlarmId id, double time) {
+    Alarm& alarm = m_alarms[id];
+    ++m_evaluated;
+
+    const bool condition = computeCondition(alarm, time);
+    alarm.condition = condition;
+    if (condition == alarm.active) {
+        if (alarm.pending) {
+            // Условие вернулось до окончания задержки: таймер устарел
+            alarm.pending = false;
+            ++alarm.delayGeneration;
+        }
+        return;
+    }
+
+    const double delay = condition ? alarm.definition.onDelay : alarm.definition.offDelay;
+    if (delay <= 0.0) {
+        applyActive(id, condition, time);
+    } else if (!alarm.pending) {
+        alarm.pending = true;
+        pushTimer(time + delay, id, TimerKind::Delay, ++alarm.delayGeneration);
+    }
+}
+
+bool AlarmEngine::computeCondition(const Alarm& alarm, double time) const {
+    const AlarmDefinition& definition = alarm.definition;
+    const Tag& tag = m_tags[alarm.tag];
+
+    if (definition.condition == AlarmCondition::Stale) {
+        return time - tag.lastUpdate + TIME_EPSILON >= definition.setpoint;
+    }
+    if (!tag.hasValue) {
+        return false;
+    }
+
+    switch (definition.condition) {
+        case AlarmCondition::High:
+            return alarm.condition ? tag.value > definition.setpoint - definition.deadband
+                                   : tag.value >= definition.setpoint;
+        case AlarmCondition::Low:
+            return alarm.condition ? tag.value < definition.setpoint + definition.deadband
+                                   : tag.value <= definition.setpoint;
+        case AlarmCondition::Discrete:
+            return tag.value == definition.setpoint;
+        case AlarmCondition::Stale:
+            break;
+    }
+    return false;
+}
+
+void AlarmEngine::applyActive(AlarmId id, bool active, double time) {
+    Alarm& alarm = m_alarms[id];
+    alarm.active = active;
+    alarm.pending = false;
+    if (alarm.shelved) {
+        return;  // Состояние отслеживается, но переходов нет
+    }
+
+    if (active) {
+        alarm.activatedAt = time;
+        setState(id, AlarmState::Unacknowledged);
+        emit(id, AlarmEvent::Raised, time);
+    } else {
+        setState(id, alarm.state == AlarmState::Acknowledged ? AlarmState::Normal
+                                                             : AlarmState::ReturnedUnack);
+        emit(id, AlarmEvent::Cleared, time);
+    }
+}
+
+void AlarmEngine::handleTimer(const Timer& timer) {
+    Alarm& alarm = m_alarms[timer.alarm];
+
+    switch (timer.kind) {
+        case TimerKind::Delay:
+            if (alarm.pending && timer.generation == alarm.delayGeneration) {
+                applyActive(timer.alarm, alarm.condition, timer.deadline);
+            }
+            break;
+
+        case TimerKind::Stale:
+            alarm.staleQueued = false;
+            evaluate(timer.alarm, timer.deadline);
+            scheduleStale(timer.alarm);
+            break;
+
+        case TimerKind::Shelve:
+            if (alarm.shelved && timer.generation == alarm.shelveGeneration) {
+                unshelve(timer.alarm, timer.deadline);
+            }
+            break;
+    }
+}
+
+void AlarmEngine::scheduleStale(AlarmId id) {
+    Alarm& alarm = m_alarms[id];
+    if (alarm.staleQueued || alarm.condition) {
+        return;  // Таймер уже стоит или связь уже потеряна (ждём setTag)
+    }
+    alarm.staleQueued = true;
+    pushTimer(m_tags[alarm.tag].lastUpdate + alarm.definition.setpoint, id, TimerKind::Stale, 0);
+}
+
+void AlarmEngine::pushTimer(double deadline, AlarmId id, TimerKind kind, uint32_t generation) {
+    m_timers.push_back(Timer{deadline, id, kind, generation});
+    std::push_heap(m_timers.begin(), m_timers.end(), std::greater<Timer>{});
+}
+
+// ============================================================================
+// Действия оператора
+// ============================================================================
+
+bool AlarmEngine::acknowledge(AlarmId id, double time) {
+    Alarm& alarm = m_alarms[id];
+    if (alarm.shelved || !isUnacknowledged(alarm.state)) {
+        return false;
+    }
+    setState(id, alarm.state == AlarmState::Unacknowledged ? AlarmState::Acknowledged
+                                                           : AlarmState::Normal);
+    emit(id, AlarmEvent::Acknowledged, time);
+    return true;
+}
+
+size_t AlarmEngine::acknowledgeAll(double time) {
+    // Квитирование не добавляет тревог в кучу: обходим копию
+    const std::vector<AlarmId> active = m_active;
+    size_t count = 0;
+    for (AlarmId id : active) {
+        if (acknowledge(id, time)) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+bool AlarmEngine::shelve(AlarmId id, double time, double duration) {
+    Alarm& alarm = m_alarms[id];
+    if (alarm.shelved) {
+        return false;
+    }
+    alarm.shelved = true;
+    ++alarm.shelveGeneration;
+    setState(id, AlarmState::Normal);
+    emit(id, AlarmEvent::Shelved, time);
+
+    if (duration > 0.0) {
+        pushTimer(time + duration, id, TimerKind::Shelve, alarm.shelveGeneration);
+    }
+    return true;
+}
+
+bool AlarmEngine::unshelve(AlarmId id, double time) {
+    Alarm& alarm = m_alarms[id];
+    if (!alarm.shelved) {
+        return false;
+    }
+    alarm.shelved = false;
+    ++alarm.shelveGeneration;
+    emit(id, AlarmEvent::Unshelved, time);
+
+    // Пока тревога была скрыта, условие могло сработать: снова требуем внимания
+    if (alarm.active) {
+        alarm.activatedAt = time;
+        setState(id, AlarmState::Unacknowledged);
+        emit(id, AlarmEvent::Raised, time);
+    }
+    return true;
+}
+
+// ============================================================================
+// Переходы
+// ============================================================================
+
+size_t AlarmEngine::collectTransitions(std::vector<AlarmTransition>& out) {
+    const size_t count = m_transitions.size();
+    out.insert(out.end(), m_transitions.begin(), m_transitions.end());
+    m_transitions.clear();
+    return count;
+}
+
+size_t AlarmEngine::publishTransitions(double timestamp) {
+    if (m_transitions.empty()) {
+        return 0;
+    }
+    AlarmBatchEvent event;
+    event.timestamp = timestamp;
+    event.transitions.swap(m_transitions);
+    EventBus::getInstance().publish(event);
+
+    // Вернуть буфер, чтобы не выделять память каждый такт
+    const size_t count = event.transitions.size();
+    event.transitions.clear();
+    m_transitions.swap(event.transitions);
+    return count;
+}
+
+size_t AlarmEngine::collectActive(std::vector<AlarmId>& out) const {
+    const size_t first = out.size();
+    out.insert(out.end(), m_active.begin(), m_active.end());
+    std::sort(out.begin() + static_cast<std::ptrdiff_t>(first), out.end(),
+              [this](AlarmId a, AlarmId b) { return before(a, b); });
+    return m_active.size();
+}
+
+void AlarmEngine::setState(AlarmId id, AlarmState state) {
+    Alarm& alarm = m_alarms[id];
+    if (isUnacknowledged(alarm.state)) {
+        --m_unacknowledged;
+    }
+    if (isUnacknowledged(state)) {
+        ++m_unacknowledged;
+    }
+    alarm.state = state;
+
+    const bool listed = state != AlarmState::Normal && !alarm.shelved;
+    if (!listed) {
+        heapRemove(id);
+    } else if (alarm.heapPosition == NO_POSITION) {
+        const auto position = static_cast<uint32_t>(m_active.size());
+        m_active.push_back(id);
+        alarm.heapPosition = position;
+        siftUp(position);
+    } else {
+        // Порядок зависит от состояния и времени срабатывания
+        siftUp(alarm.heapPosition);
+        siftDown(alarm.heapPosition);
+    }
+}
+
+void AlarmEngine::emit(AlarmId id, AlarmEvent event, double time) {
+    const Alarm& alarm = m_alarms[id];
+    AlarmTransition transition;
+    transition.alarm = id;
+    transition.name = alarm.definition.name;
+    transition.event = event;
+    transition.state = alarm.state;
+    transition.priority = alarm.definition.priority;
+    transition.value = m_tags[alarm.tag].value;
+    transition.time = time;
+    m_transitions.push_back(transition);
+}
+
+// ============================================================================
+// Индексированная куча активных тревог
+// ============================================================================
+
+bool AlarmEngine::before(AlarmId a, AlarmId b) const {
+    const Alarm& first = m_alarms[a];
+    const Alarm& second = m_alarms[b];
+    if (first.definition.priority != second.definition.priority) {
+        return first.definition.priority > second.definition.priority;
+    }
+    const bool firstUnack = isUnacknowledged(first.state);
+    if (firstUnack != isUnacknowledged(second.state)) {
+        return firstUnack;
+    }
+    if (first.activatedAt != second.activatedAt) {
+        return first.activatedAt > second.activatedAt;
+    }
+    return a < b;
+}
+
+void AlarmEngine::heapPlace(uint32_t position, AlarmId id) {
+    m_active[position] = id;
+    m_alarms[id].heapPosition = position;
+}
+
+void AlarmEngine::siftUp(uint32_t position) {
+    const AlarmId id = m_active[position];
+    while (position > 0) {
+        const uint32_t parent = (position - 1) / 2;
+        if (!before(id, m_active[parent])) {
+            break;
+        }
+        heapPlace(position, m_active[parent]);
+        position = parent;
+    }
+    heapPlace(position, id);
+}
+
+void AlarmEngine::siftDown(uint32_t position) {
+    const AlarmId id = m_active[position];
+    const auto size = static_cast<uint32_t>(m_active.size());
+    while (true) {
+        uint32_t child = position * 2 + 1;
+        if (child >= size) {
+            break;
+        }
+        if (child + 1 < size && before(m_active[child + 1], m_active[child])) {
+            ++child;
+        }
+        if (!before(m_active[child], id)) {
+            break;
+        }
+        heapPlace(position, m_active[child]);
+        position = child;
+    }
+    heapPlace(position, id);
+}
+
+void AlarmEngine::heapRemove(AlarmId id) {
+    const uint32_t position = m_alarms[id].heapPosition;
+    if (position == NO_POSITION) {
+        return;
+    }
+    m_alarms[id].heapPosition = NO_POSITION;
+
+    const AlarmId last = m_active.back();
+    m_active.pop_back();
+    if (last == id) {
+        return;
+    }
+    heapPlace(position, last);
+    siftUp(position);
+    siftDown(m_alarms[last].heapPosition);
+}
+
+} // namespace core
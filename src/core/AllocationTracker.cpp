@@ -0,0 +1,306 @@
+#include "core/AllocationTracker.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+namespace core {
+
+namespace {
+
+/**
+ * @brief Счётчики одного тега
+ *
+ * constinit: хуки operator new работают ещё до main(), поэтому счётчики
+ * должны быть проинициализированы статически.
+ */
+struct TagCounters {
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> deallocations{0};
+    std::atomic<uint64_t> bytesAllocated{0};
+    std::atomic<int64_t> currentBytes{0};
+    std::atomic<int64_t> peakBytes{0};
+    std::atomic<uint64_t> frameAllocations{0};
+    std::atomic<uint64_t> lastFrameAllocations{0};
+};
+
+constinit TagCounters g_counters[AllocationTracker::TAG_COUNT];
+constinit thread_local AllocationTag t_currentTag = AllocationTag::Other;
+
+inline TagCounters& countersFor(AllocationTag tag) {
+    const auto index = static_cast<size_t>(tag);
+    return g_counters[index < AllocationTracker::TAG_COUNT ? index : 0];
+}
+
+/**
+ * @brief pmr-ресурс, приписывающий выделения своему тегу
+ */
+class TaggedResource : public std::pmr::memory_resource {
+public:
+    explicit TaggedResource(AllocationTag tag) : m_tag(tag) {}
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        // С хуками выделение учтёт operator new — достаточно выставить тег
+        AllocationScope scope(m_tag);
+        void* ptr = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        if (!AllocationTracker::isHookEnabled()) {
+            AllocationTracker::recordAllocation(m_tag, bytes);
+        }
+        return ptr;
+    }
+
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+        if (!AllocationTracker::isHookEnabled()) {
+            AllocationTracker::recordDeallocation(m_tag, bytes);
+        }
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+private:
+    AllocationTag m_tag;  ///< Тег выделений
+};
+
+} // namespace
+
+const char* toString(AllocationTag tag) {
+    switch (tag) {
+        case AllocationTag::Other:      return "other";
+        case AllocationTag::Core:       return "core";
+        case AllocationTag::Rendering:  return "rendering";
+        case AllocationTag::Simulation: return "simulation";
+        case AllocationTag::Resources:  return "resources";
+        case AllocationTag::Scripting:  return "scripting";
+        default:                        return "unknown";
+    }
+}
+
+bool AllocationTracker::isHookEnabled() {
+#ifdef ENABLE_ALLOCATION_TRACKING
+    return true;
+#else
+    return false;
+#endif
+}
+
+void AllocationTracker::recordAllocation(AllocationTag tag, size_t bytes) {
+    TagCounters& counters = countersFor(tag);
+    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+    counters.frameAllocations.fetch_add(1, std::memory_order_relaxed);
+    counters.bytesAllocated.fetch_add(bytes, std::memory_order_relaxed);
+
+    const int64_t current =
+        counters.currentBytes.fetch_add(static_cast<int64_t>(bytes), std::memory_order_relaxed) +
+        static_cast<int64_t>(bytes);
+    int64_t peak = counters.peakBytes.load(std::memory_order_relaxed);
+    while (current > peak &&
+           !counters.peakBytes.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+    }
+}
+
+void AllocationTracker::recordDeallocation(AllocationTag tag, size_t bytes) {
+    TagCounters& counters = countersFor(tag);
+    counters.deallocations.fetch_add(1, std::memory_order_relaxed);
+    counters.currentBytes.fetch_sub(static_cast<int64_t>(bytes), std::memory_order_relaxed);
+}
+
+void AllocationTracker::endFrame() {
+    for (auto& counters : g_counters) {
+        counters.lastFrameAllocations.store(
+            counters.frameAllocations.exchange(0, std::memory_order_relaxed),
+            std::memory_order_relaxed);
+    }
+}
+
+AllocationStats AllocationTracker::getStats(AllocationTag tag) {
+    const TagCounters& counters = countersFor(tag);
+    AllocationStats stats;
+    stats.allocations = counters.allocations.load(std::memory_order_relaxed);
+    stats.deallocations = counters.deallocations.load(std::memory_order_relaxed);
+    stats.bytesAllocated = counters.bytesAllocated.load(std::memory_order_relaxed);
+    stats.currentBytes = counters.currentBytes.load(std::memory_order_relaxed);
+    stats.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+    stats.lastFrameAllocations = counters.lastFrameAllocations.load(std::memory_order_relaxed);
+    return stats;
+}
+
+uint64_t AllocationTracker::getLastFrameAllocations() {
+    uint64_t total = 0;
+    for (const auto& counters : g_counters) {
+        total += counters.lastFrameAllocations.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+bool AllocationTracker::hasData() {
+    for (const auto& counters : g_counters) {
+        if (counters.allocations.load(std::memory_order_relaxed) > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void AllocationTracker::reset() {
+    for (auto& counters : g_counters) {
+        counters.allocations.store(0, std::memory_order_relaxed);
+        counters.deallocations.store(0, std::memory_order_relaxed);
+        counters.bytesAllocated.store(0, std::memory_order_relaxed);
+        counters.currentBytes.store(0, std::memory_order_relaxed);
+        counters.peakBytes.store(0, std::memory_order_relaxed);
+        counters.frameAllocations.store(0, std::memory_order_relaxed);
+        counters.lastFrameAllocations.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::string AllocationTracker::formatReport() {
+    std::string report = fmt::format("Allocation report (global new/delete hook: {})\n",
+                                     isHookEnabled() ? "on" : "off");
+    report += fmt::format("{:<12}{:>14}{:>14}{:>14}{:>14}{:>12}\n", "tag", "allocs", "frees",
+                          "total KB", "peak KB", "last frame");
+    for (size_t i = 0; i < TAG_COUNT; ++i) {
+        const auto tag = static_cast<AllocationTag>(i);
+        const AllocationStats stats = getStats(tag);
+        report += fmt::format("{:<12}{:>14}{:>14}{:>14.1f}{:>14.1f}{:>12}\n", toString(tag),
+                              stats.allocations, stats.deallocations,
+                              stats.bytesAllocated / 1024.0, stats.peakBytes / 1024.0,
+                              stats.lastFrameAllocations);
+    }
+    return report;
+}
+
+std::pmr::memory_resource* AllocationTracker::resource(AllocationTag tag) {
+    static const auto resources = [] {
+        std::array<std::unique_ptr<TaggedResource>, TAG_COUNT> result;
+        for (size_t i = 0; i < TAG_COUNT; ++i) {
+            result[i] = std::make_unique<TaggedResource>(static_cast<AllocationTag>(i));
+        }
+        return result;
+    }();
+
+    const auto index = static_cast<size_t>(tag);
+    return resources[index < TAG_COUNT ? index : 0].get();
+}
+
+AllocationTag AllocationTracker::currentTag() {
+    return t_currentTag;
+}
+
+void AllocationTracker::setCurrentTag(AllocationTag tag) {
+    t_currentTag = tag;
+}
+
+} // namespace core
+
+#ifdef ENABLE_ALLOCATION_TRACKING
+
+// ============== ПЕРЕХВАТ ГЛОБАЛЬНЫХ operator new/delete ==============
+
+namespace {
+
+/**
+ * @brief Заголовок перед каждым блоком: размер, тег и смещение от начала malloc
+ *
+ * 16 байт, чтобы не ломать выравнивание по умолчанию.
+ */
+struct alignas(16) BlockHeader {
+    size_t size;
+    uint32_t offset;
+    core::AllocationTag tag;
+};
+static_assert(sizeof(BlockHeader) == 16);
+
+void* trackedAllocate(size_t size, size_t alignment) noexcept {
+    alignment = std::max<size_t>(alignment, alignof(BlockHeader));
+
+    // Всегда malloc + ручное выравнивание: освобождение одним free() на всех платформах
+    auto* raw = static_cast<std::byte*>(std::malloc(size + sizeof(BlockHeader) + alignment - 1));
+    if (!raw) {
+        return nullptr;
+    }
+
+    const auto rawAddress = reinterpret_cast<uintptr_t>(raw) + sizeof(BlockHeader);
+    const uintptr_t userAddress = (rawAddress + alignment - 1) & ~(uintptr_t(alignment) - 1);
+    auto* user = reinterpret_cast<std::byte*>(userAddress);
+
+    const core::AllocationTag tag = core::AllocationTracker::currentTag();
+    new (user - sizeof(BlockHeader))
+        BlockHeader{size, static_cast<uint32_t>(user - raw), tag};
+    core::AllocationTracker::recordAllocation(tag, size);
+    return user;
+}
+
+void trackedFree(void* ptr) noexcept {
+    if (!ptr) {
+        return;
+    }
+
+    auto* user = static_cast<std::byte*>(ptr);
+    const auto* header = reinterpret_cast<const BlockHeader*>(user - sizeof(BlockHeader));
+    core::AllocationTracker::recordDeallocation(header->tag, header->size);
+    std::free(user - header->offset);
+}
+
+void* trackedNew(size_t size, size_t alignment) {
+    for (;;) {
+        if (void* ptr = trackedAllocate(size, alignment)) {
+            return ptr;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+} // namespace
+
+void* operator new(size_t size) { return trackedNew(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](size_t size) { return trackedNew(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(size_t size, std::align_val_t al) {
+    return trackedNew(size, static_cast<size_t>(al));
+}
+void* operator new[](size_t size, std::align_val_t al) {
+    return trackedNew(size, static_cast<size_t>(al));
+}
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return trackedAllocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return trackedAllocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+void* operator new(size_t size, std::align_val_t al, const std::nothrow_t&) noexcept {
+    return trackedAllocate(size, static_cast<size_t>(al));
+}
+void* operator new[](size_t size, std::align_val_t al, const std::nothrow_t&) noexcept {
+    return trackedAllocate(size, static_cast<size_t>(al));
+}
+
+void operator delete(void* ptr) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, size_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept {
+    trackedFree(ptr);
+}
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept {
+    trackedFree(ptr);
+}
+
+#endif // ENABLE_ALLOCATION_TRACKING
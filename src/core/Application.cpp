@@ -1,5 +1,7 @@
 #include "core/Application.h"
 #include "core/states/MenuState.h"
+#include "core/FrameArena.h"
+#include "core/AllocationTracker.h"
 #include <SFML/Window/Event.hpp>
 #include <chrono>
 
@@ -115,16 +117,26 @@ int Application::run() {
         processEvents();
 
         // Обновление с фиксированным timestep
-        while (accumulator >= m_config.fixedTimestep) {
-            update(m_config.fixedTimestep);
-            m_metrics->recordUpdate();
-            accumulator -= m_config.fixedTimestep;
+        {
+            AllocationScope allocationScope(AllocationTag::Core);
+            while (accumulator >= m_config.fixedTimestep) {
+                update(m_config.fixedTimestep);
+                m_metrics->recordUpdate();
+                accumulator -= m_config.fixedTimestep;
+            }
         }
 
         // Рендеринг (может происходить с переменной частотой)
-        render();
+        {
+            AllocationScope allocationScope(AllocationTag::Rendering);
+            render();
+        }
         m_metrics->recordFrame();
 
+        // Временные данные кадра больше не нужны
+        FrameArena::current().reset();
+        AllocationTracker::endFrame();
+
         // Периодическое логирование метрик производительности
         if (m_metricsTimer >= m_config.metricsLogInterval) {
             LOG_INFO("Performance metrics: FPS={:.1f} (min={:.1f}, max={:.1f}), UPS={:.1f}, FrameTime={:.2f}ms",
@@ -141,6 +153,9 @@ int Application::run() {
     LOG_INFO("Final performance metrics: FPS={:.1f}, UPS={:.1f}",
              m_metrics->getFPS(),
              m_metrics->getUPS());
+    if (AllocationTracker::hasData()) {
+        LOG_INFO("{}", AllocationTracker::formatReport());
+    }
     LOG_INFO("=== OPC Game Simulator Shutting Down ===");
 
     // Завершаем работу логгера
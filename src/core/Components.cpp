@@ -5,16 +5,17 @@
 
 namespace core {
 
-void EntityStateComponent::setState(const std::string& newState, entt::entity entity) {
+void EntityStateComponent::setState(StringId newState, entt::entity entity,
+                                    const StateCallbacksComponent* callbacks) {
     // Игнорируем, если пытаемся установить то же состояние
     if (currentState == newState) {
         return;
     }
 
     // Вызываем onExit для текущего состояния
-    if (!currentState.empty()) {
-        auto exitIt = onExitCallbacks.find(currentState);
-        if (exitIt != onExitCallbacks.end() && exitIt->second) {
+    if (callbacks && !currentState.empty()) {
+        auto exitIt = callbacks->onExitCallbacks.find(currentState);
+        if (exitIt != callbacks->onExitCallbacks.end() && exitIt->second) {
             exitIt->second();
         }
     }
@@ -29,18 +30,20 @@ void EntityStateComponent::setState(const std::string& newState, entt::entity en
     timeInState = 0.0f;
 
     // Вызываем onEnter для нового состояния
-    if (!currentState.empty()) {
-        auto enterIt = onEnterCallbacks.find(currentState);
-        if (enterIt != onEnterCallbacks.end() && enterIt->second) {
+    if (callbacks && !currentState.empty()) {
+        auto enterIt = callbacks->onEnterCallbacks.find(currentState);
+        if (enterIt != callbacks->onEnterCallbacks.end() && enterIt->second) {
             enterIt->second();
         }
     }
 
-    LOG_TRACE("EntityStateComponent: {} -> {}", previousState.empty() ? "none" : previousState, currentState);
+    LOG_TRACE("EntityStateComponent: {} -> {}",
+              previousState.empty() ? std::string("none") : previousState.str(),
+              currentState.str());
 
     // Публикуем событие изменения состояния (если передана сущность)
     if (entity != entt::null) {
-        StateChangedEvent event(entity, previousState, currentState);
+        StateChangedEvent event(entity, previousState.str(), currentState.str());
         EventBus::getInstance().publish(event);
     }
 }
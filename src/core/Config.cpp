@@ -2,6 +2,7 @@
 #include "core/Logger.h"
 #include <fstream>
 #include <filesystem>
+#include <vector>
 
 namespace core {
 
@@ -98,6 +99,28 @@ void Config::createDefaultConfig() {
     m_data["game"]["maxFrameTime"] = 0.25;
     m_data["game"]["metricsLogInterval"] = 5.0;
 
+    // Physics settings
+    m_data["physics"]["lodEnabled"] = true;
+    m_data["physics"]["lodRegionSize"] = 512.0;
+    m_data["physics"]["lodFocusMargin"] = 256.0;
+    m_data["physics"]["lodFarStepDivisor"] = 4;
+    m_data["physics"]["lodFarSubSteps"] = 1;
+    m_data["physics"]["lodReclassifyInterval"] = 15;
+
+    // Thread scheduling settings (physics, worker pool)
+    for (const char* prefix : {"physics", "worker"}) {
+        std::string base(prefix);
+        m_data["threads"][base + "Name"] = "opc-" + base;
+        m_data["threads"][base + "Affinity"] = std::vector<int>{};
+        m_data["threads"][base + "Policy"] = "default";
+        m_data["threads"][base + "Priority"] = 0;
+        m_data["threads"][base + "Nice"] = 0;
+    }
+    m_data["threads"]["physicsPriority"] = 20;
+    m_data["threads"]["physicsNice"] = -5;
+    m_data["threads"]["workerPolicy"] = "nice";
+    m_data["threads"]["workerNice"] = 5;
+
     // Audio settings
     m_data["audio"]["masterVolume"] = 100;
     m_data["audio"]["musicVolume"] = 80;
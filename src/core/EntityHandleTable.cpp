@@ -0,0 +1,120 @@
+#include "core/EntityHandleTable.h"
+
+namespace core {
+
+EntityHandleTable::~EntityHandleTable() {
+    // Таблица из контекста уничтожается вместе с registry — обращаться к его сигналам нельзя
+    if (!m_ownedByRegistry) {
+        shutdown();
+    }
+}
+
+EntityHandleTable& EntityHandleTable::of(entt::registry& registry) {
+    if (auto* table = registry.ctx().find<EntityHandleTable>()) {
+        return *table;
+    }
+
+    auto& table = registry.ctx().emplace<EntityHandleTable>();
+    table.init(registry);
+    table.m_ownedByRegistry = true;
+    return table;
+}
+
+void EntityHandleTable::init(entt::registry& registry) {
+    shutdown();
+    m_registry = &registry;
+    registry.on_destroy<entt::entity>().connect<&EntityHandleTable::onEntityDestroy>(this);
+}
+
+void EntityHandleTable::shutdown() {
+    if (m_registry) {
+        m_registry->on_destroy<entt::entity>().disconnect<&EntityHandleTable::onEntityDestroy>(
+            this);
+        m_registry = nullptr;
+    }
+
+    // Слоты не удаляем: поколения должны расти, иначе старые хэндлы оживут
+    for (Slot& slot : m_slots) {
+        if (slot.entity != entt::null) {
+            slot.entity = entt::null;
+            bumpGeneration(slot);
+        }
+    }
+    m_liveCount = 0;
+}
+
+EntityHandle EntityHandleTable::acquire(entt::entity entity) {
+    if (entity == entt::null) {
+        return {};
+    }
+
+    const auto index = static_cast<uint32_t>(entt::to_entity(entity));
+    if (index >= m_slots.size()) {
+        m_slots.resize(index + 1);
+    }
+
+    Slot& slot = m_slots[index];
+    if (slot.entity != entity) {
+        if (slot.entity == entt::null) {
+            ++m_liveCount;
+        } else {
+            // Индекс переиспользован без уведомления об уничтожении
+            bumpGeneration(slot);
+        }
+        slot.entity = entity;
+    }
+    return EntityHandle::make(index, slot.generation);
+}
+
+EntityHandle EntityHandleTable::find(entt::entity entity) const {
+    if (entity == entt::null) {
+        return {};
+    }
+
+    const auto index = static_cast<uint32_t>(entt::to_entity(entity));
+    if (index >= m_slots.size() || m_slots[index].entity != entity) {
+        return {};
+    }
+    return EntityHandle::make(index, m_slots[index].generation);
+}
+
+entt::entity EntityHandleTable::resolve(EntityHandle handle) const {
+    const uint32_t index = handle.index();
+    if (handle.isNull() || index >= m_slots.size()) {
+        return entt::null;
+    }
+
+    const Slot& slot = m_slots[index];
+    if (slot.generation != handle.generation()) {
+        return entt::null;
+    }
+    return slot.entity;
+}
+
+void EntityHandleTable::release(entt::entity entity) {
+    if (entity == entt::null) {
+        return;
+    }
+
+    const auto index = static_cast<uint32_t>(entt::to_entity(entity));
+    if (index >= m_slots.size() || m_slots[index].entity != entity) {
+        return;
+    }
+
+    Slot& slot = m_slots[index];
+    slot.entity = entt::null;
+    bumpGeneration(slot);
+    --m_liveCount;
+}
+
+void EntityHandleTable::onEntityDestroy(entt::registry& /*registry*/, entt::entity entity) {
+    release(entity);
+}
+
+void EntityHandleTable::bumpGeneration(Slot& slot) {
+    if (++slot.generation == 0) {
+        slot.generation = 1;
+    }
+}
+
+} // namespace core
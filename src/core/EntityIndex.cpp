@@ -0,0 +1,166 @@
+#include "core/EntityIndex.h"
+#include "core/Components.h"
+#include "core/Logger.h"
+
+namespace core {
+
+EntityIndex::~EntityIndex() {
+    shutdown();
+}
+
+void EntityIndex::init(entt::registry& registry) {
+    if (m_registry) {
+        shutdown();
+    }
+    m_registry = &registry;
+
+    auto names = registry.view<NameComponent>();
+    for (auto entity : names) {
+        m_names.insert(entity, names.get<NameComponent>(entity).name);
+    }
+    auto tags = registry.view<TagComponent>();
+    for (auto entity : tags) {
+        m_tags.insert(entity, StringId(tags.get<TagComponent>(entity).tag));
+    }
+
+    registry.on_construct<NameComponent>().connect<&EntityIndex::onNameChanged>(this);
+    registry.on_update<NameComponent>().connect<&EntityIndex::onNameChanged>(this);
+    registry.on_destroy<NameComponent>().connect<&EntityIndex::onNameDestroyed>(this);
+    registry.on_construct<TagComponent>().connect<&EntityIndex::onTagChanged>(this);
+    registry.on_update<TagComponent>().connect<&EntityIndex::onTagChanged>(this);
+    registry.on_destroy<TagComponent>().connect<&EntityIndex::onTagDestroyed>(this);
+
+    LOG_DEBUG("EntityIndex initialized: {} named, {} tagged entities", m_names.slots.size(),
+              m_tags.slots.size());
+}
+
+void EntityIndex::shutdown() {
+    if (m_registry) {
+        m_registry->on_construct<NameComponent>().disconnect<&EntityIndex::onNameChanged>(this);
+        m_registry->on_update<NameComponent>().disconnect<&EntityIndex::onNameChanged>(this);
+        m_registry->on_destroy<NameComponent>().disconnect<&EntityIndex::onNameDestroyed>(this);
+        m_registry->on_construct<TagComponent>().disconnect<&EntityIndex::onTagChanged>(this);
+        m_registry->on_update<TagComponent>().disconnect<&EntityIndex::onTagChanged>(this);
+        m_registry->on_destroy<TagComponent>().disconnect<&EntityIndex::onTagDestroyed>(this);
+        m_registry = nullptr;
+    }
+
+    m_names.clear();
+    m_tags.clear();
+}
+
+entt::entity EntityIndex::findByName(std::string_view name) const {
+    auto entities = m_names.find(name);
+    return entities.empty() ? entt::null : entities.front();
+}
+
+std::span<const entt::entity> EntityIndex::findAllByName(std::string_view name) const {
+    return m_names.find(name);
+}
+
+std::span<const entt::entity> EntityIndex::findByTag(StringId tag) const {
+    return m_tags.find(tag);
+}
+
+const std::string& EntityIndex::nameOf(entt::entity entity) const {
+    static const std::string empty;
+    const std::string* name = m_names.keyOf(entity);
+    return name ? *name : empty;
+}
+
+StringId EntityIndex::tagOf(entt::entity entity) const {
+    const StringId* tag = m_tags.keyOf(entity);
+    return tag ? *tag : StringId();
+}
+
+void EntityIndex::onNameChanged(entt::registry& registry, entt::entity entity) {
+    m_names.insert(entity, registry.get<NameComponent>(entity).name);
+}
+
+void EntityIndex::onNameDestroyed(entt::registry& /*registry*/, entt::entity entity) {
+    m_names.erase(entity);
+}
+
+void EntityIndex::onTagChanged(entt::registry& registry, entt::entity entity) {
+    m_tags.insert(entity, StringId(registry.get<TagComponent>(entity).tag));
+}
+
+void EntityIndex::onTagDestroyed(entt::registry& /*registry*/, entt::entity entity) {
+    m_tags.erase(entity);
+}
+
+template<typename Key, typename Hash, typename Equal>
+template<typename K>
+void EntityIndex::Table<Key, Hash, Equal>::insert(entt::entity entity, const K& key) {
+    auto it = slots.find(entity);
+    if (it != slots.end()) {
+        if (Equal{}(it->second.bucket->first, key)) {
+            return;
+        }
+        erase(entity);
+    }
+
+    // Пустое имя/тег не индексируем
+    if (key.empty()) {
+        return;
+    }
+
+    auto bucketIt = buckets.find(key);
+    if (bucketIt == buckets.end()) {
+        bucketIt = buckets.emplace(Key(key), std::vector<entt::entity>{}).first;
+    }
+    auto& bucket = bucketIt->second;
+    slots.emplace(entity, Slot{&*bucketIt, bucket.size()});
+    bucket.push_back(entity);
+}
+
+template<typename Key, typename Hash, typename Equal>
+void EntityIndex::Table<Key, Hash, Equal>::erase(entt::entity entity) {
+    auto it = slots.find(entity);
+    if (it == slots.end()) {
+        return;
+    }
+
+    const Slot slot = it->second;
+    slots.erase(it);
+
+    auto bucketIt = buckets.find(slot.bucket->first);
+    auto& bucket = bucketIt->second;
+
+    // swap-and-pop: последний элемент занимает место удалённого
+    const entt::entity last = bucket.back();
+    bucket[slot.position] = last;
+    bucket.pop_back();
+    if (last != entity) {
+        slots[last].position = slot.position;
+    }
+
+    // Пустая корзина удаляется вместе с ключом (строка имени освобождается)
+    if (bucket.empty()) {
+        buckets.erase(bucketIt);
+    }
+}
+
+template<typename Key, typename Hash, typename Equal>
+template<typename K>
+std::span<const entt::entity> EntityIndex::Table<Key, Hash, Equal>::find(const K& key) const {
+    auto it = buckets.find(key);
+    if (it == buckets.end()) {
+        return {};
+    }
+    return it->second;
+}
+
+template<typename Key, typename Hash, typename Equal>
+const Key* EntityIndex::Table<Key, Hash, Equal>::keyOf(entt::entity entity) const {
+    auto it = slots.find(entity);
+    return it != slots.end() ? &it->second.bucket->first : nullptr;
+}
+
+template<typename Key, typename Hash, typename Equal>
+void EntityIndex::Table<Key, Hash, Equal>::clear() {
+    buckets.clear();
+    slots.clear();
+}
+
+} // namespace core
@@ -0,0 +1,253 @@
+#include "core/FlowField.h"
+#include "core/Config.h"
+#include "core/Logger.h"
+
+#include <algorithm>
+
+namespace core {
+
+FlowFieldSettings FlowFieldSettings::fromConfig() {
+    auto& config = Config::getInstance();
+
+    FlowFieldSettings settings;
+    settings.cacheSize = config.get("pathfinding.flowFieldCacheSize", settings.cacheSize);
+    return settings;
+}
+
+namespace {
+
+FlowFieldSettings sanitize(FlowFieldSettings settings) {
+    settings.cacheSize = std::max(settings.cacheSize, 1);
+    return settings;
+}
+
+/// Корзин в очереди Дейкстры: больше максимального веса ребра
+constexpr uint32_t BUCKET_COUNT = FlowField::DIAGONAL_COST + 1;
+
+} // namespace
+
+// ============================================================================
+// FlowField
+// ============================================================================
+
+FlowField::FlowField(const NavigationSnapshot& grid, const TileRect& destination,
+                     PathConnectivity connectivity)
+    : m_destination(destination)
+    , m_connectivity(connectivity)
+    , m_width(grid.getWidth())
+    , m_height(grid.getHeight())
+    , m_gridVersion(grid.getVersion()) {
+    integrate(grid);
+    buildDirections(grid);
+    buildDependencies(grid);
+}
+
+bool FlowField::canStep(const NavigationSnapshot& grid, int x, int y, size_t direction) const {
+    auto open = [&](int tx, int ty) {
+        return grid.isWalkable(tx, ty) || (inBounds(tx, ty) && m_destination.contains(tx, ty));
+    };
+
+    const TilePoint offset = DIRECTIONS[direction];
+    if (!open(x + offset.x, y + offset.y)) {
+        return false;
+    }
+    // Углы не срезаются — как в JumpPointSearch
+    return offset.x == 0 || offset.y == 0 || (open(x + offset.x, y) && open(x, y + offset.y));
+}
+
+void FlowField::integrate(const NavigationSnapshot& grid) {
+    const size_t cells = static_cast<size_t>(m_width) * static_cast<size_t>(m_height);
+    m_costs.assign(cells, UNREACHABLE);
+
+    // Дейкстра с кольцевой очередью корзин (алгоритм Дайала): веса целые и
+    // не больше DIAGONAL_COST, поэтому каждая операция очереди — O(1)
+    std::array<std::vector<uint32_t>, BUCKET_COUNT> buckets;
+    size_t pending = 0;
+
+    const int x0 = std::max(m_destination.x, 0);
+    const int y0 = std::max(m_destination.y, 0);
+    const int x1 = std::min(m_destination.x + m_destination.width, m_width);
+    const int y1 = std::min(m_destination.y + m_destination.height, m_height);
+    for (int y = y0; y < y1; ++y) {
+        for (int x = x0; x < x1; ++x) {
+            m_costs[indexOf(x, y)] = 0;
+            buckets[0].push_back(static_cast<uint32_t>(indexOf(x, y)));
+            ++pending;
+        }
+    }
+
+    const size_t directionCount = m_connectivity == PathConnectivity::Eight ? 8 : 4;
+    for (uint32_t current = 0; pending > 0; ++current) {
+        auto& bucket = buckets[current % BUCKET_COUNT];
+        while (!bucket.empty()) {
+            const uint32_t index = bucket.back();
+            bucket.pop_back();
+            --pending;
+            if (m_costs[index] != current) {
+                continue;  // Устаревшая запись: тайл уже получил меньшую стоимость
+            }
+
+            const int x = static_cast<int>(index % static_cast<uint32_t>(m_width));
+            const int y = static_cast<int>(index / static_cast<uint32_t>(m_width));
+            for (size_t direction = 0; direction < directionCount; ++direction) {
+                if (!canStep(grid, x, y, direction)) {
+                    continue;
+                }
+                const TilePoint offset = DIRECTIONS[direction];
+                const uint32_t cost = current + (direction < 4 ? STRAIGHT_COST : DIAGONAL_COST);
+                const size_t neighbor = indexOf(x + offset.x, y + offset.y);
+                if (cost < m_costs[neighbor]) {
+                    m_costs[neighbor] = cost;
+                    buckets[cost % BUCKET_COUNT].push_back(static_cast<uint32_t>(neighbor));
+                    ++pending;
+                }
+            }
+        }
+    }
+}
+
+void FlowField::buildDirections(const NavigationSnapshot& grid) {
+    m_directions.assign(m_costs.size(), NO_DIRECTION);
+    m_reachable = 0;
+
+    const size_t directionCount = m_connectivity == PathConnectivity::Eight ? 8 : 4;
+    for (int y = 0; y < m_height; ++y) {
+        for (int x = 0; x < m_width; ++x) {
+            const size_t index = indexOf(x, y);
+            const uint32_t cost = m_costs[index];
+            if (cost == UNREACHABLE) {
+                continue;
+            }
+            ++m_reachable;
+            if (cost == 0) {
+                continue;  // Тайл цели
+            }
+
+            // Спуск по градиенту; оси перечислены первыми и выигрывают при равенстве
+            uint32_t best = UNREACHABLE;
+            for (size_t direction = 0; direction < directionCount; ++direction) {
+                if (!canStep(grid, x, y, direction)) {
+                    continue;
+                }
+                const TilePoint offset = DIRECTIONS[direction];
+                const uint32_t neighborCost = m_costs[indexOf(x + offset.x, y + offset.y)];
+                if (neighborCost == UNREACHABLE) {
+                    continue;
+                }
+                const uint32_t total =
+                    neighborCost + (direction < 4 ? STRAIGHT_COST : DIAGONAL_COST);
+                if (total < best) {
+                    best = total;
+                    m_directions[index] = static_cast<uint8_t>(direction);
+                }
+            }
+        }
+    }
+}
+
+void FlowField::buildDependencies(const NavigationSnapshot& grid) {
+    const size_t chunksX = grid.getChunksX();
+    const size_t chunkCount = grid.getChunkCount();
+    if (chunksX == 0 || chunkCount == 0) {
+        return;
+    }
+    const size_t chunksY = chunkCount / chunksX;
+    constexpr int CHUNK = NavigationSnapshot::CHUNK_SIZE;
+
+    std::vector<uint8_t> covered(chunkCount, 0);
+    for (int y = 0; y < m_height; ++y) {
+        for (int x = 0; x < m_width; ++x) {
+            if (m_costs[indexOf(x, y)] != UNREACHABLE) {
+                const size_t chunk =
+                    static_cast<size_t>(y / CHUNK) * chunksX + static_cast<size_t>(x / CHUNK);
+                covered[chunk] = 1;
+            }
+        }
+    }
+
+    // Соседний чанк может открыть проход в достижимую область
+    m_dependencies.assign(chunkCount, 0);
+    for (size_t cy = 0; cy < chunksY; ++cy) {
+        for (size_t cx = 0; cx < chunksX; ++cx) {
+            if (!covered[cy * chunksX + cx]) {
+                continue;
+            }
+            const size_t ny0 = cy > 0 ? cy - 1 : 0;
+            const size_t nx0 = cx > 0 ? cx - 1 : 0;
+            for (size_t ny = ny0; ny <= std::min(cy + 1, chunksY - 1); ++ny) {
+                for (size_t nx = nx0; nx <= std::min(cx + 1, chunksX - 1); ++nx) {
+                    m_dependencies[ny * chunksX + nx] = 1;
+                }
+            }
+        }
+    }
+}
+
+// ============================================================================
+// FlowFieldCache
+// ============================================================================
+
+FlowFieldCache::FlowFieldCache(NavigationGrid& grid, const FlowFieldSettings& settings)
+    : m_grid(grid)
+    , m_settings(sanitize(settings)) {
+}
+
+std::shared_ptr<const FlowField> FlowFieldCache::get(const TileRect& destination,
+                                                     PathConnectivity connectivity) {
+    sync();
+
+    for (Entry& entry : m_entries) {
+        if (entry.field->getDestination() == destination &&
+            entry.field->getConnectivity() == connectivity) {
+            entry.lastUse = ++m_useCounter;
+            return entry.field;
+        }
+    }
+
+    if (m_entries.size() >= static_cast<size_t>(m_settings.cacheSize)) {
+        auto oldest = std::min_element(m_entries.begin(), m_entries.end(),
+                                       [](const Entry& a, const Entry& b) {
+                                           return a.lastUse < b.lastUse;
+                                       });
+        m_entries.erase(oldest);
+    }
+
+    auto field = std::make_shared<const FlowField>(*m_snapshot, destination, connectivity);
+    ++m_buildCount;
+    m_entries.push_back(Entry{field, ++m_useCounter});
+
+    LOG_DEBUG("FlowFieldCache: built field to ({}, {}) {}x{}, {} reachable tiles", destination.x,
+              destination.y, destination.width, destination.height, field->getReachableCount());
+    return field;
+}
+
+size_t FlowFieldCache::sync() {
+    auto snapshot = m_grid.snapshot();
+    if (snapshot == m_snapshot) {
+        return 0;
+    }
+
+    const size_t before = m_entries.size();
+    m_changedChunks.clear();
+    if (!m_snapshot || !snapshot->diffChunks(*m_snapshot, m_changedChunks)) {
+        m_entries.clear();
+    } else {
+        std::erase_if(m_entries, [this](const Entry& entry) {
+            return std::any_of(m_changedChunks.begin(), m_changedChunks.end(),
+                               [&entry](uint32_t chunk) {
+                                   return entry.field->dependsOnChunk(chunk);
+                               });
+        });
+    }
+    m_snapshot = std::move(snapshot);
+
+    const size_t invalidated = before - m_entries.size();
+    m_invalidatedCount += invalidated;
+    return invalidated;
+}
+
+void FlowFieldCache::clear() {
+    m_entries.clear();
+}
+
+} // namespace core
@@ -0,0 +1,69 @@
+#include "core/FrameArena.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace core {
+
+FrameArena::FrameArena(size_t initialSize) {
+    addBlock(std::max<size_t>(initialSize, 1));
+}
+
+FrameArena::~FrameArena() = default;
+
+FrameArena& FrameArena::current() {
+    thread_local FrameArena arena;
+    return arena;
+}
+
+void FrameArena::reset() {
+    m_peakBytes = std::max(m_peakBytes, m_bytesUsed);
+
+    // Кадр не поместился в один блок — заменяем все блоки одним общим,
+    // чтобы следующие кадры обходились без выделений
+    if (m_blocks.size() > 1) {
+        const size_t total = m_capacity;
+        m_blocks.clear();
+        m_capacity = 0;
+        addBlock(total);
+    }
+
+    m_offset = 0;
+    m_bytesUsed = 0;
+}
+
+void* FrameArena::do_allocate(size_t bytes, size_t alignment) {
+    Block* block = &m_blocks.back();
+    auto base = reinterpret_cast<uintptr_t>(block->data.get());
+    uintptr_t aligned = (base + m_offset + alignment - 1) & ~(uintptr_t(alignment) - 1);
+
+    if (aligned + bytes > base + block->size) {
+        // Новый блок: не меньше удвоенного предыдущего, чтобы число блоков росло логарифмически
+        addBlock(std::max(block->size * 2, bytes + alignment));
+        block = &m_blocks.back();
+        base = reinterpret_cast<uintptr_t>(block->data.get());
+        aligned = (base + alignment - 1) & ~(uintptr_t(alignment) - 1);
+    }
+
+    const size_t newOffset = aligned + bytes - base;
+    m_bytesUsed += newOffset - m_offset;
+    m_offset = newOffset;
+    return reinterpret_cast<void*>(aligned);
+}
+
+void FrameArena::do_deallocate(void* /*p*/, size_t /*bytes*/, size_t /*alignment*/) {
+    // Память освобождается только целиком в reset()
+}
+
+bool FrameArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+void FrameArena::addBlock(size_t minSize) {
+    m_blocks.push_back(Block{std::make_unique_for_overwrite<std::byte[]>(minSize), minSize});
+    m_capacity += minSize;
+    m_offset = 0;
+    ++m_blockAllocations;
+}
+
+} // namespace core
@@ -0,0 +1,388 @@
+#include "core/JumpPointSearch.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+
+namespace core {
+
+namespace {
+
+constexpr float SQRT2 = 1.41421356f;
+
+inline int sign(int value) {
+    return (value > 0) - (value < 0);
+}
+
+/**
+ * @brief Порядок кучи: меньшее f выше, при равенстве — большее g (ближе к цели)
+ */
+struct WorseEntry {
+    template<typename Entry>
+    bool operator()(const Entry& a, const Entry& b) const {
+        return a.f > b.f || (a.f == b.f && a.g < b.g);
+    }
+};
+
+} // namespace
+
+PathStatus JumpPointSearch::findPath(const NavigationSnapshot& grid, const PathQuery& query,
+                                     std::vector<TilePoint>& path) {
+    path.clear();
+    m_expanded = 0;
+    m_pathCost = 0.0f;
+
+    if (!grid.contains(query.start) || !grid.contains(query.goal)) {
+        return PathStatus::InvalidEndpoint;
+    }
+    if (query.start == query.goal) {
+        path.push_back(query.start);
+        return PathStatus::Found;
+    }
+
+    m_grid = &grid;
+    m_width = grid.getWidth();
+    m_start = query.start;
+    m_goal = query.goal;
+    m_connectivity = query.connectivity;
+
+    const size_t cells = static_cast<size_t>(grid.getWidth()) * grid.getHeight();
+    if (m_nodes.size() < cells) {
+        m_nodes.resize(cells);
+    }
+    if (++m_generation == 0) {
+        // Переполнение счётчика: сбрасываем метки, чтобы старые узлы не ожили
+        for (Node& node : m_nodes) {
+            node.generation = 0;
+        }
+        m_generation = 1;
+    }
+    m_open.clear();
+
+    const uint32_t startIndex = indexOf(m_start.x, m_start.y);
+    const uint32_t goalIndex = indexOf(m_goal.x, m_goal.y);
+    m_nodes[startIndex] = Node{m_generation, NONE, 0.0f, false};
+    push(startIndex, 0.0f);
+
+    while (!m_open.empty()) {
+        std::pop_heap(m_open.begin(), m_open.end(), WorseEntry{});
+        const OpenEntry entry = m_open.back();
+        m_open.pop_back();
+
+        Node& node = m_nodes[entry.index];
+        if (node.closed || entry.g > node.g) {
+            continue;  // Устаревшая запись: узел уже раскрыт или найден путь короче
+        }
+        node.closed = true;
+
+        if (entry.index == goalIndex) {
+            buildPath(goalIndex, path);
+            return PathStatus::Found;
+        }
+        if (query.maxExpanded != 0 && m_expanded >= query.maxExpanded) {
+            return PathStatus::LimitReached;
+        }
+        ++m_expanded;
+
+        const int x = static_cast<int>(entry.index % static_cast<uint32_t>(m_width));
+        const int y = static_cast<int>(entry.index / static_cast<uint32_t>(m_width));
+        collectDirections(x, y, node.parent);
+
+        for (size_t i = 0; i < m_directions.size(); i += 2) {
+            const uint32_t jumpPoint = jump(x, y, m_directions[i], m_directions[i + 1]);
+            if (jumpPoint == NONE) {
+                continue;
+            }
+
+            const int jx = static_cast<int>(jumpPoint % static_cast<uint32_t>(m_width));
+            const int jy = static_cast<int>(jumpPoint / static_cast<uint32_t>(m_width));
+            const int ax = std::abs(jx - x);
+            const int ay = std::abs(jy - y);
+            // Отрезок между точками прыжка — прямая или чистая диагональ
+            const float distance = m_connectivity == PathConnectivity::Eight
+                ? static_cast<float>(std::max(ax, ay)) +
+                      (SQRT2 - 1.0f) * static_cast<float>(std::min(ax, ay))
+                : static_cast<float>(ax + ay);
+            const float g = node.g + distance;
+
+            Node& next = m_nodes[jumpPoint];
+            if (next.generation != m_generation) {
+                next = Node{m_generation, entry.index, g, false};
+                push(jumpPoint, g);
+            } else if (!next.closed && g < next.g) {
+                next.g = g;
+                next.parent = entry.index;
+                push(jumpPoint, g);
+            }
+        }
+    }
+
+    return PathStatus::NoPath;
+}
+
+bool JumpPointSearch::isOpen(int x, int y) const {
+    return m_grid->isWalkable(x, y) || (x == m_goal.x && y == m_goal.y) ||
+           (x == m_start.x && y == m_start.y);
+}
+
+float JumpPointSearch::heuristic(int x, int y) const {
+    const int ax = std::abs(m_goal.x - x);
+    const int ay = std::abs(m_goal.y - y);
+    if (m_connectivity == PathConnectivity::Four) {
+        return static_cast<float>(ax + ay);
+    }
+    return static_cast<float>(std::max(ax, ay)) +
+           (SQRT2 - 1.0f) * static_cast<float>(std::min(ax, ay));
+}
+
+uint32_t JumpPointSearch::jump(int x, int y, int dx, int dy) const {
+    if (m_connectivity == PathConnectivity::Four) {
+        return dx != 0 ? jumpHorizontal4(x, y, dx) : jumpVertical4(x, y, dy);
+    }
+    return (dx != 0 && dy != 0) ? jumpDiagonal(x, y, dx, dy) : jumpStraight(x, y, dx, dy);
+}
+
+uint32_t JumpPointSearch::lineBits(bool vertical, int line, int base) const {
+    uint32_t bits = vertical ? m_grid->columnBits(line, base) : m_grid->rowBits(base, line);
+    for (const TilePoint& endpoint : {m_start, m_goal}) {
+        const int endpointLine = vertical ? endpoint.x : endpoint.y;
+        const int endpointPos = vertical ? endpoint.y : endpoint.x;
+        if (endpointLine == line && endpointPos >= base && endpointPos < base + LINE_BITS) {
+            bits |= 1u << (endpointPos - base);
+        }
+    }
+    return bits;
+}
+
+uint32_t JumpPointSearch::scanLine(bool vertical, int line, int from, int step) const {
+    const int goalLine = vertical ? m_goal.x : m_goal.y;
+    const int goalPos = vertical ? m_goal.y : m_goal.x;
+
+    int pos = from + step;
+    while (true) {
+        const int base = pos & ~(LINE_BITS - 1);
+        const uint32_t current = lineBits(vertical, line, base);
+        const uint32_t sideA = lineBits(vertical, line - 1, base);
+        const uint32_t sideB = lineBits(vertical, line + 1, base);
+
+        // Вынужденный сосед в бите i: боковой тайл i открыт, а боковой тайл
+        // позади него (i - step) закрыт — в него нельзя было попасть диагональю
+        uint32_t forced = 0;
+        uint32_t mask = 0;
+        if (step > 0) {
+            const int prev = base - LINE_BITS;
+            const uint32_t behindA = (sideA << 1) | (lineBits(vertical, line - 1, prev) >> 31);
+            const uint32_t behindB = (sideB << 1) | (lineBits(vertical, line + 1, prev) >> 31);
+            forced = (sideA & ~behindA) | (sideB & ~behindB);
+            mask = ~0u << (pos - base);
+        } else {
+            const int next = base + LINE_BITS;
+            const uint32_t behindA = (sideA >> 1) | (lineBits(vertical, line - 1, next) << 31);
+            const uint32_t behindB = (sideB >> 1) | (lineBits(vertical, line + 1, next) << 31);
+            forced = (sideA & ~behindA) | (sideB & ~behindB);
+            mask = ~0u >> (LINE_BITS - 1 - (pos - base));
+        }
+        if (goalLine == line && goalPos >= base && goalPos < base + LINE_BITS) {
+            forced |= 1u << (goalPos - base);
+        }
+
+        const uint32_t blocked = ~current & mask;
+        const uint32_t stops = forced & mask;
+        int stop = 0;
+        if (step > 0) {
+            const int firstBlocked = blocked ? std::countr_zero(blocked) : LINE_BITS;
+            stop = stops ? std::countr_zero(stops) : LINE_BITS;
+            if (stop >= firstBlocked) {
+                if (firstBlocked < LINE_BITS) {
+                    return NONE;
+                }
+                pos = base + LINE_BITS;
+                continue;
+            }
+        } else {
+            const int firstBlocked = blocked ? LINE_BITS - 1 - std::countl_zero(blocked) : -1;
+            stop = stops ? LINE_BITS - 1 - std::countl_zero(stops) : -1;
+            if (stop <= firstBlocked) {
+                if (firstBlocked >= 0) {
+                    return NONE;
+                }
+                pos = base - 1;
+                continue;
+            }
+        }
+        return vertical ? indexOf(line, base + stop) : indexOf(base + stop, line);
+    }
+}
+
+uint32_t JumpPointSearch::jumpStraight(int x, int y, int dx, int dy) const {
+    return dx != 0 ? scanLine(false, y, x, dx) : scanLine(true, x, y, dy);
+}
+
+uint32_t JumpPointSearch::jumpDiagonal(int x, int y, int dx, int dy) const {
+    while (true) {
+        x += dx;
+        y += dy;
+        if (!isOpen(x, y)) {
+            return NONE;
+        }
+        if (x == m_goal.x && y == m_goal.y) {
+            return indexOf(x, y);
+        }
+        if (jumpStraight(x, y, dx, 0) != NONE || jumpStraight(x, y, 0, dy) != NONE) {
+            return indexOf(x, y);
+        }
+        if (!isOpen(x + dx, y) || !isOpen(x, y + dy)) {
+            return NONE;
+        }
+    }
+}
+
+uint32_t JumpPointSearch::jumpHorizontal4(int x, int y, int dx) const {
+    // Правило вынужденных соседей по оси то же, что и для восьми направлений
+    return scanLine(false, y, x, dx);
+}
+
+uint32_t JumpPointSearch::jumpVertical4(int x, int y, int dy) const {
+    while (true) {
+        y += dy;
+        if (!isOpen(x, y)) {
+            return NONE;
+        }
+        if (x == m_goal.x && y == m_goal.y) {
+            return indexOf(x, y);
+        }
+        if ((isOpen(x - 1, y) && !isOpen(x - 1, y - dy)) ||
+            (isOpen(x + 1, y) && !isOpen(x + 1, y - dy))) {
+            return indexOf(x, y);
+        }
+        // Без диагоналей поворот возможен на любом тайле вертикали
+        if (jumpHorizontal4(x, y, 1) != NONE || jumpHorizontal4(x, y, -1) != NONE) {
+            return indexOf(x, y);
+        }
+    }
+}
+
+void JumpPointSearch::collectDirections(int x, int y, uint32_t parent) {
+    m_directions.clear();
+    auto add = [this](int dx, int dy) {
+        m_directions.push_back(dx);
+        m_directions.push_back(dy);
+    };
+
+    if (parent == NONE) {
+        add(1, 0);
+        add(-1, 0);
+        add(0, 1);
+        add(0, -1);
+        if (m_connectivity == PathConnectivity::Eight) {
+            for (int dy : {-1, 1}) {
+                for (int dx : {-1, 1}) {
+                    if (isOpen(x + dx, y) && isOpen(x, y + dy)) {
+                        add(dx, dy);
+                    }
+                }
+            }
+        }
+        return;
+    }
+
+    const int dx = sign(x - static_cast<int>(parent % static_cast<uint32_t>(m_width)));
+    const int dy = sign(y - static_cast<int>(parent / static_cast<uint32_t>(m_width)));
+
+    if (m_connectivity == PathConnectivity::Four) {
+        if (dx != 0) {
+            add(0, -1);
+            add(0, 1);
+            add(dx, 0);
+        } else {
+            add(-1, 0);
+            add(1, 0);
+            add(0, dy);
+        }
+        return;
+    }
+
+    if (dx != 0 && dy != 0) {
+        const bool openY = isOpen(x, y + dy);
+        const bool openX = isOpen(x + dx, y);
+        if (openY) {
+            add(0, dy);
+        }
+        if (openX) {
+            add(dx, 0);
+        }
+        if (openX && openY) {
+            add(dx, dy);
+        }
+    } else if (dx != 0) {
+        const bool openUp = isOpen(x, y - 1);
+        const bool openDown = isOpen(x, y + 1);
+        if (isOpen(x + dx, y)) {
+            add(dx, 0);
+            if (openUp) {
+                add(dx, -1);
+            }
+            if (openDown) {
+                add(dx, 1);
+            }
+        }
+        if (openUp) {
+            add(0, -1);
+        }
+        if (openDown) {
+            add(0, 1);
+        }
+    } else {
+        const bool openLeft = isOpen(x - 1, y);
+        const bool openRight = isOpen(x + 1, y);
+        if (isOpen(x, y + dy)) {
+            add(0, dy);
+            if (openLeft) {
+                add(-1, dy);
+            }
+            if (openRight) {
+                add(1, dy);
+            }
+        }
+        if (openLeft) {
+            add(-1, 0);
+        }
+        if (openRight) {
+            add(1, 0);
+        }
+    }
+}
+
+void JumpPointSearch::push(uint32_t index, float g) {
+    const int x = static_cast<int>(index % static_cast<uint32_t>(m_width));
+    const int y = static_cast<int>(index / static_cast<uint32_t>(m_width));
+    m_open.push_back(OpenEntry{g + heuristic(x, y), g, index});
+    std::push_heap(m_open.begin(), m_open.end(), WorseEntry{});
+}
+
+void JumpPointSearch::buildPath(uint32_t goal, std::vector<TilePoint>& path) {
+    m_jumpPoints.clear();
+    for (uint32_t index = goal; index != NONE; index = m_nodes[index].parent) {
+        m_jumpPoints.push_back(index);
+    }
+    m_pathCost = m_nodes[goal].g;
+
+    // Разворачиваем точки прыжка в непрерывную цепочку тайлов
+    const auto width = static_cast<uint32_t>(m_width);
+    int x = static_cast<int>(m_jumpPoints.back() % width);
+    int y = static_cast<int>(m_jumpPoints.back() / width);
+    path.push_back(TilePoint{x, y});
+    for (auto it = m_jumpPoints.rbegin() + 1; it != m_jumpPoints.rend(); ++it) {
+        const int tx = static_cast<int>(*it % width);
+        const int ty = static_cast<int>(*it / width);
+        const int dx = sign(tx - x);
+        const int dy = sign(ty - y);
+        while (x != tx || y != ty) {
+            x += dx;
+            y += dy;
+            path.push_back(TilePoint{x, y});
+        }
+    }
+}
+
+} // namespace core
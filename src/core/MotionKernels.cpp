@@ -0,0 +1,76 @@
+#include "core/MotionKernels.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define OPC_MOTION_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define OPC_MOTION_SSE2 1
+#endif
+
+namespace core {
+
+size_t cullAabbs(const float* minX, const float* minY, const float* maxX, const float* maxY,
+                 size_t count, const CullRect& view, uint8_t* visible) {
+    size_t visibleCount = 0;
+    size_t i = 0;
+
+#if defined(OPC_MOTION_AVX2)
+    const __m256 viewLeft = _mm256_set1_ps(view.left);
+    const __m256 viewTop = _mm256_set1_ps(view.top);
+    const __m256 viewRight = _mm256_set1_ps(view.right);
+    const __m256 viewBottom = _mm256_set1_ps(view.bottom);
+    for (; i + 8 <= count; i += 8) {
+        __m256 inside = _mm256_and_ps(
+            _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(minX + i), viewRight, _CMP_LT_OQ),
+                          _mm256_cmp_ps(_mm256_loadu_ps(maxX + i), viewLeft, _CMP_GT_OQ)),
+            _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(minY + i), viewBottom, _CMP_LT_OQ),
+                          _mm256_cmp_ps(_mm256_loadu_ps(maxY + i), viewTop, _CMP_GT_OQ)));
+        int bits = _mm256_movemask_ps(inside);
+        for (int lane = 0; lane < 8; ++lane) {
+            uint8_t v = static_cast<uint8_t>((bits >> lane) & 1);
+            visible[i + lane] = v;
+            visibleCount += v;
+        }
+    }
+#elif defined(OPC_MOTION_SSE2)
+    const __m128 viewLeft = _mm_set1_ps(view.left);
+    const __m128 viewTop = _mm_set1_ps(view.top);
+    const __m128 viewRight = _mm_set1_ps(view.right);
+    const __m128 viewBottom = _mm_set1_ps(view.bottom);
+    for (; i + 4 <= count; i += 4) {
+        __m128 inside = _mm_and_ps(
+            _mm_and_ps(_mm_cmplt_ps(_mm_loadu_ps(minX + i), viewRight),
+                       _mm_cmpgt_ps(_mm_loadu_ps(maxX + i), viewLeft)),
+            _mm_and_ps(_mm_cmplt_ps(_mm_loadu_ps(minY + i), viewBottom),
+                       _mm_cmpgt_ps(_mm_loadu_ps(maxY + i), viewTop)));
+        int bits = _mm_movemask_ps(inside);
+        for (int lane = 0; lane < 4; ++lane) {
+            uint8_t v = static_cast<uint8_t>((bits >> lane) & 1);
+            visible[i + lane] = v;
+            visibleCount += v;
+        }
+    }
+#endif
+
+    for (; i < count; ++i) {
+        bool inside = minX[i] < view.right && maxX[i] > view.left && minY[i] < view.bottom &&
+                      maxY[i] > view.top;
+        visible[i] = inside ? 1 : 0;
+        visibleCount += visible[i];
+    }
+
+    return visibleCount;
+}
+
+const char* motionKernelInstructionSet() {
+#if defined(OPC_MOTION_AVX2)
+    return "AVX2";
+#elif defined(OPC_MOTION_SSE2)
+    return "SSE2";
+#else
+    return "Scalar";
+#endif
+}
+
+} // namespace core
@@ -0,0 +1,238 @@
+#include "core/NavigationGrid.h"
+#include "core/Logger.h"
+
+#include <algorithm>
+
+namespace core {
+
+namespace {
+
+std::shared_ptr<const NavigationSnapshot::Chunk> makeOpenChunk() {
+    auto chunk = std::make_shared<NavigationSnapshot::Chunk>();
+    chunk->rows.fill(~0u);
+    chunk->columns.fill(~0u);
+    return chunk;
+}
+
+} // namespace
+
+bool NavigationSnapshot::diffChunks(const NavigationSnapshot& older,
+                                    std::vector<uint32_t>& out) const {
+    if (older.m_width != m_width || older.m_height != m_height) {
+        return false;
+    }
+    for (size_t i = 0; i < m_chunks.size(); ++i) {
+        if (m_chunks[i] != older.m_chunks[i]) {
+            out.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    return true;
+}
+
+NavigationGrid::NavigationGrid() : NavigationGrid(0, 0) {}
+
+NavigationGrid::NavigationGrid(int width, int height) : m_openChunk(makeOpenChunk()) {
+    resize(width, height);
+}
+
+NavigationGrid::~NavigationGrid() {
+    shutdown();
+}
+
+void NavigationGrid::init(TileOccupancyGrid& occupancy) {
+    if (m_occupancy) {
+        shutdown();
+    }
+    m_occupancy = &occupancy;
+
+    for (const auto& [entity, footprint] : occupancy.getFootprints()) {
+        onFootprintAdded(entity, footprint);
+    }
+    occupancy.addListener(this);
+
+    LOG_DEBUG("NavigationGrid initialized: {}x{} tiles, {} blocking objects", m_width, m_height,
+              m_objectCount);
+}
+
+void NavigationGrid::shutdown() {
+    if (!m_occupancy) {
+        return;
+    }
+
+    m_occupancy->removeListener(this);
+    for (const auto& [entity, footprint] : m_occupancy->getFootprints()) {
+        onFootprintRemoved(entity, footprint);
+    }
+    m_occupancy = nullptr;
+}
+
+void NavigationGrid::resize(int width, int height) {
+    m_width = std::max(0, width);
+    m_height = std::max(0, height);
+    m_chunksX = static_cast<size_t>((m_width + CHUNK_SIZE - 1) / CHUNK_SIZE);
+    m_chunksY = static_cast<size_t>((m_height + CHUNK_SIZE - 1) / CHUNK_SIZE);
+
+    const size_t cells = static_cast<size_t>(m_width) * static_cast<size_t>(m_height);
+    m_terrain.assign(cells, 0);
+    m_objects.assign(cells, 0);
+    m_snapshot.reset();
+    markAllDirty();
+    ++m_version;
+
+    if (!m_occupancy) {
+        return;
+    }
+    for (const auto& [entity, footprint] : m_occupancy->getFootprints()) {
+        if (blocksTiles(footprint)) {
+            applyFootprint(footprint, +1);
+        }
+    }
+}
+
+void NavigationGrid::setTerrain(std::span<const uint8_t> blocked) {
+    if (blocked.size() != m_terrain.size()) {
+        LOG_WARN("NavigationGrid::setTerrain - mask has {} cells, map has {}", blocked.size(),
+                 m_terrain.size());
+        return;
+    }
+    for (size_t i = 0; i < blocked.size(); ++i) {
+        const bool wasWalkable = walkableAt(i);
+        m_terrain[i] = blocked[i] != 0 ? 1 : 0;
+        onCellChanged(i, wasWalkable);
+    }
+}
+
+void NavigationGrid::setTerrainBlocked(int x, int y, bool blocked) {
+    if (x < 0 || y < 0 || x >= m_width || y >= m_height) {
+        return;
+    }
+    const size_t index = static_cast<size_t>(y) * static_cast<size_t>(m_width) + x;
+    const bool wasWalkable = walkableAt(index);
+    m_terrain[index] = blocked ? 1 : 0;
+    onCellChanged(index, wasWalkable);
+}
+
+bool NavigationGrid::blocksTiles(const TileFootprint& footprint) {
+    return footprint.layer == OccupancyLayer::Object && footprint.autoSync;
+}
+
+void NavigationGrid::onFootprintAdded(entt::entity /*entity*/, const TileFootprint& footprint) {
+    if (!blocksTiles(footprint)) {
+        return;
+    }
+    ++m_objectCount;
+    applyFootprint(footprint, +1);
+}
+
+void NavigationGrid::onFootprintRemoved(entt::entity /*entity*/,
+                                        const TileFootprint& footprint) {
+    if (!blocksTiles(footprint)) {
+        return;
+    }
+    --m_objectCount;
+    applyFootprint(footprint, -1);
+}
+
+bool NavigationGrid::isWalkable(int x, int y) const {
+    if (x < 0 || y < 0 || x >= m_width || y >= m_height) {
+        return false;
+    }
+    return walkableAt(static_cast<size_t>(y) * static_cast<size_t>(m_width) + x);
+}
+
+std::shared_ptr<const NavigationSnapshot> NavigationGrid::snapshot() {
+    if (m_snapshot && m_dirtyChunks.empty()) {
+        return m_snapshot;
+    }
+
+    auto next = std::make_shared<NavigationSnapshot>();
+    next->m_width = m_width;
+    next->m_height = m_height;
+    next->m_chunksX = m_chunksX;
+    next->m_version = m_version;
+    if (m_snapshot) {
+        next->m_chunks = m_snapshot->m_chunks;
+    } else {
+        next->m_chunks.resize(m_chunksX * m_chunksY);
+    }
+
+    for (uint32_t chunkIndex : m_dirtyChunks) {
+        next->m_chunks[chunkIndex] = buildChunk(chunkIndex);
+        m_dirtyFlags[chunkIndex] = 0;
+    }
+    m_dirtyChunks.clear();
+
+    m_snapshot = std::move(next);
+    return m_snapshot;
+}
+
+void NavigationGrid::applyFootprint(const TileFootprint& footprint, int delta) {
+    // Тайлы за пределами карты непроходимы и так — обрезаем footprint
+    const int x0 = std::max(footprint.tileX, 0);
+    const int y0 = std::max(footprint.tileY, 0);
+    const int x1 = std::min(footprint.tileX + footprint.widthTiles, m_width);
+    const int y1 = std::min(footprint.tileY + footprint.heightTiles, m_height);
+
+    for (int y = y0; y < y1; ++y) {
+        for (int x = x0; x < x1; ++x) {
+            const size_t index = static_cast<size_t>(y) * static_cast<size_t>(m_width) + x;
+            const bool wasWalkable = walkableAt(index);
+            uint16_t& count = m_objects[index];
+            count = static_cast<uint16_t>(delta > 0 ? count + 1 : (count > 0 ? count - 1 : 0));
+            onCellChanged(index, wasWalkable);
+        }
+    }
+}
+
+void NavigationGrid::onCellChanged(size_t index, bool wasWalkable) {
+    if (walkableAt(index) == wasWalkable) {
+        return;
+    }
+    ++m_version;
+
+    const size_t x = index % static_cast<size_t>(m_width);
+    const size_t y = index / static_cast<size_t>(m_width);
+    const size_t chunkIndex = (y / CHUNK_SIZE) * m_chunksX + x / CHUNK_SIZE;
+    if (!m_dirtyFlags[chunkIndex]) {
+        m_dirtyFlags[chunkIndex] = 1;
+        m_dirtyChunks.push_back(static_cast<uint32_t>(chunkIndex));
+    }
+}
+
+void NavigationGrid::markAllDirty() {
+    const size_t chunkCount = m_chunksX * m_chunksY;
+    m_dirtyFlags.assign(chunkCount, 1);
+    m_dirtyChunks.resize(chunkCount);
+    for (size_t i = 0; i < chunkCount; ++i) {
+        m_dirtyChunks[i] = static_cast<uint32_t>(i);
+    }
+}
+
+std::shared_ptr<const NavigationSnapshot::Chunk> NavigationGrid::buildChunk(
+    size_t chunkIndex) const {
+    const int originX = static_cast<int>(chunkIndex % m_chunksX) * CHUNK_SIZE;
+    const int originY = static_cast<int>(chunkIndex / m_chunksX) * CHUNK_SIZE;
+    const int endX = std::min(originX + CHUNK_SIZE, m_width);
+    const int endY = std::min(originY + CHUNK_SIZE, m_height);
+
+    NavigationSnapshot::Chunk chunk;
+    bool anyBlocked = endX - originX < CHUNK_SIZE || endY - originY < CHUNK_SIZE;
+    for (int y = originY; y < endY; ++y) {
+        for (int x = originX; x < endX; ++x) {
+            if (walkableAt(static_cast<size_t>(y) * static_cast<size_t>(m_width) + x)) {
+                chunk.rows[static_cast<size_t>(y - originY)] |= 1u << (x - originX);
+                chunk.columns[static_cast<size_t>(x - originX)] |= 1u << (y - originY);
+            } else {
+                anyBlocked = true;
+            }
+        }
+    }
+
+    // Полностью проходимые чанки (большая часть цеха) разделяют один экземпляр
+    if (!anyBlocked) {
+        return m_openChunk;
+    }
+    return std::make_shared<const NavigationSnapshot::Chunk>(chunk);
+}
+
+} // namespace core
@@ -0,0 +1,250 @@
+#include "core/ObjectiveEvaluator.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace core {
+
+namespace {
+
+/// Допуск сравнения времени для таймеров (накопленная ошибка шага симуляции)
+constexpr double TIME_EPSILON = 1e-9;
+
+bool applyCompare(CompareOp op, double a, double b) {
+    switch (op) {
+        case CompareOp::Less:         return a < b;
+        case CompareOp::LessEqual:    return a <= b;
+        case CompareOp::Greater:      return a > b;
+        case CompareOp::GreaterEqual: return a >= b;
+        case CompareOp::Equal:        return a == b;
+        case CompareOp::NotEqual:     return a != b;
+    }
+    return false;
+}
+
+} // namespace
+
+// ============================================================================
+// Построение графа
+// ============================================================================
+
+ObjectiveNode ObjectiveEvaluator::input(StringId tag) {
+    auto it = m_inputs.find(tag);
+    if (it != m_inputs.end()) {
+        return it->second;
+    }
+    const ObjectiveNode node = addNode(Kind::Input, {});
+    m_inputs.emplace(tag, node);
+    return node;
+}
+
+ObjectiveNode ObjectiveEvaluator::constant(double value) {
+    return addNode(Kind::Constant, {}, value);
+}
+
+ObjectiveNode ObjectiveEvaluator::compare(ObjectiveNode a, CompareOp op, ObjectiveNode b) {
+    const ObjectiveNode children[] = {a, b};
+    return addNode(Kind::Compare, children, 0.0, op);
+}
+
+ObjectiveNode ObjectiveEvaluator::between(ObjectiveNode value, double low, double high) {
+    return allOf({compare(value, CompareOp::GreaterEqual, low),
+                  compare(value, CompareOp::LessEqual, high)});
+}
+
+ObjectiveNode ObjectiveEvaluator::allOf(std::span<const ObjectiveNode> conditions) {
+    return addNode(Kind::All, conditions);
+}
+
+ObjectiveNode ObjectiveEvaluator::anyOf(std::span<const ObjectiveNode> conditions) {
+    return addNode(Kind::Any, conditions);
+}
+
+ObjectiveNode ObjectiveEvaluator::negate(ObjectiveNode condition) {
+    return addNode(Kind::Not, std::span<const ObjectiveNode>(&condition, 1));
+}
+
+ObjectiveNode ObjectiveEvaluator::holdsFor(ObjectiveNode condition, double seconds) {
+    return addNode(Kind::HoldsFor, std::span<const ObjectiveNode>(&condition, 1),
+                   std::max(seconds, 0.0));
+}
+
+ObjectiveNode ObjectiveEvaluator::latch(ObjectiveNode condition) {
+    return addNode(Kind::Latch, std::span<const ObjectiveNode>(&condition, 1));
+}
+
+ObjectiveId ObjectiveEvaluator::addObjective(StringId name, ObjectiveNode success,
+                                             ObjectiveNode failure) {
+    const auto id = static_cast<ObjectiveId>(m_objectives.size());
+    Objective objective;
+    objective.name = name;
+    objective.success = success;
+    objective.failure = failure;
+    m_objectives.push_back(objective);
+
+    m_watchers[success].push_back(id);
+    if (failure != NO_NODE) {
+        m_watchers[failure].push_back(id);
+    }
+    checkObjective(id);
+    return id;
+}
+
+ObjectiveNode ObjectiveEvaluator::addNode(Kind kind, std::span<const ObjectiveNode> children,
+                                          double param, CompareOp op) {
+    const auto node = static_cast<ObjectiveNode>(m_nodes.size());
+
+    Node entry;
+    entry.kind = kind;
+    entry.op = op;
+    entry.param = param;
+    entry.firstChild = static_cast<uint32_t>(m_children.size());
+    entry.childCount = static_cast<uint32_t>(children.size());
+    m_nodes.push_back(entry);
+    m_dependents.emplace_back();
+    m_watchers.emplace_back();
+
+    for (ObjectiveNode child : children) {
+        m_children.push_back(child);
+        m_dependents[child].push_back(node);
+    }
+    m_nodes[node].value = evaluate(node);
+    return node;
+}
+
+// ============================================================================
+// Вычисление
+// ============================================================================
+
+bool ObjectiveEvaluator::setInput(StringId tag, double value) {
+    auto it = m_inputs.find(tag);
+    if (it == m_inputs.end()) {
+        return false;
+    }
+    Node& node = m_nodes[it->second];
+    if (node.param != value) {
+        node.param = value;  // Новое значение применится в update()
+        markDirty(it->second);
+    }
+    return true;
+}
+
+size_t ObjectiveEvaluator::update(double time) {
+    m_time = std::max(m_time, time);
+    m_evaluated = 0;
+    const size_t changesBefore = m_changes.size();
+
+    while (!m_timers.empty() && m_timers.front().deadline <= m_time + TIME_EPSILON) {
+        std::pop_heap(m_timers.begin(), m_timers.end(), std::greater<Timer>{});
+        markDirty(m_timers.back().node);
+        m_timers.pop_back();
+    }
+
+    // Узлы создаются после своих аргументов: обход по возрастанию индекса
+    // пересчитывает каждый узел один раз, уже после всех его аргументов
+    while (!m_dirty.empty()) {
+        std::pop_heap(m_dirty.begin(), m_dirty.end(), std::greater<ObjectiveNode>{});
+        const ObjectiveNode node = m_dirty.back();
+        m_dirty.pop_back();
+        m_nodes[node].queued = false;
+
+        const double value = evaluate(node);
+        ++m_evaluated;
+        if (value == m_nodes[node].value) {
+            continue;
+        }
+        m_nodes[node].value = value;
+        for (ObjectiveNode dependent : m_dependents[node]) {
+            markDirty(dependent);
+        }
+        m_checks.insert(m_checks.end(), m_watchers[node].begin(), m_watchers[node].end());
+    }
+
+    // Цели проверяются после пересчёта всего графа: провал и выполнение,
+    // наступившие в одном такте, видны одновременно (провал важнее)
+    for (ObjectiveId objective : m_checks) {
+        checkObjective(objective);
+    }
+    m_checks.clear();
+
+    return m_changes.size() - changesBefore;
+}
+
+size_t ObjectiveEvaluator::collectChanges(std::vector<ObjectiveChange>& out) {
+    const size_t count = m_changes.size();
+    out.insert(out.end(), m_changes.begin(), m_changes.end());
+    m_changes.clear();
+    return count;
+}
+
+double ObjectiveEvaluator::evaluate(ObjectiveNode node) {
+    Node& entry = m_nodes[node];
+    const ObjectiveNode* children = m_children.data() + entry.firstChild;
+    auto truth = [this](ObjectiveNode child) { return m_nodes[child].value != 0.0; };
+
+    switch (entry.kind) {
+        case Kind::Input:
+        case Kind::Constant:
+            return entry.param;
+
+        case Kind::Compare:
+            return applyCompare(entry.op, m_nodes[children[0]].value,
+                                m_nodes[children[1]].value) ? 1.0 : 0.0;
+
+        case Kind::All:
+            return std::all_of(children, children + entry.childCount, truth) ? 1.0 : 0.0;
+
+        case Kind::Any:
+            return std::any_of(children, children + entry.childCount, truth) ? 1.0 : 0.0;
+
+        case Kind::Not:
+            return truth(children[0]) ? 0.0 : 1.0;
+
+        case Kind::HoldsFor:
+            if (!truth(children[0])) {
+                entry.since = -1.0;
+                return 0.0;
+            }
+            if (entry.since < 0.0) {
+                // Пересчитать, когда условие продержится нужное время; таймер
+                // прерванного отсчёта просто пересчитает узел впустую
+                entry.since = m_time;
+                m_timers.push_back(Timer{entry.since + entry.param, node});
+                std::push_heap(m_timers.begin(), m_timers.end(), std::greater<Timer>{});
+            }
+            return m_time - entry.since + TIME_EPSILON >= entry.param ? 1.0 : 0.0;
+
+        case Kind::Latch:
+            return entry.value != 0.0 || truth(children[0]) ? 1.0 : 0.0;
+    }
+    return 0.0;
+}
+
+void ObjectiveEvaluator::markDirty(ObjectiveNode node) {
+    if (m_nodes[node].queued) {
+        return;
+    }
+    m_nodes[node].queued = true;
+    m_dirty.push_back(node);
+    std::push_heap(m_dirty.begin(), m_dirty.end(), std::greater<ObjectiveNode>{});
+}
+
+void ObjectiveEvaluator::checkObjective(ObjectiveId id) {
+    Objective& objective = m_objectives[id];
+    if (objective.status != ObjectiveStatus::Pending) {
+        return;
+    }
+
+    if (objective.failure != NO_NODE && isTrue(objective.failure)) {
+        objective.status = ObjectiveStatus::Failed;
+    } else if (isTrue(objective.success)) {
+        objective.status = ObjectiveStatus::Completed;
+        ++m_completed;
+    } else {
+        return;
+    }
+    objective.statusTime = m_time;
+    m_changes.push_back(ObjectiveChange{id, objective.status, m_time});
+}
+
+} // namespace core
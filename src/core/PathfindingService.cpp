@@ -0,0 +1,207 @@
+#include "core/PathfindingService.h"
+#include "core/Config.h"
+#include "core/Logger.h"
+#include "core/ThreadConfig.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace core {
+
+PathfindingSettings PathfindingSettings::fromConfig() {
+    auto& config = Config::getInstance();
+
+    PathfindingSettings settings;
+    settings.workerThreads = config.get("pathfinding.workerThreads", settings.workerThreads);
+    settings.batchSize = config.get("pathfinding.batchSize", settings.batchSize);
+    settings.maxExpandedNodes =
+        config.get("pathfinding.maxExpandedNodes", settings.maxExpandedNodes);
+    return settings;
+}
+
+namespace {
+
+PathfindingSettings sanitize(PathfindingSettings settings) {
+    settings.workerThreads = std::clamp(settings.workerThreads, 0, 16);
+    settings.batchSize = std::max(settings.batchSize, 1);
+    settings.maxExpandedNodes = std::max(settings.maxExpandedNodes, 0);
+    return settings;
+}
+
+} // namespace
+
+PathfindingService::PathfindingService(NavigationGrid& grid, const PathfindingSettings& settings)
+    : m_grid(grid)
+    , m_settings(sanitize(settings)) {
+}
+
+PathfindingService::~PathfindingService() {
+    stop();
+}
+
+bool PathfindingService::start() {
+    if (m_running.load(std::memory_order_acquire) || m_settings.workerThreads == 0) {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = false;
+    }
+    m_workers.reserve(static_cast<size_t>(m_settings.workerThreads));
+    for (int i = 0; i < m_settings.workerThreads; ++i) {
+        m_workers.emplace_back(&PathfindingService::workerLoop, this);
+    }
+    m_running.store(true, std::memory_order_release);
+
+    LOG_INFO("PathfindingService started ({} workers, batch {})", m_settings.workerThreads,
+             m_settings.batchSize);
+    return true;
+}
+
+void PathfindingService::stop() {
+    if (!m_running.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_condition.notify_all();
+    for (std::thread& worker : m_workers) {
+        worker.join();
+    }
+    m_workers.clear();
+    m_running.store(false, std::memory_order_release);
+
+    LOG_DEBUG("PathfindingService stopped ({} requests left in queue)", m_queue.size());
+}
+
+PathRequestId PathfindingService::requestPath(const PathQuery& query) {
+    PendingRequest request{0, query, m_grid.snapshot()};
+    if (request.query.maxExpanded == 0) {
+        request.query.maxExpanded = static_cast<size_t>(m_settings.maxExpandedNodes);
+    }
+
+    PathRequestId id = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        id = m_nextId++;
+        request.id = id;
+        m_queue.push_back(std::move(request));
+    }
+    m_condition.notify_one();
+    return id;
+}
+
+bool PathfindingService::cancel(PathRequestId id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto queued = std::find_if(m_queue.begin(), m_queue.end(),
+                               [id](const PendingRequest& request) { return request.id == id; });
+    if (queued != m_queue.end()) {
+        m_queue.erase(queued);
+        return true;
+    }
+    if (m_inFlight.contains(id)) {
+        // Поток досчитает путь, но результат будет отброшен
+        m_cancelled.insert(id);
+        return true;
+    }
+    auto done = std::find_if(m_results.begin(), m_results.end(),
+                             [id](const PathResult& result) { return result.id == id; });
+    if (done != m_results.end()) {
+        m_results.erase(done);
+        return true;
+    }
+    return false;
+}
+
+size_t PathfindingService::collectResults(std::vector<PathResult>& out) {
+    if (!m_running.load(std::memory_order_acquire)) {
+        // Однопоточный режим: выполняем очередь здесь
+        std::deque<PendingRequest> queue;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            queue.swap(m_queue);
+        }
+        for (const PendingRequest& request : queue) {
+            PathResult result = execute(m_search, request);
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_results.push_back(std::move(result));
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const size_t count = m_results.size();
+    std::move(m_results.begin(), m_results.end(), std::back_inserter(out));
+    m_results.clear();
+    return count;
+}
+
+PathStatus PathfindingService::findPathNow(const PathQuery& query, std::vector<TilePoint>& path) {
+    return m_search.findPath(*m_grid.snapshot(), query, path);
+}
+
+size_t PathfindingService::getPendingCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_queue.size() + m_inFlight.size();
+}
+
+PathResult PathfindingService::execute(JumpPointSearch& search, const PendingRequest& request) {
+    PathResult result;
+    result.id = request.id;
+    result.gridVersion = request.grid->getVersion();
+    result.status = search.findPath(*request.grid, request.query, result.path);
+    result.cost = search.getPathCost();
+    return result;
+}
+
+void PathfindingService::workerLoop() {
+    static const ThreadSchedulingConfig schedule =
+        ThreadSchedulingConfig::fromConfig("worker", "opc-worker");
+    schedule.applyToCurrentThread();
+
+    JumpPointSearch search;
+    std::vector<PendingRequest> batch;
+    std::vector<PathResult> done;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+            if (m_stopping) {
+                return;
+            }
+
+            // Делим очередь между потоками, чтобы один не забрал всю мелочь
+            const auto workers = static_cast<size_t>(m_settings.workerThreads);
+            const size_t share = (m_queue.size() + workers - 1) / workers;
+            const size_t take = std::min(static_cast<size_t>(m_settings.batchSize), share);
+            for (size_t i = 0; i < take; ++i) {
+                m_inFlight.insert(m_queue.front().id);
+                batch.push_back(std::move(m_queue.front()));
+                m_queue.pop_front();
+            }
+        }
+
+        for (const PendingRequest& request : batch) {
+            done.push_back(execute(search, request));
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (PathResult& result : done) {
+                m_inFlight.erase(result.id);
+                if (m_cancelled.erase(result.id) == 0) {
+                    m_results.push_back(std::move(result));
+                }
+            }
+        }
+        batch.clear();
+        done.clear();
+    }
+}
+
+} // namespace core
@@ -1,6 +1,5 @@
 #include "core/PerformanceMetrics.h"
 #include <algorithm>
-#include <numeric>
 
 namespace core {
 
@@ -73,46 +72,38 @@ double PerformanceMetrics::getAverageFrameTime() const {
         return 0.0;
     }
 
-    std::vector<double> frameTimes;
-    for (size_t i = 1; i < m_frameTimes.size(); ++i) {
-        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
-            m_frameTimes[i] - m_frameTimes[i - 1]
-        );
-        frameTimes.push_back(duration.count() / 1000.0); // в миллисекундах
-    }
-
-    double sum = std::accumulate(frameTimes.begin(), frameTimes.end(), 0.0);
-    return sum / frameTimes.size();
+    // Сумма интервалов между соседними кадрами телескопируется в (последний - первый)
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+        m_frameTimes.back() - m_frameTimes.front()
+    );
+    return duration.count() / 1000.0 / static_cast<double>(m_frameTimes.size() - 1); // в миллисекундах
 }
 
 void PerformanceMetrics::updateMinMaxCache() const {
-    if (m_frameTimes.size() < 2) {
-        m_cachedMinFPS = 0.0;
-        m_cachedMaxFPS = 0.0;
-        m_minMaxDirty = false;
-        return;
-    }
+    m_cachedMinFPS = 0.0;
+    m_cachedMaxFPS = 0.0;
+    m_minMaxDirty = false;
 
-    std::vector<double> fps;
+    bool hasSample = false;
     for (size_t i = 1; i < m_frameTimes.size(); ++i) {
         auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
             m_frameTimes[i] - m_frameTimes[i - 1]
         );
         double seconds = duration.count() / 1000000.0;
-        if (seconds > 0.0) {
-            fps.push_back(1.0 / seconds);
+        if (seconds <= 0.0) {
+            continue;
         }
-    }
 
-    if (fps.empty()) {
-        m_cachedMinFPS = 0.0;
-        m_cachedMaxFPS = 0.0;
-    } else {
-        m_cachedMinFPS = *std::min_element(fps.begin(), fps.end());
-        m_cachedMaxFPS = *std::max_element(fps.begin(), fps.end());
+        double fps = 1.0 / seconds;
+        if (!hasSample) {
+            m_cachedMinFPS = fps;
+            m_cachedMaxFPS = fps;
+            hasSample = true;
+        } else {
+            m_cachedMinFPS = std::min(m_cachedMinFPS, fps);
+            m_cachedMaxFPS = std::max(m_cachedMaxFPS, fps);
+        }
     }
-
-    m_minMaxDirty = false;
 }
 
 double PerformanceMetrics::getMinFPS() const {
@@ -0,0 +1,408 @@
+#include "core/ProductionStatistics.h"
+#include "core/Config.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace core {
+
+ProductionSettings ProductionSettings::fromConfig() {
+    auto& config = Config::getInstance();
+
+    ProductionSettings settings;
+    settings.windowSeconds = config.get("production.windowSeconds", settings.windowSeconds);
+    settings.windowBuckets = config.get("production.windowBuckets", settings.windowBuckets);
+    settings.cycleSmoothing = config.get("production.cycleSmoothing", settings.cycleSmoothing);
+    return settings;
+}
+
+namespace {
+
+ProductionSettings sanitize(ProductionSettings settings) {
+    settings.windowSeconds = std::max(settings.windowSeconds, 1.0);
+    settings.windowBuckets = std::clamp(settings.windowBuckets, 1, 3600);
+    settings.cycleSmoothing = std::clamp(settings.cycleSmoothing, 0.001, 1.0);
+    return settings;
+}
+
+constexpr double SECONDS_PER_HOUR = 3600.0;
+
+size_t stateIndex(MachineState state) {
+    return static_cast<size_t>(state);
+}
+
+} // namespace
+
+ProductionStatistics::ProductionStatistics(const ProductionSettings& settings)
+    : m_settings(sanitize(settings)) {
+}
+
+bool ProductionStatistics::addMachine(entt::entity machine, StringId line,
+                                      double idealCycleSeconds, bool lineOutput, double time) {
+    if (m_machineIndex.contains(machine)) {
+        return false;
+    }
+
+    Machine entry;
+    entry.entity = machine;
+    entry.line = lineIndex(line);
+    entry.idealCycleSeconds = std::max(idealCycleSeconds, 0.0);
+    entry.lineOutput = lineOutput;
+    entry.startTime = time;
+    entry.stateSince = time;
+    entry.window.resize(static_cast<size_t>(m_settings.windowBuckets));
+
+    m_machineIndex.emplace(machine, static_cast<uint32_t>(m_machines.size()));
+    m_machines.push_back(std::move(entry));
+    return true;
+}
+
+bool ProductionStatistics::removeMachine(entt::entity machine) {
+    auto it = m_machineIndex.find(machine);
+    if (it == m_machineIndex.end()) {
+        return false;
+    }
+
+    const uint32_t index = it->second;
+    m_machineIndex.erase(it);
+    if (index + 1 != m_machines.size()) {
+        m_machines[index] = std::move(m_machines.back());
+        m_machineIndex[m_machines[index].entity] = index;
+    }
+    m_machines.pop_back();
+    return true;
+}
+
+bool ProductionStatistics::addBuffer(entt::entity buffer, StringId line, uint32_t capacity,
+                                     double time) {
+    if (m_bufferIndex.contains(buffer)) {
+        return false;
+    }
+
+    Buffer entry;
+    entry.entity = buffer;
+    entry.line = lineIndex(line);
+    entry.capacity = capacity;
+    entry.startTime = time;
+    entry.levelSince = time;
+
+    m_bufferIndex.emplace(buffer, static_cast<uint32_t>(m_buffers.size()));
+    m_buffers.push_back(entry);
+    return true;
+}
+
+bool ProductionStatistics::removeBuffer(entt::entity buffer) {
+    auto it = m_bufferIndex.find(buffer);
+    if (it == m_bufferIndex.end()) {
+        return false;
+    }
+
+    const uint32_t index = it->second;
+    m_bufferIndex.erase(it);
+    if (index + 1 != m_buffers.size()) {
+        m_buffers[index] = m_buffers.back();
+        m_bufferIndex[m_buffers[index].entity] = index;
+    }
+    m_buffers.pop_back();
+    return true;
+}
+
+bool ProductionStatistics::setState(entt::entity machine, MachineState state, double time) {
+    auto it = m_machineIndex.find(machine);
+    if (it == m_machineIndex.end() || state == MachineState::Count) {
+        return false;
+    }
+
+    Machine& entry = m_machines[it->second];
+    if (state == entry.state) {
+        return true;
+    }
+    time = std::max(time, entry.stateSince);
+    addInterval(entry, entry.state, entry.stateSince, time);
+
+    if (state == MachineState::Down) {
+        ++entry.failures;
+    }
+    entry.state = state;
+    entry.stateSince = time;
+    return true;
+}
+
+bool ProductionStatistics::addOutput(entt::entity machine, uint32_t good, uint32_t scrap,
+                                     double time) {
+    auto it = m_machineIndex.find(machine);
+    if (it == m_machineIndex.end()) {
+        return false;
+    }
+
+    Machine& entry = m_machines[it->second];
+    const uint32_t count = good + scrap;
+    if (count == 0) {
+        return true;
+    }
+    time = std::max(time, entry.stateSince);
+
+    entry.good += good;
+    entry.scrap += scrap;
+    WindowBucket& bucket = bucketAt(entry, static_cast<uint64_t>(time / bucketSeconds()));
+    bucket.good += good;
+    bucket.scrap += scrap;
+
+    // EWMA интервала между выпусками на одно изделие
+    if (entry.lastOutputTime >= 0.0) {
+        const double cycle = (time - entry.lastOutputTime) / count;
+        entry.meanCycleSeconds = entry.meanCycleSeconds > 0.0
+            ? entry.meanCycleSeconds + m_settings.cycleSmoothing * (cycle - entry.meanCycleSeconds)
+            : cycle;
+    }
+    entry.lastOutputTime = time;
+    return true;
+}
+
+bool ProductionStatistics::setBufferLevel(entt::entity buffer, uint32_t level, double time) {
+    auto it = m_bufferIndex.find(buffer);
+    if (it == m_bufferIndex.end()) {
+        return false;
+    }
+
+    Buffer& entry = m_buffers[it->second];
+    time = std::max(time, entry.levelSince);
+    const double elapsed = time - entry.levelSince;
+    entry.levelSeconds += static_cast<double>(entry.level) * elapsed;
+    if (entry.level == 0) {
+        entry.emptySeconds += elapsed;
+    } else if (entry.level >= entry.capacity) {
+        entry.fullSeconds += elapsed;
+    }
+    entry.level = level;
+    entry.levelSince = time;
+    return true;
+}
+
+bool ProductionStatistics::getMachineStats(entt::entity machine, double time,
+                                           MachineStats& out) const {
+    auto it = m_machineIndex.find(machine);
+    if (it == m_machineIndex.end()) {
+        return false;
+    }
+    OeeTotals total;
+    OeeTotals window;
+    collect(m_machines[it->second], time, out, total, window);
+    return true;
+}
+
+bool ProductionStatistics::getLineStats(StringId line, double time, LineStats& out) const {
+    out = LineStats{};
+    out.line = line;
+
+    OeeTotals total;
+    OeeTotals window;
+    MachineStats machineStats;
+    for (const Machine& machine : m_machines) {
+        if (m_lines[machine.line] != line) {
+            continue;
+        }
+        collect(machine, time, machineStats, total, window);
+        ++out.machineCount;
+        out.machinesDown += machine.state == MachineState::Down ? 1 : 0;
+        out.scrapCount += machine.scrap;
+        if (machine.lineOutput) {
+            out.goodCount += machine.good;
+            out.throughputPerHour += machineStats.throughputPerHour;
+        }
+    }
+    out.oee = computeOee(total);
+    out.windowOee = computeOee(window);
+    return out.machineCount > 0;
+}
+
+void ProductionStatistics::snapshot(double time, ProductionSnapshot& out) const {
+    out.time = time;
+    out.machines.resize(m_machines.size());
+    out.buffers.resize(m_buffers.size());
+
+    std::vector<LineStats> lines(m_lines.size());
+    std::vector<OeeTotals> lineTotals(m_lines.size());
+    std::vector<OeeTotals> lineWindows(m_lines.size());
+
+    for (size_t i = 0; i < m_machines.size(); ++i) {
+        const Machine& machine = m_machines[i];
+        MachineStats& stats = out.machines[i];
+        collect(machine, time, stats, lineTotals[machine.line], lineWindows[machine.line]);
+
+        LineStats& line = lines[machine.line];
+        ++line.machineCount;
+        line.machinesDown += machine.state == MachineState::Down ? 1 : 0;
+        line.scrapCount += machine.scrap;
+        if (machine.lineOutput) {
+            line.goodCount += machine.good;
+            line.throughputPerHour += stats.throughputPerHour;
+        }
+    }
+
+    out.lines.clear();
+    for (size_t i = 0; i < m_lines.size(); ++i) {
+        if (lines[i].machineCount == 0) {
+            continue;
+        }
+        lines[i].line = m_lines[i];
+        lines[i].oee = computeOee(lineTotals[i]);
+        lines[i].windowOee = computeOee(lineWindows[i]);
+        out.lines.push_back(lines[i]);
+    }
+
+    for (size_t i = 0; i < m_buffers.size(); ++i) {
+        collectBuffer(m_buffers[i], time, out.buffers[i]);
+    }
+}
+
+ProductionStatistics::WindowBucket& ProductionStatistics::bucketAt(Machine& machine,
+                                                                   uint64_t index) {
+    WindowBucket& bucket = machine.window[index % machine.window.size()];
+    if (bucket.index != index) {
+        bucket = WindowBucket{};  // Корзина вышла из окна — переиспользуем
+        bucket.index = index;
+    }
+    return bucket;
+}
+
+void ProductionStatistics::addInterval(Machine& machine, MachineState state, double from,
+                                       double to) {
+    if (!(to > from)) {
+        return;
+    }
+    machine.stateSeconds[stateIndex(state)] += to - from;
+
+    // Интервал дробится по корзинам; из длинного учитываются только последние
+    // windowBuckets корзин — остальное всё равно вне окна
+    const double width = bucketSeconds();
+    const auto buckets = static_cast<uint64_t>(machine.window.size());
+    uint64_t first = static_cast<uint64_t>(from / width);
+    const uint64_t last = static_cast<uint64_t>(to / width);
+    if (last - first >= buckets) {
+        first = last - buckets + 1;
+        from = static_cast<double>(first) * width;
+    }
+    for (uint64_t index = first; index <= last; ++index) {
+        const double begin = std::max(from, static_cast<double>(index) * width);
+        const double end = std::min(to, static_cast<double>(index + 1) * width);
+        if (end > begin) {
+            bucketAt(machine, index).stateSeconds[stateIndex(state)] += end - begin;
+        }
+    }
+}
+
+uint32_t ProductionStatistics::lineIndex(StringId line) {
+    auto it = std::find(m_lines.begin(), m_lines.end(), line);
+    if (it != m_lines.end()) {
+        return static_cast<uint32_t>(it - m_lines.begin());
+    }
+    m_lines.push_back(line);
+    return static_cast<uint32_t>(m_lines.size() - 1);
+}
+
+void ProductionStatistics::collect(const Machine& machine, double time, MachineStats& out,
+                                   OeeTotals& total, OeeTotals& window) const {
+    out.machine = machine.entity;
+    out.line = m_lines[machine.line];
+    out.state = machine.state;
+    out.timeInState = std::max(0.0, time - machine.stateSince);
+    out.stateSeconds = machine.stateSeconds;
+    out.stateSeconds[stateIndex(machine.state)] += out.timeInState;
+    out.goodCount = machine.good;
+    out.scrapCount = machine.scrap;
+    out.failureCount = machine.failures;
+    out.meanCycleSeconds = machine.meanCycleSeconds;
+
+    // Окно: корзины [first, now] плюс открытый интервал текущего состояния
+    const double width = bucketSeconds();
+    const auto buckets = static_cast<uint64_t>(machine.window.size());
+    const uint64_t now = time > 0.0 ? static_cast<uint64_t>(time / width) : 0;
+    const uint64_t first = now + 1 >= buckets ? now + 1 - buckets : 0;
+    const double windowStart = std::max(static_cast<double>(first) * width, machine.startTime);
+
+    std::array<double, MACHINE_STATE_COUNT> windowSeconds{};
+    uint64_t windowGood = 0;
+    uint64_t windowScrap = 0;
+    for (const WindowBucket& bucket : machine.window) {
+        if (bucket.index == UINT64_MAX || bucket.index < first || bucket.index > now) {
+            continue;
+        }
+        for (size_t s = 0; s < MACHINE_STATE_COUNT; ++s) {
+            windowSeconds[s] += bucket.stateSeconds[s];
+        }
+        windowGood += bucket.good;
+        windowScrap += bucket.scrap;
+    }
+    const double openFrom = std::max(machine.stateSince, windowStart);
+    if (time > openFrom) {
+        windowSeconds[stateIndex(machine.state)] += time - openFrom;
+    }
+
+    const double span = time - windowStart;
+    out.throughputPerHour = span > 0.0 ? windowGood * SECONDS_PER_HOUR / span : 0.0;
+
+    auto accumulate = [&machine](OeeTotals& totals,
+                                 const std::array<double, MACHINE_STATE_COUNT>& seconds,
+                                 uint64_t good, uint64_t scrap) {
+        for (size_t s = 0; s < MACHINE_STATE_COUNT; ++s) {
+            if (s != stateIndex(MachineState::PlannedStop)) {
+                totals.planned += seconds[s];
+            }
+        }
+        totals.running += seconds[stateIndex(MachineState::Running)];
+        totals.idealOutput += machine.idealCycleSeconds * static_cast<double>(good + scrap);
+        totals.good += good;
+        totals.total += good + scrap;
+    };
+
+    OeeTotals own;
+    OeeTotals ownWindow;
+    accumulate(own, out.stateSeconds, machine.good, machine.scrap);
+    accumulate(ownWindow, windowSeconds, windowGood, windowScrap);
+    out.oee = computeOee(own);
+    out.windowOee = computeOee(ownWindow);
+
+    accumulate(total, out.stateSeconds, machine.good, machine.scrap);
+    accumulate(window, windowSeconds, windowGood, windowScrap);
+}
+
+void ProductionStatistics::collectBuffer(const Buffer& buffer, double time,
+                                         BufferStats& out) const {
+    const double open = std::max(0.0, time - buffer.levelSince);
+    out.buffer = buffer.entity;
+    out.line = m_lines[buffer.line];
+    out.level = buffer.level;
+    out.capacity = buffer.capacity;
+    out.fullSeconds = buffer.fullSeconds;
+    out.emptySeconds = buffer.emptySeconds;
+    if (buffer.level == 0) {
+        out.emptySeconds += open;
+    } else if (buffer.level >= buffer.capacity) {
+        out.fullSeconds += open;
+    }
+
+    const double elapsed = std::max(buffer.levelSince, time) - buffer.startTime;
+    const double levelSeconds = buffer.levelSeconds + static_cast<double>(buffer.level) * open;
+    if (buffer.capacity == 0) {
+        out.averageFill = 0.0;
+    } else if (elapsed > 0.0) {
+        out.averageFill = levelSeconds / (static_cast<double>(buffer.capacity) * elapsed);
+    } else {
+        out.averageFill = static_cast<double>(buffer.level) / buffer.capacity;
+    }
+}
+
+OeeBreakdown ProductionStatistics::computeOee(const OeeTotals& totals) {
+    OeeBreakdown result;
+    result.availability = totals.planned > 0.0 ? totals.running / totals.planned : 0.0;
+    result.performance =
+        totals.running > 0.0 ? std::min(1.0, totals.idealOutput / totals.running) : 0.0;
+    result.quality = totals.total > 0
+        ? static_cast<double>(totals.good) / static_cast<double>(totals.total)
+        : 0.0;
+    result.oee = result.availability * result.performance * result.quality;
+    return result;
+}
+
+} // namespace core
@@ -0,0 +1,105 @@
+#include "core/ReservationTable.h"
+#include "core/FlowField.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace core {
+
+size_t ReservationTable::SlotHash::operator()(const Slot& slot) const {
+    const uint64_t tile = (static_cast<uint64_t>(static_cast<uint32_t>(slot.tile.x)) << 32) |
+                          static_cast<uint32_t>(slot.tile.y);
+    // Перемешивание в духе splitmix64: соседние тайлы и такты не сталкиваются в корзинах
+    uint64_t hash = tile ^ (slot.tick * 0x9E3779B97F4A7C15ull);
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBull;
+    return static_cast<size_t>(hash ^ (hash >> 31));
+}
+
+bool ReservationTable::reserve(TilePoint tile, uint64_t tick, entt::entity agent) {
+    auto [it, inserted] = m_owners.try_emplace(Slot{tile, tick}, agent);
+    if (!inserted) {
+        return it->second == agent;
+    }
+    m_agentSlots[agent].push_back(Slot{tile, tick});
+    return true;
+}
+
+entt::entity ReservationTable::ownerAt(TilePoint tile, uint64_t tick) const {
+    auto it = m_owners.find(Slot{tile, tick});
+    return it != m_owners.end() ? it->second : entt::null;
+}
+
+bool ReservationTable::tryMove(entt::entity agent, TilePoint from, TilePoint to, uint64_t tick) {
+    if (from == to) {
+        return reserve(to, tick + 1, agent);
+    }
+    // Тайл занят сейчас — его владелец мог бы шагнуть навстречу (обмен местами)
+    if (!isFree(to, tick, agent) || !isFree(to, tick + 1, agent)) {
+        return false;
+    }
+    if (from.x != to.x && from.y != to.y) {
+        const TilePoint cornerA{to.x, from.y};
+        const TilePoint cornerB{from.x, to.y};
+        if (!isFree(cornerA, tick, agent) || !isFree(cornerA, tick + 1, agent) ||
+            !isFree(cornerB, tick, agent) || !isFree(cornerB, tick + 1, agent)) {
+            return false;
+        }
+    }
+    return reserve(to, tick + 1, agent);
+}
+
+bool ReservationTable::reservePath(entt::entity agent, std::span<const TilePoint> path,
+                                   uint64_t startTick) {
+    for (size_t i = 0; i < path.size(); ++i) {
+        if (!isFree(path[i], startTick + i, agent)) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < path.size(); ++i) {
+        reserve(path[i], startTick + i, agent);
+    }
+    return true;
+}
+
+TilePoint ReservationTable::followField(const FlowField& field, entt::entity agent,
+                                        TilePoint position, uint64_t tick) {
+    const TilePoint next = field.next(position);
+    if (next != position && tryMove(agent, position, next, tick)) {
+        return next;
+    }
+    reserve(position, tick + 1, agent);
+    return position;
+}
+
+void ReservationTable::release(entt::entity agent) {
+    auto it = m_agentSlots.find(agent);
+    if (it == m_agentSlots.end()) {
+        return;
+    }
+    for (const Slot& slot : it->second) {
+        m_owners.erase(slot);
+    }
+    m_agentSlots.erase(it);
+}
+
+void ReservationTable::advance(uint64_t tick) {
+    for (auto it = m_agentSlots.begin(); it != m_agentSlots.end();) {
+        auto& slots = it->second;
+        std::erase_if(slots, [this, tick](const Slot& slot) {
+            if (slot.tick >= tick) {
+                return false;
+            }
+            m_owners.erase(slot);
+            return true;
+        });
+        it = slots.empty() ? m_agentSlots.erase(it) : std::next(it);
+    }
+}
+
+void ReservationTable::clear() {
+    m_owners.clear();
+    m_agentSlots.clear();
+}
+
+} // namespace core
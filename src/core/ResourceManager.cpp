@@ -1,11 +1,28 @@
 #include "core/ResourceManager.h"
 #include "core/Logger.h"
+#include "core/ThreadConfig.h"
+#include "core/AllocationTracker.h"
 #include <stdexcept>
 #include <thread>
 #include <chrono>
 
 namespace core {
 
+namespace {
+
+/**
+ * @brief Применить параметры планирования пула загрузчиков к текущему потоку
+ *
+ * Параметры читаются из секции threads (префикс "worker") один раз.
+ */
+void configureWorkerThread() {
+    static const ThreadSchedulingConfig config =
+        ThreadSchedulingConfig::fromConfig("worker", "opc-worker");
+    config.applyToCurrentThread();
+}
+
+} // namespace
+
 ResourceManager::ResourceManager() {
     LOG_DEBUG("ResourceManager initialized");
 }
@@ -69,6 +86,7 @@ const sf::Texture& ResourceManager::getTexture(const std::string& path) {
 }
 
 bool ResourceManager::loadFont(const std::string& name, const std::string& path) {
+    AllocationScope allocationScope(AllocationTag::Resources);
     sf::Font font;
     if (!font.openFromFile(path)) {
         LOG_WARN("Failed to load font from: {}", path);
@@ -90,6 +108,7 @@ bool ResourceManager::loadFont(const std::string& name, const std::string& path)
 }
 
 bool ResourceManager::loadTexture(const std::string& name, const std::string& path) {
+    AllocationScope allocationScope(AllocationTag::Resources);
     sf::Texture texture;
     if (!texture.loadFromFile(path)) {
         LOG_WARN("Failed to load texture from: {}", path);
@@ -101,6 +120,7 @@ bool ResourceManager::loadTexture(const std::string& name, const std::string& pa
     {
         std::lock_guard<std::mutex> lock(m_textureMutex);
         m_textures[name] = std::move(texture);
+        m_textureGeneration.fetch_add(1, std::memory_order_release);
     }
 
     auto stats = getMemoryUsage();
@@ -118,6 +138,7 @@ bool ResourceManager::loadTexture(const std::string& path) {
 }
 
 bool ResourceManager::loadTextureFromImage(const std::string& name, const sf::Image& image) {
+    AllocationScope allocationScope(AllocationTag::Resources);
     sf::Texture texture;
     if (!texture.loadFromImage(image)) {
         LOG_WARN("Failed to load texture from image: {}", name);
@@ -129,6 +150,7 @@ bool ResourceManager::loadTextureFromImage(const std::string& name, const sf::Im
     {
         std::lock_guard<std::mutex> lock(m_textureMutex);
         m_textures[name] = std::move(texture);
+        m_textureGeneration.fetch_add(1, std::memory_order_release);
     }
 
     auto stats = getMemoryUsage();
@@ -221,6 +243,7 @@ bool ResourceManager::unloadTexture(const std::string& name) {
         if (it != m_textures.end()) {
             textureSize = calculateTextureSize(it->second);
             m_textures.erase(it);
+            m_textureGeneration.fetch_add(1, std::memory_order_release);
         } else {
             LOG_WARN("Cannot unload texture '{}': not found", name);
             return false;
@@ -267,6 +290,7 @@ const sf::SoundBuffer& ResourceManager::getSound(const std::string& name) {
 }
 
 bool ResourceManager::loadSound(const std::string& name, const std::string& path) {
+    AllocationScope allocationScope(AllocationTag::Resources);
     sf::SoundBuffer buffer;
     if (!buffer.loadFromFile(path)) {
         LOG_WARN("Failed to load sound from: {}", path);
@@ -361,6 +385,7 @@ void ResourceManager::clear() {
               m_spriteMetadata.size(), MemoryStats::formatSize(statsBefore.totalMemory));
     m_fonts.clear();
     m_textures.clear();
+    m_textureGeneration.fetch_add(1, std::memory_order_release);
     m_soundBuffers.clear();
     m_spriteMetadata.clear();
 }
@@ -411,6 +436,8 @@ std::future<bool> ResourceManager::loadTextureAsync(const std::string& name, con
     m_activeLoads++;
 
     return std::async(std::launch::async, [this, name, path]() -> bool {
+        configureWorkerThread();
+
         // Загружаем текстуру из файла в отдельном потоке
         sf::Texture texture;
         if (!texture.loadFromFile(path)) {
@@ -425,6 +452,7 @@ std::future<bool> ResourceManager::loadTextureAsync(const std::string& name, con
         {
             std::lock_guard<std::mutex> lock(m_textureMutex);
             m_textures[name] = std::move(texture);
+            m_textureGeneration.fetch_add(1, std::memory_order_release);
         }
 
         auto stats = getMemoryUsage();
@@ -451,6 +479,8 @@ std::future<bool> ResourceManager::loadFontAsync(const std::string& name, const
     m_activeLoads++;
 
     return std::async(std::launch::async, [this, name, path]() -> bool {
+        configureWorkerThread();
+
         // Загружаем шрифт из файла в отдельном потоке
         sf::Font font;
         if (!font.openFromFile(path)) {
@@ -479,6 +509,8 @@ std::future<bool> ResourceManager::loadSoundAsync(const std::string& name, const
     m_activeLoads++;
 
     return std::async(std::launch::async, [this, name, path]() -> bool {
+        configureWorkerThread();
+
         // Загружаем звук из файла в отдельном потоке
         sf::SoundBuffer buffer;
         if (!buffer.loadFromFile(path)) {
@@ -613,6 +645,8 @@ std::future<size_t> ResourceManager::preloadTexturesAsync(
     LOG_INFO("Starting async preload of {} textures...", paths.size());
 
     return std::async(std::launch::async, [this, paths, progressCallback, completionCallback]() -> size_t {
+        configureWorkerThread();
+
         size_t loaded = 0;
         size_t total = paths.size();
 
@@ -666,6 +700,8 @@ std::future<size_t> ResourceManager::preloadFontsAsync(
     LOG_INFO("Starting async preload of {} fonts...", fontConfigs.size());
 
     return std::async(std::launch::async, [this, fontConfigs, progressCallback, completionCallback]() -> size_t {
+        configureWorkerThread();
+
         size_t loaded = 0;
         size_t total = fontConfigs.size();
 
@@ -719,6 +755,8 @@ std::future<size_t> ResourceManager::preloadSoundsAsync(
     LOG_INFO("Starting async preload of {} sounds...", soundConfigs.size());
 
     return std::async(std::launch::async, [this, soundConfigs, progressCallback, completionCallback]() -> size_t {
+        configureWorkerThread();
+
         size_t loaded = 0;
         size_t total = soundConfigs.size();
 
@@ -854,6 +892,7 @@ void ResourceManager::checkMemoryLimit(const MemoryStats& stats) const {
 // ========== Метаданные спрайтов ==========
 
 const SpriteMetadata* ResourceManager::loadSpriteMetadata(const std::string& path) {
+    AllocationScope allocationScope(AllocationTag::Resources);
     LOG_DEBUG("Loading sprite metadata from: {}", path);
 
     // Загружаем метаданные из файла
@@ -931,6 +970,8 @@ std::future<bool> ResourceManager::loadSpriteMetadataAsync(const std::string& pa
     m_activeLoads++;
 
     return std::async(std::launch::async, [this, path]() -> bool {
+        configureWorkerThread();
+
         // Загружаем метаданные
         auto metadataOpt = SpriteMetadata::loadFromFile(path);
         if (!metadataOpt.has_value()) {
@@ -961,6 +1002,7 @@ std::future<bool> ResourceManager::loadSpriteMetadataAsync(const std::string& pa
             if (texture.loadFromFile(fullTexturePath)) {
                 std::lock_guard<std::mutex> lock(m_textureMutex);
                 m_textures[fullTexturePath] = std::move(texture);
+                m_textureGeneration.fetch_add(1, std::memory_order_release);
             } else {
                 LOG_WARN("Failed to async load associated texture: {}", fullTexturePath);
             }
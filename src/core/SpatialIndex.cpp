@@ -0,0 +1,378 @@
+#include "core/SpatialIndex.h"
+#include "core/Components.h"
+#include "core/Logger.h"
+#include "simulation/PhysicsComponents.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace core {
+
+namespace {
+
+using simulation::RigidbodyComponent;
+
+inline uint64_t packCell(int64_t cellX, int64_t cellY) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) |
+           static_cast<uint32_t>(cellY);
+}
+
+} // namespace
+
+SpatialIndex::SpatialIndex(float cellSize)
+    : m_cellSize(cellSize > 0.0f ? cellSize : DEFAULT_CELL_SIZE)
+    , m_maxEntrySize(m_cellSize) {
+}
+
+template <typename Func>
+void SpatialIndex::forEachCandidate(const Aabb& area, Func&& func) const {
+    // Запись не больше ячейки выходит за свою ячейку максимум на полячейки
+    const float margin = m_maxEntrySize * 0.5f;
+    const int64_t minCellX = static_cast<int64_t>(std::floor((area.minX - margin) / m_cellSize));
+    const int64_t minCellY = static_cast<int64_t>(std::floor((area.minY - margin) / m_cellSize));
+    const int64_t maxCellX = static_cast<int64_t>(std::floor((area.maxX + margin) / m_cellSize));
+    const int64_t maxCellY = static_cast<int64_t>(std::floor((area.maxY + margin) / m_cellSize));
+    const uint64_t rangeCells =
+        static_cast<uint64_t>(maxCellX - minCellX + 1) * static_cast<uint64_t>(maxCellY - minCellY + 1);
+
+    if (rangeCells > m_cells.size()) {
+        // Большая область (выделение всей карты) — дешевле перебрать занятые ячейки
+        for (const auto& [key, entries] : m_cells) {
+            for (const Entry& entry : entries) {
+                func(entry);
+            }
+        }
+    } else {
+        for (int64_t cellY = minCellY; cellY <= maxCellY; ++cellY) {
+            for (int64_t cellX = minCellX; cellX <= maxCellX; ++cellX) {
+                auto it = m_cells.find(packCell(cellX, cellY));
+                if (it == m_cells.end()) {
+                    continue;
+                }
+                for (const Entry& entry : it->second) {
+                    func(entry);
+                }
+            }
+        }
+    }
+
+    for (const Entry& entry : m_oversized) {
+        func(entry);
+    }
+}
+
+SpatialIndex::~SpatialIndex() {
+    shutdown();
+}
+
+void SpatialIndex::init(entt::registry& registry) {
+    if (m_registry) {
+        shutdown();
+    }
+    m_registry = &registry;
+
+    auto view = registry.view<TransformComponent>(entt::exclude<RigidbodyComponent>);
+    for (auto entity : view) {
+        refresh(entity);
+    }
+
+    registry.on_construct<TransformComponent>().connect<&SpatialIndex::onTransformConstruct>(this);
+    registry.on_update<TransformComponent>().connect<&SpatialIndex::onBoundsChanged>(this);
+    registry.on_destroy<TransformComponent>().connect<&SpatialIndex::onTransformDestroy>(this);
+    registry.on_construct<CollisionComponent>().connect<&SpatialIndex::onBoundsChanged>(this);
+    registry.on_update<CollisionComponent>().connect<&SpatialIndex::onBoundsChanged>(this);
+    registry.on_construct<TilePositionComponent>().connect<&SpatialIndex::onBoundsChanged>(this);
+    registry.on_update<TilePositionComponent>().connect<&SpatialIndex::onBoundsChanged>(this);
+    registry.on_construct<SpriteComponent>().connect<&SpatialIndex::onBoundsChanged>(this);
+    registry.on_update<SpriteComponent>().connect<&SpatialIndex::onBoundsChanged>(this);
+    registry.on_construct<RigidbodyComponent>().connect<&SpatialIndex::onRigidbodyConstruct>(this);
+    registry.on_destroy<RigidbodyComponent>().connect<&SpatialIndex::onRigidbodyDestroy>(this);
+
+    LOG_DEBUG("SpatialIndex initialized: cell {:.0f}px, {} entities in {} cells ({} oversized)",
+              m_cellSize, m_locations.size(), m_cells.size(), m_oversized.size());
+}
+
+void SpatialIndex::shutdown() {
+    if (m_registry) {
+        auto& registry = *m_registry;
+        registry.on_construct<TransformComponent>().disconnect<&SpatialIndex::onTransformConstruct>(this);
+        registry.on_update<TransformComponent>().disconnect<&SpatialIndex::onBoundsChanged>(this);
+        registry.on_destroy<TransformComponent>().disconnect<&SpatialIndex::onTransformDestroy>(this);
+        registry.on_construct<CollisionComponent>().disconnect<&SpatialIndex::onBoundsChanged>(this);
+        registry.on_update<CollisionComponent>().disconnect<&SpatialIndex::onBoundsChanged>(this);
+        registry.on_construct<TilePositionComponent>().disconnect<&SpatialIndex::onBoundsChanged>(this);
+        registry.on_update<TilePositionComponent>().disconnect<&SpatialIndex::onBoundsChanged>(this);
+        registry.on_construct<SpriteComponent>().disconnect<&SpatialIndex::onBoundsChanged>(this);
+        registry.on_update<SpriteComponent>().disconnect<&SpatialIndex::onBoundsChanged>(this);
+        registry.on_construct<RigidbodyComponent>().disconnect<&SpatialIndex::onRigidbodyConstruct>(this);
+        registry.on_destroy<RigidbodyComponent>().disconnect<&SpatialIndex::onRigidbodyDestroy>(this);
+        m_registry = nullptr;
+    }
+
+    m_cells.clear();
+    m_oversized.clear();
+    m_locations.clear();
+    m_dirty.clear();
+}
+
+void SpatialIndex::update() {
+    if (!m_registry) {
+        return;
+    }
+    auto& registry = *m_registry;
+
+    // Движущиеся сущности меняют Transform напрямую (без patch) — проверяем их каждый кадр.
+    // Пока центр не покинул ячейку, обновляются только границы записи.
+    auto moving = registry.view<TransformComponent, VelocityComponent>(
+        entt::exclude<RigidbodyComponent>);
+    for (auto entity : moving) {
+        refresh(entity);
+    }
+
+    if (m_dirty.empty()) {
+        return;
+    }
+
+    std::sort(m_dirty.begin(), m_dirty.end());
+    m_dirty.erase(std::unique(m_dirty.begin(), m_dirty.end()), m_dirty.end());
+
+    for (auto entity : m_dirty) {
+        if (registry.valid(entity) && registry.all_of<TransformComponent>(entity) &&
+            !registry.all_of<RigidbodyComponent>(entity)) {
+            refresh(entity);
+        } else {
+            remove(entity);
+        }
+    }
+    m_dirty.clear();
+}
+
+void SpatialIndex::markDirty(entt::entity entity) {
+    m_dirty.push_back(entity);
+}
+
+void SpatialIndex::queryPoint(sf::Vector2f point, std::vector<entt::entity>& out,
+                              const SpatialQueryFilter& filter) const {
+    const Aabb area{point.x, point.y, point.x, point.y};
+    forEachCandidate(area, [&](const Entry& entry) {
+        if (point.x >= entry.bounds.minX && point.x <= entry.bounds.maxX &&
+            point.y >= entry.bounds.minY && point.y <= entry.bounds.maxY &&
+            passes(entry.entity, filter)) {
+            out.push_back(entry.entity);
+        }
+    });
+}
+
+void SpatialIndex::queryRect(const sf::FloatRect& rect, std::vector<entt::entity>& out,
+                             const SpatialQueryFilter& filter) const {
+    // Нормализуем прямоугольник (рамка выделения может тянуться в любую сторону)
+    const Aabb area{std::min(rect.position.x, rect.position.x + rect.size.x),
+                    std::min(rect.position.y, rect.position.y + rect.size.y),
+                    std::max(rect.position.x, rect.position.x + rect.size.x),
+                    std::max(rect.position.y, rect.position.y + rect.size.y)};
+    forEachCandidate(area, [&](const Entry& entry) {
+        if (entry.bounds.minX <= area.maxX && entry.bounds.maxX >= area.minX &&
+            entry.bounds.minY <= area.maxY && entry.bounds.maxY >= area.minY &&
+            passes(entry.entity, filter)) {
+            out.push_back(entry.entity);
+        }
+    });
+}
+
+void SpatialIndex::queryRadius(sf::Vector2f center, float radius, std::vector<entt::entity>& out,
+                               const SpatialQueryFilter& filter) const {
+    const Aabb area{center.x - radius, center.y - radius, center.x + radius, center.y + radius};
+    const float radiusSq = radius * radius;
+    forEachCandidate(area, [&](const Entry& entry) {
+        // Ближайшая к центру точка AABB
+        const float nearestX = std::clamp(center.x, entry.bounds.minX, entry.bounds.maxX);
+        const float nearestY = std::clamp(center.y, entry.bounds.minY, entry.bounds.maxY);
+        const float dx = center.x - nearestX;
+        const float dy = center.y - nearestY;
+        if (dx * dx + dy * dy <= radiusSq && passes(entry.entity, filter)) {
+            out.push_back(entry.entity);
+        }
+    });
+}
+
+entt::entity SpatialIndex::pickTop(sf::Vector2f point, const SpatialQueryFilter& filter) const {
+    if (!m_registry) {
+        return entt::null;
+    }
+
+    // Один проход по кандидатам без промежуточного вектора (pickTop зовётся на каждое
+    // движение мыши); при равных слоях побеждает первый, как в queryPoint()
+    entt::entity top = entt::null;
+    int topLayer = 0;
+    const Aabb area{point.x, point.y, point.x, point.y};
+    forEachCandidate(area, [&](const Entry& entry) {
+        if (point.x < entry.bounds.minX || point.x > entry.bounds.maxX ||
+            point.y < entry.bounds.minY || point.y > entry.bounds.maxY ||
+            !passes(entry.entity, filter)) {
+            return;
+        }
+        const auto* sprite = m_registry->try_get<SpriteComponent>(entry.entity);
+        const int layer = sprite ? sprite->layer : std::numeric_limits<int>::min();
+        if (top == entt::null || layer > topLayer) {
+            top = entry.entity;
+            topLayer = layer;
+        }
+    });
+    return top;
+}
+
+sf::FloatRect SpatialIndex::getBounds(entt::entity entity) const {
+    auto it = m_locations.find(entity);
+    if (it == m_locations.end()) {
+        return {};
+    }
+
+    const Location& location = it->second;
+    const Aabb& bounds = location.cellKey == OVERSIZED_KEY
+                             ? m_oversized[location.position].bounds
+                             : m_cells.at(location.cellKey)[location.position].bounds;
+    return sf::FloatRect({bounds.minX, bounds.minY},
+                         {bounds.maxX - bounds.minX, bounds.maxY - bounds.minY});
+}
+
+void SpatialIndex::onTransformConstruct(entt::registry& registry, entt::entity entity) {
+    if (!registry.all_of<RigidbodyComponent>(entity)) {
+        // Остальные компоненты обычно добавляются позже — их сигналы уточнят границы
+        refresh(entity);
+    }
+}
+
+void SpatialIndex::onTransformDestroy(entt::registry& /*registry*/, entt::entity entity) {
+    remove(entity);
+}
+
+void SpatialIndex::onBoundsChanged(entt::registry& /*registry*/, entt::entity entity) {
+    markDirty(entity);
+}
+
+void SpatialIndex::onRigidbodyConstruct(entt::registry& /*registry*/, entt::entity entity) {
+    remove(entity);
+}
+
+void SpatialIndex::onRigidbodyDestroy(entt::registry& /*registry*/, entt::entity entity) {
+    // Компонент ещё существует во время сигнала — вернём сущность в индекс в update()
+    markDirty(entity);
+}
+
+void SpatialIndex::refresh(entt::entity entity) {
+    const Aabb bounds = computeBounds(entity);
+    const uint64_t key = keyFor(bounds);
+
+    auto it = m_locations.find(entity);
+    if (it != m_locations.end() && it->second.cellKey == key) {
+        // Центр остался в той же ячейке — обновляем границы на месте
+        auto& entries = key == OVERSIZED_KEY ? m_oversized : m_cells[key];
+        entries[it->second.position].bounds = bounds;
+        return;
+    }
+
+    remove(entity);
+    insert(entity, bounds);
+}
+
+void SpatialIndex::insert(entt::entity entity, const Aabb& bounds) {
+    const uint64_t key = keyFor(bounds);
+    auto& entries = key == OVERSIZED_KEY ? m_oversized : m_cells[key];
+    m_locations[entity] = Location{key, entries.size()};
+    entries.push_back(Entry{entity, bounds});
+}
+
+void SpatialIndex::remove(entt::entity entity) {
+    auto it = m_locations.find(entity);
+    if (it == m_locations.end()) {
+        return;
+    }
+
+    const Location location = it->second;
+    m_locations.erase(it);
+
+    auto cellIt = m_cells.end();
+    std::vector<Entry>* entries = &m_oversized;
+    if (location.cellKey != OVERSIZED_KEY) {
+        cellIt = m_cells.find(location.cellKey);
+        entries = &cellIt->second;
+    }
+
+    // swap-and-pop: последняя запись занимает место удалённой
+    const Entry last = entries->back();
+    (*entries)[location.position] = last;
+    entries->pop_back();
+    if (last.entity != entity) {
+        m_locations[last.entity].position = location.position;
+    }
+
+    if (entries->empty() && cellIt != m_cells.end()) {
+        m_cells.erase(cellIt);
+    }
+}
+
+SpatialIndex::Aabb SpatialIndex::computeBounds(entt::entity entity) const {
+    const auto& transform = m_registry->get<TransformComponent>(entity);
+
+    sf::FloatRect rect;
+    if (const auto* collision = m_registry->try_get<CollisionComponent>(entity)) {
+        rect = collision->getWorldBounds(transform);
+    } else if (const auto* tilePos = m_registry->try_get<TilePositionComponent>(entity)) {
+        rect = sf::FloatRect(
+            {static_cast<float>(tilePos->tileX * TILE_SIZE),
+             static_cast<float>(tilePos->tileY * TILE_SIZE)},
+            {static_cast<float>(std::max(1, tilePos->widthTiles) * TILE_SIZE),
+             static_cast<float>(std::max(1, tilePos->heightTiles) * TILE_SIZE)});
+    } else {
+        // Спрайт рисуется от левого НИЖНЕГО угла (см. RenderSystem)
+        sf::Vector2f size(static_cast<float>(TILE_SIZE), static_cast<float>(TILE_SIZE));
+        const auto* sprite = m_registry->try_get<SpriteComponent>(entity);
+        if (sprite && sprite->textureRect.size.x > 0 && sprite->textureRect.size.y > 0) {
+            size = sf::Vector2f(sprite->textureRect.size);
+        }
+        size.x *= transform.scaleX;
+        size.y *= transform.scaleY;
+        rect = sf::FloatRect({transform.x, transform.y - size.y}, size);
+    }
+
+    // Отрицательный масштаб/размер переворачивает прямоугольник
+    return Aabb{std::min(rect.position.x, rect.position.x + rect.size.x),
+                std::min(rect.position.y, rect.position.y + rect.size.y),
+                std::max(rect.position.x, rect.position.x + rect.size.x),
+                std::max(rect.position.y, rect.position.y + rect.size.y)};
+}
+
+uint64_t SpatialIndex::keyFor(const Aabb& bounds) const {
+    if (bounds.maxX - bounds.minX > m_maxEntrySize || bounds.maxY - bounds.minY > m_maxEntrySize) {
+        return OVERSIZED_KEY;
+    }
+
+    const float centerX = (bounds.minX + bounds.maxX) * 0.5f;
+    const float centerY = (bounds.minY + bounds.maxY) * 0.5f;
+    return packCell(static_cast<int64_t>(std::floor(centerX / m_cellSize)),
+                    static_cast<int64_t>(std::floor(centerY / m_cellSize)));
+}
+
+bool SpatialIndex::passes(entt::entity entity, const SpatialQueryFilter& filter) const {
+    if (!m_registry) {
+        return true;
+    }
+
+    if (filter.hasLayerFilter()) {
+        const auto* sprite = m_registry->try_get<SpriteComponent>(entity);
+        if (!sprite || sprite->layer < filter.minLayer || sprite->layer > filter.maxLayer) {
+            return false;
+        }
+    }
+
+    if (!filter.tag.empty()) {
+        const auto* tag = m_registry->try_get<TagComponent>(entity);
+        if (!tag || !(filter.tag == tag->tag)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace core
@@ -0,0 +1,82 @@
+#include "core/StringId.h"
+
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace core {
+
+namespace {
+
+/**
+ * @brief Глобальная таблица интернированных строк
+ *
+ * std::deque не перемещает элементы при добавлении, поэтому ключи-string_view
+ * в индексе и ссылки, возвращаемые str(), остаются валидными.
+ */
+struct StringTable {
+    std::shared_mutex mutex;
+    std::deque<std::string> strings;                            ///< id → строка
+    std::unordered_map<std::string_view, StringId::ValueType> index;  ///< строка → id
+
+    StringTable() {
+        // id 0 зарезервирован за пустой строкой
+        strings.emplace_back();
+        index.emplace(std::string_view(strings.front()), 0);
+    }
+};
+
+StringTable& table() {
+    static StringTable instance;
+    return instance;
+}
+
+} // namespace
+
+StringId::ValueType StringId::intern(std::string_view str) {
+    if (str.empty()) {
+        return 0;
+    }
+
+    auto& t = table();
+    {
+        std::shared_lock lock(t.mutex);
+        auto it = t.index.find(str);
+        if (it != t.index.end()) {
+            return it->second;
+        }
+    }
+
+    std::unique_lock lock(t.mutex);
+    // Строку могли добавить между снятием shared и взятием unique блокировки
+    auto it = t.index.find(str);
+    if (it != t.index.end()) {
+        return it->second;
+    }
+
+    if (t.strings.size() >= std::numeric_limits<ValueType>::max()) {
+        throw std::length_error("StringId table overflow");
+    }
+
+    auto id = static_cast<ValueType>(t.strings.size());
+    const std::string& stored = t.strings.emplace_back(str);
+    t.index.emplace(std::string_view(stored), id);
+    return id;
+}
+
+const std::string& StringId::str() const {
+    auto& t = table();
+    std::shared_lock lock(t.mutex);
+    return t.strings[m_id];
+}
+
+size_t StringId::internedCount() {
+    auto& t = table();
+    std::shared_lock lock(t.mutex);
+    return t.strings.size();
+}
+
+} // namespace core
@@ -0,0 +1,191 @@
+#include "core/ThreadConfig.h"
+#include "core/Config.h"
+#include "core/Logger.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(__APPLE__)
+#include <pthread.h>
+#endif
+
+namespace core {
+
+ThreadSchedulingConfig ThreadSchedulingConfig::fromConfig(const std::string& prefix,
+                                                          const std::string& defaultName) {
+    auto& config = Config::getInstance();
+    const std::string base = "threads." + prefix;
+
+    ThreadSchedulingConfig result;
+    result.name = config.get(base + "Name", defaultName);
+    result.cpuAffinity = config.get(base + "Affinity", std::vector<int>{});
+    result.policy = parsePolicy(config.get(base + "Policy", std::string("default")));
+    result.priority = config.get(base + "Priority", 0);
+    result.niceValue = config.get(base + "Nice", 0);
+    return result;
+}
+
+ThreadPolicy ThreadSchedulingConfig::parsePolicy(const std::string& value) {
+    std::string lower = value;
+    std::transform(lower.begin(), lower.end(), lower.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+    if (lower == "fifo" || lower == "realtime") {
+        return ThreadPolicy::Fifo;
+    }
+    if (lower == "nice") {
+        return ThreadPolicy::Nice;
+    }
+    return ThreadPolicy::Default;
+}
+
+#if defined(__linux__)
+
+namespace {
+
+bool applyNice(int niceValue, const std::string& name) {
+    // В Linux nice задаётся для отдельного потока через его TID
+    auto tid = static_cast<id_t>(syscall(SYS_gettid));
+    if (setpriority(PRIO_PROCESS, tid, niceValue) != 0) {
+        LOG_WARN("Thread '{}': setpriority(nice={}) failed: {}", name, niceValue,
+                 std::strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+bool ThreadSchedulingConfig::applyToCurrentThread() const {
+    bool ok = true;
+    pthread_t self = pthread_self();
+
+    if (!name.empty()) {
+        // Имя потока ограничено 16 байтами вместе с завершающим нулём
+        std::string shortName = name.substr(0, 15);
+        if (int rc = pthread_setname_np(self, shortName.c_str()); rc != 0) {
+            LOG_WARN("Thread '{}': pthread_setname_np failed: {}", name, std::strerror(rc));
+            ok = false;
+        }
+    }
+
+    if (!cpuAffinity.empty()) {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        for (int cpu : cpuAffinity) {
+            if (cpu >= 0 && cpu < CPU_SETSIZE) {
+                CPU_SET(cpu, &cpuSet);
+            }
+        }
+        if (int rc = pthread_setaffinity_np(self, sizeof(cpuSet), &cpuSet); rc != 0) {
+            LOG_WARN("Thread '{}': pthread_setaffinity_np failed: {}", name, std::strerror(rc));
+            ok = false;
+        }
+    }
+
+    switch (policy) {
+        case ThreadPolicy::Fifo: {
+            sched_param param{};
+            param.sched_priority = std::clamp(priority, sched_get_priority_min(SCHED_FIFO),
+                                              sched_get_priority_max(SCHED_FIFO));
+            if (int rc = pthread_setschedparam(self, SCHED_FIFO, &param); rc != 0) {
+                // Нет CAP_SYS_NICE — откатываемся на nice
+                LOG_WARN("Thread '{}': SCHED_FIFO unavailable ({}), falling back to nice {}",
+                         name, std::strerror(rc), niceValue);
+                ok = applyNice(niceValue, name) && ok;
+            }
+            break;
+        }
+        case ThreadPolicy::Nice:
+            ok = applyNice(niceValue, name) && ok;
+            break;
+        case ThreadPolicy::Default:
+            break;
+    }
+
+    LOG_DEBUG("Thread '{}' configured (cpus: {}, policy: {})", name, cpuAffinity.size(),
+              static_cast<int>(policy));
+    return ok;
+}
+
+#elif defined(_WIN32)
+
+bool ThreadSchedulingConfig::applyToCurrentThread() const {
+    bool ok = true;
+    HANDLE self = GetCurrentThread();
+
+#if defined(_MSC_VER)
+    if (!name.empty()) {
+        std::wstring wideName(name.begin(), name.end());
+        if (FAILED(SetThreadDescription(self, wideName.c_str()))) {
+            LOG_WARN("Thread '{}': SetThreadDescription failed", name);
+            ok = false;
+        }
+    }
+#endif
+
+    if (!cpuAffinity.empty()) {
+        DWORD_PTR mask = 0;
+        for (int cpu : cpuAffinity) {
+            if (cpu >= 0 && cpu < static_cast<int>(sizeof(DWORD_PTR) * 8)) {
+                mask |= DWORD_PTR{1} << cpu;
+            }
+        }
+        if (mask != 0 && SetThreadAffinityMask(self, mask) == 0) {
+            LOG_WARN("Thread '{}': SetThreadAffinityMask failed ({})", name, GetLastError());
+            ok = false;
+        }
+    }
+
+    int winPriority = THREAD_PRIORITY_NORMAL;
+    if (policy == ThreadPolicy::Fifo) {
+        winPriority = THREAD_PRIORITY_TIME_CRITICAL;
+    } else if (policy == ThreadPolicy::Nice) {
+        // Отрицательный nice — выше нормы, положительный — ниже
+        if (niceValue < 0) {
+            winPriority = niceValue <= -10 ? THREAD_PRIORITY_HIGHEST : THREAD_PRIORITY_ABOVE_NORMAL;
+        } else if (niceValue > 0) {
+            winPriority = niceValue >= 10 ? THREAD_PRIORITY_LOWEST : THREAD_PRIORITY_BELOW_NORMAL;
+        }
+    }
+    if (policy != ThreadPolicy::Default && !SetThreadPriority(self, winPriority)) {
+        LOG_WARN("Thread '{}': SetThreadPriority failed ({})", name, GetLastError());
+        ok = false;
+    }
+
+    return ok;
+}
+
+#else
+
+bool ThreadSchedulingConfig::applyToCurrentThread() const {
+#if defined(__APPLE__)
+    // macOS позволяет задать только имя текущего потока
+    if (!name.empty()) {
+        pthread_setname_np(name.c_str());
+    }
+#endif
+    if (!cpuAffinity.empty() || policy != ThreadPolicy::Default) {
+        LOG_WARN("Thread '{}': affinity/priority settings are not supported on this platform",
+                 name);
+        return false;
+    }
+    return true;
+}
+
+#endif
+
+} // namespace core
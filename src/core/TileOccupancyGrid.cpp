@@ -0,0 +1,316 @@
+#include "core/TileOccupancyGrid.h"
+#include "core/Logger.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace core {
+
+namespace {
+
+/**
+ * @brief Деление с округлением вниз (для отрицательных координат чанков)
+ */
+inline int floorDiv(int value, int divisor) {
+    int quotient = value / divisor;
+    return (value % divisor != 0 && (value < 0) != (divisor < 0)) ? quotient - 1 : quotient;
+}
+
+inline size_t layerIndex(OccupancyLayer layer) {
+    return static_cast<size_t>(layer);
+}
+
+} // namespace
+
+TileOccupancyGrid::TileOccupancyGrid() = default;
+
+TileOccupancyGrid::TileOccupancyGrid(int width, int height) {
+    resize(width, height);
+}
+
+TileOccupancyGrid::~TileOccupancyGrid() {
+    shutdown();
+}
+
+void TileOccupancyGrid::init(entt::registry& registry) {
+    if (m_registry) {
+        shutdown();
+    }
+    m_registry = &registry;
+
+    auto view = registry.view<TilePositionComponent>();
+    for (auto entity : view) {
+        insert(entity, view.get<TilePositionComponent>(entity));
+    }
+
+    registry.on_construct<TilePositionComponent>().connect<&TileOccupancyGrid::onConstruct>(this);
+    registry.on_update<TilePositionComponent>().connect<&TileOccupancyGrid::onUpdate>(this);
+    registry.on_destroy<TilePositionComponent>().connect<&TileOccupancyGrid::onDestroy>(this);
+
+    LOG_DEBUG("TileOccupancyGrid initialized: {}x{} dense, {} entities, {} chunks", m_width,
+              m_height, m_footprints.size(), m_chunks.size());
+}
+
+void TileOccupancyGrid::shutdown() {
+    if (m_registry) {
+        m_registry->on_construct<TilePositionComponent>()
+            .disconnect<&TileOccupancyGrid::onConstruct>(this);
+        m_registry->on_update<TilePositionComponent>().disconnect<&TileOccupancyGrid::onUpdate>(this);
+        m_registry->on_destroy<TilePositionComponent>()
+            .disconnect<&TileOccupancyGrid::onDestroy>(this);
+        m_registry = nullptr;
+    }
+
+    for (ITileOccupancyListener* listener : m_listeners) {
+        for (const auto& [entity, footprint] : m_footprints) {
+            listener->onFootprintRemoved(entity, footprint);
+        }
+    }
+
+    std::fill(m_dense.begin(), m_dense.end(), emptyCell());
+    m_chunks.clear();
+    m_footprints.clear();
+    m_overlaps.clear();
+}
+
+void TileOccupancyGrid::resize(int width, int height) {
+    // Запоминаем текущие footprint'ы, чтобы разложить их по новому хранилищу
+    auto footprints = std::move(m_footprints);
+    m_footprints.clear();
+    m_chunks.clear();
+    m_overlaps.clear();
+    m_dense.clear();
+
+    m_width = std::max(0, width);
+    m_height = std::max(0, height);
+
+    const size_t cells = static_cast<size_t>(m_width) * static_cast<size_t>(m_height);
+    if (cells > MAX_DENSE_CELLS) {
+        LOG_INFO("TileOccupancyGrid: map {}x{} exceeds dense limit, using sparse chunks only",
+                 m_width, m_height);
+        m_width = 0;
+        m_height = 0;
+    } else {
+        m_dense.assign(cells, emptyCell());
+    }
+
+    for (const auto& [entity, footprint] : footprints) {
+        m_footprints.emplace(entity, footprint);
+        occupy(entity, footprint);
+    }
+}
+
+void TileOccupancyGrid::insert(entt::entity entity, const TilePositionComponent& position) {
+    if (m_footprints.contains(entity)) {
+        remove(entity);
+    }
+
+    Footprint footprint = footprintOf(position);
+    m_footprints.emplace(entity, footprint);
+    occupy(entity, footprint);
+
+    for (ITileOccupancyListener* listener : m_listeners) {
+        listener->onFootprintAdded(entity, footprint);
+    }
+}
+
+void TileOccupancyGrid::remove(entt::entity entity) {
+    auto it = m_footprints.find(entity);
+    if (it == m_footprints.end()) {
+        return;
+    }
+
+    Footprint footprint = it->second;
+    m_footprints.erase(it);
+    vacate(entity, footprint);
+
+    for (ITileOccupancyListener* listener : m_listeners) {
+        listener->onFootprintRemoved(entity, footprint);
+    }
+}
+
+void TileOccupancyGrid::addListener(ITileOccupancyListener* listener) {
+    if (listener && std::find(m_listeners.begin(), m_listeners.end(), listener) ==
+                        m_listeners.end()) {
+        m_listeners.push_back(listener);
+    }
+}
+
+void TileOccupancyGrid::removeListener(ITileOccupancyListener* listener) {
+    m_listeners.erase(std::remove(m_listeners.begin(), m_listeners.end(), listener),
+                      m_listeners.end());
+}
+
+entt::entity TileOccupancyGrid::at(int tileX, int tileY, OccupancyLayer layer) const {
+    const Cell* cell = findCell(tileX, tileY);
+    return cell ? (*cell)[layerIndex(layer)] : entt::null;
+}
+
+entt::entity TileOccupancyGrid::topAt(int tileX, int tileY) const {
+    const Cell* cell = findCell(tileX, tileY);
+    if (!cell) {
+        return entt::null;
+    }
+
+    for (size_t layer = LAYER_COUNT; layer-- > 0;) {
+        if ((*cell)[layer] != entt::null) {
+            return (*cell)[layer];
+        }
+    }
+    return entt::null;
+}
+
+bool TileOccupancyGrid::isAreaFree(int tileX, int tileY, int widthTiles, int heightTiles,
+                                   OccupancyLayer layer, entt::entity ignore) const {
+    for (int y = tileY; y < tileY + heightTiles; ++y) {
+        for (int x = tileX; x < tileX + widthTiles; ++x) {
+            entt::entity occupant = at(x, y, layer);
+            if (occupant != entt::null && occupant != ignore) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void TileOccupancyGrid::queryArea(int tileX, int tileY, int widthTiles, int heightTiles,
+                                  OccupancyLayer layer, std::vector<entt::entity>& out) const {
+    const size_t firstNew = out.size();
+    for (int y = tileY; y < tileY + heightTiles; ++y) {
+        for (int x = tileX; x < tileX + widthTiles; ++x) {
+            entt::entity occupant = at(x, y, layer);
+            if (occupant == entt::null) {
+                continue;
+            }
+            // Многотайловый объект попадает в несколько тайлов — добавляем один раз
+            if (std::find(out.begin() + firstNew, out.end(), occupant) == out.end()) {
+                out.push_back(occupant);
+            }
+        }
+    }
+}
+
+void TileOccupancyGrid::onConstruct(entt::registry& registry, entt::entity entity) {
+    insert(entity, registry.get<TilePositionComponent>(entity));
+}
+
+void TileOccupancyGrid::onUpdate(entt::registry& registry, entt::entity entity) {
+    insert(entity, registry.get<TilePositionComponent>(entity));
+}
+
+void TileOccupancyGrid::onDestroy(entt::registry& /*registry*/, entt::entity entity) {
+    remove(entity);
+}
+
+void TileOccupancyGrid::occupy(entt::entity entity, const Footprint& footprint) {
+    const size_t layer = layerIndex(footprint.layer);
+    for (int y = footprint.tileY; y < footprint.tileY + footprint.heightTiles; ++y) {
+        for (int x = footprint.tileX; x < footprint.tileX + footprint.widthTiles; ++x) {
+            entt::entity& slot = cellAt(x, y)[layer];
+            if (slot == entt::null) {
+                slot = entity;
+            } else if (slot != entity) {
+                m_overlaps.emplace(packKey(x, y), entity);
+            }
+        }
+    }
+}
+
+void TileOccupancyGrid::vacate(entt::entity entity, const Footprint& footprint) {
+    const size_t layer = layerIndex(footprint.layer);
+    for (int y = footprint.tileY; y < footprint.tileY + footprint.heightTiles; ++y) {
+        for (int x = footprint.tileX; x < footprint.tileX + footprint.widthTiles; ++x) {
+            const uint64_t key = packKey(x, y);
+            Cell* cell = findCell(x, y);
+            if (!cell) {
+                continue;
+            }
+
+            entt::entity& slot = (*cell)[layer];
+            auto [begin, end] = m_overlaps.equal_range(key);
+
+            if (slot != entity) {
+                // Сущность не владела тайлом — убираем её из очереди ожидания
+                for (auto it = begin; it != end; ++it) {
+                    if (it->second == entity) {
+                        m_overlaps.erase(it);
+                        break;
+                    }
+                }
+                continue;
+            }
+
+            // Освобождаем тайл и передаём его следующему претенденту того же слоя
+            slot = entt::null;
+            for (auto it = begin; it != end; ++it) {
+                auto owner = m_footprints.find(it->second);
+                if (owner != m_footprints.end() && owner->second.layer == footprint.layer) {
+                    slot = it->second;
+                    m_overlaps.erase(it);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+TileOccupancyGrid::Cell* TileOccupancyGrid::findCell(int tileX, int tileY) {
+    return const_cast<Cell*>(std::as_const(*this).findCell(tileX, tileY));
+}
+
+const TileOccupancyGrid::Cell* TileOccupancyGrid::findCell(int tileX, int tileY) const {
+    if (tileX >= 0 && tileY >= 0 && tileX < m_width && tileY < m_height) {
+        return &m_dense[static_cast<size_t>(tileY) * m_width + tileX];
+    }
+
+    if (m_chunks.empty()) {
+        return nullptr;
+    }
+
+    const int chunkX = floorDiv(tileX, CHUNK_SIZE);
+    const int chunkY = floorDiv(tileY, CHUNK_SIZE);
+    auto it = m_chunks.find(packKey(chunkX, chunkY));
+    if (it == m_chunks.end()) {
+        return nullptr;
+    }
+
+    const int localX = tileX - chunkX * CHUNK_SIZE;
+    const int localY = tileY - chunkY * CHUNK_SIZE;
+    return &(*it->second)[localY * CHUNK_SIZE + localX];
+}
+
+TileOccupancyGrid::Cell& TileOccupancyGrid::cellAt(int tileX, int tileY) {
+    if (tileX >= 0 && tileY >= 0 && tileX < m_width && tileY < m_height) {
+        return m_dense[static_cast<size_t>(tileY) * m_width + tileX];
+    }
+
+    const int chunkX = floorDiv(tileX, CHUNK_SIZE);
+    const int chunkY = floorDiv(tileY, CHUNK_SIZE);
+    auto& chunk = m_chunks[packKey(chunkX, chunkY)];
+    if (!chunk) {
+        chunk = std::make_unique<Chunk>();
+        chunk->fill(emptyCell());
+    }
+
+    const int localX = tileX - chunkX * CHUNK_SIZE;
+    const int localY = tileY - chunkY * CHUNK_SIZE;
+    return (*chunk)[localY * CHUNK_SIZE + localX];
+}
+
+uint64_t TileOccupancyGrid::packKey(int a, int b) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(a)) << 32) | static_cast<uint32_t>(b);
+}
+
+TileOccupancyGrid::Footprint TileOccupancyGrid::footprintOf(const TilePositionComponent& position) {
+    return Footprint{position.tileX, position.tileY, std::max(1, position.widthTiles),
+                     std::max(1, position.heightTiles), position.occupancyLayer,
+                     position.autoSync};
+}
+
+TileOccupancyGrid::Cell TileOccupancyGrid::emptyCell() {
+    Cell cell;
+    cell.fill(entt::null);
+    return cell;
+}
+
+} // namespace core
@@ -0,0 +1,310 @@
+#include "core/TrendSeries.h"
+#include "core/Config.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace core {
+
+TrendSettings TrendSettings::fromConfig() {
+    auto& config = Config::getInstance();
+
+    TrendSettings settings;
+    settings.rawCapacity = config.get("trends.rawCapacity", settings.rawCapacity);
+    settings.levelCapacity = config.get("trends.levelCapacity", settings.levelCapacity);
+    settings.pointsPerPixel = config.get("trends.pointsPerPixel", settings.pointsPerPixel);
+    return settings;
+}
+
+namespace {
+
+TrendSettings sanitize(TrendSettings settings) {
+    settings.rawCapacity = std::max<size_t>(settings.rawCapacity, 16);
+    settings.levelCapacity = std::max<size_t>(settings.levelCapacity, 16);
+    settings.pointsPerPixel = std::max(settings.pointsPerPixel, 0.5);
+    return settings;
+}
+
+/// Первый логический индекс [0, size), для которого pred ложен (pred монотонен)
+template<typename Pred>
+size_t partitionPoint(size_t size, Pred pred) {
+    size_t low = 0;
+    size_t high = size;
+    while (low < high) {
+        const size_t mid = low + (high - low) / 2;
+        if (pred(mid)) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+} // namespace
+
+// ============================================================
+// Bucket
+// ============================================================
+
+void TrendSeries::Bucket::addSample(double time, double value) {
+    if (count == 0) {
+        firstTime = lastTime = minTime = maxTime = time;
+        min = max = value;
+    } else {
+        lastTime = time;
+        if (value < min) {
+            min = value;
+            minTime = time;
+        }
+        if (value > max) {
+            max = value;
+            maxTime = time;
+        }
+    }
+    ++count;
+}
+
+// ============================================================
+// TrendSeries
+// ============================================================
+
+TrendSeries::TrendSeries(const TrendSettings& settings)
+    : m_settings(sanitize(settings)) {
+    clear();
+}
+
+void TrendSeries::clear() {
+    m_raw.reset(m_settings.rawCapacity);
+    for (Level& level : m_levels) {
+        level.closed.reset(m_settings.levelCapacity);
+        level.open = Bucket{};
+        level.children = 0;
+    }
+    m_totalCount = 0;
+    m_last = TrendPoint{};
+    m_hasLast = false;
+}
+
+void TrendSeries::append(double time, double value) {
+    if (!std::isfinite(time) || (m_hasLast && time < m_last.time)) {
+        return;
+    }
+
+    m_raw.push(TrendPoint{time, value});
+    m_last = TrendPoint{time, value};
+    m_hasLast = true;
+    ++m_totalCount;
+
+    // Каждый уровень видит отсчёт сразу; закрытие идёт каскадом снизу вверх
+    for (Level& level : m_levels) {
+        level.open.addSample(time, value);
+    }
+    if (++m_levels[0].children == LEVEL_FACTOR) {
+        closeLevel(0);
+    }
+}
+
+void TrendSeries::closeLevel(size_t level) {
+    Level& current = m_levels[level];
+    current.closed.push(current.open);
+    current.open = Bucket{};
+    current.children = 0;
+
+    if (level + 1 < LEVEL_COUNT && ++m_levels[level + 1].children == LEVEL_FACTOR) {
+        closeLevel(level + 1);
+    }
+}
+
+void TrendSeries::query(double begin, double end, size_t pixelWidth,
+                        std::vector<TrendPoint>& out) const {
+    out.clear();
+    if (!m_hasLast || end < begin) {
+        return;
+    }
+
+    const double widthPoints = static_cast<double>(std::max<size_t>(pixelWidth, 1)) *
+                               m_settings.pointsPerPixel;
+    const size_t threshold = std::max<size_t>(3, static_cast<size_t>(widthPoints));
+    const size_t limit = threshold * LTTB_INPUT_FACTOR;
+
+    m_candidates.clear();
+    bool collected = collectRaw(begin, end, limit, m_candidates);
+    for (size_t level = 0; !collected && level < LEVEL_COUNT; ++level) {
+        collected = collectFromLevel(level, begin, end, limit, false, m_candidates);
+    }
+    if (!collected) {
+        // Окно шире всей сохранённой истории — берём самый грубый уровень целиком
+        collectFromLevel(LEVEL_COUNT - 1, begin, end, limit, true, m_candidates);
+    }
+
+    if (m_candidates.size() <= threshold) {
+        out.assign(m_candidates.begin(), m_candidates.end());
+    } else {
+        downsampleLttb(m_candidates, threshold, out);
+    }
+}
+
+bool TrendSeries::collectRaw(double begin, double end, size_t limit,
+                             std::vector<TrendPoint>& out) const {
+    if (m_raw.evicted() && m_raw[0].time > begin) {
+        return false;
+    }
+
+    const size_t size = m_raw.size();
+    size_t first = partitionPoint(size, [&](size_t i) { return m_raw[i].time < begin; });
+    size_t last = partitionPoint(size, [&](size_t i) { return m_raw[i].time <= end; });
+    // По одной точке за краями окна
+    if (first > 0) {
+        --first;
+    }
+    if (last < size) {
+        ++last;
+    }
+    if (last - first > limit) {
+        return false;
+    }
+
+    for (size_t i = first; i < last; ++i) {
+        out.push_back(m_raw[i]);
+    }
+    return true;
+}
+
+bool TrendSeries::collectFromLevel(size_t level, double begin, double end, size_t limit,
+                                   bool force, std::vector<TrendPoint>& out) const {
+    const Level& current = m_levels[level];
+    const Ring<Bucket>& closed = current.closed;
+
+    if (!force && closed.evicted() && closed[0].firstTime > begin) {
+        return false;
+    }
+
+    const size_t size = closed.size();
+    size_t first = partitionPoint(size, [&](size_t i) { return closed[i].lastTime < begin; });
+    size_t last = partitionPoint(size, [&](size_t i) { return closed[i].firstTime <= end; });
+    if (first > 0) {
+        --first;
+    }
+    if (last < size) {
+        ++last;
+    }
+    // Открытый агрегат идёт после закрытых: нужен, только если за окном их нет
+    const bool withOpen = current.open.count > 0 && last == size;
+
+    const size_t points = 2 * (last - first) + (withOpen ? 3 : 0);
+    if (!force && points > limit) {
+        return false;
+    }
+
+    // Каждый агрегат раскрывается в min и max в порядке их появления
+    auto emit = [&out](const Bucket& bucket) {
+        if (bucket.minTime == bucket.maxTime) {
+            out.push_back(TrendPoint{bucket.minTime, bucket.min});
+        } else if (bucket.minTime < bucket.maxTime) {
+            out.push_back(TrendPoint{bucket.minTime, bucket.min});
+            out.push_back(TrendPoint{bucket.maxTime, bucket.max});
+        } else {
+            out.push_back(TrendPoint{bucket.maxTime, bucket.max});
+            out.push_back(TrendPoint{bucket.minTime, bucket.min});
+        }
+    };
+
+    for (size_t i = first; i < last; ++i) {
+        emit(closed[i]);
+    }
+    if (withOpen) {
+        emit(current.open);
+        // Последний отсчёт открытого агрегата — текущее значение, линия доходит до него
+        if (out.back().time < m_last.time) {
+            out.push_back(m_last);
+        }
+    }
+    return true;
+}
+
+void TrendSeries::downsampleLttb(std::span<const TrendPoint> input, size_t threshold,
+                                 std::vector<TrendPoint>& out) {
+    const size_t size = input.size();
+    if (threshold < 3 || threshold >= size) {
+        out.assign(input.begin(), input.end());
+        return;
+    }
+
+    out.clear();
+    out.reserve(threshold);
+    out.push_back(input.front());
+
+    // Внутренние корзины делят точки между первой и последней
+    const double bucketSize = static_cast<double>(size - 2) / static_cast<double>(threshold - 2);
+    size_t selected = 0;
+
+    for (size_t bucket = 0; bucket < threshold - 2; ++bucket) {
+        const size_t rangeBegin = static_cast<size_t>(static_cast<double>(bucket) * bucketSize) + 1;
+        const size_t rangeEnd =
+            std::min(static_cast<size_t>(static_cast<double>(bucket + 1) * bucketSize) + 1,
+                     size - 1);
+
+        // Среднее следующей корзины (для последней — конечная точка)
+        const size_t nextBegin = rangeEnd;
+        const size_t nextEnd =
+            std::min(static_cast<size_t>(static_cast<double>(bucket + 2) * bucketSize) + 1, size);
+        double avgTime = 0.0;
+        double avgValue = 0.0;
+        for (size_t i = nextBegin; i < nextEnd; ++i) {
+            avgTime += input[i].time;
+            avgValue += input[i].value;
+        }
+        const double nextCount = static_cast<double>(std::max<size_t>(nextEnd - nextBegin, 1));
+        avgTime /= nextCount;
+        avgValue /= nextCount;
+
+        const TrendPoint& a = input[selected];
+        double maxArea = -1.0;
+        size_t best = rangeBegin;
+        for (size_t i = rangeBegin; i < rangeEnd; ++i) {
+            // Удвоенная площадь треугольника — для сравнения множитель не нужен
+            const double area = std::abs((a.time - avgTime) * (input[i].value - a.value) -
+                                         (a.time - input[i].time) * (avgValue - a.value));
+            if (area > maxArea) {
+                maxArea = area;
+                best = i;
+            }
+        }
+
+        out.push_back(input[best]);
+        selected = best;
+    }
+
+    out.push_back(input.back());
+}
+
+// ============================================================
+// TrendStore
+// ============================================================
+
+void TrendStore::append(StringId tag, double time, double value) {
+    auto it = m_series.find(tag);
+    if (it == m_series.end()) {
+        it = m_series.emplace(tag, std::make_unique<TrendSeries>(m_settings)).first;
+        m_tags.push_back(tag);
+    }
+    it->second->append(time, value);
+}
+
+TrendSeries* TrendStore::find(StringId tag) {
+    auto it = m_series.find(tag);
+    return it != m_series.end() ? it->second.get() : nullptr;
+}
+
+const TrendSeries* TrendStore::find(StringId tag) const {
+    auto it = m_series.find(tag);
+    return it != m_series.end() ? it->second.get() : nullptr;
+}
+
+void TrendStore::clear() {
+    m_series.clear();
+    m_tags.clear();
+}
+
+} // namespace core
@@ -7,11 +7,20 @@
 #include "core/SpriteMetadata.h"
 #include "core/AnimationData.h"
 #include "core/Config.h"
+#include "core/ThreadConfig.h"
+#include "core/TileOccupancyGrid.h"
+#include "core/NavigationGrid.h"
+#include "core/PathfindingService.h"
+#include "core/EntityIndex.h"
+#include "core/SpatialIndex.h"
+#include "core/FrameArena.h"
+#include "core/AllocationTracker.h"
 #include "core/systems/RenderSystem.h"
 #include "core/systems/UpdateSystem.h"
 #include "core/systems/LifetimeSystem.h"
 #include "core/systems/CollisionSystem.h"
 #include "core/systems/FSMSystem.h"
+#include "core/systems/DiscreteEventSystem.h"
 #include "core/systems/TilePositionSystem.h"
 #include "core/systems/AnimationSystem.h"
 #include "core/systems/AnimationSystemV2.h"
@@ -21,17 +30,35 @@
 #include "simulation/PhysicsWorld.h"
 #include "simulation/systems/PhysicsSystem.h"
 #include "simulation/PhysicsThread.h"
+#include "simulation/PhysicsLod.h"
+#include "simulation/CollisionSensorBridge.h"
+#include "core/TrendSeries.h"
 #include "core/Components.h"
 #include "core/Logger.h"
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Image.hpp>
 #include <SFML/Window/Event.hpp>
 #include <algorithm>
+#include <chrono>
 #include <sstream>
 #include <iomanip>
 
 namespace core {
 
+namespace {
+
+// Состояния FSM демо-лампы: сравнение StringId без интернирования литералов каждый кадр
+const StringId LAMP_OFF("off");
+const StringId LAMP_ON("on");
+const StringId LAMP_BROKEN("broken");
+
+// Теги трендов показателей сцены
+const StringId TREND_FRAME_TIME("Scene.FrameTimeMs");
+const StringId TREND_ENTITIES("Scene.Entities");
+const StringId TREND_FAR_BODIES("Physics.FarBodies");
+
+} // namespace
+
 GameState::GameState(StateManager* stateManager)
     : State(stateManager)
     , m_font(nullptr)
@@ -98,6 +125,16 @@ void GameState::onExit() {
         m_physicsThread->stop();
         LOG_INFO("Physics thread stopped");
     }
+
+    // Тела сенсоров удаляются только при остановленном потоке физики
+    if (m_collisionSensorBridge) {
+        m_collisionSystem->setBroadphase(nullptr);
+        m_collisionSensorBridge->shutdown();
+    }
+
+    if (m_pathfinding) {
+        m_pathfinding->stop();
+    }
 }
 
 void GameState::onWindowResize(const sf::Vector2u& newSize) {
@@ -151,8 +188,24 @@ bool GameState::handleEvent(const sf::Event& event) {
         }
     }
 
-    // Обработка кликов мыши, если нужно
-    // TODO: Обработка кликов мыши для выделения объектов
+    // ЛКМ - выбор объекта под курсором через пространственный индекс
+    if (const auto* mousePressed = event.getIf<sf::Event::MouseButtonPressed>()) {
+        if (mousePressed->button == sf::Mouse::Button::Left && m_spatialIndex) {
+            // Аналог RenderWindow::mapPixelToCoords для m_worldView (окно здесь недоступно)
+            sf::Vector2f windowSize(getWindowSize());
+            sf::Vector2f normalized(-1.0f + 2.0f * mousePressed->position.x / windowSize.x,
+                                    1.0f - 2.0f * mousePressed->position.y / windowSize.y);
+            sf::Vector2f worldPos = m_worldView.getInverseTransform().transformPoint(normalized);
+
+            entt::entity picked = m_spatialIndex->pickTop(worldPos);
+            if (picked != entt::null) {
+                const auto* name = m_registry.try_get<NameComponent>(picked);
+                LOG_INFO("Picked entity {} '{}' at ({:.0f}, {:.0f})", static_cast<uint32_t>(picked),
+                         name ? name->name : "", worldPos.x, worldPos.y);
+            }
+            return true;
+        }
+    }
 
     return false;  // Не блокируем события
 }
@@ -261,6 +314,14 @@ void GameState::update(double dt) {
         m_renderSystem->setViewBounds(viewBounds);
     }
 
+    // Видимая область камеры — зона интереса для LOD физики
+    if (m_physicsLod) {
+        m_physicsLod->setFocusAreas({sf::FloatRect(
+            m_worldView.getCenter() - m_worldView.getSize() / 2.0f,
+            m_worldView.getSize()
+        )});
+    }
+
     // Обновление ECS систем
     if (m_updateSystem) {
         m_updateSystem->update(m_registry, dt);
@@ -271,6 +332,11 @@ void GameState::update(double dt) {
         m_lifetimeSystem->update(m_registry, dt);
     }
 
+    // Дискретные события процессов: срабатывают ровно на своём такте фиксированного шага
+    if (m_discreteEventSystem) {
+        m_discreteEventSystem->update(m_registry, dt);
+    }
+
     // Обновление системы коллизий (приоритет 100)
     if (m_collisionSystem) {
         m_collisionSystem->update(m_registry, dt);
@@ -282,21 +348,18 @@ void GameState::update(double dt) {
     }
 
     // === ДЕМОНСТРАЦИЯ FSM: Автоматическое переключение состояний лампы ===
-    // Переключаем состояние лампы на основе времени в текущем состоянии
-    auto fsmView = m_registry.view<EntityStateComponent, NameComponent>();
-    for (auto entity : fsmView) {
-        auto& fsm = fsmView.get<EntityStateComponent>(entity);
-        auto& name = fsmView.get<NameComponent>(entity);
-
-        // Обрабатываем только нашу тестовую лампу
-        if (name.name == "Lamp_FSM") {
+    // Переключаем состояние лампы на основе времени в текущем состоянии.
+    // Лампа ищется через индекс имён, без обхода всех FSM-сущностей
+    entt::entity lamp = m_entityIndex ? m_entityIndex->findByName("Lamp_FSM") : entt::null;
+    if (lamp != entt::null) {
+        if (auto* fsm = m_registry.try_get<EntityStateComponent>(lamp)) {
             // off → on после 3 секунд
-            if (fsm.isInState("off") && fsm.timeInState > 3.0f) {
-                fsm.setState("on");
+            if (fsm->isInState(LAMP_OFF) && fsm->timeInState > 3.0f) {
+                FSMSystem::setState(m_registry, lamp, LAMP_ON);
             }
             // on → broken после 3 секунд работы
-            else if (fsm.isInState("on") && fsm.timeInState > 3.0f) {
-                fsm.setState("broken");
+            else if (fsm->isInState(LAMP_ON) && fsm->timeInState > 3.0f) {
+                FSMSystem::setState(m_registry, lamp, LAMP_BROKEN);
             }
             // broken - конечное состояние, лампа "сломана"
         }
@@ -305,9 +368,9 @@ void GameState::update(double dt) {
     // Обновление Tile Systems (Milestone 1.3)
     if (m_tilePositionSystem) {
         m_tilePositionSystem->update(m_registry);
-        // TilePositionSystem обновляет слои объектов для Y-sorting
-        // Помечаем слои как измененные для пересортировки в RenderSystem
-        if (m_renderSystem) {
+        // TilePositionSystem обновляет слои объектов для Y-sorting.
+        // Пересортировка в RenderSystem нужна только если слой реально изменился
+        if (m_renderSystem && m_tilePositionSystem->layersChanged()) {
             m_renderSystem->markLayersDirty();
         }
     }
@@ -324,8 +387,14 @@ void GameState::update(double dt) {
         m_overlaySystem->update(m_registry);
     }
 
+    // Пространственный индекс: пересчёт границ изменённых и движущихся сущностей
+    if (m_spatialIndex) {
+        m_spatialIndex->update();
+    }
+
     // Обновление RenderSystem (подготовка данных для рендеринга)
     if (m_renderSystem) {
+        AllocationScope allocationScope(AllocationTag::Rendering);
         m_renderSystem->update(m_registry, dt);
     }
 
@@ -338,9 +407,20 @@ void GameState::update(double dt) {
         m_physicsThread->applyTransformsToRegistry();
     } else if (m_physicsSystem) {
         // Fallback: если поток не запущен, обновляем синхронно
+        AllocationScope allocationScope(AllocationTag::Simulation);
         m_physicsSystem->update(m_registry, dt);
     }
 
+    // Тренды показателей сцены (время — время симуляции с начала игры)
+    if (m_trends) {
+        m_trends->append(TREND_ENTITIES, m_elapsedTime,
+                         static_cast<double>(m_registry.storage<entt::entity>().size()));
+        if (m_physicsLod) {
+            m_trends->append(TREND_FAR_BODIES, m_elapsedTime,
+                             static_cast<double>(m_physicsLod->getFarBodyCount()));
+        }
+    }
+
     // TODO: Обновление OPC UA привязок
 
     // Обновляем информационный текст
@@ -362,6 +442,24 @@ void GameState::update(double dt) {
             oss << "Physics Steps: " << m_physicsThread->getStepCount() << "\n";
             oss << "Step Time: " << std::fixed << std::setprecision(2)
                 << m_physicsThread->getAverageStepTime() << "ms\n";
+            auto pacing = m_physicsThread->getPacingStats();
+            oss << "Physics Jitter: " << std::fixed << std::setprecision(2)
+                << pacing.meanJitterMs << "ms (max " << pacing.maxJitterMs << "ms, dropped "
+                << pacing.droppedTicks << ")\n";
+            if (m_physicsLod) {
+                oss << "Physics LOD Far Bodies: " << m_physicsLod->getFarBodyCount() << "\n";
+            }
+        }
+
+        // Выделения памяти по подсистемам (учёт всех new/delete — с ENABLE_ALLOCATION_TRACKING)
+        if (AllocationTracker::isHookEnabled()) {
+            oss << "Allocs/frame: " << AllocationTracker::getLastFrameAllocations() << "\n";
+            for (auto tag : {AllocationTag::Core, AllocationTag::Rendering,
+                             AllocationTag::Simulation, AllocationTag::Resources}) {
+                auto stats = AllocationTracker::getStats(tag);
+                oss << "  " << toString(tag) << ": " << stats.lastFrameAllocations << "/frame, "
+                    << stats.currentBytes / 1024 << "KB (peak " << stats.peakBytes / 1024 << "KB)\n";
+            }
         }
 
         oss << "\nControls:\n";
@@ -413,6 +511,15 @@ void GameState::render(sf::RenderWindow& window) {
         return;
     }
 
+    // Время кадра меряем по часам между вызовами render(): update() получает
+    // фиксированный шаг и вызывается 0..N раз за кадр
+    const auto frameStart = std::chrono::steady_clock::now();
+    if (m_trends && m_lastFrameStart.time_since_epoch().count() != 0) {
+        const std::chrono::duration<double, std::milli> frameTime = frameStart - m_lastFrameStart;
+        m_trends->append(TREND_FRAME_TIME, m_elapsedTime, frameTime.count());
+    }
+    m_lastFrameStart = frameStart;
+
     // Устанавливаем World View для рендеринга игровых объектов
     window.setView(m_worldView);
 
@@ -436,6 +543,9 @@ void GameState::render(sf::RenderWindow& window) {
     if (m_debugDrawPhysics && m_physicsWorld && m_physicsDebugDraw) {
         m_physicsDebugDraw->begin(&window);
         b2World_Draw(m_physicsWorld->getWorldId(), &m_physicsDebugDraw->getDebugDraw());
+        if (m_physicsLod) {
+            b2World_Draw(m_physicsLod->getFarWorld().getWorldId(), &m_physicsDebugDraw->getDebugDraw());
+        }
         m_physicsDebugDraw->end();
     }
 
@@ -483,6 +593,8 @@ void GameState::initializeScene() {
     m_lifetimeSystem = std::make_unique<LifetimeSystem>();
     m_collisionSystem = std::make_unique<CollisionSystem>();
     m_fsmSystem = std::make_unique<FSMSystem>();
+    m_discreteEventSystem = std::make_unique<DiscreteEventSystem>(
+        Config::getInstance().get("game.fixedTimestep", 1.0 / 60.0));
 
     // Инициализация Tile Systems (Milestone 1.3)
     LOG_INFO("Initializing Tile Systems (Milestone 1.3)");
@@ -492,19 +604,83 @@ void GameState::initializeScene() {
     m_overlaySystem = std::make_unique<OverlaySystem>();
     m_tileMapSystem = std::make_unique<rendering::TileMapSystem>();
 
+    // Карта грузится до сетки занятости и навигации: их размер и рельеф берутся из неё
+    const std::string mapPath = Config::getInstance().get("game.map", std::string());
+    if (!mapPath.empty() && !m_tileMapSystem->loadMap(mapPath)) {
+        LOG_WARN("Failed to load map '{}', using the test scene only", mapPath);
+    }
+
+    // Индекс занятости тайлов: размер по загруженной карте, иначе по тестовой сцене
+    int gridWidth = TEST_SCENE_WIDTH_TILES;
+    int gridHeight = TEST_SCENE_HEIGHT_TILES;
+    if (m_tileMapSystem->isLoaded()) {
+        gridWidth = std::max(gridWidth, m_tileMapSystem->getMapWidth());
+        gridHeight = std::max(gridHeight, m_tileMapSystem->getMapHeight());
+    }
+    m_occupancyGrid = std::make_unique<TileOccupancyGrid>(gridWidth, gridHeight);
+    m_occupancyGrid->init(m_registry);
+
+    // Проходимость для поиска путей: объекты — из индекса занятости, рельеф — из карты
+    m_navigationGrid = std::make_unique<NavigationGrid>(gridWidth, gridHeight);
+    if (m_tileMapSystem->isLoaded()) {
+        const std::vector<uint8_t> blocked = m_tileMapSystem->buildBlockedMask();
+        const size_t mapWidth = static_cast<size_t>(m_tileMapSystem->getMapWidth());
+        for (size_t i = 0; i < blocked.size(); ++i) {
+            if (blocked[i] != 0) {
+                m_navigationGrid->setTerrainBlocked(static_cast<int>(i % mapWidth),
+                                                    static_cast<int>(i / mapWidth), true);
+            }
+        }
+    }
+    m_navigationGrid->init(*m_occupancyGrid);
+
+    m_pathfinding = std::make_unique<PathfindingService>(*m_navigationGrid);
+    m_pathfinding->start();
+
+    // Индекс имён и тегов (до создания сцены, чтобы все сущности попали через сигналы)
+    m_entityIndex = std::make_unique<EntityIndex>();
+    m_entityIndex->init(m_registry);
+
+    // Пространственный индекс для picking (мышь, выделение рамкой, скрипты)
+    m_spatialIndex = std::make_unique<SpatialIndex>(
+        Config::getInstance().get("spatialIndex.cellSize", SpatialIndex::DEFAULT_CELL_SIZE));
+    m_spatialIndex->init(m_registry);
+
+    // Ёмкости трендов — из секции trends конфигурации
+    m_trends = std::make_unique<TrendStore>(TrendSettings::fromConfig());
+
     // Инициализация физики (Milestone 2.1)
     LOG_INFO("Initializing Physics (Milestone 2.1)");
     m_physicsWorld = std::make_unique<simulation::PhysicsWorld>(b2Vec2{0.0f, 9.8f});
     m_physicsSystem = std::make_unique<simulation::PhysicsSystem>(*m_physicsWorld);
     m_physicsSystem->init(m_registry);
+
+    auto lodSettings = simulation::PhysicsLodSettings::fromConfig();
+    if (lodSettings.enabled) {
+        m_physicsLod = std::make_unique<simulation::PhysicsLod>(*m_physicsWorld, lodSettings);
+        m_physicsSystem->setLod(m_physicsLod.get());
+    }
     m_physicsDebugDraw = std::make_unique<rendering::PhysicsDebugDraw>();
 
+    // Пересечения CollisionComponent через broadphase Box2D вместо O(n²) проверки AABB
+    const std::string collisionBroadphase =
+        Config::getInstance().get("collision.broadphase", std::string("aabb"));
+    if (collisionBroadphase == "box2d") {
+        m_collisionSensorBridge = std::make_unique<simulation::CollisionSensorBridge>(*m_physicsWorld);
+        m_collisionSensorBridge->init(m_registry);
+        m_physicsSystem->addStepListener(m_collisionSensorBridge.get());
+        m_collisionSystem->setBroadphase(m_collisionSensorBridge.get());
+        LOG_INFO("Collision broadphase: Box2D sensors");
+    }
+
     // Инициализация потока физики (Task 6.3)
     LOG_INFO("Initializing Physics Thread (Task 6)");
     m_physicsThread = std::make_unique<simulation::PhysicsThread>(
         *m_physicsWorld, *m_physicsSystem, m_registry
     );
 
+    m_physicsThread->setThreadConfig(ThreadSchedulingConfig::fromConfig("physics", "opc-physics"));
+
     // Устанавливаем обработчик исключений для потока физики
     m_physicsThread->setExceptionHandler([](const std::exception& e) {
         LOG_ERROR("Physics thread exception: {}", e.what());
@@ -678,12 +854,12 @@ void GameState::createTileTestScene() {
 
     // === 1. Создаем "пол" из зеленых тайлов (слой Ground) ===
     LOG_INFO("Creating ground layer");
-    for (int y = 0; y < 8; ++y) {
-        for (int x = 0; x < 12; ++x) {
+    for (int y = 0; y < TEST_SCENE_HEIGHT_TILES; ++y) {
+        for (int x = 0; x < TEST_SCENE_WIDTH_TILES; ++x) {
             auto entity = m_registry.create();
 
             m_registry.emplace<NameComponent>(entity, "Ground_" + std::to_string(y) + "_" + std::to_string(x));
-            m_registry.emplace<TilePositionComponent>(entity, x, y, 1, 1);
+            m_registry.emplace<TilePositionComponent>(entity, x, y, 1, 1, true, OccupancyLayer::Ground);
 
             auto& transform = m_registry.emplace<TransformComponent>(entity);
             // Позиция будет автоматически установлена TilePositionSystem
@@ -695,16 +871,17 @@ void GameState::createTileTestScene() {
         }
     }
 
-    // Добавляем немного "воды" на пол
+    // Добавляем немного "воды" на пол (поиск тайла пола через индекс занятости)
     for (int x = 2; x < 6; ++x) {
         for (int y = 3; y < 5; ++y) {
-            auto view = m_registry.view<TilePositionComponent, SpriteComponent>();
-            for (auto entity : view) {
-                auto& tilePos = view.get<TilePositionComponent>(entity);
-                if (tilePos.tileX == x && tilePos.tileY == y) {
-                    auto& sprite = view.get<SpriteComponent>(entity);
-                    sprite.textureName = "tile_blue";
-                }
+            m_navigationGrid->setTerrainBlocked(x, y, true);  // Вода непроходима
+
+            entt::entity ground = m_occupancyGrid->at(x, y, OccupancyLayer::Ground);
+            if (ground == entt::null) {
+                continue;
+            }
+            if (auto* sprite = m_registry.try_get<SpriteComponent>(ground)) {
+                sprite->textureName = "tile_blue";
             }
         }
     }
@@ -873,7 +1050,9 @@ void GameState::createTileTestScene() {
         collision.isTrigger = false;
         collision.layer = "wall";
         collision.setFromTileSize(1, 2);
-        collision.onCollisionEnter = [](entt::entity other) {
+
+        auto& callbacks = m_registry.emplace<CollisionCallbacksComponent>(wall1);
+        callbacks.onCollisionEnter = [](entt::entity other) {
             LOG_INFO("Wall collision ENTER with entity {}", static_cast<uint32_t>(other));
         };
 
@@ -925,11 +1104,12 @@ void GameState::createTileTestScene() {
         collision.layer = "player";
         collision.setFromTileSize(1, 1);
 
-        collision.onCollisionEnter = [](entt::entity other) {
+        auto& callbacks = m_registry.emplace<CollisionCallbacksComponent>(movingObj);
+        callbacks.onCollisionEnter = [](entt::entity other) {
             LOG_WARN("MovingObject collision ENTER with entity {}", static_cast<uint32_t>(other));
         };
 
-        collision.onCollisionExit = [](entt::entity other) {
+        callbacks.onCollisionExit = [](entt::entity other) {
             LOG_INFO("MovingObject collision EXIT with entity {}", static_cast<uint32_t>(other));
         };
 
@@ -955,11 +1135,12 @@ void GameState::createTileTestScene() {
         collision.layer = "trigger";
         collision.setFromTileSize(3, 2);
 
-        collision.onCollisionEnter = [](entt::entity other) {
+        auto& callbacks = m_registry.emplace<CollisionCallbacksComponent>(trigger);
+        callbacks.onCollisionEnter = [](entt::entity other) {
             LOG_WARN("Entity {} ENTERED trigger zone!", static_cast<uint32_t>(other));
         };
 
-        collision.onCollisionExit = [](entt::entity other) {
+        callbacks.onCollisionExit = [](entt::entity other) {
             LOG_INFO("Entity {} LEFT trigger zone", static_cast<uint32_t>(other));
         };
 
@@ -981,32 +1162,33 @@ void GameState::createTileTestScene() {
         sprite.color = sf::Color(128, 128, 128);  // Серая (выключенная)
 
         // Добавляем FSM компонент с начальным состоянием "off"
-        auto& fsm = m_registry.emplace<EntityStateComponent>(lamp, "off");
+        m_registry.emplace<EntityStateComponent>(lamp, LAMP_OFF);
 
-        // Регистрируем коллбеки для состояний
+        // Регистрируем коллбеки для состояний (отдельный холодный компонент)
         // ВАЖНО: Захватываем entity, чтобы получить доступ к компонентам через registry
-        fsm.registerOnEnter("off", [this, lamp]() {
+        auto& callbacks = m_registry.emplace<StateCallbacksComponent>(lamp);
+        callbacks.registerOnEnter(LAMP_OFF, [this, lamp]() {
             if (auto* spr = m_registry.try_get<SpriteComponent>(lamp)) {
                 spr->color = sf::Color(128, 128, 128);  // Серая
                 LOG_INFO("Lamp FSM: state → OFF (gray)");
             }
         });
 
-        fsm.registerOnEnter("on", [this, lamp]() {
+        callbacks.registerOnEnter(LAMP_ON, [this, lamp]() {
             if (auto* spr = m_registry.try_get<SpriteComponent>(lamp)) {
                 spr->color = sf::Color(255, 255, 0);  // Желтая (включенная)
                 LOG_INFO("Lamp FSM: state → ON (yellow)");
             }
         });
 
-        fsm.registerOnEnter("broken", [this, lamp]() {
+        callbacks.registerOnEnter(LAMP_BROKEN, [this, lamp]() {
             if (auto* spr = m_registry.try_get<SpriteComponent>(lamp)) {
                 spr->color = sf::Color(255, 0, 0);  // Красная (сломанная)
                 LOG_WARN("Lamp FSM: state → BROKEN (red) - permanent failure!");
             }
         });
 
-        fsm.registerOnExit("on", []() {
+        callbacks.registerOnExit(LAMP_ON, []() {
             LOG_INFO("Lamp FSM: exiting ON state");
         });
 
@@ -1035,8 +1217,9 @@ void GameState::drawDebugGrid(sf::RenderWindow& window) {
     int startY = static_cast<int>(top / TILE_SIZE) - 1;
     int endY = static_cast<int>(bottom / TILE_SIZE) + 1;
 
-    // Создаем массив вертексов для линий (2 точки на линию)
-    std::vector<sf::Vertex> lines;
+    // Создаем массив вертексов для линий (2 точки на линию) в арене кадра
+    std::pmr::vector<sf::Vertex> lines(&FrameArena::current());
+    lines.reserve(static_cast<size_t>((endX - startX + 1) + (endY - startY + 1)) * 2);
     sf::Color gridColor(0, 0, 0, 128);  // Черный полупрозрачный
 
     // Вертикальные линии
@@ -2,6 +2,7 @@
 #include "core/Components.h"
 #include "core/Logger.h"
 #include "core/EventBus.h"
+#include <algorithm>
 
 namespace core {
 
@@ -11,12 +12,20 @@ CollisionSystem::CollisionSystem() {
 
 CollisionSystem::~CollisionSystem() = default;
 
-void CollisionSystem::update(entt::registry& registry, double dt) {
+void CollisionSystem::update(entt::registry& registry, double /*dt*/) {
+    if (m_broadphase) {
+        updateFromBroadphase(registry);
+    } else {
+        updateBruteForce(registry);
+    }
+}
+
+void CollisionSystem::updateBruteForce(entt::registry& registry) {
     // Получаем view всех сущностей с коллизиями
     auto view = registry.view<TransformComponent, CollisionComponent>();
 
-    // Множество текущих активных коллизий
-    std::set<EntityPair> currentCollisions;
+    // Текущие активные коллизии (буфер с прошлого кадра, ёмкость сохраняется)
+    m_currentCollisions.clear();
 
     // Проверяем все пары сущностей на коллизии
     for (auto it1 = view.begin(); it1 != view.end(); ++it1) {
@@ -42,10 +51,11 @@ void CollisionSystem::update(entt::registry& registry, double dt) {
             if (checkAABB(boundsA, boundsB)) {
                 // Создаем пару сущностей
                 EntityPair pair(entityA, entityB);
-                currentCollisions.insert(pair);
+                m_currentCollisions.push_back(pair);
 
                 // Проверяем, была ли эта коллизия в предыдущем кадре
-                bool isNewCollision = m_previousCollisions.find(pair) == m_previousCollisions.end();
+                bool isNewCollision = !std::binary_search(m_previousCollisions.begin(),
+                                                          m_previousCollisions.end(), pair);
 
                 // Обрабатываем коллизию
                 handleCollision(registry, entityA, entityB, isNewCollision);
@@ -53,15 +63,64 @@ void CollisionSystem::update(entt::registry& registry, double dt) {
         }
     }
 
+    // Каждая пара проверяется один раз, поэтому после сортировки дубликатов нет
+    std::sort(m_currentCollisions.begin(), m_currentCollisions.end());
+
     // Обрабатываем коллизии, которые закончились (были в предыдущем кадре, но нет сейчас)
     for (const auto& pair : m_previousCollisions) {
-        if (currentCollisions.find(pair) == currentCollisions.end()) {
+        if (!std::binary_search(m_currentCollisions.begin(), m_currentCollisions.end(), pair)) {
             handleCollisionExit(registry, pair);
         }
     }
 
     // Обновляем список активных коллизий для следующего кадра
-    m_previousCollisions = std::move(currentCollisions);
+    m_previousCollisions.swap(m_currentCollisions);
+}
+
+void CollisionSystem::updateFromBroadphase(entt::registry& registry) {
+    m_pairChanges.clear();
+    m_broadphase->drainPairChanges(m_pairChanges);
+
+    // m_previousCollisions — активные пары, m_currentCollisions — вошедшие в этом кадре
+    m_currentCollisions.clear();
+
+    // Изменения применяются по порядку: начало и конец пары в одном кадре дают Enter и Exit
+    for (const auto& change : m_pairChanges) {
+        EntityPair pair(change.entityA, change.entityB);
+        auto it = std::lower_bound(m_previousCollisions.begin(), m_previousCollisions.end(), pair);
+        const bool active = it != m_previousCollisions.end() && *it == pair;
+
+        if (change.began && !active) {
+            m_previousCollisions.insert(it, pair);
+            m_currentCollisions.push_back(pair);
+            handleCollision(registry, pair.first, pair.second, true);
+        } else if (!change.began && active) {
+            m_previousCollisions.erase(it);
+            handleCollisionExit(registry, pair);
+        }
+    }
+
+    // Пары удалённых сущностей (или потерявших CollisionComponent) завершаются сразу,
+    // не дожидаясь, пока broadphase сообщит об этом
+    auto isStale = [&registry](const EntityPair& pair) {
+        return !registry.valid(pair.first) || !registry.valid(pair.second) ||
+               !registry.all_of<CollisionComponent>(pair.first) ||
+               !registry.all_of<CollisionComponent>(pair.second);
+    };
+    auto stale = std::stable_partition(m_previousCollisions.begin(), m_previousCollisions.end(),
+                                       [&](const EntityPair& pair) { return !isStale(pair); });
+    for (auto it = stale; it != m_previousCollisions.end(); ++it) {
+        handleCollisionExit(registry, *it);
+    }
+    m_previousCollisions.erase(stale, m_previousCollisions.end());
+
+    // Остальные активные пары продолжают пересекаться
+    std::sort(m_currentCollisions.begin(), m_currentCollisions.end());
+    for (const auto& pair : m_previousCollisions) {
+        if (!std::binary_search(m_currentCollisions.begin(), m_currentCollisions.end(), pair)) {
+            handleCollision(registry, pair.first, pair.second, false);
+        }
+    }
 }
 
 bool CollisionSystem::checkAABB(const sf::FloatRect& a, const sf::FloatRect& b) const {
@@ -95,13 +154,17 @@ void CollisionSystem::handleCollision(entt::registry& registry, entt::entity ent
         );
     }
 
+    // Коллбеки хранятся в отдельном (холодном) компоненте и есть не у всех сущностей
+    auto* callbacksA = registry.try_get<CollisionCallbacksComponent>(entityA);
+    auto* callbacksB = registry.try_get<CollisionCallbacksComponent>(entityB);
+
     // Если это новая коллизия, вызываем onCollisionEnter
     if (isNewCollision) {
-        if (collisionA->onCollisionEnter) {
-            collisionA->onCollisionEnter(entityB);
+        if (callbacksA && callbacksA->onCollisionEnter) {
+            callbacksA->onCollisionEnter(entityB);
         }
-        if (collisionB->onCollisionEnter) {
-            collisionB->onCollisionEnter(entityA);
+        if (callbacksB && callbacksB->onCollisionEnter) {
+            callbacksB->onCollisionEnter(entityA);
         }
 
         LOG_TRACE("Collision ENTER: entity {} <-> entity {}", static_cast<uint32_t>(entityA), static_cast<uint32_t>(entityB));
@@ -112,11 +175,11 @@ void CollisionSystem::handleCollision(entt::registry& registry, entt::entity ent
     }
     // Иначе вызываем onCollisionStay (продолжающаяся коллизия)
     else {
-        if (collisionA->onCollisionStay) {
-            collisionA->onCollisionStay(entityB);
+        if (callbacksA && callbacksA->onCollisionStay) {
+            callbacksA->onCollisionStay(entityB);
         }
-        if (collisionB->onCollisionStay) {
-            collisionB->onCollisionStay(entityA);
+        if (callbacksB && callbacksB->onCollisionStay) {
+            callbacksB->onCollisionStay(entityA);
         }
 
         // Публикуем событие продолжения коллизии
@@ -126,16 +189,20 @@ void CollisionSystem::handleCollision(entt::registry& registry, entt::entity ent
 }
 
 void CollisionSystem::handleCollisionExit(entt::registry& registry, const EntityPair& pair) {
-    // Получаем компоненты коллизий
-    auto* collisionA = registry.try_get<CollisionComponent>(pair.first);
-    auto* collisionB = registry.try_get<CollisionComponent>(pair.second);
+    // Получаем коллбеки коллизий (сущность могла быть уничтожена)
+    auto* callbacksA = registry.valid(pair.first)
+                           ? registry.try_get<CollisionCallbacksComponent>(pair.first)
+                           : nullptr;
+    auto* callbacksB = registry.valid(pair.second)
+                           ? registry.try_get<CollisionCallbacksComponent>(pair.second)
+                           : nullptr;
 
     // Вызываем коллбеки выхода из коллизии
-    if (collisionA && collisionA->onCollisionExit) {
-        collisionA->onCollisionExit(pair.second);
+    if (callbacksA && callbacksA->onCollisionExit) {
+        callbacksA->onCollisionExit(pair.second);
     }
-    if (collisionB && collisionB->onCollisionExit) {
-        collisionB->onCollisionExit(pair.first);
+    if (callbacksB && callbacksB->onCollisionExit) {
+        callbacksB->onCollisionExit(pair.first);
     }
 
     LOG_TRACE("Collision EXIT: entity {} <-> entity {}", static_cast<uint32_t>(pair.first), static_cast<uint32_t>(pair.second));
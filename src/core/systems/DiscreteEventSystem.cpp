@@ -0,0 +1,148 @@
+#include "core/systems/DiscreteEventSystem.h"
+#include "core/Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace core {
+
+namespace {
+
+/// Допуск округления при переводе секунд в такты (37.5 с / (1/60) ≠ ровно 2250.0)
+constexpr double TICK_EPSILON = 1e-6;
+
+SimEventId makeId(uint32_t slot, uint32_t generation) {
+    return (static_cast<SimEventId>(generation) << 32) | slot;
+}
+
+} // namespace
+
+DiscreteEventSystem::DiscreteEventSystem(double tickSeconds)
+    : m_tickSeconds(tickSeconds > 0.0 ? tickSeconds : 1.0 / 60.0) {
+}
+
+void DiscreteEventSystem::setHandler(StringId kind, SimEventHandler handler) {
+    m_handlers[kind] = std::move(handler);
+}
+
+SimEventId DiscreteEventSystem::scheduleAt(SimTick tick, StringId kind, entt::entity entity,
+                                           uint64_t data) {
+    uint32_t slotIndex;
+    if (!m_freeSlots.empty()) {
+        slotIndex = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    } else {
+        slotIndex = static_cast<uint32_t>(m_slots.size());
+        m_slots.emplace_back();
+    }
+
+    Slot& slot = m_slots[slotIndex];
+    slot.pending = true;
+    slot.event.id = makeId(slotIndex, slot.generation);
+    slot.event.tick = std::max(tick, m_now);
+    slot.event.kind = kind;
+    slot.event.entity = entity;
+    slot.event.data = data;
+
+    m_heap.push_back(HeapEntry{slot.event.tick, m_nextSequence++, slotIndex, slot.generation});
+    std::push_heap(m_heap.begin(), m_heap.end(), later);
+    ++m_pendingCount;
+    return slot.event.id;
+}
+
+SimEventId DiscreteEventSystem::scheduleAfter(double seconds, StringId kind, entt::entity entity,
+                                              uint64_t data) {
+    return scheduleAt(m_now + toTicks(seconds), kind, entity, data);
+}
+
+bool DiscreteEventSystem::cancel(SimEventId id) {
+    if (!findSlot(id)) {
+        return false;
+    }
+    releaseSlot(static_cast<uint32_t>(id & 0xFFFFFFFFu));
+    dropCancelled();
+    return true;
+}
+
+bool DiscreteEventSystem::isPending(SimEventId id) const {
+    return findSlot(id) != nullptr;
+}
+
+void DiscreteEventSystem::update(entt::registry& registry, double dt) {
+    m_accumulator += dt;
+    const double ticks = std::floor(m_accumulator / m_tickSeconds + TICK_EPSILON);
+    if (ticks < 1.0) {
+        return;
+    }
+    m_accumulator = std::max(0.0, m_accumulator - ticks * m_tickSeconds);
+    advanceTo(registry, m_now + static_cast<SimTick>(ticks));
+}
+
+size_t DiscreteEventSystem::advanceTo(entt::registry& registry, SimTick tick) {
+    if (tick < m_now) {
+        return 0;
+    }
+
+    size_t dispatched = 0;
+    while (!m_heap.empty() && m_heap.front().tick <= tick) {
+        std::pop_heap(m_heap.begin(), m_heap.end(), later);
+        const uint32_t slotIndex = m_heap.back().slot;
+        m_heap.pop_back();
+
+        // Копия: обработчик может планировать события и перераспределить пул
+        const SimEvent event = m_slots[slotIndex].event;
+        releaseSlot(slotIndex);
+        dropCancelled();
+        m_now = event.tick;
+
+        auto it = m_handlers.find(event.kind);
+        if (it != m_handlers.end() && it->second) {
+            it->second(registry, event);
+        } else {
+            LOG_WARN("DiscreteEventSystem: no handler for event '{}'", event.kind.str());
+        }
+        ++dispatched;
+    }
+
+    m_now = tick;
+    m_dispatchedCount += dispatched;
+    return dispatched;
+}
+
+SimTick DiscreteEventSystem::toTicks(double seconds) const {
+    if (!(seconds > 0.0)) {
+        return 0;
+    }
+    return static_cast<SimTick>(std::ceil(seconds / m_tickSeconds - TICK_EPSILON));
+}
+
+const DiscreteEventSystem::Slot* DiscreteEventSystem::findSlot(SimEventId id) const {
+    const auto slotIndex = static_cast<uint32_t>(id & 0xFFFFFFFFu);
+    const auto generation = static_cast<uint32_t>(id >> 32);
+    if (slotIndex >= m_slots.size()) {
+        return nullptr;
+    }
+    const Slot& slot = m_slots[slotIndex];
+    return slot.pending && slot.generation == generation ? &slot : nullptr;
+}
+
+void DiscreteEventSystem::releaseSlot(uint32_t slot) {
+    Slot& released = m_slots[slot];
+    released.pending = false;
+    released.generation = released.generation == 0xFFFFFFFFu ? 1 : released.generation + 1;
+    m_freeSlots.push_back(slot);
+    --m_pendingCount;
+}
+
+void DiscreteEventSystem::dropCancelled() {
+    while (!m_heap.empty()) {
+        const HeapEntry& top = m_heap.front();
+        if (m_slots[top.slot].pending && m_slots[top.slot].generation == top.generation) {
+            return;
+        }
+        std::pop_heap(m_heap.begin(), m_heap.end(), later);
+        m_heap.pop_back();
+    }
+}
+
+} // namespace core
@@ -23,4 +23,17 @@ void FSMSystem::update(entt::registry& registry, double dt) {
     }
 }
 
+bool FSMSystem::setState(entt::registry& registry, entt::entity entity, StringId newState) {
+    auto* stateComponent = registry.try_get<EntityStateComponent>(entity);
+    if (!stateComponent) {
+        LOG_WARN("FSMSystem::setState: entity {} has no EntityStateComponent",
+                 static_cast<uint32_t>(entity));
+        return false;
+    }
+
+    const auto* callbacks = registry.try_get<StateCallbacksComponent>(entity);
+    stateComponent->setState(newState, entity, callbacks);
+    return true;
+}
+
 } // namespace core
@@ -1,8 +1,11 @@
 #include "core/systems/LifetimeSystem.h"
 #include "core/Components.h"
 #include "core/Logger.h"
+#include "core/FrameArena.h"
 #include <algorithm>
 #include <cstdint>
+#include <memory_resource>
+#include <vector>
 
 namespace core {
 
@@ -10,8 +13,9 @@ void LifetimeSystem::update(entt::registry& registry, double dt) {
     // Получаем все сущности с LifetimeComponent
     auto view = registry.view<LifetimeComponent>();
 
-    // Собираем сущности для удаления (нельзя удалять во время итерации)
-    std::vector<entt::entity> entitiesToDestroy;
+    // Собираем сущности для удаления (нельзя удалять во время итерации).
+    // Список живёт только в этом кадре — берём память из арены кадра
+    std::pmr::vector<entt::entity> entitiesToDestroy(&FrameArena::current());
 
     for (auto entity : view) {
         // Обрабатываем сущность (fade-out эффекты и т.д.)
@@ -23,9 +23,9 @@ void OverlaySystem::syncOverlayPositions(entt::registry& registry) {
     auto view = registry.view<OverlayComponent, ParentComponent, TransformComponent>();
 
     for (auto entity : view) {
-        auto& overlay = view.get<OverlayComponent>(entity);
-        auto& parent = view.get<ParentComponent>(entity);
-        auto& transform = view.get<TransformComponent>(entity);
+        const auto& overlay = view.get<OverlayComponent>(entity);
+        const auto& parent = view.get<ParentComponent>(entity);
+        const auto& transform = view.get<TransformComponent>(entity);
 
         // Пропускаем если синхронизация отключена
         if (!overlay.syncWithParent) {
@@ -45,9 +45,17 @@ void OverlaySystem::syncOverlayPositions(entt::registry& registry) {
             continue;
         }
 
-        // Копируем позицию родителя и добавляем локальное смещение
-        transform.x = parentTransform->x + overlay.localOffset.x;
-        transform.y = parentTransform->y + overlay.localOffset.y;
+        // Копируем позицию родителя и добавляем локальное смещение.
+        // Через patch(): on_update оповещает SpatialIndex; без изменений сигнал не шлём
+        const float x = parentTransform->x + overlay.localOffset.x;
+        const float y = parentTransform->y + overlay.localOffset.y;
+        if (transform.x == x && transform.y == y) {
+            continue;
+        }
+        registry.patch<TransformComponent>(entity, [x, y](TransformComponent& synced) {
+            synced.x = x;
+            synced.y = y;
+        });
 
         // Наследуем вращение родителя (опционально)
         // transform.rotation = parentTransform->rotation;
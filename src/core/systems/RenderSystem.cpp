@@ -2,6 +2,7 @@
 #include "core/Components.h"
 #include "core/ResourceManager.h"
 #include "core/Logger.h"
+#include "core/MotionKernels.h"
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/Transformable.hpp>
 #include <algorithm>
@@ -18,25 +19,141 @@ RenderSystem::RenderSystem(ResourceManager* resourceManager)
     LOG_DEBUG("RenderSystem initialized");
 }
 
+RenderSystem::~RenderSystem() {
+    disconnect();
+}
+
+void RenderSystem::connect(entt::registry& registry) {
+    disconnect();
+    m_registry = &registry;
+    m_handles = &EntityHandleTable::of(registry);
+    m_layersDirty = true;
+
+    // Кеш адресован хэндлами прежнего registry
+    m_spriteCache.clear();
+
+    registry.on_construct<SpriteComponent>().connect<&RenderSystem::onSpriteConstruct>(this);
+    registry.on_destroy<SpriteComponent>().connect<&RenderSystem::onSpriteDestroy>(this);
+    registry.on_construct<TransformComponent>().connect<&RenderSystem::onTransformChanged>(this);
+    registry.on_destroy<TransformComponent>().connect<&RenderSystem::onTransformChanged>(this);
+}
+
+void RenderSystem::disconnect() {
+    if (!m_registry) {
+        return;
+    }
+
+    m_registry->on_construct<SpriteComponent>().disconnect<&RenderSystem::onSpriteConstruct>(this);
+    m_registry->on_destroy<SpriteComponent>().disconnect<&RenderSystem::onSpriteDestroy>(this);
+    m_registry->on_construct<TransformComponent>().disconnect<&RenderSystem::onTransformChanged>(
+        this);
+    m_registry->on_destroy<TransformComponent>().disconnect<&RenderSystem::onTransformChanged>(
+        this);
+    m_registry = nullptr;
+    m_handles = nullptr;
+}
+
+void RenderSystem::onSpriteConstruct(entt::registry& /*registry*/, entt::entity /*entity*/) {
+    // Новый участник группы добавлен в её конец — порядок слоёв нарушен
+    m_layersDirty = true;
+}
+
+void RenderSystem::onSpriteDestroy(entt::registry& /*registry*/, entt::entity entity) {
+    // Выход из группы переставляет последнего участника на место удалённого
+    m_layersDirty = true;
+    releaseCachedSprite(entity);
+}
+
+void RenderSystem::onTransformChanged(entt::registry& registry, entt::entity entity) {
+    // Transform без спрайта (физика, триггеры) на группу не влияет
+    if (registry.all_of<SpriteComponent>(entity)) {
+        m_layersDirty = true;
+    }
+}
+
+void RenderSystem::releaseCachedSprite(entt::entity entity) {
+    const EntityHandle handle = m_handles ? m_handles->find(entity) : EntityHandle{};
+    if (handle.isNull() || handle.index() >= m_spriteCache.size()) {
+        return;
+    }
+
+    CachedSprite& cached = m_spriteCache[handle.index()];
+    if (cached.handle == handle) {
+        cached.sprite.reset();
+        cached.handle = {};
+    }
+}
+
 void RenderSystem::setViewBounds(const sf::FloatRect& viewBounds) {
     m_viewBounds = viewBounds;
 }
 
+const sf::Texture* RenderSystem::findTexture(StringId name) {
+    auto it = m_textureCache.find(name);
+    if (it != m_textureCache.end()) {
+        return it->second;
+    }
+
+    const sf::Texture* texture = nullptr;
+    try {
+        texture = &m_resourceManager->getTexture(name.str());
+    } catch (const std::exception&) {
+        // Предупреждаем один раз на имя текстуры, а не каждый кадр
+        if (m_missingTextures.insert(name).second) {
+            LOG_WARN("Sprites skipped - texture not found: {}", name.str());
+        }
+    }
+    m_textureCache.emplace(name, texture);
+    return texture;
+}
+
 void RenderSystem::update(entt::registry& registry, double dt) {
     // Очищаем очередь рендеринга от предыдущего кадра
     m_renderQueue.clear();
+    m_cullCandidates.clear();
+    m_cullMinX.clear();
+    m_cullMinY.clear();
+    m_cullMaxX.clear();
+    m_cullMaxY.clear();
 
-    // Получаем view всех сущностей с Transform и Sprite
-    auto view = registry.view<TransformComponent, SpriteComponent>();
+    if (m_registry != &registry) {
+        connect(registry);
+    }
 
-    // Резервируем место для оптимизации
-    m_renderQueue.reserve(view.size_hint());
+    // Загрузка или выгрузка текстур могла сделать указатели кеша устаревшими
+    const uint64_t textureGeneration = m_resourceManager->getTextureGeneration();
+    if (textureGeneration != m_textureGeneration) {
+        m_textureCache.clear();
+        m_textureGeneration = textureGeneration;
+    }
+
+    // Группа владеет только пулом Sprite: сортировка и вход/выход участников
+    // переставляют спрайты, но не Transform, который поток физики пишет под
+    // своим мьютексом registry
+    auto group = registry.group<SpriteComponent>(entt::get<TransformComponent>);
+
+    // Сортируем группу по слоям только если они изменились.
+    // Дальше обход группы идёт уже в порядке отрисовки.
+    if (m_layersDirty) {
+        // Сортировка неустойчива: при равных слоях порядок задаёт id сущности,
+        // иначе спрайты одного слоя менялись бы местами при каждой пересортировке
+        group.sort([&registry](const entt::entity lhs, const entt::entity rhs) {
+            const int lhsLayer = registry.get<SpriteComponent>(lhs).layer;
+            const int rhsLayer = registry.get<SpriteComponent>(rhs).layer;
+            if (lhsLayer != rhsLayer) {
+                return lhsLayer < rhsLayer;
+            }
+            return entt::to_integral(lhs) < entt::to_integral(rhs);
+        });
+        m_layersDirty = false;
+        ++m_sortCount;
+    }
 
-    // Собираем все видимые спрайты и выполняем frustum culling
-    for (auto entity : view) {
-        const auto& transform = view.get<TransformComponent>(entity);
-        const auto& sprite = view.get<SpriteComponent>(entity);
+    // Резервируем место для оптимизации
+    m_renderQueue.reserve(group.size());
 
+    // Проход 1: собираем bounds видимых спрайтов в SoA массивы для отсечения
+    for (auto [entity, sprite, transform] : group.each()) {
         // Пропускаем невидимые спрайты
         if (!sprite.visible) {
             continue;
@@ -47,98 +164,97 @@ void RenderSystem::update(entt::registry& registry, double dt) {
             continue;
         }
 
-        // Frustum culling: вычисляем bounds с учетом bottom-left origin
-        try {
-            const sf::Texture& texture = m_resourceManager->getTexture(sprite.textureName);
+        const sf::Texture* texture = findTexture(sprite.textureName);
+        if (!texture) {
+            continue;
+        }
 
-            // Получаем размер спрайта (либо из textureRect, либо из размера текстуры)
-            sf::Vector2f spriteSize;
-            if (sprite.textureRect.size.x > 0 && sprite.textureRect.size.y > 0) {
-                sf::Vector2f baseSize = sf::Vector2f(sprite.textureRect.size);
-                spriteSize = sf::Vector2f(baseSize.x * transform.scaleX, baseSize.y * transform.scaleY);
-            } else {
-                sf::Vector2f baseSize = sf::Vector2f(texture.getSize());
-                spriteSize = sf::Vector2f(baseSize.x * transform.scaleX, baseSize.y * transform.scaleY);
-            }
+        // Получаем размер спрайта (либо из textureRect, либо из размера текстуры)
+        sf::Vector2f baseSize = (sprite.textureRect.size.x > 0 && sprite.textureRect.size.y > 0)
+                                    ? sf::Vector2f(sprite.textureRect.size)
+                                    : sf::Vector2f(texture->getSize());
+        sf::Vector2f spriteSize(baseSize.x * transform.scaleX, baseSize.y * transform.scaleY);
 
-            // Вычисляем bounds с учетом bottom-left origin
-            // Transform.x, Transform.y - это позиция НИЖНЕГО ЛЕВОГО угла спрайта
-            sf::FloatRect spriteBounds(
-                sf::Vector2f(transform.x, transform.y - spriteSize.y),  // top-left
-                spriteSize
-            );
+        // Bounds с учетом bottom-left origin:
+        // Transform.x, Transform.y - это позиция НИЖНЕГО ЛЕВОГО угла спрайта
+        m_cullCandidates.push_back({entity, texture});
+        m_cullMinX.push_back(transform.x);
+        m_cullMinY.push_back(transform.y - spriteSize.y);
+        m_cullMaxX.push_back(transform.x + spriteSize.x);
+        m_cullMaxY.push_back(transform.y);
+    }
 
-            // Пропускаем объекты вне камеры
-            if (!m_viewBounds.findIntersection(spriteBounds).has_value()) {
-                continue;
-            }
-        } catch (const std::exception& e) {
-            // Если текстура не найдена, пропускаем culling для этого спрайта
-            LOG_WARN("Frustum culling skipped for entity - texture not found: {}", sprite.textureName);
+    // Проход 2: frustum culling векторным ядром
+    const size_t candidateCount = m_cullCandidates.size();
+    m_cullVisible.resize(candidateCount);
+
+    CullRect viewRect{m_viewBounds.position.x, m_viewBounds.position.y,
+                      m_viewBounds.position.x + m_viewBounds.size.x,
+                      m_viewBounds.position.y + m_viewBounds.size.y};
+    cullAabbs(m_cullMinX.data(), m_cullMinY.data(), m_cullMaxX.data(), m_cullMaxY.data(),
+              candidateCount, viewRect, m_cullVisible.data());
+
+    // Проход 3: подготовка спрайтов, прошедших отсечение
+    for (size_t i = 0; i < candidateCount; ++i) {
+        if (!m_cullVisible[i]) {
+            continue;
         }
 
-        // Добавляем в очередь рендеринга
-        m_renderQueue.push_back({entity, sprite.layer});
+        const entt::entity entity = m_cullCandidates[i].entity;
+        const sf::Texture& texture = *m_cullCandidates[i].texture;
+        const auto& [transform, sprite] = group.get<TransformComponent, SpriteComponent>(entity);
 
-        // Подготавливаем или обновляем спрайт в кеше
-        try {
-            const sf::Texture& texture = m_resourceManager->getTexture(sprite.textureName);
+        // Слот кеша — индекс хэндла сущности (доступ без хэш-таблицы)
+        const EntityHandle handle = m_handles->acquire(entity);
+        const uint32_t cacheIndex = handle.index();
+        if (cacheIndex >= m_spriteCache.size()) {
+            m_spriteCache.resize(cacheIndex + 1);
+        }
 
-            // Получаем или создаем спрайт из кеша
-            auto it = m_spriteCache.find(entity);
-            bool isNewSprite = (it == m_spriteCache.end());
+        // Добавляем в очередь рендеринга (порядок кандидатов = порядок слоёв)
+        m_renderQueue.push_back({cacheIndex});
 
-            if (isNewSprite) {
-                // Создаем новый спрайт и добавляем в кеш
-                auto [inserted_it, success] = m_spriteCache.emplace(entity, sf::Sprite(texture));
-                it = inserted_it;
-            }
+        // Спрайт в слоте принадлежал удалённой сущности с тем же индексом — пересоздаём
+        CachedSprite& cached = m_spriteCache[cacheIndex];
+        const bool isNewSprite = !cached.sprite || cached.handle != handle;
 
-            sf::Sprite& cachedSprite = it->second;
+        if (isNewSprite) {
+            cached.handle = handle;
+            cached.sprite.emplace(texture);
+        }
 
-            // Обновляем текстуру (на случай если изменилась)
-            cachedSprite.setTexture(texture);
+        sf::Sprite& cachedSprite = *cached.sprite;
 
-            // Устанавливаем прямоугольник текстуры
-            if (sprite.textureRect.size.x > 0 && sprite.textureRect.size.y > 0) {
-                cachedSprite.setTextureRect(sprite.textureRect);
-            } else {
-                cachedSprite.setTextureRect(sf::IntRect(sf::Vector2i(0, 0), sf::Vector2i(texture.getSize())));
-            }
+        // Обновляем текстуру (на случай если изменилась)
+        cachedSprite.setTexture(texture);
 
-            // Устанавливаем цвет модуляции
-            cachedSprite.setColor(sprite.color);
-
-            // Устанавливаем origin ТОЛЬКО при создании нового спрайта
-            if (isNewSprite) {
-                sf::FloatRect bounds = cachedSprite.getLocalBounds();
-                // Для вращения используем центр, иначе левый НИЖНИЙ угол
-                if (transform.rotation != 0.0f) {
-                    // Origin в центре для корректного вращения
-                    cachedSprite.setOrigin(bounds.size / 2.0f);
-                } else {
-                    // Origin в левом НИЖНЕМ углу для интуитивного позиционирования
-                    cachedSprite.setOrigin(sf::Vector2f(0.0f, bounds.size.y));
-                }
-            }
+        // Устанавливаем прямоугольник текстуры
+        if (sprite.textureRect.size.x > 0 && sprite.textureRect.size.y > 0) {
+            cachedSprite.setTextureRect(sprite.textureRect);
+        } else {
+            cachedSprite.setTextureRect(sf::IntRect(sf::Vector2i(0, 0), sf::Vector2i(texture.getSize())));
+        }
 
-            // Применяем трансформацию (SFML 3 uses Vector2f and sf::Angle)
-            cachedSprite.setPosition(sf::Vector2f(transform.x, transform.y));
-            cachedSprite.setRotation(sf::degrees(transform.rotation));
-            cachedSprite.setScale(sf::Vector2f(transform.scaleX, transform.scaleY));
+        // Устанавливаем цвет модуляции
+        cachedSprite.setColor(sprite.color);
 
-        } catch (const std::exception& e) {
-            LOG_ERROR("Failed to prepare sprite for entity: {}", e.what());
+        // Устанавливаем origin ТОЛЬКО при создании нового спрайта
+        if (isNewSprite) {
+            sf::FloatRect bounds = cachedSprite.getLocalBounds();
+            // Для вращения используем центр, иначе левый НИЖНИЙ угол
+            if (transform.rotation != 0.0f) {
+                // Origin в центре для корректного вращения
+                cachedSprite.setOrigin(bounds.size / 2.0f);
+            } else {
+                // Origin в левом НИЖНЕМ углу для интуитивного позиционирования
+                cachedSprite.setOrigin(sf::Vector2f(0.0f, bounds.size.y));
+            }
         }
-    }
 
-    // Сортируем по слоям только если они изменились
-    if (m_layersDirty) {
-        std::stable_sort(m_renderQueue.begin(), m_renderQueue.end(),
-                         [](const RenderData& a, const RenderData& b) {
-                             return a.layer < b.layer;
-                         });
-        m_layersDirty = false;
+        // Применяем трансформацию (SFML 3 uses Vector2f and sf::Angle)
+        cachedSprite.setPosition(sf::Vector2f(transform.x, transform.y));
+        cachedSprite.setRotation(sf::degrees(transform.rotation));
+        cachedSprite.setScale(sf::Vector2f(transform.scaleX, transform.scaleY));
     }
 }
 
@@ -146,20 +262,20 @@ void RenderSystem::render(sf::RenderWindow& window) {
     // Отрисовываем все подготовленные спрайты из очереди
     for (const auto& data : m_renderQueue) {
         // Получаем спрайт из кеша
-        auto it = m_spriteCache.find(data.entity);
-        if (it == m_spriteCache.end()) {
+        const CachedSprite& cached = m_spriteCache[data.cacheIndex];
+        if (!cached.sprite) {
             // Спрайт должен был быть подготовлен в update()
             LOG_WARN("Sprite not found in cache for entity during render - was update() called?");
             continue;
         }
 
         // Отрисовываем спрайт (все параметры уже установлены в update())
-        window.draw(it->second);
+        window.draw(*cached.sprite);
     }
 }
 
 void RenderSystem::invalidateCache(entt::entity entity) {
-    m_spriteCache.erase(entity);
+    releaseCachedSprite(entity);
 }
 
 void RenderSystem::clearCache() {
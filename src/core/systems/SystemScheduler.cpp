@@ -1,6 +1,7 @@
 #include "core/systems/SystemScheduler.h"
 #include "core/Logger.h"
 #include <algorithm>
+#include <cstring>
 
 namespace core {
 
@@ -23,6 +24,9 @@ void SystemScheduler::addSystem(std::unique_ptr<ISystem> system) {
 
     LOG_INFO("Adding system '{}' with priority {}", name, priority);
 
+    m_typeCache.clear();
+    m_nameIndexDirty = true;
+
     m_systems.push_back(std::move(system));
     m_needsSort = true;
 }
@@ -42,17 +46,44 @@ void SystemScheduler::update(entt::registry& registry, double dt) {
 }
 
 ISystem* SystemScheduler::getSystem(const char* name) {
-    for (auto& sys : m_systems) {
-        if (std::strcmp(sys->getName(), name) == 0) {
-            return sys.get();
-        }
+    if (!name) {
+        return nullptr;
+    }
+    if (m_needsSort) {
+        sortSystems();
+    }
+    if (m_nameIndexDirty) {
+        rebuildNameIndex();
+    }
+
+    auto it = m_nameIndex.find(std::string_view(name));
+    if (it == m_nameIndex.end()) {
+        return nullptr;
     }
-    return nullptr;
+    if (std::strcmp(it->second->getName(), name) == 0) {
+        return it->second;
+    }
+
+    // Устаревшая запись: система переименована после addSystem()
+    rebuildNameIndex();
+    it = m_nameIndex.find(std::string_view(name));
+    return it != m_nameIndex.end() ? it->second : nullptr;
+}
+
+void SystemScheduler::rebuildNameIndex() {
+    m_nameIndex.clear();
+    for (const auto& sys : m_systems) {
+        m_nameIndex.try_emplace(sys->getName(), sys.get());
+    }
+    m_nameIndexDirty = false;
 }
 
 void SystemScheduler::clear() {
     LOG_DEBUG("Clearing all systems from scheduler");
     m_systems.clear();
+    m_typeCache.clear();
+    m_nameIndex.clear();
+    m_nameIndexDirty = false;
     m_needsSort = false;
 }
 
@@ -64,6 +95,10 @@ void SystemScheduler::sortSystems() {
 
     m_needsSort = false;
 
+    // Первая система с данным именем/типом могла смениться
+    m_typeCache.clear();
+    m_nameIndexDirty = true;
+
     // Логируем порядок систем
     LOG_DEBUG("Systems sorted by priority:");
     for (const auto& sys : m_systems) {
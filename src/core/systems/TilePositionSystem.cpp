@@ -1,7 +1,7 @@
 #include "core/systems/TilePositionSystem.h"
 #include "core/Components.h"
 #include "core/Logger.h"
-#include <algorithm>  // для std::clamp
+#include <algorithm>  // для std::clamp, std::sort, std::unique
 
 namespace core {
 
@@ -9,64 +9,136 @@ TilePositionSystem::TilePositionSystem() {
     LOG_DEBUG("TilePositionSystem initialized");
 }
 
+TilePositionSystem::~TilePositionSystem() {
+    disconnect();
+}
+
 void TilePositionSystem::update(entt::registry& registry, double dt) {
     // ISystem interface - вызывает старый API
     update(registry);
 }
 
 void TilePositionSystem::update(entt::registry& registry) {
-    // Синхронизируем тайловые координаты с пиксельными
-    syncPositions(registry);
+    if (m_registry != &registry) {
+        connect(registry);
+    }
 
-    // Вычисляем layer для Y-sorting
-    updateLayers(registry);
-}
+    m_layersChanged = false;
+    m_lastProcessedCount = 0;
+
+    if (m_needsFullPass) {
+        // Первый проход (или принудительный): все тайловые сущности
+        m_needsFullPass = false;
+        m_dirty.clear();
 
-void TilePositionSystem::syncPositions(entt::registry& registry) {
-    // Получаем view всех сущностей с TilePosition и Transform
-    auto view = registry.view<TilePositionComponent, TransformComponent>();
+        auto view = registry.view<TilePositionComponent>();
+        for (auto entity : view) {
+            processEntity(registry, entity);
+        }
+        return;
+    }
+
+    if (m_dirty.empty()) {
+        return;
+    }
 
-    for (auto entity : view) {
-        auto& tilePos = view.get<TilePositionComponent>(entity);
-        auto& transform = view.get<TransformComponent>(entity);
+    // Сущность могла измениться несколько раз за кадр — обрабатываем один раз
+    std::sort(m_dirty.begin(), m_dirty.end());
+    m_dirty.erase(std::unique(m_dirty.begin(), m_dirty.end()), m_dirty.end());
 
-        // Пропускаем если автоматическая синхронизация отключена
-        if (!tilePos.autoSync) {
-            continue;
+    for (auto entity : m_dirty) {
+        // Сущность могла быть уничтожена после изменения
+        if (registry.valid(entity) && registry.all_of<TilePositionComponent>(entity)) {
+            processEntity(registry, entity);
         }
+    }
+    m_dirty.clear();
+}
+
+void TilePositionSystem::connect(entt::registry& registry) {
+    disconnect();
+    m_registry = &registry;
+    m_needsFullPass = true;
+
+    registry.on_construct<TilePositionComponent>().connect<&TilePositionSystem::markDirty>(this);
+    registry.on_update<TilePositionComponent>().connect<&TilePositionSystem::markDirty>(this);
+    // Transform/Sprite могут быть добавлены после TilePositionComponent
+    registry.on_construct<TransformComponent>().connect<&TilePositionSystem::markDirty>(this);
+    registry.on_construct<SpriteComponent>().connect<&TilePositionSystem::markDirty>(this);
+}
 
-        // Конвертируем тайловые координаты в пиксельные
-        // Используем левый НИЖНИЙ угол объекта как anchor point
-        // (объекты "стоят" на нижней границе своего тайла)
-        sf::Vector2f pixelPos = tilePos.getPixelPosition();
-        transform.x = pixelPos.x;
-        transform.y = pixelPos.y;
+void TilePositionSystem::disconnect() {
+    if (!m_registry) {
+        return;
     }
+
+    m_registry->on_construct<TilePositionComponent>().disconnect<&TilePositionSystem::markDirty>(this);
+    m_registry->on_update<TilePositionComponent>().disconnect<&TilePositionSystem::markDirty>(this);
+    m_registry->on_construct<TransformComponent>().disconnect<&TilePositionSystem::markDirty>(this);
+    m_registry->on_construct<SpriteComponent>().disconnect<&TilePositionSystem::markDirty>(this);
+    m_registry = nullptr;
+    m_dirty.clear();
 }
 
-void TilePositionSystem::updateLayers(entt::registry& registry) {
-    // Получаем view сущностей с TilePosition и Sprite
-    auto view = registry.view<TilePositionComponent, SpriteComponent>();
-
-    for (auto entity : view) {
-        auto& tilePos = view.get<TilePositionComponent>(entity);
-        auto& sprite = view.get<SpriteComponent>(entity);
-
-        // Если объект на слое Objects, применяем Y-sorting
-        // Объекты с большим Y рисуются позже (находятся "ближе" к камере)
-        if (sprite.layer >= toInt(RenderLayer::Objects) && sprite.layer < toInt(RenderLayer::Overlays)) {
-            // Базовый слой Objects (200) + позиция по Y для Y-sorting
-            // Ограничиваем yOffset в диапазоне [0, 99] чтобы не переполнить слой Overlays (300)
-            int yOffset = std::clamp(tilePos.tileY, 0, 99);
-            sprite.layer = toInt(RenderLayer::Objects) + yOffset;
-        }
-        // Для Overlays синхронизируем с тем же Y, что у родителя
-        else if (sprite.layer >= toInt(RenderLayer::Overlays) && sprite.layer < toInt(RenderLayer::UIOverlay)) {
-            // Ограничиваем yOffset в диапазоне [0, 99] чтобы не переполнить слой UIOverlay (400)
-            int yOffset = std::clamp(tilePos.tileY, 0, 99);
-            sprite.layer = toInt(RenderLayer::Overlays) + yOffset;
-        }
+void TilePositionSystem::markDirty(entt::registry& /*registry*/, entt::entity entity) {
+    m_dirty.push_back(entity);
+}
+
+void TilePositionSystem::processEntity(entt::registry& registry, entt::entity entity) {
+    const auto& tilePos = registry.get<TilePositionComponent>(entity);
+    ++m_lastProcessedCount;
+
+    syncPosition(registry, entity, tilePos);
+    if (auto* sprite = registry.try_get<SpriteComponent>(entity)) {
+        m_layersChanged = updateLayer(tilePos, *sprite) || m_layersChanged;
     }
 }
 
+void TilePositionSystem::syncPosition(entt::registry& registry, entt::entity entity,
+                                      const TilePositionComponent& tilePos) {
+    // Пропускаем если автоматическая синхронизация отключена
+    if (!tilePos.autoSync) {
+        return;
+    }
+
+    const auto* transform = registry.try_get<TransformComponent>(entity);
+    if (!transform) {
+        return;
+    }
+
+    // Конвертируем тайловые координаты в пиксельные
+    // Используем левый НИЖНИЙ угол объекта как anchor point
+    // (объекты "стоят" на нижней границе своего тайла)
+    const sf::Vector2f pixelPos = tilePos.getPixelPosition();
+    if (transform->x == pixelPos.x && transform->y == pixelPos.y) {
+        return;
+    }
+
+    registry.patch<TransformComponent>(entity, [&](TransformComponent& synced) {
+        synced.x = pixelPos.x;
+        synced.y = pixelPos.y;
+    });
+}
+
+bool TilePositionSystem::updateLayer(const TilePositionComponent& tilePos, SpriteComponent& sprite) {
+    const int previousLayer = sprite.layer;
+
+    // Если объект на слое Objects, применяем Y-sorting
+    // Объекты с большим Y рисуются позже (находятся "ближе" к камере)
+    if (sprite.layer >= toInt(RenderLayer::Objects) && sprite.layer < toInt(RenderLayer::Overlays)) {
+        // Базовый слой Objects (200) + позиция по Y для Y-sorting
+        // Ограничиваем yOffset в диапазоне [0, 99] чтобы не переполнить слой Overlays (300)
+        int yOffset = std::clamp(tilePos.tileY, 0, 99);
+        sprite.layer = toInt(RenderLayer::Objects) + yOffset;
+    }
+    // Для Overlays синхронизируем с тем же Y, что у родителя
+    else if (sprite.layer >= toInt(RenderLayer::Overlays) && sprite.layer < toInt(RenderLayer::UIOverlay)) {
+        // Ограничиваем yOffset в диапазоне [0, 99] чтобы не переполнить слой UIOverlay (400)
+        int yOffset = std::clamp(tilePos.tileY, 0, 99);
+        sprite.layer = toInt(RenderLayer::Overlays) + yOffset;
+    }
+
+    return sprite.layer != previousLayer;
+}
+
 } // namespace core
@@ -1,7 +1,7 @@
 #include "core/systems/UpdateSystem.h"
 #include "core/Components.h"
 #include "core/Logger.h"
-#include <cmath>
+#include "core/MotionKernels.h"
 
 namespace core {
 
@@ -20,25 +20,21 @@ void UpdateSystem::update(entt::registry& registry, double dt) {
 }
 
 void UpdateSystem::updateMovement(entt::registry& registry, double dt) {
-    // Получаем view всех сущностей с Transform и Velocity
-    auto view = registry.view<TransformComponent, VelocityComponent>();
-
-    for (auto entity : view) {
-        auto& transform = view.get<TransformComponent>(entity);
-        const auto& velocity = view.get<VelocityComponent>(entity);
-
-        // Обновляем позицию на основе скорости
-        transform.x += velocity.vx * static_cast<float>(dt);
-        transform.y += velocity.vy * static_cast<float>(dt);
-
-        // Обновляем вращение
-        transform.rotation += velocity.angularVelocity * static_cast<float>(dt);
-
-        // Нормализуем угол вращения (0-360) используя fmod для O(1) сложности
-        transform.rotation = std::fmod(transform.rotation, 360.0f);
-        if (transform.rotation < 0.0f) {
-            transform.rotation += 360.0f;
-        }
+    // Partial-owning группа: пул Velocity упакован (первые group.size() элементов —
+    // участники группы), Transform берётся по сущности. Пулом Transform не владеет
+    // ни одна группа: его перестановки гонялись бы с записью из потока физики.
+    //
+    // Группа обходится напрямую, без сбора в SoA буфер и записи обратно: при
+    // AoS хранении это два лишних прохода с поиском Transform по сущности.
+    auto group = registry.group<VelocityComponent>(entt::get<TransformComponent>);
+    const float step = static_cast<float>(dt);
+
+    for (auto [entity, velocity, transform] : group.each()) {
+        transform.x += velocity.vx * step;
+        transform.y += velocity.vy * step;
+
+        // Нормализация угла (0-360) через floor, без ветвлений std::fmod
+        transform.rotation = wrapDegrees(transform.rotation + velocity.angularVelocity * step);
     }
 }
 
@@ -0,0 +1,456 @@
+#include "editor/CommandJournal.h"
+#include "core/Config.h"
+#include "core/Logger.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace editor {
+
+CommandJournalSettings CommandJournalSettings::fromConfig() {
+    auto& config = core::Config::getInstance();
+
+    CommandJournalSettings settings;
+    const int budgetMb = config.get("editor.undoMemoryBudgetMb",
+                                    static_cast<int>(settings.memoryBudget / (1024u * 1024u)));
+    settings.memoryBudget = static_cast<size_t>(std::max(budgetMb, 1)) * 1024u * 1024u;
+    return settings;
+}
+
+size_t CommandJournal::Entry::memoryUsage() const {
+    return sizeof(Entry) + label.capacity() + entities.capacity() * sizeof(EntityChange) +
+           diffs.capacity() * sizeof(ComponentDiff) + bytes.capacity();
+}
+
+CommandJournal::CommandJournal(entt::registry& registry, const ComponentCodecs& codecs,
+                               const CommandJournalSettings& settings)
+    : m_registry(registry), m_codecs(codecs), m_settings(settings) {
+}
+
+// ============================================================
+// Транзакция
+// ============================================================
+
+bool CommandJournal::begin(std::string label, uint64_t mergeKey) {
+    if (m_recording) {
+        LOG_WARN("CommandJournal: begin('{}') while '{}' is still recording", label, m_label);
+        return false;
+    }
+    m_recording = true;
+    m_label = std::move(label);
+    m_mergeKey = mergeKey;
+    return true;
+}
+
+CommandJournal::TrackedEntity& CommandJournal::trackEntity(entt::entity entity,
+                                                           bool existedBefore) {
+    auto [it, inserted] = m_trackedIndex.try_emplace(entity, m_tracked.size());
+    if (inserted) {
+        m_tracked.push_back(TrackedEntity{entity, existedBefore});
+    }
+    return m_tracked[it->second];
+}
+
+void CommandJournal::capture(entt::entity entity, entt::id_type typeId) {
+    if (!m_recording || entity == entt::null) {
+        return;
+    }
+    const ComponentCodec* codec = m_codecs.find(typeId);
+    if (!codec) {
+        return;
+    }
+    if (!m_captureIndex.try_emplace(captureKey(entity, typeId), m_captures.size()).second) {
+        return;
+    }
+
+    const TrackedEntity& tracked = trackEntity(entity, m_registry.valid(entity));
+
+    Capture capture;
+    capture.entity = entity;
+    capture.codec = codec;
+    capture.offset = static_cast<uint32_t>(m_beforeBytes.size());
+    // Созданная в транзакции сущность «до» не имела компонентов
+    capture.present = tracked.existedBefore && m_registry.valid(entity) &&
+                      codec->save(m_registry, entity, m_beforeBytes);
+    capture.size = static_cast<uint32_t>(m_beforeBytes.size()) - capture.offset;
+    m_captures.push_back(capture);
+}
+
+void CommandJournal::capture(entt::entity entity) {
+    for (const ComponentCodec& codec : m_codecs.codecs()) {
+        capture(entity, codec.typeId);
+    }
+}
+
+void CommandJournal::trackCreated(entt::entity entity) {
+    if (!m_recording || entity == entt::null) {
+        return;
+    }
+    trackEntity(entity, false).existedBefore = false;
+    capture(entity);
+}
+
+bool CommandJournal::commit() {
+    if (!m_recording) {
+        return false;
+    }
+
+    Entry entry;
+    entry.label = m_label;
+    entry.mergeKey = m_mergeKey;
+
+    for (const Capture& capture : m_captures) {
+        m_scratch.clear();
+        const bool afterPresent = m_registry.valid(capture.entity) &&
+                                  capture.codec->save(m_registry, capture.entity, m_scratch);
+        const std::span<const uint8_t> before(m_beforeBytes.data() + capture.offset, capture.size);
+        appendDiff(entry, capture.entity, capture.codec->typeId, before, capture.present,
+                   m_scratch, afterPresent);
+    }
+    for (const TrackedEntity& tracked : m_tracked) {
+        const bool existsAfter = m_registry.valid(tracked.entity);
+        if (tracked.existedBefore != existsAfter) {
+            entry.entities.push_back(EntityChange{tracked.entity, existsAfter});
+        }
+    }
+
+    const uint64_t mergeKey = m_mergeKey;
+    resetTransaction();
+
+    if (entry.diffs.empty() && entry.entities.empty()) {
+        return false;
+    }
+
+    // Новая команда отменяет ветку повторов
+    while (m_entries.size() > m_cursor) {
+        m_memoryUsage -= m_entries.back().memoryUsage();
+        m_entries.pop_back();
+    }
+
+    const bool mergeable = !m_mergeSealed && mergeKey != 0 && m_cursor > 0 &&
+                           m_entries[m_cursor - 1].mergeKey == mergeKey &&
+                           m_entries[m_cursor - 1].entities.empty() && entry.entities.empty();
+    if (!mergeable || !mergeIntoLast(entry)) {
+        entry.diffs.shrink_to_fit();
+        entry.bytes.shrink_to_fit();
+        m_memoryUsage += entry.memoryUsage();
+        m_entries.push_back(std::move(entry));
+        ++m_cursor;
+    }
+    m_mergeSealed = mergeKey == 0;
+
+    enforceBudget();
+    return true;
+}
+
+void CommandJournal::cancel() {
+    resetTransaction();
+}
+
+void CommandJournal::resetTransaction() {
+    m_recording = false;
+    m_label.clear();
+    m_mergeKey = 0;
+    m_captures.clear();
+    m_tracked.clear();
+    m_captureIndex.clear();
+    m_trackedIndex.clear();
+    m_beforeBytes.clear();
+}
+
+// ============================================================
+// Diff'ы
+// ============================================================
+
+void CommandJournal::appendDiff(Entry& entry, entt::entity entity, entt::id_type typeId,
+                                std::span<const uint8_t> before, bool beforePresent,
+                                std::span<const uint8_t> after, bool afterPresent) {
+    if (!beforePresent && !afterPresent) {
+        return;
+    }
+
+    ComponentDiff diff;
+    diff.entity = entity;
+    diff.typeId = typeId;
+    diff.dataOffset = static_cast<uint32_t>(entry.bytes.size());
+
+    if (beforePresent && afterPresent && before.size() == after.size()) {
+        // Только диапазон от первого до последнего отличающегося байта
+        size_t first = 0;
+        while (first < before.size() && before[first] == after[first]) {
+            ++first;
+        }
+        if (first == before.size()) {
+            return;
+        }
+        size_t last = before.size();
+        while (before[last - 1] == after[last - 1]) {
+            --last;
+        }
+
+        diff.offset = static_cast<uint32_t>(first);
+        diff.beforeSize = diff.afterSize = static_cast<uint32_t>(last - first);
+        diff.flags = BeforePresent | AfterPresent | Partial;
+        entry.bytes.insert(entry.bytes.end(), before.begin() + first, before.begin() + last);
+        entry.bytes.insert(entry.bytes.end(), after.begin() + first, after.begin() + last);
+    } else {
+        if (beforePresent) {
+            diff.flags |= BeforePresent;
+            diff.beforeSize = static_cast<uint32_t>(before.size());
+            entry.bytes.insert(entry.bytes.end(), before.begin(), before.end());
+        }
+        if (afterPresent) {
+            diff.flags |= AfterPresent;
+            diff.afterSize = static_cast<uint32_t>(after.size());
+            entry.bytes.insert(entry.bytes.end(), after.begin(), after.end());
+        }
+    }
+    entry.diffs.push_back(diff);
+}
+
+void CommandJournal::copyDiff(Entry& entry, const Entry& source, const ComponentDiff& diff) {
+    ComponentDiff copy = diff;
+    copy.dataOffset = static_cast<uint32_t>(entry.bytes.size());
+    const auto data = source.bytes.begin() + diff.dataOffset;
+    entry.bytes.insert(entry.bytes.end(), data, data + diff.beforeSize + diff.afterSize);
+    entry.diffs.push_back(copy);
+}
+
+bool CommandJournal::mergeIntoLast(const Entry& entry) {
+    Entry& last = m_entries[m_cursor - 1];
+
+    std::unordered_map<uint64_t, size_t> lastIndex;
+    lastIndex.reserve(last.diffs.size());
+    for (size_t i = 0; i < last.diffs.size(); ++i) {
+        lastIndex.emplace(captureKey(last.diffs[i].entity, last.diffs[i].typeId), i);
+    }
+
+    Entry merged;
+    merged.label = last.label;
+    merged.mergeKey = last.mergeKey;
+    std::vector<bool> replaced(last.diffs.size(), false);
+    std::vector<uint8_t> after;
+    std::vector<uint8_t> before;
+
+    // Сначала проверяем, что каждую пару можно слить, затем собираем запись
+    std::vector<ComponentDiff> pending;
+    for (const ComponentDiff& diff : entry.diffs) {
+        auto it = lastIndex.find(captureKey(diff.entity, diff.typeId));
+        if (it == lastIndex.end()) {
+            continue;
+        }
+        const ComponentDiff& previous = last.diffs[it->second];
+        // Частичный старый diff требует, чтобы «до» новой команды было той же длины
+        if ((previous.flags & Partial) && !(diff.flags & BeforePresent)) {
+            return false;
+        }
+    }
+
+    for (const ComponentDiff& diff : entry.diffs) {
+        auto it = lastIndex.find(captureKey(diff.entity, diff.typeId));
+        if (it == lastIndex.end()) {
+            pending.push_back(diff);
+            continue;
+        }
+
+        // Полное «после» — текущее состояние; «до» новой команды восстанавливается из него
+        const bool afterPresent = (diff.flags & AfterPresent) != 0;
+        after.clear();
+        if (afterPresent) {
+            const ComponentCodec* codec = m_codecs.find(diff.typeId);
+            if (!codec || !codec->save(m_registry, diff.entity, after)) {
+                return false;
+            }
+        }
+
+        const auto data = entry.bytes.begin() + diff.dataOffset;
+        if (diff.flags & Partial) {
+            before = after;
+            std::copy(data, data + diff.beforeSize, before.begin() + diff.offset);
+        } else {
+            before.assign(data, data + diff.beforeSize);
+        }
+
+        // «До» старой записи: её diff поверх «до» новой команды
+        const ComponentDiff& previous = last.diffs[it->second];
+        const auto previousData = last.bytes.begin() + previous.dataOffset;
+        bool beforePresent = (previous.flags & BeforePresent) != 0;
+        if (previous.flags & Partial) {
+            if (before.size() < previous.offset + previous.beforeSize) {
+                return false;
+            }
+            std::copy(previousData, previousData + previous.beforeSize,
+                      before.begin() + previous.offset);
+        } else {
+            before.assign(previousData, previousData + previous.beforeSize);
+        }
+
+        replaced[it->second] = true;
+        appendDiff(merged, diff.entity, diff.typeId, before, beforePresent, after, afterPresent);
+    }
+
+    for (size_t i = 0; i < last.diffs.size(); ++i) {
+        if (!replaced[i]) {
+            copyDiff(merged, last, last.diffs[i]);
+        }
+    }
+    for (const ComponentDiff& diff : pending) {
+        copyDiff(merged, entry, diff);
+    }
+
+    merged.diffs.shrink_to_fit();
+    merged.bytes.shrink_to_fit();
+    m_memoryUsage -= last.memoryUsage();
+    m_memoryUsage += merged.memoryUsage();
+    last = std::move(merged);
+    return true;
+}
+
+// ============================================================
+// Undo / redo
+// ============================================================
+
+bool CommandJournal::undo() {
+    if (m_recording || !canUndo()) {
+        return false;
+    }
+
+    Entry& entry = m_entries[--m_cursor];
+    for (size_t i = 0; i < entry.entities.size(); ++i) {
+        if (!entry.entities[i].created) {
+            restoreEntity(entry.entities[i].entity);
+        }
+    }
+    for (auto it = entry.diffs.rbegin(); it != entry.diffs.rend(); ++it) {
+        applyDiff(entry, *it, false);
+    }
+    for (const EntityChange& change : entry.entities) {
+        if (change.created && m_registry.valid(change.entity)) {
+            m_registry.destroy(change.entity);
+        }
+    }
+
+    m_mergeSealed = true;
+    return true;
+}
+
+bool CommandJournal::redo() {
+    if (m_recording || !canRedo()) {
+        return false;
+    }
+
+    Entry& entry = m_entries[m_cursor++];
+    for (size_t i = 0; i < entry.entities.size(); ++i) {
+        if (entry.entities[i].created) {
+            restoreEntity(entry.entities[i].entity);
+        }
+    }
+    for (const ComponentDiff& diff : entry.diffs) {
+        applyDiff(entry, diff, true);
+    }
+    for (const EntityChange& change : entry.entities) {
+        if (!change.created && m_registry.valid(change.entity)) {
+            m_registry.destroy(change.entity);
+        }
+    }
+
+    m_mergeSealed = true;
+    return true;
+}
+
+void CommandJournal::applyDiff(const Entry& entry, const ComponentDiff& diff, bool after) {
+    const ComponentCodec* codec = m_codecs.find(diff.typeId);
+    if (!codec || !m_registry.valid(diff.entity)) {
+        LOG_WARN("CommandJournal: cannot apply '{}' to entity {}", entry.label,
+                 entt::to_integral(diff.entity));
+        return;
+    }
+
+    const uint8_t flag = after ? AfterPresent : BeforePresent;
+    if (!(diff.flags & flag)) {
+        codec->remove(m_registry, diff.entity);
+        return;
+    }
+
+    const uint8_t* data = entry.bytes.data() + diff.dataOffset + (after ? diff.beforeSize : 0);
+    std::span<const uint8_t> bytes(data, after ? diff.afterSize : diff.beforeSize);
+
+    if (diff.flags & Partial) {
+        m_scratch.clear();
+        if (!codec->save(m_registry, diff.entity, m_scratch) ||
+            m_scratch.size() < diff.offset + bytes.size()) {
+            LOG_WARN("CommandJournal: {} of entity {} changed outside the journal, '{}' skipped",
+                     codec->name, entt::to_integral(diff.entity), entry.label);
+            return;
+        }
+        std::memcpy(m_scratch.data() + diff.offset, bytes.data(), bytes.size());
+        bytes = m_scratch;
+    }
+
+    if (!codec->load(m_registry, diff.entity, bytes)) {
+        LOG_WARN("CommandJournal: failed to load {} of entity {}", codec->name,
+                 entt::to_integral(diff.entity));
+    }
+}
+
+void CommandJournal::restoreEntity(entt::entity entity) {
+    if (m_registry.valid(entity)) {
+        return;
+    }
+    const entt::entity restored = m_registry.create(entity);
+    if (restored != entity) {
+        // Слот занят сущностью, созданной вне журнала: дальше используем новый id.
+        // Ссылки на старый id внутри компонентов (ParentComponent) не переписываются.
+        LOG_WARN("CommandJournal: entity {} restored as {}", entt::to_integral(entity),
+                 entt::to_integral(restored));
+        remapEntity(entity, restored);
+    }
+}
+
+void CommandJournal::remapEntity(entt::entity from, entt::entity to) {
+    for (Entry& entry : m_entries) {
+        for (EntityChange& change : entry.entities) {
+            if (change.entity == from) {
+                change.entity = to;
+            }
+        }
+        for (ComponentDiff& diff : entry.diffs) {
+            if (diff.entity == from) {
+                diff.entity = to;
+            }
+        }
+    }
+}
+
+// ============================================================
+// Память
+// ============================================================
+
+void CommandJournal::enforceBudget() {
+    while (m_memoryUsage > m_settings.memoryBudget && m_entries.size() > 1 && m_cursor > 0) {
+        m_memoryUsage -= m_entries.front().memoryUsage();
+        m_entries.pop_front();
+        --m_cursor;
+        ++m_evictedCount;
+    }
+}
+
+void CommandJournal::clear() {
+    resetTransaction();
+    m_entries.clear();
+    m_cursor = 0;
+    m_memoryUsage = 0;
+    m_mergeSealed = true;
+}
+
+const std::string& CommandJournal::undoLabel() const {
+    static const std::string empty;
+    return canUndo() ? m_entries[m_cursor - 1].label : empty;
+}
+
+const std::string& CommandJournal::redoLabel() const {
+    static const std::string empty;
+    return canRedo() ? m_entries[m_cursor].label : empty;
+}
+
+} // namespace editor
@@ -0,0 +1,80 @@
+#include "editor/ComponentCodecs.h"
+#include "core/Components.h"
+
+#include <string>
+
+namespace editor {
+
+namespace {
+
+/// Компонент из одной строки: 4 байта длины + символы
+template<typename T, std::string T::*Member>
+ComponentCodec makeStringCodec(const char* name) {
+    ComponentCodec codec;
+    codec.name = name;
+    codec.typeId = entt::type_hash<T>::value();
+    codec.save = +[](const entt::registry& registry, entt::entity entity,
+                     std::vector<uint8_t>& out) {
+        const T* component = registry.try_get<T>(entity);
+        if (!component) {
+            return false;
+        }
+        const std::string& text = component->*Member;
+        const auto length = static_cast<uint32_t>(text.size());
+        const auto* lengthBytes = reinterpret_cast<const uint8_t*>(&length);
+        out.insert(out.end(), lengthBytes, lengthBytes + sizeof(length));
+        out.insert(out.end(), text.begin(), text.end());
+        return true;
+    };
+    codec.load = +[](entt::registry& registry, entt::entity entity,
+                     std::span<const uint8_t> bytes) {
+        uint32_t length = 0;
+        if (bytes.size() < sizeof(length)) {
+            return false;
+        }
+        std::memcpy(&length, bytes.data(), sizeof(length));
+        if (bytes.size() != sizeof(length) + length) {
+            return false;
+        }
+        T value;
+        value.*Member = std::string(reinterpret_cast<const char*>(bytes.data() + sizeof(length)),
+                                    length);
+        registry.emplace_or_replace<T>(entity, std::move(value));
+        return true;
+    };
+    codec.remove = +[](entt::registry& registry, entt::entity entity) {
+        registry.remove<T>(entity);
+    };
+    return codec;
+}
+
+} // namespace
+
+void ComponentCodecs::registerCodec(const ComponentCodec& codec) {
+    auto [it, inserted] = m_byType.try_emplace(codec.typeId, m_codecs.size());
+    if (inserted) {
+        m_codecs.push_back(codec);
+    } else {
+        m_codecs[it->second] = codec;
+    }
+}
+
+const ComponentCodec* ComponentCodecs::find(entt::id_type typeId) const {
+    auto it = m_byType.find(typeId);
+    return it != m_byType.end() ? &m_codecs[it->second] : nullptr;
+}
+
+void ComponentCodecs::registerCoreComponents() {
+    using namespace core;
+
+    registerTrivial<TransformComponent>("Transform");
+    registerTrivial<SpriteComponent>("Sprite");
+    registerTrivial<VelocityComponent>("Velocity");
+    registerTrivial<CollisionComponent>("Collision");
+    registerTrivial<TilePositionComponent>("TilePosition");
+    registerTrivial<ParentComponent>("Parent");
+    registerCodec(makeStringCodec<NameComponent, &NameComponent::name>("Name"));
+    registerCodec(makeStringCodec<TagComponent, &TagComponent::tag>("Tag"));
+}
+
+} // namespace editor
@@ -0,0 +1,69 @@
+#include "editor/EntityClipboard.h"
+#include "core/Components.h"
+
+#include <unordered_set>
+
+namespace editor {
+
+size_t EntityClipboard::copy(const entt::registry& registry,
+                             std::span<const entt::entity> selection) {
+    clear();
+
+    // Повторы и недействительные отбрасываем здесь, чтобы m_sources[i]
+    // соответствовала m_entities[i] (клонировщик сохраняет порядок)
+    std::unordered_set<entt::entity> seen;
+    seen.reserve(selection.size());
+    for (entt::entity entity : selection) {
+        if (registry.valid(entity) && seen.insert(entity).second) {
+            m_sources.push_back(entity);
+        }
+    }
+    EntityCloner::appendDescendants(registry, m_sources);
+    seen.insert(m_sources.begin(), m_sources.end());
+
+    for (entt::entity source : m_sources) {
+        const auto* parent = registry.try_get<core::ParentComponent>(source);
+        if (parent && parent->parent != entt::null && !seen.contains(parent->parent)) {
+            m_externalParents.emplace(source, parent->parent);
+        }
+    }
+
+    // В отсоединённом хранилище внешние родители не существуют: клонировщик
+    // снимает такие ParentComponent, ссылки хранит m_externalParents
+    EntityCloner::Options options;
+    options.linkExternal = false;
+    return m_cloner.clone(registry, m_sources, m_storage, m_entities, options);
+}
+
+size_t EntityClipboard::paste(entt::registry& registry, std::vector<entt::entity>& out) {
+    if (m_entities.empty()) {
+        out.clear();
+        return 0;
+    }
+
+    // Родители проверяются до вставки: новая копия может получить тот же id,
+    // что и внешний родитель, которого в этом registry нет
+    m_links.clear();
+    for (size_t i = 0; i < m_sources.size(); ++i) {
+        auto it = m_externalParents.find(m_sources[i]);
+        if (it != m_externalParents.end() && registry.valid(it->second)) {
+            m_links.emplace_back(i, it->second);
+        }
+    }
+
+    const size_t count = m_cloner.clone(m_storage, m_entities, registry, out);
+    for (const auto& [index, parent] : m_links) {
+        registry.emplace_or_replace<core::ParentComponent>(out[index], parent);
+        registry.get_or_emplace<core::ChildrenComponent>(parent).addChild(out[index]);
+    }
+    return count;
+}
+
+void EntityClipboard::clear() {
+    m_storage.clear();
+    m_entities.clear();
+    m_sources.clear();
+    m_externalParents.clear();
+}
+
+} // namespace editor
@@ -0,0 +1,168 @@
+#include "editor/EntityCloner.h"
+#include "core/Components.h"
+#include "core/Logger.h"
+#include "simulation/PhysicsComponents.h"
+#include "simulation/systems/PhysicsSystem.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+namespace editor {
+
+namespace {
+
+void remapParent(core::ParentComponent& parent, const EntityRemap& remap) {
+    parent.parent = remap(parent.parent);
+}
+
+void remapChildren(core::ChildrenComponent& children, const EntityRemap& remap) {
+    // Дети вне выделения остаются у оригинала: у сущности один родитель
+    auto out = children.children.begin();
+    for (entt::entity child : children.children) {
+        const entt::entity clone = remap.find(child);
+        if (clone != entt::null) {
+            *out++ = clone;
+        }
+    }
+    children.children.erase(out, children.children.end());
+}
+
+void resetBody(simulation::RigidbodyComponent& rigidbody, const EntityRemap&) {
+    // Тело копии создаёт PhysicsSystem; id оригинала копировать нельзя
+    rigidbody.box2dBodyId = b2_nullBodyId;
+    rigidbody.handle = {};
+}
+
+} // namespace
+
+void EntityCloner::registerColumn(entt::id_type typeId, const char* name, ColumnCloneFn clone) {
+    auto it = std::find_if(m_columns.begin(), m_columns.end(),
+                           [typeId](const Column& column) { return column.typeId == typeId; });
+    if (it != m_columns.end()) {
+        it->name = name;
+        it->clone = clone;
+    } else {
+        m_columns.push_back(Column{typeId, name, clone});
+    }
+}
+
+void EntityCloner::registerCoreComponents() {
+    using namespace core;
+
+    registerComponent<TransformComponent>("Transform");
+    registerComponent<SpriteComponent>("Sprite");
+    registerComponent<VelocityComponent>("Velocity");
+    registerComponent<NameComponent>("Name");
+    registerComponent<TagComponent>("Tag");
+    registerComponent<LifetimeComponent>("Lifetime");
+    registerComponent<AnimationComponent>("Animation");
+    registerComponent<AnimationComponentV2>("AnimationV2");
+    registerComponent<EntityStateComponent>("EntityState");
+    registerComponent<TilePositionComponent>("TilePosition");
+    registerComponent<CollisionComponent>("Collision");
+    registerComponent<OverlayComponent>("Overlay");
+    registerComponent<ParentComponent, &remapParent>("Parent");
+    registerComponent<ChildrenComponent, &remapChildren>("Children");
+    registerComponent<simulation::ColliderComponent>("Collider");
+    registerComponent<simulation::RigidbodyComponent, &resetBody>("Rigidbody");
+}
+
+size_t EntityCloner::clone(const entt::registry& src, std::span<const entt::entity> selection,
+                           entt::registry& dst, std::vector<entt::entity>& out,
+                           const Options& options) {
+    out.clear();
+    m_remap.clear();
+    m_sources.clear();
+
+    std::unordered_set<entt::entity> seen;
+    seen.reserve(selection.size());
+    for (entt::entity entity : selection) {
+        if (src.valid(entity) && seen.insert(entity).second) {
+            m_sources.push_back(entity);
+        }
+    }
+    if (m_sources.empty()) {
+        return 0;
+    }
+
+    out.resize(m_sources.size());
+    dst.create(out.begin(), out.end());
+    m_remap.reserve(m_sources.size());
+    for (size_t i = 0; i < m_sources.size(); ++i) {
+        m_remap.add(m_sources[i], out[i]);
+    }
+
+    if (m_physics) {
+        m_physics->beginBodyBatch();
+    }
+
+    for (const Column& column : m_columns) {
+        column.clone(src, m_sources, out, dst, m_remap);
+    }
+    linkHierarchy(src, dst, out, options);
+
+    if (m_physics) {
+        m_physics->endBodyBatch(dst);
+    }
+
+    LOG_DEBUG("EntityCloner: cloned {} entities ({} component types)", out.size(),
+              m_columns.size());
+    return out.size();
+}
+
+void EntityCloner::linkHierarchy(const entt::registry& src, entt::registry& dst,
+                                 std::span<const entt::entity> clones,
+                                 const Options& options) const {
+    // Колонка Children копирует и тех, чьи дети остались вне выделения
+    for (entt::entity clone : clones) {
+        const auto* children = dst.try_get<core::ChildrenComponent>(clone);
+        if (children && children->children.empty()) {
+            dst.remove<core::ChildrenComponent>(clone);
+        }
+    }
+
+    for (size_t i = 0; i < clones.size(); ++i) {
+        const entt::entity clone = clones[i];
+        const auto* parentComponent = dst.try_get<core::ParentComponent>(clone);
+        if (!parentComponent || parentComponent->parent == entt::null) {
+            continue;
+        }
+        const entt::entity parent = parentComponent->parent;
+
+        const entt::entity sourceParent = src.get<core::ParentComponent>(m_sources[i]).parent;
+        if (!m_remap.contains(sourceParent)) {
+            // Внешний родитель: в отсоединённое хранилище ссылку не переносим
+            if (!options.linkExternal || !dst.valid(parent)) {
+                dst.remove<core::ParentComponent>(clone);
+                continue;
+            }
+        }
+        // ChildrenComponent — зеркало ParentComponent, восстанавливаем и для копий
+        dst.get_or_emplace<core::ChildrenComponent>(parent).addChild(clone);
+    }
+}
+
+void EntityCloner::appendDescendants(const entt::registry& registry,
+                                     std::vector<entt::entity>& selection) {
+    std::unordered_map<entt::entity, std::vector<entt::entity>> children;
+    for (auto [entity, parent] : registry.view<const core::ParentComponent>().each()) {
+        if (parent.parent != entt::null) {
+            children[parent.parent].push_back(entity);
+        }
+    }
+
+    std::unordered_set<entt::entity> seen(selection.begin(), selection.end());
+    for (size_t i = 0; i < selection.size(); ++i) {
+        auto it = children.find(selection[i]);
+        if (it == children.end()) {
+            continue;
+        }
+        for (entt::entity child : it->second) {
+            if (seen.insert(child).second) {
+                selection.push_back(child);
+            }
+        }
+    }
+}
+
+} // namespace editor
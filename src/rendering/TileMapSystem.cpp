@@ -1,4 +1,5 @@
 #include "rendering/TileMapSystem.h"
+#include "core/FrameArena.h"
 #include <spdlog/spdlog.h>
 #include <tmxlite/Map.hpp>
 #include <tmxlite/Layer.hpp>
@@ -7,6 +8,9 @@
 #include <tmxlite/Tileset.hpp>
 #include <cmath>
 #include <algorithm>
+#include <memory_resource>
+#include <tuple>
+#include <vector>
 
 namespace rendering {
 
@@ -131,6 +135,12 @@ void TileMapSystem::processTileLayer(const tmx::TileLayer& layer) {
     tileLayer.height = static_cast<int>(layer.getSize().y);
     tileLayer.opacity = layer.getOpacity();
     tileLayer.visible = layer.getVisible();
+    tileLayer.blocked = false;
+    for (const auto& property : layer.getProperties()) {
+        if (property.getName() == "blocked" && property.getType() == tmx::Property::Type::Boolean) {
+            tileLayer.blocked = property.getBoolValue();
+        }
+    }
 
     // Копируем тайлы
     const auto& tiles = layer.getTiles();
@@ -146,6 +156,27 @@ void TileMapSystem::processTileLayer(const tmx::TileLayer& layer) {
                   tileLayer.width, tileLayer.height, layer.getVisible(), layer.getOpacity());
 }
 
+std::vector<uint8_t> TileMapSystem::buildBlockedMask() const {
+    std::vector<uint8_t> mask(static_cast<size_t>(m_mapWidth) * static_cast<size_t>(m_mapHeight),
+                              0);
+
+    for (const auto& layer : m_tileLayers) {
+        if (!layer.blocked) {
+            continue;
+        }
+        const int width = std::min(layer.width, m_mapWidth);
+        const int height = std::min(layer.height, m_mapHeight);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                if (layer.tiles[static_cast<size_t>(y) * layer.width + x] != 0) {
+                    mask[static_cast<size_t>(y) * m_mapWidth + x] = 1;
+                }
+            }
+        }
+    }
+    return mask;
+}
+
 void TileMapSystem::processObjectLayer(const tmx::ObjectGroup& layer) {
     // TODO: Обработка объектов (будет реализовано позже)
     // Объекты могут использоваться для размещения промышленных объектов,
@@ -167,15 +198,26 @@ void TileMapSystem::render(sf::RenderTarget& target, const sf::View& camera) {
     int endX = std::min(m_mapWidth, static_cast<int>(std::ceil((viewBounds.position.x + viewBounds.size.x) / m_tileWidth)) + 1);
     int endY = std::min(m_mapHeight, static_cast<int>(std::ceil((viewBounds.position.y + viewBounds.size.y) / m_tileHeight)) + 1);
 
+    // Без тайлсетов рисовать нечего
+    if (m_tilesets.empty()) {
+        return;
+    }
+
+    // Группируем тайлы по тайлсетам для батчинга
+    // Индекс - индекс тайлсета, значение - список тайлов (x, y, gid).
+    // Списки временные, поэтому живут в арене кадра и переиспользуются между слоями
+    using TileList = std::pmr::vector<std::tuple<int, int, int>>;
+    std::pmr::vector<TileList> tilesByTileset(m_tilesets.size(), &core::FrameArena::current());
+
     // Отрисовываем каждый слой
     for (const auto& layer : m_tileLayers) {
         if (!layer.visible) {
             continue;
         }
 
-        // Группируем тайлы по тайлсетам для батчинга
-        // Ключ - индекс тайлсета, значение - список тайлов (x, y, gid)
-        std::unordered_map<size_t, std::vector<std::tuple<int, int, int>>> tilesByTileset;
+        for (auto& tiles : tilesByTileset) {
+            tiles.clear();
+        }
 
         // Собираем видимые тайлы слоя
         for (int y = startY; y < endY; ++y) {
@@ -200,13 +242,10 @@ void TileMapSystem::render(sf::RenderTarget& target, const sf::View& camera) {
         }
 
         // Рендерим батчи по тайлсетам
-        for (const auto& [tilesetIdx, tiles] : tilesByTileset) {
-            if (tilesetIdx >= m_tilesets.size()) {
-                continue;
-            }
-
+        for (size_t tilesetIdx = 0; tilesetIdx < tilesByTileset.size(); ++tilesetIdx) {
+            const auto& tiles = tilesByTileset[tilesetIdx];
             const Tileset& tileset = m_tilesets[tilesetIdx];
-            if (!tileset.texture) {
+            if (tiles.empty() || !tileset.texture) {
                 continue;
             }
 
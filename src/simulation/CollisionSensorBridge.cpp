@@ -0,0 +1,316 @@
+#include "simulation/CollisionSensorBridge.h"
+#include "core/Components.h"
+#include "core/Logger.h"
+#include <algorithm>
+
+namespace simulation {
+
+CollisionSensorBridge::CollisionSensorBridge(PhysicsWorld& world)
+    : m_world(world) {
+}
+
+CollisionSensorBridge::~CollisionSensorBridge() {
+    if (m_registry) {
+        m_registry->on_construct<core::CollisionComponent>()
+            .disconnect<&CollisionSensorBridge::onCollisionChanged>(this);
+        m_registry->on_update<core::CollisionComponent>()
+            .disconnect<&CollisionSensorBridge::onCollisionChanged>(this);
+        m_registry->on_destroy<core::CollisionComponent>()
+            .disconnect<&CollisionSensorBridge::onCollisionDestroy>(this);
+        m_registry = nullptr;
+    }
+}
+
+void CollisionSensorBridge::init(entt::registry& registry) {
+    shutdown();
+    m_registry = &registry;
+    m_handles = &core::EntityHandleTable::of(registry);
+
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        for (auto entity : registry.view<core::CollisionComponent>()) {
+            m_pendingCreates.push_back({m_handles->acquire(entity), entity});
+        }
+    }
+
+    registry.on_construct<core::CollisionComponent>()
+        .connect<&CollisionSensorBridge::onCollisionChanged>(this);
+    registry.on_update<core::CollisionComponent>()
+        .connect<&CollisionSensorBridge::onCollisionChanged>(this);
+    registry.on_destroy<core::CollisionComponent>()
+        .connect<&CollisionSensorBridge::onCollisionDestroy>(this);
+
+    LOG_INFO("CollisionSensorBridge: {} collision entities queued for Box2D sensors",
+             m_pendingCreates.size());
+}
+
+void CollisionSensorBridge::shutdown() {
+    if (m_registry) {
+        m_registry->on_construct<core::CollisionComponent>()
+            .disconnect<&CollisionSensorBridge::onCollisionChanged>(this);
+        m_registry->on_update<core::CollisionComponent>()
+            .disconnect<&CollisionSensorBridge::onCollisionChanged>(this);
+        m_registry->on_destroy<core::CollisionComponent>()
+            .disconnect<&CollisionSensorBridge::onCollisionDestroy>(this);
+        m_registry = nullptr;
+    }
+
+    if (b2World_IsValid(m_world.getWorldId())) {
+        for (const Proxy& proxy : m_proxies) {
+            if (b2Body_IsValid(proxy.body)) {
+                b2DestroyBody(proxy.body);
+            }
+        }
+    }
+    m_proxies.clear();
+    m_proxyBySlot.clear();
+    m_activePairs.clear();
+
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        m_pendingCreates.clear();
+        m_pendingDestroys.clear();
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_changesMutex);
+        m_changes.clear();
+    }
+}
+
+void CollisionSensorBridge::onCollisionChanged(entt::registry& /*registry*/, entt::entity entity) {
+    // Тело создаётся в потоке физики: мир Box2D нельзя менять во время шага.
+    // Хэндл выдаётся здесь — поток физики таблицу хэндлов не трогает
+    const core::EntityHandle handle = m_handles->acquire(entity);
+
+    std::lock_guard<std::mutex> lock(m_pendingMutex);
+    m_pendingCreates.push_back({handle, entity});
+}
+
+void CollisionSensorBridge::onCollisionDestroy(entt::registry& /*registry*/, entt::entity entity) {
+    const core::EntityHandle handle = m_handles->find(entity);
+    if (handle.isNull()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_pendingMutex);
+    m_pendingDestroys.push_back(handle);
+}
+
+void CollisionSensorBridge::onPhysicsStep(entt::registry& registry, float /*dt*/) {
+    // События шага, который только что выполнен, затем подготовка к следующему
+    collectSensorEvents(registry);
+    applyPendingProxies(registry);
+    syncProxies(registry);
+}
+
+void CollisionSensorBridge::drainPairChanges(std::vector<core::CollisionPairChange>& changes) {
+    std::lock_guard<std::mutex> lock(m_changesMutex);
+    changes.insert(changes.end(), m_changes.begin(), m_changes.end());
+    m_changes.clear();
+}
+
+void CollisionSensorBridge::applyPendingProxies(entt::registry& registry) {
+    std::vector<PendingProxy> creates;
+    std::vector<core::EntityHandle> destroys;
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        if (m_pendingCreates.empty() && m_pendingDestroys.empty()) {
+            return;
+        }
+        creates.swap(m_pendingCreates);
+        destroys.swap(m_pendingDestroys);
+    }
+
+    for (core::EntityHandle handle : destroys) {
+        destroyProxy(handle);
+    }
+    for (const PendingProxy& pending : creates) {
+        createProxy(registry, pending);
+    }
+}
+
+void CollisionSensorBridge::createProxy(entt::registry& registry, const PendingProxy& pending) {
+    const core::EntityHandle handle = pending.handle;
+    const entt::entity entity = pending.entity;
+
+    // Пересоздание (изменились размеры) — старое тело и его пары завершаются
+    destroyProxy(handle);
+
+    // Сущность могла быть удалена после постановки в очередь (версия отличается)
+    if (!registry.valid(entity)) {
+        return;
+    }
+    const auto* transform = registry.try_get<core::TransformComponent>(entity);
+    const auto* collision = registry.try_get<core::CollisionComponent>(entity);
+    if (!transform || !collision) {
+        return;
+    }
+
+    const sf::FloatRect bounds = collision->getWorldBounds(*transform);
+    const sf::Vector2f center = bounds.position + bounds.size * 0.5f;
+
+    // Кинематическое тело не засыпает: сенсоры спящих тел Box2D не обрабатывает
+    b2BodyDef bodyDef = b2DefaultBodyDef();
+    bodyDef.type = b2_kinematicBody;
+    bodyDef.position = PhysicsWorld::pixelsToMeters(b2Vec2{center.x, center.y});
+    bodyDef.enableSleep = false;
+    bodyDef.userData = handle.toUserData();
+    b2BodyId body = b2CreateBody(m_world.getWorldId(), &bodyDef);
+
+    const b2Polygon box = b2MakeBox(PhysicsWorld::pixelsToMeters(bounds.size.x * 0.5f),
+                                    PhysicsWorld::pixelsToMeters(bounds.size.y * 0.5f));
+
+    b2ShapeDef shapeDef = b2DefaultShapeDef();
+    shapeDef.filter.categoryBits = PROXY_CATEGORY;
+    shapeDef.filter.maskBits = PROXY_CATEGORY;
+    shapeDef.enableSensorEvents = true;
+    shapeDef.enableContactEvents = false;
+
+    // Прокси: его обнаруживают сенсоры других сущностей
+    shapeDef.isSensor = false;
+    b2CreatePolygonShape(body, &shapeDef, &box);
+
+    // Сенсор: обнаруживает прокси других сущностей (своё тело Box2D пропускает)
+    shapeDef.isSensor = true;
+    b2CreatePolygonShape(body, &shapeDef, &box);
+
+    const uint32_t slot = handle.index();
+    if (slot >= m_proxyBySlot.size()) {
+        m_proxyBySlot.resize(slot + 1, NO_PROXY);
+    }
+    m_proxyBySlot[slot] = static_cast<uint32_t>(m_proxies.size());
+    m_proxies.push_back({handle, entity, body, bounds});
+}
+
+void CollisionSensorBridge::destroyProxy(core::EntityHandle handle) {
+    const uint32_t slot = handle.index();
+    if (slot >= m_proxyBySlot.size() || m_proxyBySlot[slot] == NO_PROXY) {
+        return;
+    }
+
+    const uint32_t position = m_proxyBySlot[slot];
+    Proxy& proxy = m_proxies[position];
+
+    if (b2Body_IsValid(proxy.body)) {
+        b2DestroyBody(proxy.body);
+    }
+
+    // Box2D не присылает событий конца для удалённых shape — завершаем пары сами.
+    // Хэндл к этому моменту может быть уже недействителен (сущность удалена),
+    // поэтому сущность восстанавливаем по индексу слота из активных пар.
+    {
+        std::lock_guard<std::mutex> lock(m_changesMutex);
+        auto ended = std::remove_if(m_activePairs.begin(), m_activePairs.end(),
+                                    [&](const EntityPair& pair) {
+                                        const bool involved = entt::to_entity(pair.first) == slot ||
+                                                              entt::to_entity(pair.second) == slot;
+                                        if (involved) {
+                                            m_changes.push_back({pair.first, pair.second, false});
+                                        }
+                                        return involved;
+                                    });
+        m_activePairs.erase(ended, m_activePairs.end());
+    }
+
+    // swap-and-pop
+    const uint32_t last = static_cast<uint32_t>(m_proxies.size() - 1);
+    if (position != last) {
+        m_proxies[position] = m_proxies[last];
+        m_proxyBySlot[m_proxies[position].handle.index()] = position;
+    }
+    m_proxies.pop_back();
+    m_proxyBySlot[slot] = NO_PROXY;
+}
+
+void CollisionSensorBridge::collectSensorEvents(const entt::registry& registry) {
+    const b2SensorEvents events = b2World_GetSensorEvents(m_world.getWorldId());
+
+    for (int i = 0; i < events.beginCount; ++i) {
+        const b2SensorBeginTouchEvent& event = events.beginEvents[i];
+        const entt::entity sensor = entityFromShape(registry, event.sensorShapeId);
+        const entt::entity visitor = entityFromShape(registry, event.visitorShapeId);
+        if (sensor == entt::null || visitor == entt::null) {
+            continue;
+        }
+        recordChange(sensor, visitor, true);
+    }
+
+    for (int i = 0; i < events.endCount; ++i) {
+        const b2SensorEndTouchEvent& event = events.endEvents[i];
+        const entt::entity sensor = entityFromShape(registry, event.sensorShapeId);
+        const entt::entity visitor = entityFromShape(registry, event.visitorShapeId);
+        if (sensor == entt::null || visitor == entt::null) {
+            continue;
+        }
+        recordChange(sensor, visitor, false);
+    }
+}
+
+void CollisionSensorBridge::syncProxies(entt::registry& registry) {
+    for (Proxy& proxy : m_proxies) {
+        const entt::entity entity = proxy.entity;
+        if (!registry.valid(entity)) {
+            continue;
+        }
+        const auto* transform = registry.try_get<core::TransformComponent>(entity);
+        const auto* collision = registry.try_get<core::CollisionComponent>(entity);
+        if (!transform || !collision) {
+            continue;
+        }
+
+        // Размеры меняются через on_update (пересоздание), здесь только позиция
+        const sf::FloatRect bounds = collision->getWorldBounds(*transform);
+        if (bounds.position == proxy.bounds.position) {
+            continue;
+        }
+        proxy.bounds = bounds;
+
+        const sf::Vector2f center = bounds.position + bounds.size * 0.5f;
+        b2Body_SetTransform(proxy.body, PhysicsWorld::pixelsToMeters(b2Vec2{center.x, center.y}),
+                            b2MakeRot(0.0f));
+    }
+}
+
+entt::entity CollisionSensorBridge::entityFromShape(const entt::registry& registry,
+                                                   b2ShapeId shapeId) const {
+    if (!b2Shape_IsValid(shapeId)) {
+        return entt::null;
+    }
+    if (b2Shape_GetFilter(shapeId).categoryBits != PROXY_CATEGORY) {
+        return entt::null;
+    }
+
+    // Сущность — из прокси по слоту хэндла (таблица хэндлов — данные главного потока)
+    const b2BodyId body = b2Shape_GetBody(shapeId);
+    const auto handle = core::EntityHandle::fromUserData(b2Body_GetUserData(body));
+    const uint32_t slot = handle.index();
+    if (slot >= m_proxyBySlot.size() || m_proxyBySlot[slot] == NO_PROXY) {
+        return entt::null;
+    }
+    const Proxy& proxy = m_proxies[m_proxyBySlot[slot]];
+    if (proxy.handle != handle || !registry.valid(proxy.entity)) {
+        return entt::null;
+    }
+    return proxy.entity;
+}
+
+void CollisionSensorBridge::recordChange(entt::entity a, entt::entity b, bool began) {
+    // Сенсоры обеих сущностей видят прокси друг друга — пара учитывается один раз
+    const EntityPair pair(a, b);
+    auto it = std::lower_bound(m_activePairs.begin(), m_activePairs.end(), pair);
+    const bool active = it != m_activePairs.end() && *it == pair;
+
+    if (began == active) {
+        return;
+    }
+    if (began) {
+        m_activePairs.insert(it, pair);
+    } else {
+        m_activePairs.erase(it);
+    }
+
+    std::lock_guard<std::mutex> lock(m_changesMutex);
+    m_changes.push_back({pair.first, pair.second, began});
+}
+
+} // namespace simulation
@@ -1,10 +1,13 @@
 #include "PhysicsEventProcessor.h"
+#include "CollisionSensorBridge.h"
+#include "PhysicsLod.h"
 #include "core/Logger.h"
 
 namespace simulation {
 
 PhysicsEventProcessor::PhysicsEventProcessor(PhysicsWorld& world, entt::registry& registry)
-    : m_world(world), m_registry(registry), m_hitSpeedThreshold(HIT_SPEED_THRESHOLD) {
+    : m_world(world), m_registry(registry),
+      m_handles(core::EntityHandleTable::of(registry)), m_hitSpeedThreshold(HIT_SPEED_THRESHOLD) {
     LOG_DEBUG("PhysicsEventProcessor initialized");
 }
 
@@ -14,13 +17,23 @@ PhysicsEventProcessor::~PhysicsEventProcessor() {
 }
 
 void PhysicsEventProcessor::processEvents() {
-    processContactEvents();
-    processSensorEvents();
+    processContactEvents(m_world.getWorldId());
+    processSensorEvents(m_world.getWorldId());
+
+    // Дальний мир шагает реже ближнего: его события разбираем один раз на шаг
+    if (m_lod && m_lod->getFarStepCount() != m_farStepCount) {
+        m_farStepCount = m_lod->getFarStepCount();
+        processContactEvents(m_lod->getFarWorld().getWorldId());
+        processSensorEvents(m_lod->getFarWorld().getWorldId());
+    }
 }
 
-void PhysicsEventProcessor::processContactEvents() {
-    b2WorldId worldId = m_world.getWorldId();
+void PhysicsEventProcessor::setLod(const PhysicsLod* lod) {
+    m_lod = lod;
+    m_farStepCount = lod ? lod->getFarStepCount() : 0;
+}
 
+void PhysicsEventProcessor::processContactEvents(b2WorldId worldId) {
     // Получаем события контактов
     b2ContactEvents contactEvents = b2World_GetContactEvents(worldId);
 
@@ -117,9 +130,7 @@ void PhysicsEventProcessor::processContactEvents() {
     }
 }
 
-void PhysicsEventProcessor::processSensorEvents() {
-    b2WorldId worldId = m_world.getWorldId();
-
+void PhysicsEventProcessor::processSensorEvents(b2WorldId worldId) {
     // Получаем события сенсоров
     b2SensorEvents sensorEvents = b2World_GetSensorEvents(worldId);
 
@@ -127,6 +138,11 @@ void PhysicsEventProcessor::processSensorEvents() {
     for (int i = 0; i < sensorEvents.beginCount; ++i) {
         const b2SensorBeginTouchEvent& event = sensorEvents.beginEvents[i];
 
+        // Сенсоры CollisionComponent обрабатывает CollisionSensorBridge
+        if (isCollisionProxy(event.sensorShapeId)) {
+            continue;
+        }
+
         entt::entity sensorEntity = getEntityFromShape(event.sensorShapeId);
         entt::entity visitorEntity = getEntityFromShape(event.visitorShapeId);
 
@@ -155,6 +171,9 @@ void PhysicsEventProcessor::processSensorEvents() {
         if (!b2Shape_IsValid(event.sensorShapeId) || !b2Shape_IsValid(event.visitorShapeId)) {
             continue;
         }
+        if (isCollisionProxy(event.sensorShapeId)) {
+            continue;
+        }
 
         entt::entity sensorEntity = getEntityFromShape(event.sensorShapeId);
         entt::entity visitorEntity = getEntityFromShape(event.visitorShapeId);
@@ -176,6 +195,11 @@ void PhysicsEventProcessor::processSensorEvents() {
     }
 }
 
+bool PhysicsEventProcessor::isCollisionProxy(b2ShapeId shapeId) const {
+    return b2Shape_IsValid(shapeId) &&
+           b2Shape_GetFilter(shapeId).categoryBits == CollisionSensorBridge::PROXY_CATEGORY;
+}
+
 entt::entity PhysicsEventProcessor::getEntityFromBody(b2BodyId bodyId) const {
     if (!b2Body_IsValid(bodyId)) {
         return entt::null;
@@ -187,10 +211,8 @@ entt::entity PhysicsEventProcessor::getEntityFromBody(b2BodyId bodyId) const {
         return entt::null;
     }
 
-    // userData содержит entity + 1 (чтобы избежать nullptr для entity = 0)
-    // Вычитаем 1 для получения реального значения entity
-    uintptr_t value = reinterpret_cast<uintptr_t>(userData);
-    return static_cast<entt::entity>(value - 1);
+    // userData содержит EntityHandle; устаревший хэндл разрешается в entt::null
+    return m_handles.resolve(core::EntityHandle::fromUserData(userData));
 }
 
 entt::entity PhysicsEventProcessor::getEntityFromShape(b2ShapeId shapeId) const {
@@ -0,0 +1,255 @@
+#include "simulation/PhysicsLod.h"
+#include "simulation/PhysicsComponents.h"
+#include "simulation/systems/PhysicsSystem.h"
+#include "core/Components.h"
+#include "core/Config.h"
+#include "core/Logger.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace simulation {
+
+PhysicsLodSettings PhysicsLodSettings::fromConfig() {
+    auto& config = core::Config::getInstance();
+
+    PhysicsLodSettings settings;
+    settings.enabled = config.get("physics.lodEnabled", settings.enabled);
+    settings.regionSize = config.get("physics.lodRegionSize", settings.regionSize);
+    settings.focusMargin = config.get("physics.lodFocusMargin", settings.focusMargin);
+    settings.farStepDivisor = config.get("physics.lodFarStepDivisor", settings.farStepDivisor);
+    settings.farSubSteps = config.get("physics.lodFarSubSteps", settings.farSubSteps);
+    settings.reclassifyInterval =
+        config.get("physics.lodReclassifyInterval", settings.reclassifyInterval);
+    return settings;
+}
+
+namespace {
+
+PhysicsLodSettings sanitize(PhysicsLodSettings settings) {
+    settings.regionSize = std::max(settings.regionSize, 1.0f);
+    settings.focusMargin = std::max(settings.focusMargin, 0.0f);
+    settings.farStepDivisor = std::max(settings.farStepDivisor, 1);
+    settings.farSubSteps = std::max(settings.farSubSteps, 1);
+    settings.reclassifyInterval = std::max(settings.reclassifyInterval, 1);
+    return settings;
+}
+
+/// Границы всех shapes тела в пикселях (shapes — переиспользуемый буфер)
+sf::FloatRect bodyBounds(b2BodyId bodyId, std::vector<b2ShapeId>& shapes) {
+    shapes.resize(static_cast<size_t>(b2Body_GetShapeCount(bodyId)));
+    b2Body_GetShapes(bodyId, shapes.data(), static_cast<int>(shapes.size()));
+
+    b2AABB aabb{b2Body_GetPosition(bodyId), b2Body_GetPosition(bodyId)};
+    for (b2ShapeId shape : shapes) {
+        const b2AABB shapeAabb = b2Shape_GetAABB(shape);
+        aabb.lowerBound = b2Min(aabb.lowerBound, shapeAabb.lowerBound);
+        aabb.upperBound = b2Max(aabb.upperBound, shapeAabb.upperBound);
+    }
+
+    const b2Vec2 lower = PhysicsWorld::metersToPixels(aabb.lowerBound);
+    const b2Vec2 upper = PhysicsWorld::metersToPixels(aabb.upperBound);
+    return sf::FloatRect({lower.x, lower.y}, {upper.x - lower.x, upper.y - lower.y});
+}
+
+} // namespace
+
+PhysicsLod::PhysicsLod(PhysicsWorld& nearWorld, const PhysicsLodSettings& settings)
+    : m_nearWorld(nearWorld)
+    , m_settings(sanitize(settings))
+    , m_farWorld(nearWorld.getGravity(), m_settings.farSubSteps) {
+    LOG_INFO("PhysicsLod initialized (region: {}px, far rate: 1/{}, far sub-steps: {})",
+             m_settings.regionSize, m_settings.farStepDivisor, m_settings.farSubSteps);
+}
+
+void PhysicsLod::setFocusAreas(std::vector<sf::FloatRect> areas) {
+    std::lock_guard<std::mutex> lock(m_focusMutex);
+    m_focusAreas = std::move(areas);
+}
+
+void PhysicsLod::onFixedStep(entt::registry& registry, PhysicsSystem& system, float dt) {
+    ++m_tickCount;
+    m_farPendingTime += dt;
+
+    if (m_tickCount % static_cast<uint64_t>(m_settings.farStepDivisor) == 0) {
+        flushFarWorld();
+    }
+
+    if (m_tickCount % static_cast<uint64_t>(m_settings.reclassifyInterval) == 0) {
+        reclassify(registry, system);
+    }
+}
+
+void PhysicsLod::onBodyDestroyed(entt::entity entity) {
+    if (m_farEntities.erase(entity) > 0) {
+        m_farBodyCount.store(m_farEntities.size(), std::memory_order_relaxed);
+    }
+
+    releaseStaticMirror(entity);
+}
+
+bool PhysicsLod::isFar(entt::entity entity) const {
+    return m_farEntities.contains(entity);
+}
+
+void PhysicsLod::flushFarWorld() {
+    if (m_farPendingTime <= 0.0f) {
+        return;
+    }
+
+    // Пустой дальний мир шагать незачем — время просто "сгорает"
+    if (!m_farEntities.empty()) {
+        m_farWorld.step(m_farPendingTime);
+        ++m_farStepCount;
+    }
+    m_farPendingTime = 0.0f;
+}
+
+void PhysicsLod::reclassify(entt::registry& registry, PhysicsSystem& system) {
+    if (!m_settings.enabled && m_farEntities.empty() && m_staticMirrors.empty()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_focusMutex);
+        m_focusSnapshot = m_focusAreas;
+    }
+
+    // Догоняем дальний мир до текущего момента, чтобы возвращаемые тела были актуальны
+    flushFarWorld();
+
+    // Без зон интереса (или с выключенным LOD) всё считается ближним
+    const bool everythingNear = !m_settings.enabled || m_focusSnapshot.empty();
+
+    auto view = registry.view<RigidbodyComponent, ColliderComponent, core::TransformComponent>();
+    std::vector<b2ShapeId> shapes;
+
+    for (auto entity : view) {
+        auto& rigidbody = view.get<RigidbodyComponent>(entity);
+        if (!rigidbody.hasBox2DBody()) {
+            continue;
+        }
+
+        if (rigidbody.isStatic()) {
+            // Зеркало нужно, только если до статики могут дотянуться дальние тела
+            sf::FloatRect bounds = bodyBounds(rigidbody.box2dBodyId, shapes);
+            const float margin = m_settings.focusMargin;
+            bounds.position -= sf::Vector2f(margin, margin);
+            bounds.size += sf::Vector2f(2.0f * margin, 2.0f * margin);
+
+            if (everythingNear || isBoundsInFocus(bounds, m_focusSnapshot)) {
+                releaseStaticMirror(entity);
+            } else {
+                ensureStaticMirror(registry, system, entity);
+            }
+            continue;
+        }
+
+        const bool isFar = m_farEntities.contains(entity);
+
+        bool wantNear = everythingNear;
+        if (!wantNear) {
+            b2Vec2 position = PhysicsWorld::metersToPixels(b2Body_GetPosition(rigidbody.box2dBodyId));
+            // Ближнее тело держим с запасом margin, дальнее возвращаем без запаса
+            float margin = isFar ? 0.0f : m_settings.focusMargin;
+            wantNear = isRegionInFocus(sf::Vector2f(position.x, position.y), m_focusSnapshot, margin);
+        }
+
+        if (isFar && wantNear) {
+            migrateBody(registry, system, entity, m_nearWorld);
+            m_farEntities.erase(entity);
+        } else if (!isFar && !wantNear) {
+            migrateBody(registry, system, entity, m_farWorld);
+            m_farEntities.insert(entity);
+        }
+    }
+
+    m_farBodyCount.store(m_farEntities.size(), std::memory_order_relaxed);
+}
+
+void PhysicsLod::migrateBody(entt::registry& registry, PhysicsSystem& system, entt::entity entity,
+                             PhysicsWorld& target) {
+    auto& rigidbody = registry.get<RigidbodyComponent>(entity);
+    b2BodyId oldBody = rigidbody.box2dBodyId;
+
+    // Сохраняем полное динамическое состояние тела
+    b2Transform bodyTransform = b2Body_GetTransform(oldBody);
+    b2Vec2 linearVelocity = b2Body_GetLinearVelocity(oldBody);
+    float angularVelocity = b2Body_GetAngularVelocity(oldBody);
+    bool awake = b2Body_IsAwake(oldBody);
+
+    b2DestroyBody(oldBody);
+    rigidbody.box2dBodyId = b2_nullBodyId;
+
+    b2BodyId newBody = system.createBodyInWorld(registry, entity, target);
+    if (B2_IS_NULL(newBody)) {
+        LOG_ERROR("PhysicsLod::migrateBody - Failed to recreate body for entity {}",
+                  static_cast<uint32_t>(entity));
+        return;
+    }
+
+    b2Body_SetTransform(newBody, bodyTransform.p, bodyTransform.q);
+    b2Body_SetLinearVelocity(newBody, linearVelocity);
+    b2Body_SetAngularVelocity(newBody, angularVelocity);
+    if (!awake) {
+        b2Body_SetAwake(newBody, false);
+    }
+
+    rigidbody.box2dBodyId = newBody;
+}
+
+void PhysicsLod::ensureStaticMirror(entt::registry& registry, PhysicsSystem& system,
+                                    entt::entity entity) {
+    auto it = m_staticMirrors.find(entity);
+    if (it != m_staticMirrors.end() && b2Body_IsValid(it->second)) {
+        return;
+    }
+
+    b2BodyId mirror = system.createBodyInWorld(registry, entity, m_farWorld);
+    if (B2_IS_NON_NULL(mirror)) {
+        m_staticMirrors[entity] = mirror;
+    }
+}
+
+void PhysicsLod::releaseStaticMirror(entt::entity entity) {
+    auto it = m_staticMirrors.find(entity);
+    if (it == m_staticMirrors.end()) {
+        return;
+    }
+
+    if (b2Body_IsValid(it->second)) {
+        b2DestroyBody(it->second);
+    }
+    m_staticMirrors.erase(it);
+}
+
+bool PhysicsLod::isBoundsInFocus(const sf::FloatRect& bounds,
+                                 const std::vector<sf::FloatRect>& areas) const {
+    const float size = m_settings.regionSize;
+
+    // Ближние регионы зоны — её прямоугольник, расширенный до границ сетки
+    return std::any_of(areas.begin(), areas.end(), [&](const sf::FloatRect& area) {
+        const float left = std::floor(area.position.x / size) * size;
+        const float top = std::floor(area.position.y / size) * size;
+        const float right = std::ceil((area.position.x + area.size.x) / size) * size;
+        const float bottom = std::ceil((area.position.y + area.size.y) / size) * size;
+        return bounds.position.x >= left && bounds.position.y >= top &&
+               bounds.position.x + bounds.size.x <= right &&
+               bounds.position.y + bounds.size.y <= bottom;
+    });
+}
+
+bool PhysicsLod::isRegionInFocus(const sf::Vector2f& position,
+                                 const std::vector<sf::FloatRect>& areas, float margin) const {
+    const float size = m_settings.regionSize;
+    sf::FloatRect region({std::floor(position.x / size) * size, std::floor(position.y / size) * size},
+                         {size, size});
+
+    return std::any_of(areas.begin(), areas.end(), [&](const sf::FloatRect& area) {
+        sf::FloatRect expanded({area.position.x - margin, area.position.y - margin},
+                               {area.size.x + 2.0f * margin, area.size.y + 2.0f * margin});
+        return region.findIntersection(expanded).has_value();
+    });
+}
+
+} // namespace simulation
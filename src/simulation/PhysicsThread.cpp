@@ -1,8 +1,10 @@
 #include <simulation/PhysicsThread.h>
 #include <simulation/PhysicsComponents.h>
 #include <core/Components.h>
+#include <core/AllocationTracker.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <chrono>
 
 namespace simulation {
@@ -31,6 +33,10 @@ bool PhysicsThread::start()
     m_paused.store(false, std::memory_order_release);
     m_stepCount.store(0, std::memory_order_relaxed);
     m_averageStepTimeMs.store(0.0f, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(m_pacingStatsMutex);
+        m_pacingStats = PhysicsPacingStats{};
+    }
 
     m_thread = std::thread(&PhysicsThread::physicsLoop, this);
 
@@ -89,15 +95,25 @@ void PhysicsThread::physicsLoop()
 {
     spdlog::debug("PhysicsThread: entering physics loop");
 
-    using Clock = std::chrono::high_resolution_clock;
-    using Duration = std::chrono::duration<float>;
+    // Имя, привязка к CPU и приоритет потока (ошибки не фатальны)
+    m_threadConfig.applyToCurrentThread();
+
+    // Все выделения потока физики учитываются как Simulation
+    core::AllocationScope allocationScope(core::AllocationTag::Simulation);
+
+    using Clock = std::chrono::steady_clock;
+    using Milliseconds = std::chrono::duration<double, std::milli>;
 
-    constexpr auto targetDuration = std::chrono::microseconds(static_cast<int>(FIXED_TIMESTEP * 1'000'000));
+    const auto period = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(FIXED_TIMESTEP));
 
-    // Скользящее среднее для времени шага
+    // Скользящее среднее для времени шага и джиттера
     constexpr float smoothingFactor = 0.1f;
     float smoothedStepTime = 0.0f;
 
+    // Абсолютное расписание: дедлайн следующего шага
+    auto nextDeadline = Clock::now();
+
     while (m_running.load(std::memory_order_acquire)) {
         // Обработка паузы
         if (m_paused.load(std::memory_order_acquire)) {
@@ -111,9 +127,15 @@ void PhysicsThread::physicsLoop()
             if (!m_running.load(std::memory_order_acquire)) {
                 break;
             }
+
+            // Время паузы не догоняем — расписание начинается заново
+            nextDeadline = Clock::now();
         }
 
-        auto frameStart = Clock::now();
+        waitUntil(nextDeadline);
+
+        auto stepStart = Clock::now();
+        double jitterMs = Milliseconds(stepStart - nextDeadline).count();
 
         try {
             doPhysicsStep();
@@ -127,28 +149,72 @@ void PhysicsThread::physicsLoop()
             }
         }
 
-        auto frameEnd = Clock::now();
-        auto frameDuration = std::chrono::duration_cast<std::chrono::microseconds>(frameEnd - frameStart);
+        auto stepEnd = Clock::now();
 
-        // Обновляем статистику
-        float stepTimeMs = frameDuration.count() / 1000.0f;
+        // Обновляем статистику времени шага
+        float stepTimeMs = static_cast<float>(Milliseconds(stepEnd - stepStart).count());
         smoothedStepTime = smoothedStepTime * (1.0f - smoothingFactor) + stepTimeMs * smoothingFactor;
         m_averageStepTimeMs.store(smoothedStepTime, std::memory_order_relaxed);
 
-        // Спим оставшееся время до следующего кадра
-        if (frameDuration < targetDuration) {
-            auto sleepDuration = targetDuration - frameDuration;
-            std::this_thread::sleep_for(sleepDuration);
-        } else {
-            // Кадр занял больше времени, чем целевой период
-            spdlog::trace("PhysicsThread: frame took {:.2f}ms (target: {:.2f}ms)",
-                         stepTimeMs, FIXED_TIMESTEP * 1000.0f);
+        // Следующий дедлайн — строго через период от предыдущего, а не от конца шага
+        nextDeadline += period;
+
+        bool catchUp = false;
+        uint64_t droppedTicks = 0;
+        if (stepEnd > nextDeadline) {
+            auto behindTicks = static_cast<uint64_t>((stepEnd - nextDeadline) / period);
+            if (behindTicks >= static_cast<uint64_t>(MAX_CATCH_UP_STEPS)) {
+                // Слишком сильно отстали: отбрасываем тики и сдвигаем расписание
+                droppedTicks = behindTicks;
+                nextDeadline = stepEnd;
+                spdlog::trace("PhysicsThread: {} ticks behind schedule, dropping", behindTicks);
+            } else {
+                catchUp = true;
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_pacingStatsMutex);
+            m_pacingStats.lastJitterMs = jitterMs;
+            m_pacingStats.meanJitterMs =
+                m_pacingStats.meanJitterMs * (1.0 - smoothingFactor) + jitterMs * smoothingFactor;
+            m_pacingStats.maxJitterMs = std::max(m_pacingStats.maxJitterMs, jitterMs);
+            if (stepEnd - stepStart > period) {
+                ++m_pacingStats.overrunCount;
+            }
+            if (catchUp) {
+                ++m_pacingStats.catchUpSteps;
+            }
+            m_pacingStats.droppedTicks += droppedTicks;
         }
     }
 
     spdlog::debug("PhysicsThread: exiting physics loop");
 }
 
+void PhysicsThread::waitUntil(std::chrono::steady_clock::time_point deadline) const
+{
+    using Clock = std::chrono::steady_clock;
+
+    const auto spinWindow = std::chrono::microseconds(m_spinWindowUs.load(std::memory_order_relaxed));
+
+    // Грубое ожидание: сон до начала окна активного ожидания
+    if (Clock::now() + spinWindow < deadline) {
+        std::this_thread::sleep_until(deadline - spinWindow);
+    }
+
+    // Точное ожидание: spin с уступкой процессора до самого дедлайна
+    while (Clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+}
+
+PhysicsPacingStats PhysicsThread::getPacingStats() const
+{
+    std::lock_guard<std::mutex> lock(m_pacingStatsMutex);
+    return m_pacingStats;
+}
+
 void PhysicsThread::doPhysicsStep()
 {
     if (m_useDoubleBuffering.load(std::memory_order_acquire)) {
@@ -186,8 +252,14 @@ void PhysicsThread::writeTransformsToBuffer()
             continue;
         }
 
+        // Хэндл выдан главным потоком при создании тела: таблица хэндлов
+        // не потокобезопасна, поток физики к ней не обращается
+        if (rigidbody.handle.isNull()) {
+            continue;
+        }
+
         const auto& transform = view.get<core::TransformComponent>(entity);
-        m_transformBuffer.writeTransform(entity, transform);
+        m_transformBuffer.writeTransform(rigidbody.handle, transform);
     }
 }
 
@@ -2,16 +2,65 @@
 
 namespace simulation {
 
-void PhysicsTransformBuffer::writeTransform(entt::entity entity, float x, float y, float rotation)
+void PhysicsTransformBuffer::TransformBuffer::write(core::EntityHandle handle,
+                                                    const BufferedTransform& transform)
+{
+    const uint32_t index = handle.index();
+    if (index >= positions.size()) {
+        positions.resize(index + 1, NO_POSITION);
+    }
+
+    const uint32_t position = positions[index];
+    if (position != NO_POSITION && records[position].handle == handle) {
+        records[position].transform = transform;
+        return;
+    }
+
+    // Новая запись (или хэндл нового поколения — старая запись будет отброшена при применении)
+    positions[index] = static_cast<uint32_t>(records.size());
+    records.push_back({handle, transform});
+}
+
+void PhysicsTransformBuffer::TransformBuffer::remove(core::EntityHandle handle)
+{
+    const uint32_t index = handle.index();
+    if (index >= positions.size()) {
+        return;
+    }
+
+    const uint32_t position = positions[index];
+    if (position == NO_POSITION || records[position].handle != handle) {
+        return;
+    }
+
+    // swap-and-pop с переносом позиции последней записи
+    const Record& last = records.back();
+    if (positions[last.handle.index()] == records.size() - 1) {
+        positions[last.handle.index()] = position;
+    }
+    records[position] = last;
+    records.pop_back();
+    positions[index] = NO_POSITION;
+}
+
+void PhysicsTransformBuffer::TransformBuffer::clear()
+{
+    for (const Record& record : records) {
+        positions[record.handle.index()] = NO_POSITION;
+    }
+    records.clear();
+}
+
+void PhysicsTransformBuffer::writeTransform(core::EntityHandle handle, float x, float y, float rotation)
 {
     // Запись в буфер записи не требует блокировки,
     // так как главный поток работает только с буфером чтения
-    (*m_writeBuffer)[entity] = BufferedTransform(x, y, rotation);
+    m_writeBuffer->write(handle, BufferedTransform(x, y, rotation));
 }
 
-void PhysicsTransformBuffer::writeTransform(entt::entity entity, const core::TransformComponent& transform)
+void PhysicsTransformBuffer::writeTransform(core::EntityHandle handle, const core::TransformComponent& transform)
 {
-    (*m_writeBuffer)[entity] = BufferedTransform(transform);
+    m_writeBuffer->write(handle, BufferedTransform(transform));
 }
 
 void PhysicsTransformBuffer::swapBuffers()
@@ -29,13 +78,16 @@ void PhysicsTransformBuffer::applyToRegistry(entt::registry& registry)
 {
     // Буфер чтения не изменяется потоком физики после swap,
     // поэтому блокировка не нужна
-    for (const auto& [entity, transform] : *m_readBuffer) {
-        if (registry.valid(entity)) {
-            auto* transformComp = registry.try_get<core::TransformComponent>(entity);
-            if (transformComp) {
-                transform.applyTo(*transformComp);
-            }
+    const auto& handles = core::EntityHandleTable::of(registry);
+    auto& transforms = registry.storage<core::TransformComponent>();
+
+    for (const Record& record : m_readBuffer->records) {
+        // Сущность удалена или её идентификатор переиспользован — запись устарела
+        const entt::entity entity = handles.resolve(record.handle);
+        if (entity == entt::null || !transforms.contains(entity)) {
+            continue;
         }
+        record.transform.applyTo(transforms.get(entity));
     }
 }
 
@@ -46,27 +98,27 @@ void PhysicsTransformBuffer::clear()
     m_bufferB.clear();
 }
 
-void PhysicsTransformBuffer::removeEntity(entt::entity entity)
+void PhysicsTransformBuffer::removeEntity(core::EntityHandle handle)
 {
     std::lock_guard<std::mutex> lock(m_swapMutex);
-    m_bufferA.erase(entity);
-    m_bufferB.erase(entity);
+    m_bufferA.remove(handle);
+    m_bufferB.remove(handle);
 }
 
 size_t PhysicsTransformBuffer::getWriteBufferSize() const
 {
-    return m_writeBuffer->size();
+    return m_writeBuffer->records.size();
 }
 
 size_t PhysicsTransformBuffer::getReadBufferSize() const
 {
-    return m_readBuffer->size();
+    return m_readBuffer->records.size();
 }
 
 void PhysicsTransformBuffer::reserve(size_t capacity)
 {
-    m_bufferA.reserve(capacity);
-    m_bufferB.reserve(capacity);
+    m_bufferA.records.reserve(capacity);
+    m_bufferB.records.reserve(capacity);
 }
 
 } // namespace simulation
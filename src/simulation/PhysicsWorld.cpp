@@ -1,8 +1,10 @@
 #include "PhysicsWorld.h"
+#include <algorithm>
 
 namespace simulation {
 
-PhysicsWorld::PhysicsWorld(const b2Vec2& gravity) {
+PhysicsWorld::PhysicsWorld(const b2Vec2& gravity, int subStepCount)
+    : m_subStepCount(std::max(1, subStepCount)) {
     // Создать определение мира с заданной гравитацией
     b2WorldDef worldDef = b2DefaultWorldDef();
     worldDef.gravity = gravity;
@@ -21,7 +23,7 @@ PhysicsWorld::~PhysicsWorld() {
 void PhysicsWorld::step(float deltaTime) {
     // Выполнить шаг симуляции с sub-stepping для точности
     // Box2D 3.x использует sub-steps вместо velocity/position iterations
-    b2World_Step(m_worldId, deltaTime, SUB_STEP_COUNT);
+    b2World_Step(m_worldId, deltaTime, m_subStepCount);
 }
 
 void PhysicsWorld::setGravity(const b2Vec2& gravity) {
@@ -32,6 +34,10 @@ b2Vec2 PhysicsWorld::getGravity() const {
     return b2World_GetGravity(m_worldId);
 }
 
+void PhysicsWorld::setSubStepCount(int subStepCount) {
+    m_subStepCount = std::max(1, subStepCount);
+}
+
 b2WorldId PhysicsWorld::getWorldId() const {
     return m_worldId;
 }
@@ -1,6 +1,8 @@
 #include "simulation/systems/PhysicsSystem.h"
 #include "simulation/PhysicsComponents.h"
+#include "simulation/PhysicsLod.h"
 #include "core/Components.h"
+#include "core/EntityHandleTable.h"
 #include "core/Logger.h"
 #include <algorithm>
 
@@ -53,6 +55,16 @@ void PhysicsSystem::update(entt::registry& registry, double dt) {
         // Шаг симуляции Box2D
         m_physicsWorld.step(FIXED_TIMESTEP);
 
+        // LOD: дальний мир накапливает время и шагает реже
+        if (m_lod) {
+            m_lod->onFixedStep(registry, *this, FIXED_TIMESTEP);
+        }
+
+        // События Box2D действительны только до следующего шага
+        for (IPhysicsStepListener* listener : m_stepListeners) {
+            listener->onPhysicsStep(registry, FIXED_TIMESTEP);
+        }
+
         m_accumulator -= FIXED_TIMESTEP;
         stepCount++;
     }
@@ -125,6 +137,11 @@ void PhysicsSystem::syncTransforms(entt::registry& registry) {
 }
 
 void PhysicsSystem::createBody(entt::registry& registry, entt::entity entity) {
+    if (m_bodyBatchDepth > 0) {
+        m_pendingBodies.push_back(entity);
+        return;
+    }
+
     // Проверяем наличие всех необходимых компонентов
     if (!registry.all_of<RigidbodyComponent, ColliderComponent, core::TransformComponent>(entity)) {
         LOG_WARN("PhysicsSystem::createBody - Entity missing required components (Rigidbody, Collider, Transform)");
@@ -132,8 +149,6 @@ void PhysicsSystem::createBody(entt::registry& registry, entt::entity entity) {
     }
 
     auto& rigidbody = registry.get<RigidbodyComponent>(entity);
-    auto& collider = registry.get<ColliderComponent>(entity);
-    auto& transform = registry.get<core::TransformComponent>(entity);
 
     // Если тело уже создано, пропускаем
     if (rigidbody.hasBox2DBody()) {
@@ -141,6 +156,63 @@ void PhysicsSystem::createBody(entt::registry& registry, entt::entity entity) {
         return;
     }
 
+    // Хэндл выдаётся здесь (главный поток, под мьютексом registry): поток физики
+    // только читает его из компонента и не изменяет таблицу хэндлов
+    if (rigidbody.handle.isNull()) {
+        rigidbody.handle = core::EntityHandleTable::of(registry).acquire(entity);
+    }
+
+    b2BodyId bodyId = createBodyInWorld(registry, entity, m_physicsWorld);
+    if (B2_IS_NULL(bodyId)) {
+        return;
+    }
+
+    // Сохраняем ID тела в компоненте
+    rigidbody.box2dBodyId = bodyId;
+
+    LOG_DEBUG("PhysicsSystem::createBody - Created body for entity (type: {})",
+              static_cast<int>(rigidbody.bodyType));
+}
+
+size_t PhysicsSystem::endBodyBatch(entt::registry& registry) {
+    if (m_bodyBatchDepth == 0 || --m_bodyBatchDepth > 0) {
+        return 0;
+    }
+
+    std::vector<entt::entity> pending;
+    pending.swap(m_pendingBodies);
+
+    size_t created = 0;
+    for (entt::entity entity : pending) {
+        // Сущность могла быть удалена или потерять компонент до конца пакета
+        if (!registry.valid(entity)) {
+            continue;
+        }
+        const auto* rigidbody = registry.try_get<RigidbodyComponent>(entity);
+        if (!rigidbody || rigidbody->hasBox2DBody()) {
+            continue;
+        }
+        createBody(registry, entity);
+        if (rigidbody->hasBox2DBody()) {
+            ++created;
+        }
+    }
+
+    LOG_DEBUG("PhysicsSystem::endBodyBatch - Created {} of {} pending bodies", created,
+              pending.size());
+    return created;
+}
+
+b2BodyId PhysicsSystem::createBodyInWorld(entt::registry& registry, entt::entity entity,
+                                          PhysicsWorld& world) {
+    if (!registry.all_of<RigidbodyComponent, ColliderComponent, core::TransformComponent>(entity)) {
+        return b2_nullBodyId;
+    }
+
+    auto& rigidbody = registry.get<RigidbodyComponent>(entity);
+    auto& collider = registry.get<ColliderComponent>(entity);
+    auto& transform = registry.get<core::TransformComponent>(entity);
+
     // Создаём b2BodyDef
     b2BodyDef bodyDef = b2DefaultBodyDef();
 
@@ -186,13 +258,13 @@ void PhysicsSystem::createBody(entt::registry& registry, entt::entity entity) {
     bodyDef.linearVelocity = PhysicsWorld::pixelsToMeters(b2Vec2{linearVel.x, linearVel.y});
     bodyDef.angularVelocity = rigidbody.angularVelocity;
 
-    // Сохраняем entity в userData для получения из Box2D событий
-    // Добавляем 1 к entity чтобы избежать nullptr для entity = 0
-    // При извлечении нужно вычитать 1
-    bodyDef.userData = reinterpret_cast<void*>(static_cast<uintptr_t>(entity) + 1);
+    // Сохраняем в userData внешний хэндл сущности: после удаления и переиспользования
+    // entity события Box2D не попадут в чужую сущность. Хэндл выдан в createBody():
+    // функция вызывается и из потока физики (PhysicsLod), таблицу здесь не трогаем
+    bodyDef.userData = rigidbody.handle.toUserData();
 
     // Создаём тело в Box2D
-    b2BodyId bodyId = b2CreateBody(m_physicsWorld.getWorldId(), &bodyDef);
+    b2BodyId bodyId = b2CreateBody(world.getWorldId(), &bodyDef);
 
     // Создаём shape для тела
     b2ShapeDef shapeDef = createShapeFromCollider(collider);
@@ -218,7 +290,7 @@ void PhysicsSystem::createBody(entt::registry& registry, entt::entity entity) {
         if (!collider.isPolygonValid()) {
             LOG_ERROR("PhysicsSystem::createBody - Invalid polygon (vertices: {})", collider.vertices.size());
             b2DestroyBody(bodyId);
-            return;
+            return b2_nullBodyId;
         }
 
         // Конвертируем вершины из пикселей в метры
@@ -234,11 +306,7 @@ void PhysicsSystem::createBody(entt::registry& registry, entt::entity entity) {
         b2CreatePolygonShape(bodyId, &shapeDef, &polygon);
     }
 
-    // Сохраняем ID тела в компоненте
-    rigidbody.box2dBodyId = bodyId;
-
-    LOG_DEBUG("PhysicsSystem::createBody - Created body for entity (type: {})",
-              static_cast<int>(rigidbody.bodyType));
+    return bodyId;
 }
 
 void PhysicsSystem::destroyBody(entt::registry& registry, entt::entity entity) {
@@ -249,15 +317,31 @@ void PhysicsSystem::destroyBody(entt::registry& registry, entt::entity entity) {
         return;
     }
 
-    // Удаляем тело из Box2D
+    // Удаляем тело из Box2D (тело может находиться и в дальнем LOD-мире)
     b2DestroyBody(rigidbody.box2dBodyId);
 
+    if (m_lod) {
+        m_lod->onBodyDestroyed(entity);
+    }
+
     // Сбрасываем ID
     rigidbody.box2dBodyId = b2_nullBodyId;
 
     LOG_DEBUG("PhysicsSystem::destroyBody - Destroyed body for entity");
 }
 
+void PhysicsSystem::addStepListener(IPhysicsStepListener* listener) {
+    if (listener && std::find(m_stepListeners.begin(), m_stepListeners.end(), listener) ==
+                        m_stepListeners.end()) {
+        m_stepListeners.push_back(listener);
+    }
+}
+
+void PhysicsSystem::removeStepListener(IPhysicsStepListener* listener) {
+    m_stepListeners.erase(std::remove(m_stepListeners.begin(), m_stepListeners.end(), listener),
+                          m_stepListeners.end());
+}
+
 b2ShapeDef PhysicsSystem::createShapeFromCollider(const ColliderComponent& collider) {
     b2ShapeDef shapeDef = b2DefaultShapeDef();
 
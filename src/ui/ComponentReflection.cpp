@@ -0,0 +1,78 @@
+#include "ui/ComponentReflection.h"
+#include "core/Components.h"
+
+namespace ui {
+
+const ComponentDescriptor* ComponentReflection::find(entt::id_type typeId) const {
+    auto it = m_byType.find(typeId);
+    return it != m_byType.end() ? &m_components[it->second] : nullptr;
+}
+
+void ComponentReflection::registerCoreComponents() {
+    using namespace core;
+
+    reflect<NameComponent>("Name")
+        .field<&NameComponent::name>("Name");
+
+    reflect<TagComponent>("Tag")
+        .field<&TagComponent::tag>("Tag");
+
+    reflect<TransformComponent>("Transform")
+        .field<&TransformComponent::x>("X")
+        .field<&TransformComponent::y>("Y")
+        .field<&TransformComponent::rotation>("Rotation", 0.5f)
+        .field<&TransformComponent::scaleX>("Scale X", 0.01f)
+        .field<&TransformComponent::scaleY>("Scale Y", 0.01f);
+
+    reflect<VelocityComponent>("Velocity")
+        .field<&VelocityComponent::vx>("VX")
+        .field<&VelocityComponent::vy>("VY")
+        .field<&VelocityComponent::angularVelocity>("Angular", 0.5f);
+
+    reflect<SpriteComponent>("Sprite")
+        .readOnly<&SpriteComponent::textureName>("Texture")
+        .field<&SpriteComponent::color>("Color")
+        .field<&SpriteComponent::layer>("Layer")
+        .field<&SpriteComponent::visible>("Visible");
+
+    reflect<CameraComponent>("Camera")
+        .field<&CameraComponent::zoom>("Zoom", 0.01f)
+        .field<&CameraComponent::active>("Active");
+
+    reflect<LifetimeComponent>("Lifetime")
+        .field<&LifetimeComponent::lifetime>("Lifetime", 0.05f)
+        .field<&LifetimeComponent::initialLifetime>("Initial", 0.05f)
+        .field<&LifetimeComponent::autoDestroy>("Auto destroy")
+        .field<&LifetimeComponent::fadeOut>("Fade out")
+        .field<&LifetimeComponent::fadeStartRatio>("Fade start", 0.01f);
+
+    reflect<AnimationComponent>("Animation")
+        .readOnly<&AnimationComponent::currentAnimation>("Animation")
+        .field<&AnimationComponent::currentFrame>("Frame")
+        .field<&AnimationComponent::frameDelay>("Frame delay", 0.01f)
+        .field<&AnimationComponent::loop>("Loop")
+        .field<&AnimationComponent::playing>("Playing");
+
+    reflect<ParentComponent>("Parent")
+        .readOnly<&ParentComponent::parent>("Parent");
+
+    reflect<CollisionComponent>("Collision")
+        .field<&CollisionComponent::isSolid>("Solid")
+        .field<&CollisionComponent::isTrigger>("Trigger")
+        .field<&CollisionComponent::bounds>("Bounds")
+        .readOnly<&CollisionComponent::layer>("Layer");
+
+    reflect<EntityStateComponent>("State")
+        .readOnly<&EntityStateComponent::currentState>("Current")
+        .readOnly<&EntityStateComponent::previousState>("Previous")
+        .readOnly<&EntityStateComponent::timeInState>("Time in state");
+
+    reflect<TilePositionComponent>("Tile position")
+        .field<&TilePositionComponent::tileX>("Tile X")
+        .field<&TilePositionComponent::tileY>("Tile Y")
+        .field<&TilePositionComponent::widthTiles>("Width")
+        .field<&TilePositionComponent::heightTiles>("Height")
+        .field<&TilePositionComponent::autoSync>("Auto sync");
+}
+
+} // namespace ui
@@ -0,0 +1,151 @@
+#include "ui/EntityNameFilter.h"
+#include "core/Logger.h"
+#include "core/ThreadConfig.h"
+
+#include <algorithm>
+#include <cctype>
+
+namespace ui {
+
+namespace {
+
+char toLowerAscii(char c) {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+}
+
+std::string toLowerAscii(std::string_view text) {
+    std::string lowered(text);
+    std::transform(lowered.begin(), lowered.end(), lowered.begin(),
+                   [](char c) { return toLowerAscii(c); });
+    return lowered;
+}
+
+} // namespace
+
+EntityNameFilter::~EntityNameFilter() {
+    stop();
+}
+
+bool EntityNameFilter::start() {
+    if (m_running.load(std::memory_order_acquire)) {
+        return true;
+    }
+
+    m_running.store(true, std::memory_order_release);
+    m_thread = std::thread(&EntityNameFilter::workerLoop, this);
+    LOG_DEBUG("EntityNameFilter: worker started");
+    return true;
+}
+
+void EntityNameFilter::stop() {
+    if (!m_running.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_running.store(false, std::memory_order_release);
+        m_pending.reset();
+    }
+    m_condition.notify_all();
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    LOG_DEBUG("EntityNameFilter: worker stopped");
+}
+
+uint64_t EntityNameFilter::request(std::string query, EntityNameSnapshot names) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const uint64_t id = m_latestRequest.load(std::memory_order_relaxed) + 1;
+    m_latestRequest.store(id, std::memory_order_release);
+    m_pending = Request{id, std::move(query), std::move(names)};
+    m_result.reset();
+    m_condition.notify_one();
+    return id;
+}
+
+std::optional<EntityNameFilter::Result> EntityNameFilter::poll() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::optional<Result> result = std::move(m_result);
+    m_result.reset();
+    return result;
+}
+
+bool EntityNameFilter::isBusy() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_working || m_pending.has_value();
+}
+
+bool EntityNameFilter::matches(std::string_view name, std::string_view loweredQuery) {
+    if (loweredQuery.empty()) {
+        return true;
+    }
+    if (loweredQuery.size() > name.size()) {
+        return false;
+    }
+
+    auto it = std::search(name.begin(), name.end(), loweredQuery.begin(), loweredQuery.end(),
+                          [](char a, char b) { return toLowerAscii(a) == b; });
+    return it != name.end();
+}
+
+std::vector<entt::entity> EntityNameFilter::filter(const std::vector<EntityNameEntry>& names,
+                                                   std::string_view query) {
+    const std::string lowered = toLowerAscii(query);
+    std::vector<entt::entity> result;
+    for (const auto& entry : names) {
+        if (matches(entry.name, lowered)) {
+            result.push_back(entry.entity);
+        }
+    }
+    return result;
+}
+
+void EntityNameFilter::workerLoop() {
+    core::ThreadSchedulingConfig::fromConfig("worker", "opc-worker").applyToCurrentThread();
+
+    while (true) {
+        Request request;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this] {
+                return m_pending.has_value() || !m_running.load(std::memory_order_acquire);
+            });
+            if (!m_running.load(std::memory_order_acquire)) {
+                break;
+            }
+            request = std::move(*m_pending);
+            m_pending.reset();
+            m_working = true;
+        }
+
+        const std::string lowered = toLowerAscii(request.query);
+        std::vector<entt::entity> matched;
+        bool cancelled = false;
+
+        if (request.names) {
+            const auto& names = *request.names;
+            for (size_t i = 0; i < names.size(); ++i) {
+                // Пользователь продолжил печатать — этот проход уже не нужен
+                if (i % CANCEL_CHECK_INTERVAL == 0 &&
+                    (m_latestRequest.load(std::memory_order_acquire) != request.id ||
+                     !m_running.load(std::memory_order_acquire))) {
+                    cancelled = true;
+                    break;
+                }
+                if (matches(names[i].name, lowered)) {
+                    matched.push_back(names[i].entity);
+                }
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_working = false;
+        if (!cancelled && m_latestRequest.load(std::memory_order_acquire) == request.id) {
+            m_result = Result{request.id, std::move(request.query), std::move(matched)};
+        }
+    }
+}
+
+} // namespace ui
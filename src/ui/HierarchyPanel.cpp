@@ -0,0 +1,146 @@
+#include "ui/HierarchyPanel.h"
+#include "core/Components.h"
+
+#include <imgui.h>
+#include <imgui_stdlib.h>
+
+namespace ui {
+
+HierarchyPanel::HierarchyPanel(SceneTreeCache& tree, EntityNameFilter& filter)
+    : m_tree(tree), m_filter(filter) {
+}
+
+void HierarchyPanel::setSelected(entt::entity entity) {
+    m_selected = entity;
+    if (entity != entt::null) {
+        m_tree.expandTo(entity);
+        m_scrollToSelected = true;
+    }
+}
+
+void HierarchyPanel::draw(entt::registry& registry, bool* open) {
+    if (!ImGui::Begin("Hierarchy", open)) {
+        ImGui::End();
+        return;
+    }
+
+    if (m_selected != entt::null && !registry.valid(m_selected)) {
+        m_selected = entt::null;
+    }
+
+    drawFilter();
+
+    const auto& rows = m_tree.rows();
+    ImGui::TextDisabled("%zu entities, %zu rows", m_tree.getNodeCount(), rows.size());
+
+    if (ImGui::BeginChild("##hierarchy_rows")) {
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(rows.size()));
+
+        // Прокрутка к выбранной: строка должна попасть в клиппер хотя бы раз
+        int scrollIndex = -1;
+        if (m_scrollToSelected) {
+            for (size_t i = 0; i < rows.size(); ++i) {
+                if (rows[i].entity == m_selected) {
+                    scrollIndex = static_cast<int>(i);
+                    clipper.IncludeItemByIndex(scrollIndex);
+                    break;
+                }
+            }
+            m_scrollToSelected = false;
+        }
+
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
+                drawRow(registry, rows[static_cast<size_t>(i)]);
+                if (i == scrollIndex) {
+                    ImGui::SetScrollHereY();
+                }
+            }
+        }
+        clipper.End();
+    }
+    ImGui::EndChild();
+
+    ImGui::End();
+}
+
+void HierarchyPanel::drawFilter() {
+    const double now = ImGui::GetTime();
+
+    if (ImGui::InputTextWithHint("##hierarchy_filter", "Filter by name", &m_query)) {
+        if (m_query.empty()) {
+            m_pendingRequest = 0;
+            m_filteredNames.reset();
+            m_tree.clearFilter();
+        } else {
+            m_filteredNames = m_tree.nameSnapshot();
+            m_pendingRequest = m_filter.request(m_query, m_filteredNames);
+            m_lastFilterTime = now;
+        }
+    } else if (!m_query.empty() && now - m_lastFilterTime >= REFILTER_INTERVAL) {
+        // Имена могли измениться: повторяем запрос не чаще интервала и только
+        // если снимок действительно другой
+        m_lastFilterTime = now;
+        EntityNameSnapshot names = m_tree.nameSnapshot();
+        if (names != m_filteredNames) {
+            m_filteredNames = std::move(names);
+            m_pendingRequest = m_filter.request(m_query, m_filteredNames);
+        }
+    }
+
+    if (auto result = m_filter.poll()) {
+        if (result->requestId == m_pendingRequest) {
+            m_tree.setFilter(result->matches);
+            m_pendingRequest = 0;
+        }
+    }
+
+    if (m_pendingRequest != 0) {
+        ImGui::SameLine();
+        ImGui::TextDisabled("searching...");
+    }
+}
+
+void HierarchyPanel::drawRow(entt::registry& registry, const SceneTreeCache::Row& row) {
+    ImGui::PushID(static_cast<int>(entt::to_integral(row.entity)));
+
+    const float indent = static_cast<float>(row.depth) * ImGui::GetStyle().IndentSpacing;
+    ImGui::SetCursorPosX(ImGui::GetCursorPosX() + indent);
+
+    ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_OpenOnArrow |
+                               ImGuiTreeNodeFlags_SpanAvailWidth |
+                               ImGuiTreeNodeFlags_NoTreePushOnOpen;
+    if (!row.hasChildren) {
+        flags |= ImGuiTreeNodeFlags_Leaf;
+    }
+    if (row.entity == m_selected) {
+        flags |= ImGuiTreeNodeFlags_Selected;
+    }
+
+    // Имя читается только для строк, попавших в клиппер
+    const auto* name = registry.valid(row.entity)
+                           ? registry.try_get<core::NameComponent>(row.entity)
+                           : nullptr;
+
+    ImGui::SetNextItemOpen(row.expanded);
+    bool nodeOpen = false;
+    if (name) {
+        nodeOpen = ImGui::TreeNodeEx("##node", flags, "%s", name->name.c_str());
+    } else {
+        nodeOpen = ImGui::TreeNodeEx("##node", flags, "Entity %u",
+                                     static_cast<unsigned>(entt::to_entity(row.entity)));
+    }
+
+    if (ImGui::IsItemClicked() && !ImGui::IsItemToggledOpen()) {
+        m_selected = row.entity;
+    }
+    // В режиме фильтра узлы всегда раскрыты — пользовательское состояние не трогаем
+    if (row.hasChildren && !m_tree.hasFilter() && nodeOpen != row.expanded) {
+        m_tree.setExpanded(row.entity, nodeOpen);
+    }
+
+    ImGui::PopID();
+}
+
+} // namespace ui
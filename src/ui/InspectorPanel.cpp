@@ -0,0 +1,131 @@
+#include "ui/InspectorPanel.h"
+
+#include <imgui.h>
+#include <imgui_stdlib.h>
+
+#include <string>
+
+namespace ui {
+
+InspectorPanel::InspectorPanel(const ComponentReflection& reflection)
+    : m_reflection(reflection) {
+}
+
+void InspectorPanel::draw(entt::registry& registry, entt::entity entity, bool* open) {
+    if (!ImGui::Begin("Inspector", open)) {
+        ImGui::End();
+        return;
+    }
+
+    if (entity == entt::null || !registry.valid(entity)) {
+        ImGui::TextDisabled("No entity selected");
+        ImGui::End();
+        return;
+    }
+
+    ImGui::Text("Entity %u (version %u)", static_cast<unsigned>(entt::to_entity(entity)),
+                static_cast<unsigned>(entt::to_version(entity)));
+    ImGui::Separator();
+
+    for (const ComponentDescriptor& component : m_reflection.components()) {
+        void* data = component.tryGet(registry, entity);
+        if (!data) {
+            continue;
+        }
+
+        ImGui::PushID(component.name);
+        if (ImGui::CollapsingHeader(component.name, ImGuiTreeNodeFlags_DefaultOpen)) {
+            bool changed = false;
+            for (const FieldDescriptor& field : component.fields) {
+                changed |= drawField(field, field.access(data));
+            }
+            // Сигнал on_update — один раз за кадр и только при изменении
+            if (changed) {
+                component.notifyChanged(registry, entity);
+            }
+        }
+        ImGui::PopID();
+    }
+
+    // Остальные компоненты сущности — только имена типов
+    bool hasOther = false;
+    for (auto [id, storage] : registry.storage()) {
+        if (!storage.contains(entity) || m_reflection.find(id)) {
+            continue;
+        }
+        if (!hasOther) {
+            ImGui::Separator();
+            ImGui::TextDisabled("Other components:");
+            hasOther = true;
+        }
+        const std::string_view typeName = storage.type().name();
+        ImGui::BulletText("%.*s", static_cast<int>(typeName.size()), typeName.data());
+    }
+
+    ImGui::End();
+}
+
+bool InspectorPanel::drawField(const FieldDescriptor& field, void* value) {
+    if (field.readOnly) {
+        ImGui::BeginDisabled();
+    }
+
+    bool changed = false;
+    switch (field.kind) {
+        case FieldKind::Float:
+            changed = ImGui::DragFloat(field.name, static_cast<float*>(value), field.speed);
+            break;
+        case FieldKind::Int:
+            changed = ImGui::DragInt(field.name, static_cast<int*>(value), field.speed);
+            break;
+        case FieldKind::Bool:
+            changed = ImGui::Checkbox(field.name, static_cast<bool*>(value));
+            break;
+        case FieldKind::String:
+            changed = ImGui::InputText(field.name, static_cast<std::string*>(value));
+            break;
+        case FieldKind::StringId: {
+            const auto& id = *static_cast<core::StringId*>(value);
+            ImGui::LabelText(field.name, "%s", id.str().c_str());
+            break;
+        }
+        case FieldKind::Color: {
+            auto& color = *static_cast<sf::Color*>(value);
+            float rgba[4] = {color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f};
+            if (ImGui::ColorEdit4(field.name, rgba)) {
+                color = sf::Color(static_cast<uint8_t>(rgba[0] * 255.0f + 0.5f),
+                                  static_cast<uint8_t>(rgba[1] * 255.0f + 0.5f),
+                                  static_cast<uint8_t>(rgba[2] * 255.0f + 0.5f),
+                                  static_cast<uint8_t>(rgba[3] * 255.0f + 0.5f));
+                changed = true;
+            }
+            break;
+        }
+        case FieldKind::FloatRect: {
+            auto& rect = *static_cast<sf::FloatRect*>(value);
+            ImGui::PushID(field.name);
+            ImGui::TextUnformatted(field.name);
+            changed |= ImGui::DragFloat2("Position", &rect.position.x, field.speed);
+            changed |= ImGui::DragFloat2("Size", &rect.size.x, field.speed);
+            ImGui::PopID();
+            break;
+        }
+        case FieldKind::Entity: {
+            const auto entity = *static_cast<entt::entity*>(value);
+            if (entity == entt::null) {
+                ImGui::LabelText(field.name, "none");
+            } else {
+                ImGui::LabelText(field.name, "Entity %u",
+                                 static_cast<unsigned>(entt::to_entity(entity)));
+            }
+            break;
+        }
+    }
+
+    if (field.readOnly) {
+        ImGui::EndDisabled();
+    }
+    return changed && !field.readOnly;
+}
+
+} // namespace ui
@@ -0,0 +1,357 @@
+#include "ui/SceneTreeCache.h"
+#include "core/Components.h"
+#include "core/Logger.h"
+#include <algorithm>
+
+namespace ui {
+
+SceneTreeCache::~SceneTreeCache() {
+    shutdown();
+}
+
+void SceneTreeCache::init(entt::registry& registry) {
+    if (m_registry) {
+        shutdown();
+    }
+    m_registry = &registry;
+
+    // Сначала все узлы корнями, затем связи: родитель может идти позже ребёнка
+    for (auto [entity] : registry.storage<entt::entity>().each()) {
+        addNode(entity);
+    }
+    auto parents = registry.view<core::ParentComponent>();
+    for (auto entity : parents) {
+        setParent(entity, parents.get<core::ParentComponent>(entity).parent);
+    }
+
+    registry.on_construct<entt::entity>().connect<&SceneTreeCache::onEntityCreated>(this);
+    registry.on_destroy<entt::entity>().connect<&SceneTreeCache::onEntityDestroyed>(this);
+    registry.on_construct<core::ParentComponent>().connect<&SceneTreeCache::onParentChanged>(this);
+    registry.on_update<core::ParentComponent>().connect<&SceneTreeCache::onParentChanged>(this);
+    registry.on_destroy<core::ParentComponent>().connect<&SceneTreeCache::onParentDestroyed>(this);
+    registry.on_construct<core::NameComponent>().connect<&SceneTreeCache::onNameChanged>(this);
+    registry.on_update<core::NameComponent>().connect<&SceneTreeCache::onNameChanged>(this);
+    registry.on_destroy<core::NameComponent>().connect<&SceneTreeCache::onNameChanged>(this);
+
+    LOG_DEBUG("SceneTreeCache initialized: {} entities, {} roots", m_nodeCount, m_roots.size());
+}
+
+void SceneTreeCache::shutdown() {
+    if (m_registry) {
+        m_registry->on_construct<entt::entity>().disconnect<&SceneTreeCache::onEntityCreated>(this);
+        m_registry->on_destroy<entt::entity>().disconnect<&SceneTreeCache::onEntityDestroyed>(this);
+        m_registry->on_construct<core::ParentComponent>()
+            .disconnect<&SceneTreeCache::onParentChanged>(this);
+        m_registry->on_update<core::ParentComponent>()
+            .disconnect<&SceneTreeCache::onParentChanged>(this);
+        m_registry->on_destroy<core::ParentComponent>()
+            .disconnect<&SceneTreeCache::onParentDestroyed>(this);
+        m_registry->on_construct<core::NameComponent>()
+            .disconnect<&SceneTreeCache::onNameChanged>(this);
+        m_registry->on_update<core::NameComponent>()
+            .disconnect<&SceneTreeCache::onNameChanged>(this);
+        m_registry->on_destroy<core::NameComponent>()
+            .disconnect<&SceneTreeCache::onNameChanged>(this);
+        m_registry = nullptr;
+    }
+
+    m_nodes.clear();
+    m_roots.clear();
+    m_nodeCount = 0;
+    m_rows.clear();
+    m_rowsDirty = true;
+    m_filterActive = false;
+    m_filterMarks.clear();
+    m_filterStamp = 0;
+    m_nameSnapshot.reset();
+    m_namesDirty = true;
+}
+
+const std::vector<SceneTreeCache::Row>& SceneTreeCache::rows() {
+    if (m_rowsDirty) {
+        rebuildRows();
+    }
+    return m_rows;
+}
+
+void SceneTreeCache::setExpanded(entt::entity entity, bool expanded) {
+    Node* node = findNode(entity);
+    if (!node || node->expanded == expanded) {
+        return;
+    }
+    node->expanded = expanded;
+    if (!node->children.empty()) {
+        invalidateRowsAt(node->parent);
+    }
+}
+
+bool SceneTreeCache::isExpanded(entt::entity entity) const {
+    const Node* node = findNode(entity);
+    return node && node->expanded;
+}
+
+void SceneTreeCache::expandTo(entt::entity entity) {
+    const Node* node = findNode(entity);
+    while (node && node->parent != entt::null) {
+        Node* parent = findNode(node->parent);
+        if (parent && !parent->expanded) {
+            parent->expanded = true;
+            m_rowsDirty = true;
+        }
+        node = parent;
+    }
+}
+
+void SceneTreeCache::setFilter(std::span<const entt::entity> matches) {
+    m_filterMarks.resize(m_nodes.size(), 0);
+    if (++m_filterStamp == 0) {
+        // Переполнение метки: один раз очищаем массив
+        std::fill(m_filterMarks.begin(), m_filterMarks.end(), 0);
+        m_filterStamp = 1;
+    }
+
+    // Совпадение и все его предки; подъём останавливается на уже отмеченном узле
+    for (entt::entity match : matches) {
+        const Node* node = findNode(match);
+        while (node) {
+            uint32_t& mark = m_filterMarks[entt::to_entity(node->entity)];
+            if (mark == m_filterStamp) {
+                break;
+            }
+            mark = m_filterStamp;
+            node = findNode(node->parent);
+        }
+    }
+
+    m_filterActive = true;
+    m_rowsDirty = true;
+}
+
+void SceneTreeCache::clearFilter() {
+    if (m_filterActive) {
+        m_filterActive = false;
+        m_rowsDirty = true;
+    }
+}
+
+EntityNameSnapshot SceneTreeCache::nameSnapshot() {
+    if (!m_namesDirty && m_nameSnapshot) {
+        return m_nameSnapshot;
+    }
+
+    auto names = std::make_shared<std::vector<EntityNameEntry>>();
+    if (m_registry) {
+        auto view = m_registry->view<core::NameComponent>();
+        names->reserve(view.size());
+        for (auto entity : view) {
+            names->push_back({entity, view.get<core::NameComponent>(entity).name});
+        }
+    }
+
+    m_nameSnapshot = std::move(names);
+    m_namesDirty = false;
+    return m_nameSnapshot;
+}
+
+entt::entity SceneTreeCache::parentOf(entt::entity entity) const {
+    const Node* node = findNode(entity);
+    return node ? node->parent : entt::null;
+}
+
+std::span<const entt::entity> SceneTreeCache::childrenOf(entt::entity entity) const {
+    const Node* node = findNode(entity);
+    if (!node) {
+        return {};
+    }
+    return node->children;
+}
+
+void SceneTreeCache::onEntityCreated(entt::registry& /*registry*/, entt::entity entity) {
+    addNode(entity);
+}
+
+void SceneTreeCache::onEntityDestroyed(entt::registry& /*registry*/, entt::entity entity) {
+    removeNode(entity);
+}
+
+void SceneTreeCache::onParentChanged(entt::registry& registry, entt::entity entity) {
+    setParent(entity, registry.get<core::ParentComponent>(entity).parent);
+}
+
+void SceneTreeCache::onParentDestroyed(entt::registry& /*registry*/, entt::entity entity) {
+    setParent(entity, entt::null);
+}
+
+void SceneTreeCache::onNameChanged(entt::registry& /*registry*/, entt::entity /*entity*/) {
+    m_namesDirty = true;
+}
+
+SceneTreeCache::Node* SceneTreeCache::findNode(entt::entity entity) {
+    if (entity == entt::null) {
+        return nullptr;
+    }
+    const auto index = static_cast<size_t>(entt::to_entity(entity));
+    if (index >= m_nodes.size() || m_nodes[index].entity != entity) {
+        return nullptr;
+    }
+    return &m_nodes[index];
+}
+
+const SceneTreeCache::Node* SceneTreeCache::findNode(entt::entity entity) const {
+    return const_cast<SceneTreeCache*>(this)->findNode(entity);
+}
+
+void SceneTreeCache::addNode(entt::entity entity) {
+    const auto index = static_cast<size_t>(entt::to_entity(entity));
+    if (index >= m_nodes.size()) {
+        m_nodes.resize(index + 1);
+    }
+
+    Node& node = m_nodes[index];
+    if (node.entity != entt::null) {
+        // Слот занят старой версией (удаление не было замечено) — освобождаем
+        removeNode(node.entity);
+    }
+
+    node.entity = entity;
+    node.expanded = false;
+    attach(node, entt::null);
+    ++m_nodeCount;
+}
+
+void SceneTreeCache::removeNode(entt::entity entity) {
+    Node* node = findNode(entity);
+    if (!node) {
+        return;
+    }
+
+    // Дети остаются жить — переносим их в корни
+    while (!node->children.empty()) {
+        Node* child = findNode(node->children.back());
+        detach(*child);
+        attach(*child, entt::null);
+    }
+
+    detach(*node);
+    node->entity = entt::null;
+    node->children.clear();
+    node->expanded = false;
+    --m_nodeCount;
+}
+
+void SceneTreeCache::setParent(entt::entity entity, entt::entity parent) {
+    Node* node = findNode(entity);
+    if (!node) {
+        return;
+    }
+
+    // Неизвестный родитель или цикл (родитель — потомок самой сущности) — корень
+    if (!findNode(parent)) {
+        parent = entt::null;
+    }
+    for (const Node* ancestor = findNode(parent); ancestor; ancestor = findNode(ancestor->parent)) {
+        if (ancestor->entity == entity) {
+            LOG_WARN("SceneTreeCache: parent cycle at entity {}, shown as root",
+                     static_cast<uint32_t>(entity));
+            parent = entt::null;
+            break;
+        }
+    }
+
+    if (node->parent == parent && node->position != NO_POSITION) {
+        return;
+    }
+    detach(*node);
+    attach(*node, parent);
+}
+
+void SceneTreeCache::attach(Node& node, entt::entity parent) {
+    Node* parentNode = findNode(parent);
+    std::vector<entt::entity>& siblings = parentNode ? parentNode->children : m_roots;
+
+    node.parent = parentNode ? parent : entt::null;
+    node.position = static_cast<uint32_t>(siblings.size());
+    siblings.push_back(node.entity);
+    invalidateRowsAt(node.parent);
+}
+
+void SceneTreeCache::detach(Node& node) {
+    if (node.position == NO_POSITION) {
+        return;
+    }
+
+    Node* parentNode = findNode(node.parent);
+    std::vector<entt::entity>& siblings = parentNode ? parentNode->children : m_roots;
+
+    // swap-and-pop с обновлением позиции перемещённого соседа
+    const uint32_t position = node.position;
+    if (position + 1 != siblings.size()) {
+        siblings[position] = siblings.back();
+        findNode(siblings[position])->position = position;
+    }
+    siblings.pop_back();
+
+    invalidateRowsAt(node.parent);
+    node.parent = entt::null;
+    node.position = NO_POSITION;
+}
+
+void SceneTreeCache::invalidateRowsAt(entt::entity parent) {
+    if (m_rowsDirty) {
+        return;
+    }
+    // Отфильтрованный список зависит от меток, проще перестроить
+    if (m_filterActive) {
+        m_rowsDirty = true;
+        return;
+    }
+
+    // Изменение видно, только если все предки раскрыты
+    for (const Node* node = findNode(parent); node; node = findNode(node->parent)) {
+        if (!node->expanded) {
+            return;
+        }
+    }
+    m_rowsDirty = true;
+}
+
+void SceneTreeCache::rebuildRows() {
+    m_rows.clear();
+    m_stack.clear();
+
+    auto isShown = [this](entt::entity entity) {
+        return !m_filterActive ||
+               (entt::to_entity(entity) < m_filterMarks.size() &&
+                m_filterMarks[entt::to_entity(entity)] == m_filterStamp);
+    };
+
+    // Обратный порядок на стеке — прямой порядок в списке
+    for (auto it = m_roots.rbegin(); it != m_roots.rend(); ++it) {
+        if (isShown(*it)) {
+            m_stack.emplace_back(*it, 0u);
+        }
+    }
+
+    while (!m_stack.empty()) {
+        const auto [entity, depth] = m_stack.back();
+        m_stack.pop_back();
+
+        const Node* node = findNode(entity);
+        const bool expanded = m_filterActive || node->expanded;
+        m_rows.push_back({entity, depth, !node->children.empty(), expanded});
+
+        if (!expanded) {
+            continue;
+        }
+        for (auto it = node->children.rbegin(); it != node->children.rend(); ++it) {
+            if (isShown(*it)) {
+                m_stack.emplace_back(*it, depth + 1);
+            }
+        }
+    }
+
+    m_rowsDirty = false;
+    ++m_rowsRebuildCount;
+}
+
+} // namespace ui
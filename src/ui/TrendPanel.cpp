@@ -0,0 +1,84 @@
+#include "ui/TrendPanel.h"
+
+#include <imgui.h>
+#include <implot.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace ui {
+
+void TrendPanel::draw(const core::TrendStore& store, std::span<const core::StringId> tags,
+                      bool* open) {
+    if (!ImGui::Begin("Trends", open)) {
+        ImGui::End();
+        return;
+    }
+
+    if (tags.empty()) {
+        tags = store.tags();
+    }
+
+    ImGui::Checkbox("Follow", &m_follow);
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(120.0f);
+    ImGui::DragScalar("Window, s", ImGuiDataType_Double, &m_followWindow, 1.0f);
+    m_followWindow = std::max(m_followWindow, 1.0);
+
+    double latest = 0.0;
+    for (core::StringId tag : tags) {
+        if (const core::TrendSeries* series = store.find(tag); series && series->last()) {
+            latest = std::max(latest, series->last()->time);
+        }
+    }
+
+    if (ImPlot::BeginPlot("##trends", ImVec2(-1.0f, -1.0f))) {
+        ImPlot::SetupAxes("Time, s", nullptr, ImPlotAxisFlags_None, ImPlotAxisFlags_AutoFit);
+        if (m_follow) {
+            ImPlot::SetupAxisLimits(ImAxis_X1, latest - m_followWindow, latest, ImPlotCond_Always);
+        }
+
+        const ImPlotRect limits = ImPlot::GetPlotLimits();
+        const size_t width = static_cast<size_t>(std::max(ImPlot::GetPlotSize().x, 1.0f));
+
+        for (core::StringId tag : tags) {
+            const core::TrendSeries* series = store.find(tag);
+            if (!series) {
+                continue;
+            }
+            const auto& points = view(tag, *series, limits.X.Min, limits.X.Max, width);
+            if (points.empty()) {
+                continue;
+            }
+            ImPlot::PlotLine(tag.str().c_str(), &points[0].time, &points[0].value,
+                             static_cast<int>(points.size()), ImPlotLineFlags_None, 0,
+                             static_cast<int>(sizeof(core::TrendPoint)));
+        }
+
+        // Ручное панорамирование/масштабирование отключает слежение
+        if (ImPlot::IsPlotHovered() &&
+            (ImGui::IsMouseDragging(ImGuiMouseButton_Left) || ImGui::GetIO().MouseWheel != 0.0f)) {
+            m_follow = false;
+        }
+        ImPlot::EndPlot();
+    }
+
+    ImGui::End();
+}
+
+const std::vector<core::TrendPoint>& TrendPanel::view(core::StringId tag,
+                                                      const core::TrendSeries& series,
+                                                      double begin, double end, size_t width) {
+    CachedView& cached = m_cache[tag];
+    if (cached.begin != begin || cached.end != end || cached.width != width ||
+        cached.version != series.getVersion() || cached.points.empty()) {
+        series.query(begin, end, width, cached.points);
+        cached.begin = begin;
+        cached.end = end;
+        cached.width = width;
+        cached.version = series.getVersion();
+    }
+    return cached.points;
+}
+
+} // namespace ui
@@ -0,0 +1,241 @@
+/**
+ * @file test_alarm_engine.cpp
+ * @brief Unit tests for AlarmEngine
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <core/AlarmEngine.h>
+
+#include <string>
+#include <vector>
+
+using namespace core;
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+AlarmDefinition highLevel(double setpoint, double deadband = 0.0) {
+    AlarmDefinition definition;
+    definition.name = "tank1.level.high";
+    definition.tag = "tank1.level";
+    definition.condition = AlarmCondition::High;
+    definition.setpoint = setpoint;
+    definition.deadband = deadband;
+    return definition;
+}
+
+} // namespace
+
+TEST_CASE("AlarmEngine: Deadband and ISA-18.2 acknowledgement", "[Alarms]") {
+    AlarmEngine alarms;
+    auto high = alarms.addAlarm(highLevel(90.0, 5.0));
+
+    alarms.setTag("tank1.level", 89.0);
+    REQUIRE(alarms.update(1.0) == 0);
+    alarms.setTag("tank1.level", 90.0);
+    REQUIRE(alarms.update(2.0) == 1);
+    REQUIRE(alarms.getState(high) == AlarmState::Unacknowledged);
+    REQUIRE(alarms.getUnacknowledgedCount() == 1);
+
+    // Inside the deadband the alarm stays active
+    alarms.setTag("tank1.level", 86.0);
+    REQUIRE(alarms.update(3.0) == 0);
+    REQUIRE(alarms.isConditionActive(high));
+
+    REQUIRE(alarms.acknowledge(high, 4.0));
+    REQUIRE_FALSE(alarms.acknowledge(high, 4.0));
+    REQUIRE(alarms.getState(high) == AlarmState::Acknowledged);
+    REQUIRE(alarms.getUnacknowledgedCount() == 0);
+
+    // Acknowledged alarm returns straight to normal
+    alarms.setTag("tank1.level", 85.0);
+    REQUIRE(alarms.update(5.0) == 1);
+    REQUIRE(alarms.getState(high) == AlarmState::Normal);
+    REQUIRE(alarms.getActiveCount() == 0);
+
+    // Unacknowledged alarm that clears waits for acknowledgement
+    alarms.setTag("tank1.level", 95.0);
+    alarms.update(6.0);
+    alarms.setTag("tank1.level", 50.0);
+    alarms.update(7.0);
+    REQUIRE(alarms.getState(high) == AlarmState::ReturnedUnack);
+    REQUIRE(alarms.getActiveCount() == 1);
+    REQUIRE(alarms.acknowledge(high, 8.0));
+    REQUIRE(alarms.getState(high) == AlarmState::Normal);
+
+    std::vector<AlarmTransition> transitions;
+    REQUIRE(alarms.collectTransitions(transitions) == 6);
+    REQUIRE(transitions[0].event == AlarmEvent::Raised);
+    REQUIRE_THAT(transitions[0].value, WithinAbs(90.0, 1e-12));
+    REQUIRE(transitions[2].event == AlarmEvent::Cleared);
+    REQUIRE(transitions[2].state == AlarmState::Normal);
+    REQUIRE(transitions[5].event == AlarmEvent::Acknowledged);
+}
+
+TEST_CASE("AlarmEngine: On and off delays filter short excursions", "[Alarms]") {
+    AlarmEngine alarms;
+    AlarmDefinition definition = highLevel(90.0);
+    definition.onDelay = 5.0;
+    definition.offDelay = 2.0;
+    auto high = alarms.addAlarm(definition);
+
+    // A 3 second spike never raises the alarm
+    alarms.setTag("tank1.level", 95.0);
+    alarms.update(10.0);
+    alarms.setTag("tank1.level", 80.0);
+    alarms.update(13.0);
+    REQUIRE(alarms.update(20.0) == 0);
+    REQUIRE(alarms.getState(high) == AlarmState::Normal);
+
+    alarms.setTag("tank1.level", 95.0);
+    alarms.update(30.0);
+    REQUIRE(alarms.update(34.0) == 0);
+    REQUIRE(alarms.update(36.0) == 1);
+
+    std::vector<AlarmTransition> transitions;
+    alarms.collectTransitions(transitions);
+    REQUIRE_THAT(transitions.back().time, WithinAbs(35.0, 1e-9));  // The delay deadline
+
+    alarms.setTag("tank1.level", 80.0);
+    alarms.update(40.0);
+    REQUIRE(alarms.isConditionActive(high));
+    alarms.update(42.0);
+    REQUIRE_FALSE(alarms.isConditionActive(high));
+    REQUIRE(alarms.getState(high) == AlarmState::ReturnedUnack);
+}
+
+TEST_CASE("AlarmEngine: Communication loss and shelving", "[Alarms]") {
+    AlarmEngine alarms;
+    AlarmDefinition stale;
+    stale.name = "plc1.comm_loss";
+    stale.tag = "plc1.heartbeat";
+    stale.condition = AlarmCondition::Stale;
+    stale.setpoint = 10.0;
+    stale.priority = AlarmPriority::Critical;
+    auto commLoss = alarms.addAlarm(stale);
+
+    // Repeating the same value still counts as a live connection
+    for (double t = 4.0; t <= 40.0; t += 4.0) {
+        alarms.setTag("plc1.heartbeat", 1.0);
+        alarms.update(t);
+    }
+    REQUIRE(alarms.getState(commLoss) == AlarmState::Normal);
+
+    REQUIRE(alarms.update(55.0) == 1);
+    REQUIRE(alarms.getState(commLoss) == AlarmState::Unacknowledged);
+
+    SECTION("Timed shelving hides the alarm and raises it again on expiry") {
+        REQUIRE(alarms.shelve(commLoss, 56.0, 100.0));
+        REQUIRE_FALSE(alarms.shelve(commLoss, 56.0, 100.0));
+        REQUIRE(alarms.getActiveCount() == 0);
+        REQUIRE(alarms.getUnacknowledgedCount() == 0);
+        REQUIRE_FALSE(alarms.acknowledge(commLoss, 57.0));
+
+        REQUIRE(alarms.update(150.0) == 0);
+        REQUIRE(alarms.update(156.0) == 2);  // Unshelved + Raised
+        REQUIRE_FALSE(alarms.isShelved(commLoss));
+        REQUIRE(alarms.getState(commLoss) == AlarmState::Unacknowledged);
+    }
+
+    SECTION("A new heartbeat clears the alarm") {
+        alarms.setTag("plc1.heartbeat", 2.0);
+        REQUIRE(alarms.update(60.0) == 1);
+        REQUIRE(alarms.getState(commLoss) == AlarmState::ReturnedUnack);
+        REQUIRE(alarms.update(69.0) == 0);
+        REQUIRE(alarms.update(70.0) == 1);
+    }
+}
+
+TEST_CASE("AlarmEngine: Quiet plant costs nothing", "[Alarms]") {
+    AlarmEngine alarms;
+    constexpr int TAGS = 1000;
+    for (int i = 0; i < TAGS; ++i) {
+        AlarmDefinition high = highLevel(90.0, 1.0);
+        high.tag = StringId("motor." + std::to_string(i) + ".current");
+        high.name = StringId("motor." + std::to_string(i) + ".overload");
+        alarms.addAlarm(high);
+
+        AlarmDefinition low = high;
+        low.condition = AlarmCondition::Low;
+        low.setpoint = 5.0;
+        alarms.addAlarm(low);
+    }
+    REQUIRE(alarms.getAlarmCount() == 2 * TAGS);
+
+    REQUIRE(alarms.update(1.0) == 0);
+    REQUIRE(alarms.getEvaluatedCount() == 0);
+
+    REQUIRE(alarms.setTag("motor.42.current", 50.0));
+    alarms.update(2.0);
+    REQUIRE(alarms.getEvaluatedCount() == 2);
+
+    alarms.setTag("motor.42.current", 50.0);
+    alarms.update(3.0);
+    REQUIRE(alarms.getEvaluatedCount() == 0);
+
+    REQUIRE_FALSE(alarms.setTag("motor.unknown.current", 1.0));
+}
+
+TEST_CASE("AlarmEngine: Active alarms are ordered by importance", "[Alarms]") {
+    AlarmEngine alarms;
+    std::vector<AlarmId> ids;
+    const AlarmPriority priorities[] = {AlarmPriority::Low, AlarmPriority::Critical,
+                                        AlarmPriority::Medium, AlarmPriority::Critical};
+    for (int i = 0; i < 4; ++i) {
+        AlarmDefinition definition = highLevel(1.0);
+        definition.tag = StringId("tag." + std::to_string(i));
+        definition.priority = priorities[i];
+        ids.push_back(alarms.addAlarm(definition));
+    }
+    REQUIRE(alarms.getTopAlarm() == AlarmEngine::NO_ALARM);
+
+    for (int i = 0; i < 4; ++i) {
+        alarms.setTag(StringId("tag." + std::to_string(i)), 2.0);
+        alarms.update(static_cast<double>(i));
+    }
+    REQUIRE(alarms.getTopAlarm() == ids[3]);  // Newest critical first
+
+    alarms.acknowledge(ids[3], 10.0);
+    REQUIRE(alarms.getTopAlarm() == ids[1]);  // Unacknowledged before acknowledged
+
+    std::vector<AlarmId> active;
+    REQUIRE(alarms.collectActive(active) == 4);
+    REQUIRE(active == std::vector<AlarmId>{ids[1], ids[3], ids[2], ids[0]});
+
+    alarms.setTag("tag.1", 0.0);
+    alarms.update(11.0);
+    alarms.acknowledge(ids[1], 12.0);
+    REQUIRE(alarms.getTopAlarm() == ids[3]);
+    REQUIRE(alarms.acknowledgeAll(13.0) == 2);
+    REQUIRE(alarms.getUnacknowledgedCount() == 0);
+    REQUIRE(alarms.getActiveCount() == 3);
+}
+
+TEST_CASE("AlarmEngine: Transitions are published as one batch", "[Alarms]") {
+    AlarmEngine alarms;
+    for (int i = 0; i < 3; ++i) {
+        AlarmDefinition definition = highLevel(1.0);
+        definition.tag = StringId("tag." + std::to_string(i));
+        alarms.addAlarm(definition);
+    }
+
+    size_t batches = 0;
+    size_t received = 0;
+    auto connection = EventBus::getInstance().subscribe<AlarmBatchEvent>(
+        [&](const AlarmBatchEvent& event) {
+            ++batches;
+            received += event.transitions.size();
+        });
+
+    for (int i = 0; i < 3; ++i) {
+        alarms.setTag(StringId("tag." + std::to_string(i)), 5.0);
+    }
+    alarms.update(1.0);
+    REQUIRE(alarms.publishTransitions(1.0) == 3);
+    REQUIRE(alarms.publishTransitions(1.0) == 0);  // Nothing new: no event
+    connection.disconnect();
+
+    REQUIRE(batches == 1);
+    REQUIRE(received == 3);
+}
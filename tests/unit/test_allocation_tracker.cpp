@@ -0,0 +1,84 @@
+/**
+ * @file test_allocation_tracker.cpp
+ * @brief Unit tests for AllocationTracker (per-subsystem allocation counters)
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <core/AllocationTracker.h>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+using namespace core;
+
+TEST_CASE("AllocationTracker: Tagged pmr resources count allocations", "[AllocationTracker]") {
+    AllocationTracker::reset();
+
+    {
+        std::pmr::vector<int> values(AllocationTracker::resource(AllocationTag::Scripting));
+        values.reserve(16);
+
+        auto stats = AllocationTracker::getStats(AllocationTag::Scripting);
+        REQUIRE(stats.allocations == 1);
+        REQUIRE(stats.bytesAllocated == 16 * sizeof(int));
+        REQUIRE(stats.currentBytes == static_cast<int64_t>(16 * sizeof(int)));
+    }
+
+    auto stats = AllocationTracker::getStats(AllocationTag::Scripting);
+    REQUIRE(stats.deallocations == 1);
+    REQUIRE(stats.currentBytes == 0);
+    REQUIRE(stats.peakBytes == static_cast<int64_t>(16 * sizeof(int)));
+    REQUIRE(AllocationTracker::hasData());
+}
+
+TEST_CASE("AllocationTracker: Frame counters roll over on endFrame", "[AllocationTracker]") {
+    AllocationTracker::reset();
+
+    AllocationTracker::recordAllocation(AllocationTag::Rendering, 64);
+    AllocationTracker::recordAllocation(AllocationTag::Rendering, 64);
+    AllocationTracker::endFrame();
+    REQUIRE(AllocationTracker::getStats(AllocationTag::Rendering).lastFrameAllocations == 2);
+
+    AllocationTracker::endFrame();
+    REQUIRE(AllocationTracker::getStats(AllocationTag::Rendering).lastFrameAllocations == 0);
+    REQUIRE(AllocationTracker::getStats(AllocationTag::Rendering).allocations == 2);
+}
+
+TEST_CASE("AllocationTracker: Scopes nest and restore the thread tag", "[AllocationTracker]") {
+    REQUIRE(AllocationTracker::currentTag() == AllocationTag::Other);
+    {
+        AllocationScope outer(AllocationTag::Resources);
+        REQUIRE(AllocationTracker::currentTag() == AllocationTag::Resources);
+        {
+            AllocationScope inner(AllocationTag::Simulation);
+            REQUIRE(AllocationTracker::currentTag() == AllocationTag::Simulation);
+        }
+        REQUIRE(AllocationTracker::currentTag() == AllocationTag::Resources);
+    }
+    REQUIRE(AllocationTracker::currentTag() == AllocationTag::Other);
+}
+
+TEST_CASE("AllocationTracker: Global hook attributes new to the scope tag", "[AllocationTracker]") {
+    if (!AllocationTracker::isHookEnabled()) {
+        SKIP("Built without ENABLE_ALLOCATION_TRACKING");
+    }
+
+    AllocationTracker::reset();
+    uint64_t allocationsInScope = 0;
+    {
+        // No Catch2 assertions inside the scope: they would allocate under this tag too
+        AllocationScope scope(AllocationTag::Resources);
+        auto buffer = std::make_unique<std::string>(1000, 'x');
+        allocationsInScope = AllocationTracker::getStats(AllocationTag::Resources).allocations;
+    }
+    REQUIRE(allocationsInScope >= 2);
+    REQUIRE(AllocationTracker::getStats(AllocationTag::Resources).currentBytes == 0);
+}
+
+TEST_CASE("AllocationTracker: Report lists every tag", "[AllocationTracker]") {
+    std::string report = AllocationTracker::formatReport();
+    for (size_t i = 0; i < AllocationTracker::TAG_COUNT; ++i) {
+        REQUIRE(report.find(toString(static_cast<AllocationTag>(i))) != std::string::npos);
+    }
+}
@@ -0,0 +1,128 @@
+/**
+ * @file test_collision_sensor_bridge.cpp
+ * @brief Unit tests for CollisionSensorBridge (CollisionComponent overlaps via Box2D sensors)
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <core/Components.h>
+#include <core/systems/CollisionSystem.h>
+#include <simulation/CollisionSensorBridge.h>
+#include <simulation/PhysicsWorld.h>
+#include <simulation/systems/PhysicsSystem.h>
+#include <entt/entt.hpp>
+
+#include <vector>
+
+using namespace simulation;
+using namespace core;
+
+namespace {
+
+entt::entity createCollider(entt::registry& registry, float x, float y) {
+    auto entity = registry.create();
+    auto& transform = registry.emplace<TransformComponent>(entity);
+    transform.x = x;
+    transform.y = y;
+    registry.emplace<CollisionComponent>(entity);
+    return entity;
+}
+
+// Steps physics until the bridge reports something (bodies are created on the first step)
+std::vector<CollisionPairChange> stepUntilChanges(entt::registry& registry, PhysicsSystem& physics,
+                                                  CollisionSensorBridge& bridge) {
+    std::vector<CollisionPairChange> changes;
+    for (int i = 0; i < 5 && changes.empty(); ++i) {
+        physics.update(registry, PhysicsSystem::FIXED_TIMESTEP);
+        bridge.drainPairChanges(changes);
+    }
+    return changes;
+}
+
+} // namespace
+
+TEST_CASE("CollisionSensorBridge: Overlapping colliders begin and end a pair", "[CollisionSensorBridge]") {
+    entt::registry registry;
+    PhysicsWorld world(b2Vec2{0.0f, 0.0f});
+    PhysicsSystem physics(world);
+    CollisionSensorBridge bridge(world);
+
+    physics.init(registry);
+    auto entity1 = createCollider(registry, 0.0f, 0.0f);
+    bridge.init(registry);
+    auto entity2 = createCollider(registry, 16.0f, 16.0f);  // Added after init: via signal
+    physics.addStepListener(&bridge);
+
+    auto changes = stepUntilChanges(registry, physics, bridge);
+    REQUIRE(bridge.getProxyCount() == 2);
+    REQUIRE(changes.size() == 1);  // Reported once, not per sensor
+    REQUIRE(changes[0].began);
+    REQUIRE(((changes[0].entityA == entity1 && changes[0].entityB == entity2) ||
+             (changes[0].entityA == entity2 && changes[0].entityB == entity1)));
+
+    registry.get<TransformComponent>(entity2).x = 500.0f;
+    changes = stepUntilChanges(registry, physics, bridge);
+    REQUIRE(changes.size() == 1);
+    REQUIRE_FALSE(changes[0].began);
+
+    physics.removeStepListener(&bridge);
+    bridge.shutdown();
+    REQUIRE(bridge.getProxyCount() == 0);
+}
+
+TEST_CASE("CollisionSensorBridge: Destroying an entity ends its pairs", "[CollisionSensorBridge]") {
+    entt::registry registry;
+    PhysicsWorld world(b2Vec2{0.0f, 0.0f});
+    PhysicsSystem physics(world);
+    CollisionSensorBridge bridge(world);
+
+    physics.init(registry);
+    bridge.init(registry);
+    physics.addStepListener(&bridge);
+
+    createCollider(registry, 0.0f, 0.0f);
+    auto entity2 = createCollider(registry, 8.0f, 0.0f);
+    REQUIRE(stepUntilChanges(registry, physics, bridge).size() == 1);
+
+    registry.destroy(entity2);
+    auto changes = stepUntilChanges(registry, physics, bridge);
+    REQUIRE(changes.size() == 1);
+    REQUIRE_FALSE(changes[0].began);
+    REQUIRE(bridge.getProxyCount() == 1);
+
+    physics.removeStepListener(&bridge);
+    bridge.shutdown();
+}
+
+TEST_CASE("CollisionSensorBridge: Feeds CollisionSystem callbacks", "[CollisionSensorBridge][CollisionSystem]") {
+    entt::registry registry;
+    PhysicsWorld world(b2Vec2{0.0f, 0.0f});
+    PhysicsSystem physics(world);
+    CollisionSensorBridge bridge(world);
+    CollisionSystem collisions;
+
+    physics.init(registry);
+    bridge.init(registry);
+    physics.addStepListener(&bridge);
+    collisions.setBroadphase(&bridge);
+
+    auto entity1 = createCollider(registry, 0.0f, 0.0f);
+    createCollider(registry, 16.0f, 0.0f);
+
+    int enterCount = 0;
+    int stayCount = 0;
+    auto& callbacks = registry.emplace<CollisionCallbacksComponent>(entity1);
+    callbacks.onCollisionEnter = [&enterCount](entt::entity) { enterCount++; };
+    callbacks.onCollisionStay = [&stayCount](entt::entity) { stayCount++; };
+
+    for (int i = 0; i < 5; ++i) {
+        physics.update(registry, PhysicsSystem::FIXED_TIMESTEP);
+        collisions.update(registry, PhysicsSystem::FIXED_TIMESTEP);
+    }
+
+    REQUIRE(enterCount == 1);
+    REQUIRE(stayCount >= 1);
+
+    collisions.setBroadphase(nullptr);
+    physics.removeStepListener(&bridge);
+    bridge.shutdown();
+}
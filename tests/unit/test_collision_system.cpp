@@ -80,8 +80,10 @@ TEST_CASE("CollisionSystem: Basic AABB collision detection", "[CollisionSystem]"
     bool collision1Enter = false;
     bool collision2Enter = false;
 
-    collision1.onCollisionEnter = [&collision1Enter](entt::entity) { collision1Enter = true; };
-    collision2.onCollisionEnter = [&collision2Enter](entt::entity) { collision2Enter = true; };
+    auto& callbacks1 = registry.emplace<CollisionCallbacksComponent>(entity1);
+    auto& callbacks2 = registry.emplace<CollisionCallbacksComponent>(entity2);
+    callbacks1.onCollisionEnter = [&collision1Enter](entt::entity) { collision1Enter = true; };
+    callbacks2.onCollisionEnter = [&collision2Enter](entt::entity) { collision2Enter = true; };
 
     // First update should trigger onCollisionEnter
     system.update(registry, 0.016);
@@ -113,8 +115,10 @@ TEST_CASE("CollisionSystem: No collision when separated", "[CollisionSystem]") {
     bool collision1Enter = false;
     bool collision2Enter = false;
 
-    collision1.onCollisionEnter = [&collision1Enter](entt::entity) { collision1Enter = true; };
-    collision2.onCollisionEnter = [&collision2Enter](entt::entity) { collision2Enter = true; };
+    auto& callbacks1 = registry.emplace<CollisionCallbacksComponent>(entity1);
+    auto& callbacks2 = registry.emplace<CollisionCallbacksComponent>(entity2);
+    callbacks1.onCollisionEnter = [&collision1Enter](entt::entity) { collision1Enter = true; };
+    callbacks2.onCollisionEnter = [&collision2Enter](entt::entity) { collision2Enter = true; };
 
     system.update(registry, 0.016);
 
@@ -146,9 +150,10 @@ TEST_CASE("CollisionSystem: Collision Enter/Stay/Exit events", "[CollisionSystem
     int stayCount = 0;
     int exitCount = 0;
 
-    collision1.onCollisionEnter = [&enterCount](entt::entity) { enterCount++; };
-    collision1.onCollisionStay = [&stayCount](entt::entity) { stayCount++; };
-    collision1.onCollisionExit = [&exitCount](entt::entity) { exitCount++; };
+    auto& callbacks1 = registry.emplace<CollisionCallbacksComponent>(entity1);
+    callbacks1.onCollisionEnter = [&enterCount](entt::entity) { enterCount++; };
+    callbacks1.onCollisionStay = [&stayCount](entt::entity) { stayCount++; };
+    callbacks1.onCollisionExit = [&exitCount](entt::entity) { exitCount++; };
 
     // First update - should trigger Enter
     system.update(registry, 0.016);
@@ -195,7 +200,8 @@ TEST_CASE("CollisionSystem: Trigger collision (non-solid)", "[CollisionSystem]")
 
     bool triggerEntered = false;
 
-    collision1.onCollisionEnter = [&triggerEntered](entt::entity) { triggerEntered = true; };
+    auto& callbacks1 = registry.emplace<CollisionCallbacksComponent>(entity1);
+    callbacks1.onCollisionEnter = [&triggerEntered](entt::entity) { triggerEntered = true; };
 
     system.update(registry, 0.016);
 
@@ -217,7 +223,8 @@ TEST_CASE("CollisionSystem: Multiple simultaneous collisions", "[CollisionSystem
     centerCollision.bounds = sf::FloatRect(sf::Vector2f(0.0f, 0.0f), sf::Vector2f(32.0f, 32.0f));
 
     int collisionCount = 0;
-    centerCollision.onCollisionEnter = [&collisionCount](entt::entity) { collisionCount++; };
+    auto& centerCallbacks = registry.emplace<CollisionCallbacksComponent>(centerEntity);
+    centerCallbacks.onCollisionEnter = [&collisionCount](entt::entity) { collisionCount++; };
 
     // Create three entities overlapping with the center
     for (int i = 0; i < 3; ++i) {
@@ -247,3 +254,119 @@ TEST_CASE("CollisionSystem: System properties", "[CollisionSystem]") {
         REQUIRE(std::string(system.getName()) == "CollisionSystem");
     }
 }
+
+TEST_CASE("CollisionSystem: Callbacks component is optional", "[CollisionSystem]") {
+    entt::registry registry;
+    CollisionSystem system;
+
+    auto entity1 = registry.create();
+    registry.emplace<TransformComponent>(entity1);
+    registry.emplace<CollisionComponent>(entity1);
+
+    auto entity2 = registry.create();
+    auto& transform2 = registry.emplace<TransformComponent>(entity2);
+    transform2.x = 16.0f;
+    registry.emplace<CollisionComponent>(entity2);
+
+    int enterCount = 0;
+    auto& callbacks2 = registry.emplace<CollisionCallbacksComponent>(entity2);
+    callbacks2.onCollisionEnter = [&enterCount](entt::entity) { enterCount++; };
+
+    // entity1 has no callbacks - entity2 must still receive its Enter callback
+    system.update(registry, 0.016);
+    REQUIRE(enterCount == 1);
+}
+
+namespace {
+
+// Broadphase stub: the test pushes pair changes, CollisionSystem drains them
+struct FakeBroadphase : ICollisionBroadphase {
+    std::vector<CollisionPairChange> pending;
+
+    void drainPairChanges(std::vector<CollisionPairChange>& changes) override {
+        changes.insert(changes.end(), pending.begin(), pending.end());
+        pending.clear();
+    }
+};
+
+} // namespace
+
+TEST_CASE("CollisionSystem: External broadphase drives Enter/Stay/Exit", "[CollisionSystem]") {
+    entt::registry registry;
+    CollisionSystem system;
+    FakeBroadphase broadphase;
+    system.setBroadphase(&broadphase);
+    REQUIRE(system.getBroadphase() == &broadphase);
+
+    // Far apart: AABB would never report them, only the broadphase does
+    auto entity1 = registry.create();
+    registry.emplace<TransformComponent>(entity1);
+    registry.emplace<CollisionComponent>(entity1);
+
+    auto entity2 = registry.create();
+    auto& transform2 = registry.emplace<TransformComponent>(entity2);
+    transform2.x = 1000.0f;
+    registry.emplace<CollisionComponent>(entity2);
+
+    int enterCount = 0;
+    int stayCount = 0;
+    int exitCount = 0;
+    auto& callbacks1 = registry.emplace<CollisionCallbacksComponent>(entity1);
+    callbacks1.onCollisionEnter = [&enterCount](entt::entity) { enterCount++; };
+    callbacks1.onCollisionStay = [&stayCount](entt::entity) { stayCount++; };
+    callbacks1.onCollisionExit = [&exitCount](entt::entity) { exitCount++; };
+
+    system.update(registry, 0.016);
+    REQUIRE(enterCount == 0);
+
+    // Duplicate begins (both sensors saw each other) count once
+    broadphase.pending.push_back({entity2, entity1, true});
+    broadphase.pending.push_back({entity1, entity2, true});
+    system.update(registry, 0.016);
+    REQUIRE(enterCount == 1);
+    REQUIRE(stayCount == 0);
+
+    system.update(registry, 0.016);
+    REQUIRE(enterCount == 1);
+    REQUIRE(stayCount == 1);
+
+    broadphase.pending.push_back({entity1, entity2, false});
+    system.update(registry, 0.016);
+    REQUIRE(exitCount == 1);
+
+    system.update(registry, 0.016);
+    REQUIRE(stayCount == 1);
+    REQUIRE(exitCount == 1);
+}
+
+TEST_CASE("CollisionSystem: Broadphase pairs end when an entity is destroyed", "[CollisionSystem]") {
+    entt::registry registry;
+    CollisionSystem system;
+    FakeBroadphase broadphase;
+    system.setBroadphase(&broadphase);
+
+    auto entity1 = registry.create();
+    registry.emplace<TransformComponent>(entity1);
+    registry.emplace<CollisionComponent>(entity1);
+
+    auto entity2 = registry.create();
+    registry.emplace<TransformComponent>(entity2);
+    registry.emplace<CollisionComponent>(entity2);
+
+    int exitCount = 0;
+    auto& callbacks1 = registry.emplace<CollisionCallbacksComponent>(entity1);
+    callbacks1.onCollisionExit = [&exitCount](entt::entity) { exitCount++; };
+
+    broadphase.pending.push_back({entity1, entity2, true});
+    system.update(registry, 0.016);
+
+    // The broadphase has not reported the end yet
+    registry.destroy(entity2);
+    system.update(registry, 0.016);
+    REQUIRE(exitCount == 1);
+
+    // A late end from the broadphase is ignored
+    broadphase.pending.push_back({entity1, entity2, false});
+    system.update(registry, 0.016);
+    REQUIRE(exitCount == 1);
+}
@@ -0,0 +1,128 @@
+/**
+ * @file test_discrete_event_system.cpp
+ * @brief Unit tests for DiscreteEventSystem
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <core/systems/DiscreteEventSystem.h>
+#include <entt/entt.hpp>
+
+#include <vector>
+
+using namespace core;
+
+namespace {
+
+constexpr double TICK = 1.0 / 60.0;
+
+} // namespace
+
+TEST_CASE("DiscreteEventSystem: Events fire exactly on their fixed-step tick", "[DiscreteEvent]") {
+    entt::registry registry;
+    DiscreteEventSystem events(TICK);
+
+    std::vector<SimTick> fired;
+    events.setHandler("recipe_done", [&](entt::registry&, const SimEvent& event) {
+        REQUIRE(event.tick == events.getNow());
+        fired.push_back(event.tick);
+    });
+
+    REQUIRE(events.toTicks(37.5) == 2250);
+    events.scheduleAfter(37.5, "recipe_done");
+    REQUIRE(events.getNextEventTick() == 2250);
+
+    for (int step = 0; step < 2249; ++step) {
+        events.update(registry, TICK);
+    }
+    REQUIRE(fired.empty());
+    REQUIRE(events.getNow() == 2249);
+
+    events.update(registry, TICK);
+    REQUIRE(fired == std::vector<SimTick>{2250});
+    REQUIRE(events.getPendingCount() == 0);
+    REQUIRE(events.getNextEventTick() == DiscreteEventSystem::NO_EVENT);
+
+    SECTION("Frames longer than a step advance several ticks, remainders accumulate") {
+        events.update(registry, 2.5 * TICK);
+        REQUIRE(events.getNow() == 2252);
+        events.update(registry, 0.5 * TICK);
+        REQUIRE(events.getNow() == 2253);
+    }
+}
+
+TEST_CASE("DiscreteEventSystem: Same-tick events keep scheduling order", "[DiscreteEvent]") {
+    entt::registry registry;
+    DiscreteEventSystem events(TICK);
+
+    std::vector<uint64_t> order;
+    events.setHandler("step", [&](entt::registry&, const SimEvent& event) {
+        order.push_back(event.data);
+        if (event.data == 1) {
+            events.scheduleAt(0, "step", entt::null, 4);  // Past tick: runs this tick, last
+        }
+    });
+
+    events.scheduleAt(10, "step", entt::null, 3);
+    events.scheduleAt(5, "step", entt::null, 1);
+    events.scheduleAt(5, "step", entt::null, 2);
+
+    REQUIRE(events.advanceTo(registry, 5) == 3);
+    REQUIRE(order == std::vector<uint64_t>{1, 2, 4});
+    REQUIRE(events.advanceTo(registry, 10) == 1);
+    REQUIRE(order.back() == 3);
+    REQUIRE(events.getDispatchedCount() == 4);
+}
+
+TEST_CASE("DiscreteEventSystem: Cancelled events never fire", "[DiscreteEvent]") {
+    entt::registry registry;
+    DiscreteEventSystem events(TICK);
+
+    int fired = 0;
+    events.setHandler("done", [&](entt::registry&, const SimEvent&) { ++fired; });
+
+    const SimEventId first = events.scheduleAt(3, "done");
+    const SimEventId second = events.scheduleAt(6, "done");
+    REQUIRE(events.isPending(first));
+    REQUIRE(events.cancel(first));
+    REQUIRE_FALSE(events.cancel(first));
+    REQUIRE_FALSE(events.isPending(first));
+    REQUIRE(events.getNextEventTick() == 6);
+
+    // The freed slot is reused under a new id; the old id stays dead
+    const SimEventId third = events.scheduleAt(4, "done");
+    REQUIRE(third != first);
+    REQUIRE_FALSE(events.cancel(first));
+    REQUIRE(events.getPendingCount() == 2);
+
+    REQUIRE(events.advanceTo(registry, 10) == 2);
+    REQUIRE(fired == 2);
+    REQUIRE_FALSE(events.isPending(second));
+    REQUIRE_FALSE(events.cancel(third));
+}
+
+TEST_CASE("DiscreteEventSystem: Fast-forwarding a shift of production cycles", "[DiscreteEvent]") {
+    entt::registry registry;
+    DiscreteEventSystem events(TICK);
+
+    auto press = registry.create();
+    auto oven = registry.create();
+    int pressCycles = 0;
+    int ovenCycles = 0;
+
+    events.setHandler("recipe_done", [&](entt::registry&, const SimEvent& event) {
+        const bool isPress = event.entity == press;
+        (isPress ? pressCycles : ovenCycles) += 1;
+        events.scheduleAfter(isPress ? 37.5 : 600.0, "recipe_done", event.entity);
+    });
+    events.scheduleAfter(37.5, "recipe_done", press);
+    events.scheduleAfter(600.0, "recipe_done", oven);
+
+    const double shift = 8 * 3600.0;
+    const size_t dispatched = events.fastForward(registry, shift);
+
+    REQUIRE(pressCycles == 768);  // 8 h / 37.5 s
+    REQUIRE(ovenCycles == 48);    // 8 h / 10 min
+    REQUIRE(dispatched == 768 + 48);
+    REQUIRE(events.getNow() == events.toTicks(shift));
+    REQUIRE(events.getPendingCount() == 2);  // Next cycles are already scheduled
+}
@@ -0,0 +1,173 @@
+/**
+ * @file test_ecs_groups.cpp
+ * @brief Unit tests and benchmarks for the EnTT groups used on the render/movement hot paths
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <core/Components.h>
+#include <core/systems/UpdateSystem.h>
+#include <entt/entt.hpp>
+
+#include <vector>
+
+using namespace core;
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+// Extra pools so that views have to probe several pools per entity
+struct ColdA { int value = 0; };
+struct ColdB { int value = 0; };
+
+void populate(entt::registry& registry, int count) {
+    for (int i = 0; i < count; ++i) {
+        auto entity = registry.create();
+        registry.emplace<TransformComponent>(entity, static_cast<float>(i), 0.0f);
+        if (i % 3 != 0) {
+            registry.emplace<VelocityComponent>(entity, 1.0f, 2.0f, 0.0f);
+        }
+        if (i % 2 == 0) {
+            registry.emplace<SpriteComponent>(entity);
+        }
+        if (i % 5 == 0) {
+            registry.emplace<ColdA>(entity);
+            registry.emplace<ColdB>(entity);
+        }
+    }
+}
+
+} // namespace
+
+TEST_CASE("EcsGroups: Render and movement groups coexist", "[EcsGroups]") {
+    entt::registry registry;
+    populate(registry, 30);
+
+    // Same shapes as RenderSystem::update and UpdateSystem::updateMovement
+    auto renderGroup = registry.group<SpriteComponent>(entt::get<TransformComponent>);
+    auto motionGroup = registry.group<VelocityComponent>(entt::get<TransformComponent>);
+
+    REQUIRE(renderGroup.size() == 15);
+    REQUIRE(motionGroup.size() == 20);
+
+    // Group membership follows component changes
+    auto entity = registry.create();
+    registry.emplace<TransformComponent>(entity);
+    registry.emplace<SpriteComponent>(entity);
+    registry.emplace<VelocityComponent>(entity);
+    REQUIRE(renderGroup.size() == 16);
+    REQUIRE(motionGroup.size() == 21);
+
+    registry.remove<TransformComponent>(entity);
+    REQUIRE(renderGroup.size() == 15);
+    REQUIRE(motionGroup.size() == 20);
+}
+
+TEST_CASE("EcsGroups: Render group sort orders sprites by layer", "[EcsGroups]") {
+    entt::registry registry;
+    auto group = registry.group<SpriteComponent>(entt::get<TransformComponent>);
+
+    for (int layer : {300, 100, 200, 100, 200, 100}) {
+        auto entity = registry.create();
+        registry.emplace<TransformComponent>(entity);
+        registry.emplace<SpriteComponent>(entity).layer = layer;
+    }
+
+    // Same comparator as RenderSystem::update: layer, then entity id
+    auto byLayer = [&registry](const entt::entity lhs, const entt::entity rhs) {
+        const int lhsLayer = registry.get<SpriteComponent>(lhs).layer;
+        const int rhsLayer = registry.get<SpriteComponent>(rhs).layer;
+        if (lhsLayer != rhsLayer) {
+            return lhsLayer < rhsLayer;
+        }
+        return entt::to_integral(lhs) < entt::to_integral(rhs);
+    };
+    group.sort(byLayer);
+
+    const std::vector<entt::entity> firstOrder(group.begin(), group.end());
+    for (size_t i = 1; i < firstOrder.size(); ++i) {
+        REQUIRE(byLayer(firstOrder[i - 1], firstOrder[i]));
+    }
+
+    // Sorting the render group never reorders the Transform pool
+    const entt::sparse_set& transforms = registry.storage<TransformComponent>();
+    const std::vector<entt::entity> transformOrder(transforms.begin(), transforms.end());
+    group.sort([](const entt::entity lhs, const entt::entity rhs) {
+        return entt::to_integral(lhs) > entt::to_integral(rhs);
+    });
+    REQUIRE(std::vector<entt::entity>(transforms.begin(), transforms.end()) == transformOrder);
+
+    // Re-sorting a shuffled group restores the same order for equal layers
+    group.sort(byLayer);
+    REQUIRE(std::vector<entt::entity>(group.begin(), group.end()) == firstOrder);
+}
+
+TEST_CASE("EcsGroups: UpdateSystem moves only entities with velocity", "[EcsGroups]") {
+    entt::registry registry;
+    UpdateSystem system;
+
+    auto moving = registry.create();
+    registry.emplace<TransformComponent>(moving, 10.0f, 20.0f);
+    registry.emplace<VelocityComponent>(moving, 100.0f, -50.0f, 0.0f);
+
+    auto still = registry.create();
+    registry.emplace<TransformComponent>(still, 5.0f, 5.0f);
+
+    system.update(registry, 0.5);
+
+    REQUIRE_THAT(registry.get<TransformComponent>(moving).x, WithinAbs(60.0f, 1e-4f));
+    REQUIRE_THAT(registry.get<TransformComponent>(moving).y, WithinAbs(-5.0f, 1e-4f));
+    REQUIRE(registry.get<TransformComponent>(still).x == 5.0f);
+
+    // Entities entering the group after the first update are picked up
+    registry.emplace<VelocityComponent>(still, 2.0f, 0.0f, 0.0f);
+    system.update(registry, 1.0);
+    REQUIRE_THAT(registry.get<TransformComponent>(still).x, WithinAbs(7.0f, 1e-4f));
+}
+
+TEST_CASE("EcsGroups: View vs group joint iteration", "[.][benchmark][EcsGroups]") {
+    constexpr int ENTITY_COUNT = 100000;
+
+    entt::registry viewRegistry;
+    populate(viewRegistry, ENTITY_COUNT);
+
+    entt::registry groupRegistry;
+    populate(groupRegistry, ENTITY_COUNT);
+    auto partialRender = groupRegistry.group<SpriteComponent>(entt::get<TransformComponent>);
+    auto partialMotion = groupRegistry.group<VelocityComponent>(entt::get<TransformComponent>);
+
+    BENCHMARK("view<Transform, Sprite>") {
+        float sum = 0.0f;
+        for (auto [entity, transform, sprite] :
+             viewRegistry.view<TransformComponent, SpriteComponent>().each()) {
+            sum += transform.x + static_cast<float>(sprite.layer);
+        }
+        return sum;
+    };
+
+    BENCHMARK("partial group<Sprite>(get<Transform>)") {
+        float sum = 0.0f;
+        for (auto [entity, sprite, transform] : partialRender.each()) {
+            sum += transform.x + static_cast<float>(sprite.layer);
+        }
+        return sum;
+    };
+
+    BENCHMARK("view<Transform, Velocity>") {
+        float sum = 0.0f;
+        for (auto [entity, transform, velocity] :
+             viewRegistry.view<TransformComponent, VelocityComponent>().each()) {
+            sum += transform.x + velocity.vx;
+        }
+        return sum;
+    };
+
+    BENCHMARK("partial group<Velocity>(get<Transform>)") {
+        float sum = 0.0f;
+        for (auto [entity, velocity, transform] : partialMotion.each()) {
+            sum += transform.x + velocity.vx;
+        }
+        return sum;
+    };
+}
@@ -0,0 +1,243 @@
+/**
+ * @file test_entity_cloner.cpp
+ * @brief Unit tests for column-wise entity cloning: hierarchy remapping,
+ *        clipboard copy/paste and batched Box2D body creation
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <core/Components.h>
+#include <editor/EntityClipboard.h>
+#include <editor/EntityCloner.h>
+#include <entt/entt.hpp>
+#include <simulation/PhysicsComponents.h>
+#include <simulation/PhysicsWorld.h>
+#include <simulation/systems/PhysicsSystem.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace core;
+using namespace editor;
+
+namespace {
+
+EntityCloner makeCloner() {
+    EntityCloner cloner;
+    cloner.registerCoreComponents();
+    return cloner;
+}
+
+entt::entity createObject(entt::registry& registry, float x, const char* name,
+                          entt::entity parent = entt::null) {
+    auto entity = registry.create();
+    registry.emplace<TransformComponent>(entity, TransformComponent{x, 0.0f});
+    registry.emplace<NameComponent>(entity, name);
+    if (parent != entt::null) {
+        registry.emplace<ParentComponent>(entity, parent);
+        registry.get_or_emplace<ChildrenComponent>(parent).addChild(entity);
+    }
+    return entity;
+}
+
+} // namespace
+
+TEST_CASE("EntityCloner: Duplicate remaps hierarchy inside the selection", "[EntityCloner]") {
+    entt::registry registry;
+    EntityCloner cloner = makeCloner();
+
+    auto line = createObject(registry, 0.0f, "Line");
+    auto pump = createObject(registry, 10.0f, "Pump", line);
+    auto valve = createObject(registry, 20.0f, "Valve", line);
+
+    std::vector<entt::entity> selection{line, pump, valve};
+    std::vector<entt::entity> clones;
+    REQUIRE(cloner.clone(registry, selection, registry, clones) == 3);
+
+    const auto lineCopy = clones[0];
+    const auto pumpCopy = clones[1];
+    const auto valveCopy = clones[2];
+    REQUIRE(registry.get<NameComponent>(pumpCopy).name == "Pump");
+    REQUIRE(registry.get<TransformComponent>(valveCopy).x == 20.0f);
+    REQUIRE(registry.get<ParentComponent>(pumpCopy).parent == lineCopy);
+    REQUIRE(registry.get<ParentComponent>(valveCopy).parent == lineCopy);
+
+    const auto& children = registry.get<ChildrenComponent>(lineCopy).children;
+    REQUIRE(children.size() == 2);
+    REQUIRE(std::find(children.begin(), children.end(), pumpCopy) != children.end());
+    REQUIRE(std::find(children.begin(), children.end(), valveCopy) != children.end());
+
+    // The original hierarchy is untouched
+    REQUIRE(registry.get<ChildrenComponent>(line).children.size() == 2);
+    REQUIRE(registry.get<ParentComponent>(pump).parent == line);
+}
+
+TEST_CASE("EntityCloner: External parent adopts the clone", "[EntityCloner]") {
+    entt::registry registry;
+    EntityCloner cloner = makeCloner();
+
+    auto line = createObject(registry, 0.0f, "Line");
+    auto pump = createObject(registry, 10.0f, "Pump", line);
+
+    SECTION("Duplicated child joins the same parent") {
+        std::vector<entt::entity> clones;
+        REQUIRE(cloner.clone(registry, std::vector{pump, pump}, registry, clones) == 1);
+
+        REQUIRE(registry.get<ParentComponent>(clones[0]).parent == line);
+        REQUIRE(registry.get<ChildrenComponent>(line).hasChild(clones[0]));
+        REQUIRE(registry.get<ChildrenComponent>(line).children.size() == 2);
+    }
+
+    SECTION("Children outside the selection stay with the original") {
+        std::vector<entt::entity> clones;
+        REQUIRE(cloner.clone(registry, std::vector{line}, registry, clones) == 1);
+        REQUIRE_FALSE(registry.all_of<ChildrenComponent>(clones[0]));
+    }
+}
+
+TEST_CASE("EntityCloner: Descendants are appended to the selection", "[EntityCloner]") {
+    entt::registry registry;
+    auto line = createObject(registry, 0.0f, "Line");
+    auto pump = createObject(registry, 10.0f, "Pump", line);
+    auto motor = createObject(registry, 10.0f, "Motor", pump);
+    createObject(registry, 50.0f, "Other");
+
+    std::vector<entt::entity> selection{line, pump};
+    EntityCloner::appendDescendants(registry, selection);
+
+    REQUIRE(selection.size() == 3);
+    REQUIRE(std::count(selection.begin(), selection.end(), motor) == 1);
+}
+
+TEST_CASE("EntityCloner: Clipboard pastes into another registry", "[EntityCloner]") {
+    entt::registry scene;
+    EntityCloner cloner = makeCloner();
+    EntityClipboard clipboard(cloner);
+
+    auto line = createObject(scene, 0.0f, "Line");
+    auto pump = createObject(scene, 10.0f, "Pump", line);
+    createObject(scene, 20.0f, "Motor", pump);
+
+    REQUIRE(clipboard.copy(scene, std::vector{line}) == 3);
+
+    // The copy is detached: editing the source does not affect it
+    scene.patch<NameComponent>(line, [](auto& n) { n.name = "Renamed"; });
+    scene.destroy(pump);
+
+    entt::registry other;
+    std::vector<entt::entity> pasted;
+    REQUIRE(clipboard.paste(other, pasted) == 3);
+    REQUIRE(other.get<NameComponent>(pasted[0]).name == "Line");
+    REQUIRE(other.get<ParentComponent>(pasted[1]).parent == pasted[0]);
+    REQUIRE(other.get<ParentComponent>(pasted[2]).parent == pasted[1]);
+
+    // Pasting twice yields independent groups (group template)
+    std::vector<entt::entity> again;
+    REQUIRE(clipboard.paste(other, again) == 3);
+    REQUIRE(other.get<ParentComponent>(again[1]).parent == again[0]);
+    REQUIRE(other.get<ChildrenComponent>(pasted[0]).children.size() == 1);
+}
+
+TEST_CASE("EntityCloner: Clipboard keeps external parents out of its storage", "[EntityCloner]") {
+    entt::registry scene;
+    EntityCloner cloner = makeCloner();
+    EntityClipboard clipboard(cloner);
+
+    // The parent is scene entity 0, the same id the first stored copy gets
+    auto line = createObject(scene, 0.0f, "Line");
+    auto pump = createObject(scene, 10.0f, "Pump", line);
+    auto motor = createObject(scene, 20.0f, "Motor", pump);
+    REQUIRE(entt::to_integral(line) == 0);
+
+    REQUIRE(clipboard.copy(scene, std::vector{pump}) == 2);
+
+    std::vector<entt::entity> pasted;
+    REQUIRE(clipboard.paste(scene, pasted) == 2);
+    REQUIRE(scene.get<ParentComponent>(pasted[0]).parent == line);
+    REQUIRE(scene.get<ParentComponent>(pasted[1]).parent == pasted[0]);
+    REQUIRE(scene.get<ChildrenComponent>(line).hasChild(pasted[0]));
+    REQUIRE(scene.get<ChildrenComponent>(line).children.size() == 2);
+
+    // No copy became its own parent or child
+    const auto& children = scene.get<ChildrenComponent>(pasted[0]).children;
+    REQUIRE(children == std::vector<entt::entity>{pasted[1]});
+    REQUIRE_FALSE(scene.all_of<ChildrenComponent>(pasted[1]));
+    REQUIRE(scene.get<ParentComponent>(motor).parent == pump);
+
+    SECTION("A registry without the parent gets a root copy") {
+        // The first paste reuses id 0 for a copy: it must not adopt itself
+        entt::registry other;
+        std::vector<entt::entity> detached;
+        REQUIRE(clipboard.paste(other, detached) == 2);
+        REQUIRE_FALSE(other.all_of<ParentComponent>(detached[0]));
+        REQUIRE(other.get<ParentComponent>(detached[1]).parent == detached[0]);
+    }
+}
+
+TEST_CASE("EntityCloner: Large selection clones every column", "[EntityCloner]") {
+    entt::registry registry;
+    EntityCloner cloner = makeCloner();
+
+    std::vector<entt::entity> selection;
+    auto root = createObject(registry, 0.0f, "Section");
+    selection.push_back(root);
+    for (int i = 1; i < 5000; ++i) {
+        auto entity = createObject(registry, static_cast<float>(i), "Tile", root);
+        if (i % 2 == 0) {
+            registry.emplace<VelocityComponent>(entity, VelocityComponent{1.0f, 0.0f});
+        }
+        selection.push_back(entity);
+    }
+
+    std::vector<entt::entity> clones;
+    REQUIRE(cloner.clone(registry, selection, registry, clones) == 5000);
+
+    REQUIRE(registry.get<TransformComponent>(clones[4321]).x == 4321.0f);
+    REQUIRE(registry.all_of<VelocityComponent>(clones[4000]));
+    REQUIRE_FALSE(registry.all_of<VelocityComponent>(clones[4001]));
+    REQUIRE(registry.get<ParentComponent>(clones[4999]).parent == clones[0]);
+    REQUIRE(registry.get<ChildrenComponent>(clones[0]).children.size() == 4999);
+    REQUIRE(registry.get<ChildrenComponent>(root).children.size() == 4999);
+}
+
+TEST_CASE("EntityCloner: Rigidbodies are created in one batch", "[EntityCloner]") {
+    using namespace simulation;
+
+    entt::registry registry;
+    PhysicsWorld world(b2Vec2{0.0f, 9.8f});
+    PhysicsSystem physics(world);
+    physics.init(registry);
+
+    std::vector<entt::entity> selection;
+    for (int i = 0; i < 10; ++i) {
+        auto entity = createObject(registry, static_cast<float>(i) * 40.0f, "Crate");
+        registry.emplace<ColliderComponent>(entity);
+        registry.emplace<RigidbodyComponent>(entity);
+        selection.push_back(entity);
+    }
+
+    EntityCloner cloner = makeCloner();
+    cloner.setPhysicsSystem(&physics);
+
+    std::vector<entt::entity> clones;
+    REQUIRE(cloner.clone(registry, selection, registry, clones) == 10);
+
+    for (size_t i = 0; i < clones.size(); ++i) {
+        const auto& original = registry.get<RigidbodyComponent>(selection[i]);
+        const auto& copy = registry.get<RigidbodyComponent>(clones[i]);
+        REQUIRE(copy.hasBox2DBody());
+        REQUIRE_FALSE(B2_ID_EQUALS(copy.box2dBodyId, original.box2dBodyId));
+    }
+
+    SECTION("Nested batches create bodies at the outermost end") {
+        physics.beginBodyBatch();
+        physics.beginBodyBatch();
+        auto entity = createObject(registry, 0.0f, "Late");
+        registry.emplace<ColliderComponent>(entity);
+        auto& rigidbody = registry.emplace<RigidbodyComponent>(entity);
+        REQUIRE_FALSE(rigidbody.hasBox2DBody());
+
+        REQUIRE(physics.endBodyBatch(registry) == 0);
+        REQUIRE(physics.endBodyBatch(registry) == 1);
+        REQUIRE(registry.get<RigidbodyComponent>(entity).hasBox2DBody());
+    }
+}
@@ -0,0 +1,135 @@
+/**
+ * @file test_entity_handle_table.cpp
+ * @brief Unit tests for EntityHandleTable (generation-checked external entity handles)
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <core/EntityHandleTable.h>
+#include <entt/entt.hpp>
+
+using namespace core;
+
+TEST_CASE("EntityHandle: Packing and null value", "[EntityHandleTable]") {
+    EntityHandle empty;
+    REQUIRE(empty.isNull());
+    REQUIRE_FALSE(empty);
+    REQUIRE(empty.toUserData() == nullptr);
+
+    auto handle = EntityHandle::make(7, 3);
+    REQUIRE(handle.index() == 7);
+    REQUIRE(handle.generation() == 3);
+    REQUIRE(EntityHandle::fromBits(handle.bits()) == handle);
+    REQUIRE(EntityHandle::fromUserData(handle.toUserData()) == handle);
+}
+
+TEST_CASE("EntityHandleTable: Acquire and resolve", "[EntityHandleTable]") {
+    entt::registry registry;
+    EntityHandleTable table;
+    table.init(registry);
+
+    auto a = registry.create();
+    auto b = registry.create();
+
+    auto handleA = table.acquire(a);
+    auto handleB = table.acquire(b);
+
+    REQUIRE_FALSE(handleA.isNull());
+    REQUIRE(handleA != handleB);
+    REQUIRE(table.acquire(a) == handleA);
+    REQUIRE(table.find(a) == handleA);
+    REQUIRE(table.resolve(handleA) == a);
+    REQUIRE(table.resolve(handleB) == b);
+    REQUIRE(table.getLiveCount() == 2);
+
+    REQUIRE(table.acquire(entt::null).isNull());
+    REQUIRE(table.resolve(EntityHandle{}) == entt::null);
+    REQUIRE(table.find(registry.create()).isNull());
+
+    table.shutdown();
+}
+
+TEST_CASE("EntityHandleTable: Destroyed entity invalidates its handle", "[EntityHandleTable]") {
+    entt::registry registry;
+    EntityHandleTable table;
+    table.init(registry);
+
+    auto entity = registry.create();
+    auto handle = table.acquire(entity);
+
+    registry.destroy(entity);
+
+    REQUIRE_FALSE(table.isValid(handle));
+    REQUIRE(table.resolve(handle) == entt::null);
+    REQUIRE(table.getLiveCount() == 0);
+
+    table.shutdown();
+}
+
+TEST_CASE("EntityHandleTable: Recycled entity id does not alias a stale handle",
+          "[EntityHandleTable]") {
+    entt::registry registry;
+    EntityHandleTable table;
+    table.init(registry);
+
+    auto first = registry.create();
+    auto oldHandle = table.acquire(first);
+    registry.destroy(first);
+
+    // EnTT reuses the index of the destroyed entity with a new version
+    auto second = registry.create();
+    REQUIRE(entt::to_entity(second) == entt::to_entity(first));
+
+    auto newHandle = table.acquire(second);
+    REQUIRE(newHandle.index() == oldHandle.index());
+    REQUIRE(newHandle.generation() != oldHandle.generation());
+    REQUIRE(table.resolve(oldHandle) == entt::null);
+    REQUIRE(table.resolve(newHandle) == second);
+
+    table.shutdown();
+}
+
+TEST_CASE("EntityHandleTable: Recycling without a destroy signal still bumps the generation",
+          "[EntityHandleTable]") {
+    entt::registry registry;
+    EntityHandleTable table;  // not connected to the registry
+
+    auto first = registry.create();
+    auto oldHandle = table.acquire(first);
+    registry.destroy(first);
+    auto second = registry.create();
+
+    auto newHandle = table.acquire(second);
+    REQUIRE(table.resolve(oldHandle) == entt::null);
+    REQUIRE(table.resolve(newHandle) == second);
+    REQUIRE(table.getLiveCount() == 1);
+}
+
+TEST_CASE("EntityHandleTable: Shutdown invalidates every handle", "[EntityHandleTable]") {
+    entt::registry registry;
+    EntityHandleTable table;
+    table.init(registry);
+
+    auto entity = registry.create();
+    auto handle = table.acquire(entity);
+
+    table.shutdown();
+    REQUIRE(table.resolve(handle) == entt::null);
+
+    // Re-acquiring after shutdown must not resurrect the old handle
+    auto again = table.acquire(entity);
+    REQUIRE(again != handle);
+    REQUIRE(table.resolve(again) == entity);
+}
+
+TEST_CASE("EntityHandleTable: Registry context owns a shared table", "[EntityHandleTable]") {
+    entt::registry registry;
+
+    auto& table = EntityHandleTable::of(registry);
+    REQUIRE(&EntityHandleTable::of(registry) == &table);
+
+    auto entity = registry.create();
+    auto handle = table.acquire(entity);
+    registry.destroy(entity);
+
+    REQUIRE_FALSE(table.isValid(handle));
+}
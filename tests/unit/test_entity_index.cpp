@@ -0,0 +1,141 @@
+/**
+ * @file test_entity_index.cpp
+ * @brief Unit tests for EntityIndex (name/tag -> entity lookups)
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <core/EntityIndex.h>
+#include <core/Components.h>
+#include <entt/entt.hpp>
+#include <algorithm>
+
+using namespace core;
+
+namespace {
+
+bool containsEntity(std::span<const entt::entity> entities, entt::entity entity) {
+    return std::find(entities.begin(), entities.end(), entity) != entities.end();
+}
+
+} // namespace
+
+TEST_CASE("EntityIndex: Existing entities are indexed on init", "[EntityIndex]") {
+    entt::registry registry;
+    auto lamp = registry.create();
+    registry.emplace<NameComponent>(lamp, "Lamp");
+    registry.emplace<TagComponent>(lamp, "light");
+
+    EntityIndex index;
+    index.init(registry);
+
+    REQUIRE(index.findByName("Lamp") == lamp);
+    REQUIRE(index.findByTag("light").size() == 1);
+    REQUIRE(index.nameOf(lamp) == "Lamp");
+    REQUIRE(index.tagOf(lamp) == "light");
+}
+
+TEST_CASE("EntityIndex: Hooks keep the index up to date", "[EntityIndex]") {
+    entt::registry registry;
+    EntityIndex index;
+    index.init(registry);
+
+    auto a = registry.create();
+    auto b = registry.create();
+    auto c = registry.create();
+    registry.emplace<TagComponent>(a, "enemy");
+    registry.emplace<TagComponent>(b, "enemy");
+    registry.emplace<TagComponent>(c, "enemy");
+    registry.emplace<NameComponent>(a, "Enemy_A");
+
+    SECTION("Tag query returns all tagged entities") {
+        auto enemies = index.findByTag("enemy");
+        REQUIRE(enemies.size() == 3);
+        REQUIRE(containsEntity(enemies, a));
+        REQUIRE(containsEntity(enemies, b));
+        REQUIRE(containsEntity(enemies, c));
+    }
+
+    SECTION("Destroyed entity is removed and others stay reachable") {
+        registry.destroy(a);
+
+        auto enemies = index.findByTag("enemy");
+        REQUIRE(enemies.size() == 2);
+        REQUIRE_FALSE(containsEntity(enemies, a));
+        REQUIRE(containsEntity(enemies, b));
+        REQUIRE(containsEntity(enemies, c));
+        REQUIRE(index.findByName("Enemy_A") == entt::null);
+
+        // Removing the moved entity must still work after swap-and-pop
+        registry.remove<TagComponent>(c);
+        REQUIRE(index.findByTag("enemy").size() == 1);
+        REQUIRE(index.findByTag("enemy").front() == b);
+    }
+
+    SECTION("Patch moves entity to the new key") {
+        registry.patch<TagComponent>(b, [](auto& tag) { tag.tag = "friend"; });
+        registry.patch<NameComponent>(a, [](auto& name) { name.name = "Enemy_Boss"; });
+
+        REQUIRE(index.countByTag("enemy") == 2);
+        REQUIRE(index.findByTag("friend").size() == 1);
+        REQUIRE(index.findByTag("friend").front() == b);
+        REQUIRE(index.findByName("Enemy_A") == entt::null);
+        REQUIRE(index.findByName("Enemy_Boss") == a);
+    }
+
+    SECTION("Unknown keys return empty results") {
+        REQUIRE(index.findByName("Nobody") == entt::null);
+        REQUIRE(index.findByTag("nothing").empty());
+    }
+}
+
+TEST_CASE("EntityIndex: Duplicate names and empty keys", "[EntityIndex]") {
+    entt::registry registry;
+    EntityIndex index;
+    index.init(registry);
+
+    auto first = registry.create();
+    auto second = registry.create();
+    registry.emplace<NameComponent>(first, "Conveyor");
+    registry.emplace<NameComponent>(second, "Conveyor");
+    auto untagged = registry.create();
+    registry.emplace<TagComponent>(untagged);
+
+    REQUIRE(index.findAllByName("Conveyor").size() == 2);
+    REQUIRE(index.findByName("Conveyor") != entt::null);
+    REQUIRE(index.getTaggedCount() == 0);
+    REQUIRE(index.tagOf(untagged).empty());
+}
+
+TEST_CASE("EntityIndex: Shutdown disconnects from registry", "[EntityIndex]") {
+    entt::registry registry;
+    EntityIndex index;
+    index.init(registry);
+    index.shutdown();
+
+    auto entity = registry.create();
+    registry.emplace<NameComponent>(entity, "Late");
+
+    REQUIRE(index.findByName("Late") == entt::null);
+    REQUIRE(index.getNamedCount() == 0);
+}
+
+TEST_CASE("EntityIndex: Names are not interned", "[EntityIndex]") {
+    entt::registry registry;
+    EntityIndex index;
+    index.init(registry);
+
+    // Map tiles and editor renames must not grow the global StringId table
+    const size_t interned = StringId::internedCount();
+    auto tile = registry.create();
+    registry.emplace<NameComponent>(tile, "Ground_17_42_unique_test_name");
+    registry.patch<NameComponent>(tile, [](auto& n) { n.name = "Ground_17_43_unique_test_name"; });
+
+    REQUIRE(index.findByName("Ground_17_43_unique_test_name") == tile);
+    REQUIRE(index.findByName("Ground_17_42_unique_test_name") == entt::null);
+    REQUIRE(index.nameOf(tile) == "Ground_17_43_unique_test_name");
+    REQUIRE(StringId::internedCount() == interned);
+
+    registry.destroy(tile);
+    REQUIRE(index.getNamedCount() == 0);
+    REQUIRE(index.nameOf(tile).empty());
+}
@@ -0,0 +1,264 @@
+/**
+ * @file test_flow_field.cpp
+ * @brief Unit tests for FlowField, FlowFieldCache and ReservationTable
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <core/FlowField.h>
+#include <core/JumpPointSearch.h>
+#include <core/NavigationGrid.h>
+#include <core/ReservationTable.h>
+#include <entt/entt.hpp>
+
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace core;
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+entt::entity agentId(uint32_t index) {
+    return static_cast<entt::entity>(index);
+}
+
+/**
+ * @brief Wall the square [0, size) × [0, size) off from the rest of the map
+ */
+void buildRoom(NavigationGrid& grid, int size) {
+    for (int i = 0; i <= size; ++i) {
+        grid.setTerrainBlocked(size, i, true);
+        grid.setTerrainBlocked(i, size, true);
+    }
+}
+
+} // namespace
+
+TEST_CASE("FlowField: Costs match shortest paths on random maps", "[FlowField]") {
+    std::mt19937 rng(4321);
+    JumpPointSearch search;
+    std::vector<TilePoint> path;
+
+    for (int map = 0; map < 100; ++map) {
+        const int width = 8 + static_cast<int>(rng() % 70);
+        const int height = 8 + static_cast<int>(rng() % 70);
+        NavigationGrid grid(width, height);
+        std::vector<uint8_t> blocked(static_cast<size_t>(width * height));
+        const unsigned density = rng() % 35;
+        for (auto& cell : blocked) {
+            cell = rng() % 100 < density ? 1 : 0;
+        }
+        grid.setTerrain(blocked);
+        auto snapshot = grid.snapshot();
+
+        for (auto connectivity : {PathConnectivity::Four, PathConnectivity::Eight}) {
+            const TilePoint goal{static_cast<int>(rng() % width), static_cast<int>(rng() % height)};
+            FlowField field(*snapshot, TileRect{goal.x, goal.y}, connectivity);
+            REQUIRE(field.getCost(goal.x, goal.y) == 0);
+
+            for (int sample = 0; sample < 10; ++sample) {
+                TilePoint start{static_cast<int>(rng() % width), static_cast<int>(rng() % height)};
+                if (!snapshot->isWalkable(start.x, start.y) || start == goal) {
+                    continue;
+                }
+
+                const PathStatus status = search.findPath(*snapshot, {start, goal, connectivity},
+                                                          path);
+                if (status == PathStatus::NoPath) {
+                    REQUIRE_FALSE(field.isReachable(start.x, start.y));
+                    REQUIRE(field.next(start) == start);
+                    continue;
+                }
+                REQUIRE(status == PathStatus::Found);
+                REQUIRE_THAT(field.getDistance(start.x, start.y),
+                             WithinAbs(search.getPathCost(), 0.05 * search.getPathCost() + 1e-3));
+
+                // Descending the field is a valid walk that always gets closer
+                TilePoint tile = start;
+                size_t steps = 0;
+                while (!(tile == goal) && steps <= blocked.size()) {
+                    const TilePoint next = field.next(tile);
+                    REQUIRE(field.getCost(next.x, next.y) < field.getCost(tile.x, tile.y));
+                    tile = next;
+                    ++steps;
+                }
+                REQUIRE(tile == goal);
+            }
+        }
+    }
+}
+
+TEST_CASE("FlowField: Multi-tile destinations and closed areas", "[FlowField]") {
+    NavigationGrid grid(40, 40);
+    buildRoom(grid, 10);
+    grid.setTerrainBlocked(30, 30, true);  // Machine occupying its own port tile
+    auto snapshot = grid.snapshot();
+
+    FlowField dock(*snapshot, TileRect{28, 30, 4, 1}, PathConnectivity::Four);
+    REQUIRE(dock.getCost(30, 30) == 0);
+    REQUIRE(dock.getCost(29, 39) == 9 * FlowField::STRAIGHT_COST);
+    REQUIRE(dock.next(TilePoint{35, 30}) == TilePoint{34, 30});
+    REQUIRE(dock.next(TilePoint{30, 30}) == TilePoint{30, 30});
+
+    REQUIRE_FALSE(dock.isReachable(5, 5));  // Inside the walled room
+    REQUIRE(dock.getDistance(5, 5) < 0.0f);
+    REQUIRE_FALSE(dock.isReachable(10, 3));  // Wall tile
+    REQUIRE(dock.getReachableCount() == 40 * 40 - 11 * 11);
+}
+
+TEST_CASE("FlowFieldCache: Fields are shared and invalidated by chunk", "[FlowField]") {
+    NavigationGrid grid(256, 64);
+    buildRoom(grid, 40);
+
+    FlowFieldSettings settings;
+    settings.cacheSize = 2;
+    FlowFieldCache cache(grid, settings);
+
+    const TileRect roomDock{5, 5, 2, 2};
+    const TileRect yardDock{200, 20};
+    auto roomField = cache.get(roomDock);
+    REQUIRE(cache.get(roomDock) == roomField);
+    REQUIRE(cache.getBuildCount() == 1);
+
+    auto yardField = cache.get(yardDock);
+    REQUIRE(cache.size() == 2);
+
+    SECTION("A change far from the room keeps the room field") {
+        grid.setTerrainBlocked(220, 50, true);
+        REQUIRE(cache.sync() == 1);
+        REQUIRE(cache.get(roomDock) == roomField);
+        REQUIRE(cache.get(yardDock) != yardField);
+        REQUIRE(cache.getBuildCount() == 3);
+        REQUIRE(yardField->isReachable(220, 50));  // Old field is still usable
+    }
+
+    SECTION("A change inside the room rebuilds it") {
+        grid.setTerrainBlocked(20, 20, true);
+        auto rebuilt = cache.get(roomDock);
+        REQUIRE(rebuilt != roomField);
+        REQUIRE_FALSE(rebuilt->isReachable(20, 20));
+        REQUIRE(cache.getInvalidatedCount() == 2);
+    }
+
+    SECTION("Least recently used field is evicted") {
+        cache.get(roomDock);
+        cache.get(TileRect{100, 50});
+        REQUIRE(cache.size() == 2);
+        REQUIRE(cache.get(roomDock) == roomField);
+        REQUIRE(cache.get(yardDock) != yardField);
+    }
+
+    SECTION("Resizing the grid drops everything") {
+        grid.resize(128, 64);
+        REQUIRE(cache.sync() == 2);
+        REQUIRE(cache.size() == 0);
+    }
+}
+
+TEST_CASE("ReservationTable: Vertex, swap and corner conflicts", "[FlowField]") {
+    ReservationTable table;
+    const auto a = agentId(1);
+    const auto b = agentId(2);
+
+    REQUIRE(table.reserve({0, 0}, 0, a));
+    REQUIRE(table.reserve({1, 0}, 0, b));
+    REQUIRE_FALSE(table.reserve({0, 0}, 0, b));
+    REQUIRE(table.ownerAt({0, 0}, 0) == a);
+
+    REQUIRE_FALSE(table.tryMove(a, {0, 0}, {1, 0}, 0));  // Swap with b
+    REQUIRE(table.tryMove(b, {1, 0}, {2, 0}, 0));
+    REQUIRE_FALSE(table.tryMove(a, {0, 0}, {1, 0}, 0));  // b still occupies it this tick
+    REQUIRE(table.tryMove(a, {0, 0}, {0, 0}, 0));        // Wait in place
+
+    SECTION("Diagonals do not cut past another agent") {
+        REQUIRE(table.reserve({0, 1}, 1, b));
+        REQUIRE_FALSE(table.tryMove(a, {0, 0}, {1, 1}, 1));
+        table.release(b);
+        REQUIRE(table.tryMove(a, {0, 0}, {1, 1}, 1));
+    }
+
+    SECTION("Paths are reserved all or nothing") {
+        const std::vector<TilePoint> path{{0, 0}, {0, 1}, {1, 1}, {2, 1}};
+        REQUIRE(table.reservePath(a, path, 1));
+        const std::vector<TilePoint> blocked{{2, 0}, {2, 1}};
+        REQUIRE_FALSE(table.reservePath(b, blocked, 3));
+        REQUIRE(table.isFree({2, 0}, 3));
+    }
+
+    SECTION("Advance drops past ticks, release drops an agent") {
+        REQUIRE(table.size() == 4);
+        table.advance(1);
+        REQUIRE(table.size() == 2);
+        REQUIRE(table.isFree({0, 0}, 0));
+        table.release(a);
+        REQUIRE(table.size() == 1);
+        REQUIRE(table.ownerAt({2, 0}, 1) == b);
+    }
+}
+
+TEST_CASE("ReservationTable: Fleet follows a shared field without collisions", "[FlowField]") {
+    NavigationGrid grid(48, 48);
+    for (int x = 0; x < 40; ++x) {
+        grid.setTerrainBlocked(x, 24, true);  // Aisle wall with a gap on the right
+    }
+    auto snapshot = grid.snapshot();
+    FlowField field(*snapshot, TileRect{20, 0, 4, 1});
+
+    std::mt19937 rng(99);
+    std::set<std::pair<int, int>> taken;
+    std::vector<TilePoint> agents;
+    while (agents.size() < 24) {
+        const TilePoint tile{static_cast<int>(rng() % 48), 26 + static_cast<int>(rng() % 22)};
+        if (taken.insert({tile.x, tile.y}).second) {
+            agents.push_back(tile);
+        }
+    }
+
+    ReservationTable table;
+    uint64_t tick = 0;
+    for (uint32_t i = 0; i < agents.size(); ++i) {
+        REQUIRE(table.reserve(agents[i], tick, agentId(i)));
+    }
+
+    // Agents that reach the dock are served and leave the floor
+    std::vector<bool> active(agents.size(), true);
+    size_t served = 0;
+    for (; tick < 400 && served < agents.size(); ++tick) {
+        std::vector<TilePoint> moved = agents;
+        for (uint32_t i = 0; i < agents.size(); ++i) {
+            if (active[i]) {
+                moved[i] = table.followField(field, agentId(i), agents[i], tick);
+            }
+        }
+
+        std::set<std::pair<int, int>> occupied;
+        for (uint32_t i = 0; i < agents.size(); ++i) {
+            if (!active[i]) {
+                continue;
+            }
+            REQUIRE(occupied.insert({moved[i].x, moved[i].y}).second);
+            for (uint32_t j = 0; j < agents.size(); ++j) {
+                const bool swapped = i != j && active[j] && moved[i] == agents[j] &&
+                                     moved[j] == agents[i];
+                REQUIRE_FALSE(swapped);
+            }
+        }
+        agents = std::move(moved);
+        table.advance(tick + 1);
+
+        for (uint32_t i = 0; i < agents.size(); ++i) {
+            if (active[i] && field.getCost(agents[i].x, agents[i].y) == 0) {
+                table.release(agentId(i));
+                active[i] = false;
+                ++served;
+            }
+        }
+        REQUIRE(table.size() == agents.size() - served);
+    }
+
+    REQUIRE(served == agents.size());
+    REQUIRE(table.size() == 0);
+}
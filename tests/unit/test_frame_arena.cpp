@@ -0,0 +1,84 @@
+/**
+ * @file test_frame_arena.cpp
+ * @brief Unit tests for FrameArena (per-frame bump allocator)
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <core/FrameArena.h>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace core;
+
+TEST_CASE("FrameArena: Allocations are aligned and bump linearly", "[FrameArena]") {
+    FrameArena arena(1024);
+
+    void* a = arena.allocate(3, 1);
+    void* b = arena.allocate(8, 8);
+    void* c = arena.allocate(16, 64);
+
+    REQUIRE(reinterpret_cast<uintptr_t>(b) % 8 == 0);
+    REQUIRE(reinterpret_cast<uintptr_t>(c) % 64 == 0);
+    REQUIRE(static_cast<std::byte*>(b) > static_cast<std::byte*>(a));
+    REQUIRE(arena.getBytesUsed() >= 3 + 8 + 16);
+    REQUIRE(arena.getBlockCount() == 1);
+}
+
+TEST_CASE("FrameArena: Reset reuses memory without new blocks", "[FrameArena]") {
+    FrameArena arena(1024);
+
+    void* first = arena.allocate(100, 8);
+    arena.reset();
+    void* second = arena.allocate(100, 8);
+
+    REQUIRE(first == second);
+    REQUIRE(arena.getBlockAllocations() == 1);
+}
+
+TEST_CASE("FrameArena: Overflow grows and coalesces on reset", "[FrameArena]") {
+    FrameArena arena(256);
+
+    for (int i = 0; i < 10; ++i) {
+        (void)arena.allocate(200, 8);
+    }
+    REQUIRE(arena.getBlockCount() > 1);
+    const size_t capacity = arena.getCapacity();
+
+    arena.reset();
+    REQUIRE(arena.getBlockCount() == 1);
+    REQUIRE(arena.getCapacity() == capacity);
+    REQUIRE(arena.getPeakBytes() >= 2000);
+
+    // The same workload now fits in the coalesced block
+    const size_t allocations = arena.getBlockAllocations();
+    for (int i = 0; i < 10; ++i) {
+        (void)arena.allocate(200, 8);
+    }
+    REQUIRE(arena.getBlockAllocations() == allocations);
+}
+
+TEST_CASE("FrameArena: Works as a pmr memory resource", "[FrameArena]") {
+    FrameArena arena;
+
+    std::pmr::vector<int> values(&arena);
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back(i);
+    }
+
+    REQUIRE(values.size() == 1000);
+    REQUIRE(values[999] == 999);
+    REQUIRE(arena.getBytesUsed() >= 1000 * sizeof(int));
+    REQUIRE(arena.is_equal(arena));
+}
+
+TEST_CASE("FrameArena: Each thread has its own arena", "[FrameArena]") {
+    FrameArena* mainArena = &FrameArena::current();
+    FrameArena* otherArena = nullptr;
+
+    std::thread worker([&otherArena]() { otherArena = &FrameArena::current(); });
+    worker.join();
+
+    REQUIRE(mainArena == &FrameArena::current());
+    REQUIRE(otherArena != mainArena);
+}
@@ -38,7 +38,7 @@ TEST_CASE("EntityStateComponent: isInState()", "[EntityStateComponent]") {
 TEST_CASE("EntityStateComponent: setState() basic functionality", "[EntityStateComponent]") {
     EntityStateComponent state("idle");
 
-    state.setState("running");
+    state.setState("running", entt::null, nullptr);
 
     REQUIRE(state.currentState == "running");
     REQUIRE(state.previousState == "idle");
@@ -47,19 +47,20 @@ TEST_CASE("EntityStateComponent: setState() basic functionality", "[EntityStateC
 
 TEST_CASE("EntityStateComponent: State transition callbacks", "[EntityStateComponent]") {
     EntityStateComponent state("idle");
+    StateCallbacksComponent callbacks;
 
     bool onEnterCalled = false;
     bool onExitCalled = false;
 
-    state.registerOnEnter("running", [&onEnterCalled]() {
+    callbacks.registerOnEnter("running", [&onEnterCalled]() {
         onEnterCalled = true;
     });
 
-    state.registerOnExit("idle", [&onExitCalled]() {
+    callbacks.registerOnExit("idle", [&onExitCalled]() {
         onExitCalled = true;
     });
 
-    state.setState("running");
+    state.setState("running", entt::null, &callbacks);
 
     REQUIRE(onExitCalled == true);
     REQUIRE(onEnterCalled == true);
@@ -69,22 +70,23 @@ TEST_CASE("EntityStateComponent: State transition callbacks", "[EntityStateCompo
 
 TEST_CASE("EntityStateComponent: Multiple state transitions", "[EntityStateComponent]") {
     EntityStateComponent state("idle");
+    StateCallbacksComponent callbacks;
 
     int transitionCount = 0;
 
-    state.registerOnEnter("running", [&transitionCount]() { transitionCount++; });
-    state.registerOnEnter("error", [&transitionCount]() { transitionCount++; });
-    state.registerOnExit("idle", [&transitionCount]() { transitionCount++; });
-    state.registerOnExit("running", [&transitionCount]() { transitionCount++; });
+    callbacks.registerOnEnter("running", [&transitionCount]() { transitionCount++; });
+    callbacks.registerOnEnter("error", [&transitionCount]() { transitionCount++; });
+    callbacks.registerOnExit("idle", [&transitionCount]() { transitionCount++; });
+    callbacks.registerOnExit("running", [&transitionCount]() { transitionCount++; });
 
     // idle -> running
-    state.setState("running");
+    state.setState("running", entt::null, &callbacks);
     REQUIRE(transitionCount == 2);  // onExit(idle) + onEnter(running)
     REQUIRE(state.currentState == "running");
     REQUIRE(state.previousState == "idle");
 
     // running -> error
-    state.setState("error");
+    state.setState("error", entt::null, &callbacks);
     REQUIRE(transitionCount == 4);  // + onExit(running) + onEnter(error)
     REQUIRE(state.currentState == "error");
     REQUIRE(state.previousState == "running");
@@ -92,15 +94,16 @@ TEST_CASE("EntityStateComponent: Multiple state transitions", "[EntityStateCompo
 
 TEST_CASE("EntityStateComponent: Same state transition", "[EntityStateComponent]") {
     EntityStateComponent state("idle");
+    StateCallbacksComponent callbacks;
 
     int enterCount = 0;
     int exitCount = 0;
 
-    state.registerOnEnter("idle", [&enterCount]() { enterCount++; });
-    state.registerOnExit("idle", [&exitCount]() { exitCount++; });
+    callbacks.registerOnEnter("idle", [&enterCount]() { enterCount++; });
+    callbacks.registerOnExit("idle", [&exitCount]() { exitCount++; });
 
     // Transition to the same state - implementation ignores this (early return)
-    state.setState("idle");
+    state.setState("idle", entt::null, &callbacks);
 
     // Callbacks should NOT be called for same state (optimization)
     REQUIRE(exitCount == 0);
@@ -126,7 +129,7 @@ TEST_CASE("FSMSystem: Time in state tracking", "[FSMSystem]") {
     REQUIRE_THAT(state.timeInState, Catch::Matchers::WithinAbs(0.8f, 0.001f));
 
     // Change state - timeInState should reset
-    state.setState("running");
+    REQUIRE(FSMSystem::setState(registry, entity, "running"));
     REQUIRE_THAT(state.timeInState, Catch::Matchers::WithinAbs(0.0f, 0.001f));
 
     // Update again
@@ -150,7 +153,7 @@ TEST_CASE("FSMSystem: Multiple entities", "[FSMSystem]") {
     REQUIRE_THAT(state2.timeInState, Catch::Matchers::WithinAbs(1.0f, 0.001f));
 
     // Change state for entity1 only
-    state1.setState("running");
+    REQUIRE(FSMSystem::setState(registry, entity1, "running"));
     REQUIRE_THAT(state1.timeInState, Catch::Matchers::WithinAbs(0.0f, 0.001f));
     REQUIRE_THAT(state2.timeInState, Catch::Matchers::WithinAbs(1.0f, 0.001f));
 
@@ -174,18 +177,49 @@ TEST_CASE("FSMSystem: System properties", "[FSMSystem]") {
 
 TEST_CASE("EntityStateComponent: Callback registration and clearing", "[EntityStateComponent]") {
     EntityStateComponent state("idle");
+    StateCallbacksComponent callbacks;
 
     int callCount = 0;
 
-    state.registerOnEnter("running", [&callCount]() { callCount++; });
+    callbacks.registerOnEnter("running", [&callCount]() { callCount++; });
 
-    state.setState("running");
+    state.setState("running", entt::null, &callbacks);
     REQUIRE(callCount == 1);
 
     // Register new callback for the same state (should override)
-    state.registerOnEnter("running", [&callCount]() { callCount += 10; });
+    callbacks.registerOnEnter("running", [&callCount]() { callCount += 10; });
 
-    state.setState("idle");
-    state.setState("running");
+    state.setState("idle", entt::null, &callbacks);
+    state.setState("running", entt::null, &callbacks);
     REQUIRE(callCount == 11);  // Should use the new callback (1 + 10)
 }
+
+TEST_CASE("FSMSystem: setState() uses the entity's callbacks component", "[FSMSystem]") {
+    entt::registry registry;
+
+    auto entity = registry.create();
+    registry.emplace<EntityStateComponent>(entity, "idle");
+
+    SECTION("Callbacks are invoked when present") {
+        int enterCount = 0;
+        int exitCount = 0;
+        auto& callbacks = registry.emplace<StateCallbacksComponent>(entity);
+        callbacks.registerOnEnter("running", [&enterCount]() { enterCount++; });
+        callbacks.registerOnExit("idle", [&exitCount]() { exitCount++; });
+
+        REQUIRE(FSMSystem::setState(registry, entity, "running"));
+        REQUIRE(enterCount == 1);
+        REQUIRE(exitCount == 1);
+        REQUIRE(registry.get<EntityStateComponent>(entity).isInState("running"));
+    }
+
+    SECTION("Entities without callbacks still transition") {
+        REQUIRE(FSMSystem::setState(registry, entity, "running"));
+        REQUIRE(registry.get<EntityStateComponent>(entity).previousState == "idle");
+    }
+
+    SECTION("Entities without a state component are rejected") {
+        auto other = registry.create();
+        REQUIRE_FALSE(FSMSystem::setState(registry, other, "running"));
+    }
+}
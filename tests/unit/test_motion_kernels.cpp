@@ -0,0 +1,88 @@
+/**
+ * @file test_motion_kernels.cpp
+ * @brief Unit tests for the SoA culling kernel and angle wrapping
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <core/MotionKernels.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace core;
+
+namespace {
+
+float referenceWrap(float r) {
+    r = std::fmod(r, 360.0f);
+    if (r < 0.0f) {
+        r += 360.0f;
+    }
+    return r;
+}
+
+} // namespace
+
+TEST_CASE("MotionKernels: Rotation wrap stays in [0, 360)", "[MotionKernels]") {
+    const std::vector<float> angles = {-1e-6f, -360.0f, 720.0f, 359.9999f, -0.5f, 45.0f, 1080.5f,
+                                       -725.0f};
+
+    for (float angle : angles) {
+        const float wrapped = wrapDegrees(angle);
+        REQUIRE(wrapped >= 0.0f);
+        REQUIRE(wrapped < 360.0f);
+    }
+    REQUIRE_THAT(wrapDegrees(-0.5f), Catch::Matchers::WithinAbs(359.5f, 0.001f));
+    REQUIRE_THAT(wrapDegrees(45.0f), Catch::Matchers::WithinAbs(45.0f, 0.001f));
+    REQUIRE_THAT(wrapDegrees(1080.5f), Catch::Matchers::WithinAbs(0.5f, 0.01f));
+    REQUIRE_THAT(wrapDegrees(-725.0f), Catch::Matchers::WithinAbs(355.0f, 0.01f));
+
+    SECTION("Matches the fmod reference") {
+        for (float angle : {-1e-3f, -360.0f, 720.0f, -0.5f, 1080.5f, -725.0f, 12345.25f}) {
+            REQUIRE_THAT(wrapDegrees(angle), Catch::Matchers::WithinAbs(referenceWrap(angle), 1e-3f));
+        }
+    }
+}
+
+TEST_CASE("MotionKernels: AABB culling", "[MotionKernels]") {
+    CullRect view{0.0f, 0.0f, 100.0f, 100.0f};
+
+    // inside, left of view, touching edge (strict), overlapping corner, below view
+    std::vector<float> minX = {10.0f, -50.0f, 100.0f, 90.0f, 10.0f};
+    std::vector<float> minY = {10.0f, 10.0f, 10.0f, -20.0f, 150.0f};
+    std::vector<float> maxX = {20.0f, -10.0f, 120.0f, 110.0f, 20.0f};
+    std::vector<float> maxY = {20.0f, 20.0f, 20.0f, 5.0f, 170.0f};
+    std::vector<uint8_t> visible(minX.size());
+
+    size_t count = cullAabbs(minX.data(), minY.data(), maxX.data(), maxY.data(), minX.size(), view,
+                             visible.data());
+
+    REQUIRE(count == 2);
+    REQUIRE(visible == std::vector<uint8_t>{1, 0, 0, 1, 0});
+
+    SECTION("Vector path agrees with scalar tail") {
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> dist(-300.0f, 300.0f);
+        constexpr size_t n = 37;
+        std::vector<float> x0(n), y0(n), x1(n), y1(n);
+        for (size_t i = 0; i < n; ++i) {
+            x0[i] = dist(rng);
+            y0[i] = dist(rng);
+            x1[i] = x0[i] + 40.0f;
+            y1[i] = y0[i] + 40.0f;
+        }
+        std::vector<uint8_t> mask(n);
+        size_t total = cullAabbs(x0.data(), y0.data(), x1.data(), y1.data(), n, view, mask.data());
+
+        size_t expected = 0;
+        for (size_t i = 0; i < n; ++i) {
+            bool inside = x0[i] < view.right && x1[i] > view.left && y0[i] < view.bottom &&
+                          y1[i] > view.top;
+            REQUIRE(mask[i] == (inside ? 1 : 0));
+            expected += inside ? 1 : 0;
+        }
+        REQUIRE(total == expected);
+    }
+}
@@ -0,0 +1,135 @@
+/**
+ * @file test_objective_evaluator.cpp
+ * @brief Unit tests for ObjectiveEvaluator
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <core/ObjectiveEvaluator.h>
+
+#include <string>
+#include <vector>
+
+using namespace core;
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("ObjectiveEvaluator: Level must hold inside a range", "[Objectives]") {
+    ObjectiveEvaluator objectives;
+    auto level = objectives.input("tank1.level");
+    auto keep = objectives.addObjective(
+        "keep_level", objectives.holdsFor(objectives.between(level, 40.0, 60.0), 600.0));
+    REQUIRE(objectives.getStatus(keep) == ObjectiveStatus::Pending);
+
+    objectives.setInput("tank1.level", 50.0);
+    objectives.update(100.0);  // Countdown starts here
+    objectives.update(500.0);
+    REQUIRE(objectives.getStatus(keep) == ObjectiveStatus::Pending);
+
+    // Leaving the range resets the countdown
+    objectives.setInput("tank1.level", 65.0);
+    objectives.update(600.0);
+    objectives.setInput("tank1.level", 45.0);
+    objectives.update(700.0);
+    REQUIRE(objectives.update(1200.0) == 0);  // The stale timer from t=100 changes nothing
+    REQUIRE(objectives.getStatus(keep) == ObjectiveStatus::Pending);
+
+    REQUIRE(objectives.update(1300.0) == 1);
+    REQUIRE(objectives.getStatus(keep) == ObjectiveStatus::Completed);
+    REQUIRE_THAT(objectives.getStatusTime(keep), WithinAbs(1300.0, 1e-9));
+    REQUIRE(objectives.allCompleted());
+
+    std::vector<ObjectiveChange> changes;
+    REQUIRE(objectives.collectChanges(changes) == 1);
+    REQUIRE(changes[0].objective == keep);
+    REQUIRE(changes[0].status == ObjectiveStatus::Completed);
+    REQUIRE(objectives.collectChanges(changes) == 0);
+
+    // Completed is final
+    objectives.setInput("tank1.level", 90.0);
+    REQUIRE(objectives.update(1400.0) == 0);
+    REQUIRE(objectives.getStatus(keep) == ObjectiveStatus::Completed);
+}
+
+TEST_CASE("ObjectiveEvaluator: Failure condition takes precedence", "[Objectives]") {
+    ObjectiveEvaluator objectives;
+    auto good = objectives.input("line_A.good");
+    auto scrap = objectives.input("line_A.scrap");
+    auto produce = objectives.addObjective(
+        "produce_500", objectives.compare(good, CompareOp::GreaterEqual, 500.0),
+        objectives.compare(scrap, CompareOp::GreaterEqual, 3.0));
+    auto rush = objectives.addObjective(
+        "produce_500_fast", objectives.compare(good, CompareOp::GreaterEqual, 500.0),
+        objectives.compare(scrap, CompareOp::GreaterEqual, 10.0));
+
+    objectives.setInput("line_A.good", 300.0);
+    objectives.setInput("line_A.scrap", 2.0);
+    REQUIRE(objectives.update(10.0) == 0);
+
+    // Success and failure in the same update: failure wins
+    objectives.setInput("line_A.good", 500.0);
+    objectives.setInput("line_A.scrap", 3.0);
+    REQUIRE(objectives.update(20.0) == 2);
+    REQUIRE(objectives.getStatus(produce) == ObjectiveStatus::Failed);
+    REQUIRE(objectives.getStatus(rush) == ObjectiveStatus::Completed);
+    REQUIRE_FALSE(objectives.allCompleted());
+    REQUIRE(objectives.getName(produce) == "produce_500");
+}
+
+TEST_CASE("ObjectiveEvaluator: Only changed inputs are re-evaluated", "[Objectives]") {
+    ObjectiveEvaluator objectives;
+    constexpr int COUNT = 50;
+    for (int i = 0; i < COUNT; ++i) {
+        auto value = objectives.input(StringId("sensor." + std::to_string(i)));
+        objectives.addObjective(StringId("objective." + std::to_string(i)),
+                                objectives.holdsFor(objectives.between(value, 10.0, 20.0), 5.0),
+                                objectives.compare(value, CompareOp::Greater, 100.0));
+    }
+    REQUIRE(objectives.getObjectiveCount() == COUNT);
+
+    REQUIRE(objectives.update(1.0) == 0);
+    REQUIRE(objectives.getEvaluatedCount() == 0);
+
+    // One input: the input, three comparisons, the range and the timer node
+    REQUIRE(objectives.setInput("sensor.7", 15.0));
+    objectives.update(2.0);
+    REQUIRE(objectives.getEvaluatedCount() == 6);
+
+    // Same value: nothing to do
+    objectives.setInput("sensor.7", 15.0);
+    objectives.update(3.0);
+    REQUIRE(objectives.getEvaluatedCount() == 0);
+
+    // Only the timer node wakes up when the hold time is reached
+    REQUIRE(objectives.update(7.0) == 1);
+    REQUIRE(objectives.getEvaluatedCount() == 1);
+
+    REQUIRE_FALSE(objectives.setInput("sensor.unknown", 1.0));
+}
+
+TEST_CASE("ObjectiveEvaluator: Logic and latch nodes", "[Objectives]") {
+    ObjectiveEvaluator objectives;
+    auto door = objectives.input("door.open");
+    auto alarm = objectives.input("alarm.active");
+    auto any = objectives.anyOf({door, alarm});
+    auto quiet = objectives.negate(alarm);
+    auto everOpened = objectives.latch(door);
+    auto all = objectives.allOf({everOpened, quiet});
+    REQUIRE_FALSE(objectives.isTrue(any));
+    REQUIRE(objectives.isTrue(quiet));
+    REQUIRE(objectives.isTrue(objectives.allOf({})));
+    REQUIRE_FALSE(objectives.isTrue(objectives.anyOf({})));
+
+    objectives.setInput("door.open", 1.0);
+    objectives.update(1.0);
+    REQUIRE(objectives.isTrue(any));
+    REQUIRE(objectives.isTrue(all));
+
+    objectives.setInput("door.open", 0.0);
+    objectives.setInput("alarm.active", 1.0);
+    objectives.update(2.0);
+    REQUIRE(objectives.isTrue(everOpened));
+    REQUIRE(objectives.isTrue(any));
+    REQUIRE_FALSE(objectives.isTrue(all));
+
+    REQUIRE(objectives.input("door.open") == door);  // One node per tag
+}
@@ -0,0 +1,314 @@
+/**
+ * @file test_pathfinding.cpp
+ * @brief Unit tests for NavigationGrid, JumpPointSearch and PathfindingService
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <core/Components.h>
+#include <core/JumpPointSearch.h>
+#include <core/NavigationGrid.h>
+#include <core/PathfindingService.h>
+#include <core/TileOccupancyGrid.h>
+#include <entt/entt.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace core;
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+entt::entity placeObject(entt::registry& registry, int x, int y, int w = 1, int h = 1) {
+    auto entity = registry.create();
+    registry.emplace<TilePositionComponent>(entity, x, y, w, h, true, OccupancyLayer::Object);
+    return entity;
+}
+
+/**
+ * @brief Reference shortest path cost (plain Dijkstra, same movement rules)
+ * @return -1 if the goal is unreachable
+ */
+float referenceCost(const NavigationSnapshot& grid, TilePoint start, TilePoint goal,
+                    PathConnectivity connectivity) {
+    const int width = grid.getWidth();
+    const int height = grid.getHeight();
+    auto open = [&](int x, int y) {
+        return grid.isWalkable(x, y) || TilePoint{x, y} == start || TilePoint{x, y} == goal;
+    };
+
+    std::vector<float> cost(static_cast<size_t>(width * height), 1e30f);
+    using Entry = std::pair<float, int>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+    cost[start.y * width + start.x] = 0.0f;
+    queue.push({0.0f, start.y * width + start.x});
+
+    while (!queue.empty()) {
+        auto [g, index] = queue.top();
+        queue.pop();
+        if (g > cost[index]) {
+            continue;
+        }
+        const int x = index % width;
+        const int y = index / width;
+        if (TilePoint{x, y} == goal) {
+            return g;
+        }
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                const bool diagonal = dx != 0 && dy != 0;
+                if ((dx == 0 && dy == 0) ||
+                    (diagonal && connectivity == PathConnectivity::Four) ||
+                    !open(x + dx, y + dy) ||
+                    (diagonal && (!open(x + dx, y) || !open(x, y + dy)))) {
+                    continue;
+                }
+                const float next = g + (diagonal ? 1.41421356f : 1.0f);
+                const int neighbor = (y + dy) * width + x + dx;
+                if (next < cost[neighbor] - 1e-4f) {
+                    cost[neighbor] = next;
+                    queue.push({next, neighbor});
+                }
+            }
+        }
+    }
+    return -1.0f;
+}
+
+bool isContinuous(const std::vector<TilePoint>& path, PathConnectivity connectivity) {
+    for (size_t i = 1; i < path.size(); ++i) {
+        const int dx = std::abs(path[i].x - path[i - 1].x);
+        const int dy = std::abs(path[i].y - path[i - 1].y);
+        if (dx > 1 || dy > 1 || (dx + dy == 0) ||
+            (connectivity == PathConnectivity::Four && dx + dy != 1)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("NavigationGrid: Placed objects block tiles incrementally", "[Pathfinding]") {
+    entt::registry registry;
+    TileOccupancyGrid occupancy(64, 64);
+    occupancy.init(registry);
+    NavigationGrid grid(64, 64);
+    grid.init(occupancy);
+
+    auto before = grid.snapshot();
+    REQUIRE(grid.getDirtyChunkCount() == 0);
+
+    auto machine = placeObject(registry, 40, 10, 3, 2);
+    REQUIRE_FALSE(grid.isWalkable(42, 11));
+    REQUIRE(grid.getDirtyChunkCount() == 1);
+
+    auto after = grid.snapshot();
+    REQUIRE(before->isWalkable(42, 11));  // Published snapshots never change
+    REQUIRE_FALSE(after->isWalkable(42, 11));
+    REQUIRE(after->getVersion() > before->getVersion());
+    REQUIRE(grid.snapshot() == after);    // Nothing changed: same snapshot
+
+    SECTION("Moving and destroying objects frees tiles") {
+        registry.patch<TilePositionComponent>(machine, [](auto& pos) { pos.tileX = 0; });
+        REQUIRE(grid.isWalkable(42, 11));
+        REQUIRE_FALSE(grid.isWalkable(0, 10));
+
+        registry.destroy(machine);
+        REQUIRE(grid.isWalkable(0, 10));
+        REQUIRE(grid.getObjectCount() == 0);
+    }
+
+    SECTION("Overlapping objects keep the tile blocked until both leave") {
+        auto crate = placeObject(registry, 42, 11);
+        registry.destroy(machine);
+        REQUIRE_FALSE(grid.isWalkable(42, 11));
+        registry.destroy(crate);
+        REQUIRE(grid.isWalkable(42, 11));
+    }
+
+    SECTION("Ground, overlay and moving agents do not block") {
+        auto floor = registry.create();
+        registry.emplace<TilePositionComponent>(floor, 5, 5, 1, 1, true, OccupancyLayer::Ground);
+        auto agent = registry.create();
+        registry.emplace<TilePositionComponent>(agent, 6, 5, 1, 1, false, OccupancyLayer::Object);
+        REQUIRE(grid.isWalkable(5, 5));
+        REQUIRE(grid.isWalkable(6, 5));
+    }
+}
+
+TEST_CASE("NavigationGrid: Objects come from the occupancy grid", "[Pathfinding]") {
+    entt::registry registry;
+    TileOccupancyGrid occupancy(16, 16);
+    occupancy.init(registry);
+    auto machine = placeObject(registry, 2, 2, 2, 2);  // Placed before the grid attaches
+
+    NavigationGrid grid(16, 16);
+    grid.init(occupancy);
+    REQUIRE_FALSE(grid.isWalkable(3, 3));
+    REQUIRE(grid.getObjectCount() == 1);
+
+    SECTION("Detaching the grid forgets objects") {
+        grid.shutdown();
+        REQUIRE(grid.isWalkable(3, 3));
+        REQUIRE(grid.getObjectCount() == 0);
+
+        registry.destroy(machine);  // No longer observed
+        REQUIRE(grid.getObjectCount() == 0);
+    }
+
+    SECTION("Clearing the occupancy grid frees tiles") {
+        occupancy.shutdown();
+        REQUIRE(grid.isWalkable(3, 3));
+        REQUIRE(grid.getObjectCount() == 0);
+    }
+
+    SECTION("Resize keeps objects and drops terrain") {
+        grid.setTerrainBlocked(10, 10, true);
+        grid.resize(32, 32);
+        REQUIRE_FALSE(grid.isWalkable(3, 3));
+        REQUIRE(grid.isWalkable(10, 10));
+    }
+}
+
+TEST_CASE("JumpPointSearch: Paths around obstacles", "[Pathfinding]") {
+    NavigationGrid grid(40, 20);
+    for (int y = 0; y < 18; ++y) {
+        grid.setTerrainBlocked(20, y, true);  // Wall with a gap at the bottom
+    }
+    auto snapshot = grid.snapshot();
+    JumpPointSearch search;
+    std::vector<TilePoint> path;
+
+    SECTION("Open line is straight") {
+        REQUIRE(search.findPath(*snapshot, {{0, 19}, {39, 19}}, path) == PathStatus::Found);
+        REQUIRE(path.size() == 40);
+        REQUIRE_THAT(search.getPathCost(), WithinAbs(39.0, 1e-4));
+    }
+
+    SECTION("Detour through the gap") {
+        PathQuery query{{5, 2}, {35, 2}, PathConnectivity::Four};
+        REQUIRE(search.findPath(*snapshot, query, path) == PathStatus::Found);
+        REQUIRE(path.front() == query.start);
+        REQUIRE(path.back() == query.goal);
+        REQUIRE(isContinuous(path, PathConnectivity::Four));
+        REQUIRE_THAT(search.getPathCost(), WithinAbs(30.0 + 2 * 16.0, 1e-4));
+    }
+
+    SECTION("Blocked endpoints are allowed, closed areas are not") {
+        grid.setTerrainBlocked(35, 2, true);  // Machine port tile
+        REQUIRE(search.findPath(*grid.snapshot(), {{5, 2}, {35, 2}}, path) == PathStatus::Found);
+
+        for (int y = 18; y < 20; ++y) {
+            grid.setTerrainBlocked(20, y, true);
+        }
+        REQUIRE(search.findPath(*grid.snapshot(), {{5, 2}, {35, 2}}, path) == PathStatus::NoPath);
+        REQUIRE(path.empty());
+        REQUIRE(search.findPath(*grid.snapshot(), {{5, 2}, {40, 2}}, path) ==
+                PathStatus::InvalidEndpoint);
+    }
+}
+
+TEST_CASE("JumpPointSearch: Costs match Dijkstra on random maps", "[Pathfinding]") {
+    std::mt19937 rng(1234);
+    JumpPointSearch search;
+    std::vector<TilePoint> path;
+
+    for (int map = 0; map < 200; ++map) {
+        const int width = 8 + static_cast<int>(rng() % 90);
+        const int height = 8 + static_cast<int>(rng() % 90);
+        NavigationGrid grid(width, height);
+        std::vector<uint8_t> blocked(static_cast<size_t>(width * height));
+        const unsigned density = rng() % 40;
+        for (auto& cell : blocked) {
+            cell = rng() % 100 < density ? 1 : 0;
+        }
+        grid.setTerrain(blocked);
+        auto snapshot = grid.snapshot();
+
+        for (auto connectivity : {PathConnectivity::Four, PathConnectivity::Eight}) {
+            const TilePoint start{static_cast<int>(rng() % width), static_cast<int>(rng() % height)};
+            const TilePoint goal{static_cast<int>(rng() % width), static_cast<int>(rng() % height)};
+            const float expected = referenceCost(*snapshot, start, goal, connectivity);
+
+            const PathStatus status = search.findPath(*snapshot, {start, goal, connectivity}, path);
+            if (expected < 0.0f) {
+                REQUIRE(status == PathStatus::NoPath);
+            } else {
+                REQUIRE(status == PathStatus::Found);
+                REQUIRE_THAT(search.getPathCost(), WithinAbs(expected, 1e-3));
+                REQUIRE(isContinuous(path, connectivity));
+            }
+        }
+    }
+}
+
+TEST_CASE("PathfindingService: Batched requests on worker threads", "[Pathfinding]") {
+    NavigationGrid grid(128, 128);
+    for (int y = 0; y < 120; ++y) {
+        grid.setTerrainBlocked(64, y, true);
+    }
+
+    PathfindingSettings settings;
+    settings.workerThreads = 2;
+    settings.batchSize = 8;
+    PathfindingService service(grid, settings);
+    REQUIRE(service.start());
+
+    std::vector<PathRequestId> ids;
+    for (int i = 0; i < 200; ++i) {
+        ids.push_back(service.requestPath({{i % 50, i % 100}, {100 + i % 20, (i * 7) % 128}}));
+    }
+    const bool cancelled = service.cancel(ids.back());
+    REQUIRE(cancelled);
+
+    std::vector<PathResult> results;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (results.size() < ids.size() - 1 && std::chrono::steady_clock::now() < deadline) {
+        service.collectResults(results);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    service.stop();
+
+    REQUIRE(results.size() == ids.size() - 1);
+    REQUIRE(service.getPendingCount() == 0);
+    for (const PathResult& result : results) {
+        REQUIRE(result.id != ids.back());
+        REQUIRE(result.status == PathStatus::Found);
+        REQUIRE(result.path.size() >= 2);
+    }
+}
+
+TEST_CASE("PathfindingService: Without workers requests run on collect", "[Pathfinding]") {
+    entt::registry registry;
+    TileOccupancyGrid occupancy(32, 32);
+    occupancy.init(registry);
+    NavigationGrid grid(32, 32);
+    grid.init(occupancy);
+
+    PathfindingSettings settings;
+    settings.workerThreads = 0;
+    PathfindingService service(grid, settings);
+    REQUIRE_FALSE(service.start());
+
+    auto id = service.requestPath({{0, 0}, {31, 0}, PathConnectivity::Four});
+    placeObject(registry, 10, 0, 1, 31);  // Placed after the request: not seen by it
+
+    std::vector<PathResult> results;
+    REQUIRE(service.collectResults(results) == 1);
+    REQUIRE(results[0].id == id);
+    REQUIRE(results[0].path.size() == 32);
+    REQUIRE(results[0].gridVersion < grid.getVersion());
+
+    // Editor routing sees the new wall immediately
+    std::vector<TilePoint> path;
+    REQUIRE(service.findPathNow({{0, 0}, {31, 0}, PathConnectivity::Four}, path) ==
+            PathStatus::Found);
+    REQUIRE(path.size() == 32 + 2 * 31);
+}
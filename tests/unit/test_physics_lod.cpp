@@ -0,0 +1,238 @@
+/**
+ * @file test_physics_lod.cpp
+ * @brief Unit tests for PhysicsLod (reduced-rate simulation of far regions)
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <simulation/PhysicsLod.h>
+#include <simulation/PhysicsEventProcessor.h>
+#include <simulation/systems/PhysicsSystem.h>
+#include <simulation/PhysicsWorld.h>
+#include <simulation/PhysicsComponents.h>
+#include <core/Components.h>
+#include <entt/entt.hpp>
+
+using namespace simulation;
+using namespace core;
+
+namespace {
+
+entt::entity createBox(entt::registry& registry, float x, float y, sf::Vector2f size,
+                       RigidbodyComponent::BodyType type) {
+    auto entity = registry.create();
+
+    auto& transform = registry.emplace<TransformComponent>(entity);
+    transform.x = x;
+    transform.y = y;
+
+    auto& collider = registry.emplace<ColliderComponent>(entity);
+    collider.shape = ColliderComponent::Shape::Box;
+    collider.size = size;
+
+    auto& rigidbody = registry.emplace<RigidbodyComponent>(entity);
+    rigidbody.bodyType = type;
+
+    return entity;
+}
+
+PhysicsLodSettings testSettings() {
+    PhysicsLodSettings settings;
+    settings.regionSize = 64.0f;
+    settings.focusMargin = 0.0f;
+    settings.farStepDivisor = 2;
+    settings.farSubSteps = 1;
+    settings.reclassifyInterval = 1;
+    return settings;
+}
+
+} // namespace
+
+TEST_CASE("PhysicsWorld: Sub-step count is configurable", "[PhysicsLod]") {
+    PhysicsWorld world(b2Vec2{0.0f, 9.8f}, 2);
+    REQUIRE(world.getSubStepCount() == 2);
+
+    world.setSubStepCount(0);
+    REQUIRE(world.getSubStepCount() == 1);  // Минимум 1 sub-step
+
+    PhysicsWorld defaultWorld;
+    REQUIRE(defaultWorld.getSubStepCount() == PhysicsWorld::DEFAULT_SUB_STEP_COUNT);
+}
+
+TEST_CASE("PhysicsLod: Bodies outside focus move to the far world", "[PhysicsLod]") {
+    entt::registry registry;
+    PhysicsWorld world(b2Vec2{0.0f, 9.8f});
+    PhysicsSystem system(world);
+    PhysicsLod lod(world, testSettings());
+
+    auto body = createBox(registry, 1000.0f, 100.0f, {32.0f, 32.0f},
+                          RigidbodyComponent::BodyType::Dynamic);
+    system.init(registry);
+    system.setLod(&lod);
+
+    lod.setFocusAreas({sf::FloatRect({0.0f, 0.0f}, {64.0f, 64.0f})});
+
+    system.update(registry, PhysicsSystem::FIXED_TIMESTEP);
+
+    REQUIRE(lod.isFar(body));
+    REQUIRE(lod.getFarBodyCount() == 1);
+
+    SECTION("Body returns when the camera reaches its region") {
+        lod.setFocusAreas({sf::FloatRect({960.0f, 64.0f}, {128.0f, 128.0f})});
+        system.update(registry, PhysicsSystem::FIXED_TIMESTEP);
+
+        REQUIRE_FALSE(lod.isFar(body));
+        REQUIRE(lod.getFarBodyCount() == 0);
+        REQUIRE(registry.get<RigidbodyComponent>(body).hasBox2DBody());
+    }
+
+    SECTION("Empty focus list treats everything as near") {
+        lod.setFocusAreas({});
+        system.update(registry, PhysicsSystem::FIXED_TIMESTEP);
+
+        REQUIRE_FALSE(lod.isFar(body));
+    }
+
+    SECTION("Destroying a far body forgets it") {
+        registry.destroy(body);
+        REQUIRE(lod.getFarBodyCount() == 0);
+    }
+}
+
+TEST_CASE("PhysicsLod: Far bodies keep simulating at reduced rate", "[PhysicsLod]") {
+    entt::registry registry;
+    PhysicsWorld world(b2Vec2{0.0f, 9.8f});
+    PhysicsSystem system(world);
+    PhysicsLod lod(world, testSettings());
+
+    // Пол и падающий ящик далеко от зоны интереса
+    createBox(registry, 900.0f, 300.0f, {256.0f, 32.0f}, RigidbodyComponent::BodyType::Static);
+    auto box = createBox(registry, 1000.0f, 100.0f, {32.0f, 32.0f},
+                         RigidbodyComponent::BodyType::Dynamic);
+    system.init(registry);
+    system.setLod(&lod);
+
+    lod.setFocusAreas({sf::FloatRect({0.0f, 0.0f}, {64.0f, 64.0f})});
+
+    // Две секунды симуляции
+    for (int i = 0; i < 120; ++i) {
+        system.update(registry, PhysicsSystem::FIXED_TIMESTEP);
+    }
+
+    REQUIRE(lod.isFar(box));
+
+    // Ящик упал, но лежит на зеркале статического пола, а не провалился сквозь него
+    const auto& transform = registry.get<TransformComponent>(box);
+    REQUIRE(transform.y > 200.0f);
+    REQUIRE(transform.y < 300.0f);
+}
+
+TEST_CASE("PhysicsLod: Migration preserves body state", "[PhysicsLod]") {
+    entt::registry registry;
+    PhysicsWorld world(b2Vec2{0.0f, 0.0f});
+    PhysicsSystem system(world);
+    PhysicsLod lod(world, testSettings());
+
+    auto body = createBox(registry, 1000.0f, 100.0f, {32.0f, 32.0f},
+                          RigidbodyComponent::BodyType::Dynamic);
+    system.init(registry);
+    system.setLod(&lod);
+
+    auto& rigidbody = registry.get<RigidbodyComponent>(body);
+    b2Body_SetLinearVelocity(rigidbody.box2dBodyId, b2Vec2{2.0f, 0.0f});
+
+    lod.setFocusAreas({sf::FloatRect({0.0f, 0.0f}, {64.0f, 64.0f})});
+    system.update(registry, PhysicsSystem::FIXED_TIMESTEP);
+    REQUIRE(lod.isFar(body));
+
+    b2Vec2 velocity = b2Body_GetLinearVelocity(rigidbody.box2dBodyId);
+    REQUIRE_THAT(velocity.x, Catch::Matchers::WithinAbs(2.0f, 0.001f));
+    REQUIRE_THAT(velocity.y, Catch::Matchers::WithinAbs(0.0f, 0.001f));
+}
+
+TEST_CASE("PhysicsLod: Only statics reachable from far regions are mirrored", "[PhysicsLod]") {
+    entt::registry registry;
+    PhysicsWorld world(b2Vec2{0.0f, 9.8f});
+    PhysicsSystem system(world);
+    PhysicsLod lod(world, testSettings());
+
+    // Стена внутри зоны интереса и пол далеко от неё
+    auto nearWall = createBox(registry, 64.0f, 64.0f, {32.0f, 32.0f},
+                              RigidbodyComponent::BodyType::Static);
+    createBox(registry, 900.0f, 300.0f, {256.0f, 32.0f}, RigidbodyComponent::BodyType::Static);
+    createBox(registry, 1000.0f, 100.0f, {32.0f, 32.0f}, RigidbodyComponent::BodyType::Dynamic);
+    system.init(registry);
+    system.setLod(&lod);
+
+    lod.setFocusAreas({sf::FloatRect({0.0f, 0.0f}, {192.0f, 192.0f})});
+    system.update(registry, PhysicsSystem::FIXED_TIMESTEP);
+
+    REQUIRE(lod.getStaticMirrorCount() == 1);
+
+    SECTION("Mirror appears when the camera leaves the static body") {
+        lod.setFocusAreas({sf::FloatRect({2000.0f, 2000.0f}, {64.0f, 64.0f})});
+        system.update(registry, PhysicsSystem::FIXED_TIMESTEP);
+        REQUIRE(lod.getStaticMirrorCount() == 2);
+
+        // Камера вернулась — зеркало стены больше не нужно
+        lod.setFocusAreas({sf::FloatRect({0.0f, 0.0f}, {192.0f, 192.0f})});
+        system.update(registry, PhysicsSystem::FIXED_TIMESTEP);
+        REQUIRE(lod.getStaticMirrorCount() == 1);
+    }
+
+    SECTION("Everything near drops all mirrors") {
+        lod.setFocusAreas({});
+        system.update(registry, PhysicsSystem::FIXED_TIMESTEP);
+        REQUIRE(lod.getStaticMirrorCount() == 0);
+    }
+
+    SECTION("Destroying a static body removes its mirror") {
+        lod.setFocusAreas({sf::FloatRect({2000.0f, 2000.0f}, {64.0f, 64.0f})});
+        system.update(registry, PhysicsSystem::FIXED_TIMESTEP);
+        registry.destroy(nearWall);
+        REQUIRE(lod.getStaticMirrorCount() == 1);
+    }
+}
+
+TEST_CASE("PhysicsLod: Far world contacts reach the event processor", "[PhysicsLod]") {
+    entt::registry registry;
+    PhysicsWorld world(b2Vec2{0.0f, 9.8f});
+    PhysicsSystem system(world);
+    PhysicsLod lod(world, testSettings());
+    PhysicsEventProcessor processor(world, registry);
+    processor.setLod(&lod);
+
+    std::vector<CollisionBeginEvent> beginEvents;
+    processor.getSignals().onCollisionBegin.connect(
+        [&](const CollisionBeginEvent& e) { beginEvents.push_back(e); });
+
+    auto floor = createBox(registry, 900.0f, 300.0f, {256.0f, 32.0f},
+                           RigidbodyComponent::BodyType::Static);
+    auto box = createBox(registry, 1000.0f, 100.0f, {32.0f, 32.0f},
+                         RigidbodyComponent::BodyType::Dynamic);
+    system.init(registry);
+    system.setLod(&lod);
+
+    lod.setFocusAreas({sf::FloatRect({0.0f, 0.0f}, {64.0f, 64.0f})});
+
+    for (int i = 0; i < 120; ++i) {
+        system.update(registry, PhysicsSystem::FIXED_TIMESTEP);
+        processor.processEvents();
+    }
+
+    REQUIRE(lod.isFar(box));
+    REQUIRE(lod.getFarStepCount() > 0);
+
+    // Ящик упал на зеркало пола в дальнем мире
+    bool boxOnFloor = false;
+    for (const auto& event : beginEvents) {
+        boxOnFloor = boxOnFloor || (event.entityA == box && event.entityB == floor) ||
+                     (event.entityA == floor && event.entityB == box);
+    }
+    REQUIRE(boxOnFloor);
+
+    // Без нового шага дальнего мира его события повторно не отправляются
+    const size_t eventCount = beginEvents.size();
+    processor.processEvents();
+    REQUIRE(beginEvents.size() == eventCount);
+}
@@ -8,6 +8,7 @@
  * - Exception handling
  * - Double buffering synchronization
  * - Pause/resume functionality
+ * - Absolute-deadline pacing statistics
  */
 
 #include <catch2/catch_test_macros.hpp>
@@ -244,6 +245,14 @@ TEST_CASE("PhysicsThread: Double buffering", "[PhysicsThread]") {
         REQUIRE(thread.isDoubleBufferingEnabled());
     }
 
+    SECTION("Body handle is assigned before the thread starts") {
+        // The physics thread reads the stored handle and never touches the table
+        const auto& body = registry.get<RigidbodyComponent>(entity);
+        REQUIRE_FALSE(body.handle.isNull());
+        REQUIRE(EntityHandleTable::of(registry).find(entity) == body.handle);
+        REQUIRE(b2Body_GetUserData(body.box2dBodyId) == body.handle.toUserData());
+    }
+
     SECTION("Double buffering can be toggled") {
         thread.setDoubleBufferingEnabled(false);
         REQUIRE_FALSE(thread.isDoubleBufferingEnabled());
@@ -302,6 +311,75 @@ TEST_CASE("PhysicsThread: Statistics", "[PhysicsThread]") {
     }
 }
 
+TEST_CASE("PhysicsThread: Pacing follows absolute schedule", "[PhysicsThread]") {
+    entt::registry registry;
+    PhysicsWorld world(b2Vec2{0.0f, 9.8f});
+    PhysicsSystem system(world);
+
+    PhysicsThread thread(world, system, registry);
+
+    SECTION("Pacing stats start empty") {
+        auto stats = thread.getPacingStats();
+        REQUIRE(stats.overrunCount == 0);
+        REQUIRE(stats.droppedTicks == 0);
+        REQUIRE(stats.maxJitterMs == 0.0);
+    }
+
+    SECTION("Schedule never runs ahead and dropped ticks are accounted") {
+        using Clock = std::chrono::steady_clock;
+        const auto begin = Clock::now();
+        thread.start();
+
+        // Wait for steps instead of a fixed sleep: a loaded machine only runs fewer steps
+        const auto timeout = begin + std::chrono::seconds(5);
+        while (thread.getStepCount() < 10 && Clock::now() < timeout) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        thread.stop();
+        const std::chrono::duration<double> elapsed = Clock::now() - begin;
+
+        const uint64_t steps = thread.getStepCount();
+        auto stats = thread.getPacingStats();
+        REQUIRE(steps >= 10);
+
+        // Absolute deadlines: step k starts no earlier than k periods after start,
+        // and every dropped tick is a period that really elapsed
+        const double scheduledTicks = elapsed.count() / PhysicsThread::FIXED_TIMESTEP;
+        REQUIRE(static_cast<double>(steps) <= scheduledTicks + 1.0);
+        REQUIRE(static_cast<double>(steps + stats.droppedTicks) <= scheduledTicks + 1.0);
+
+        REQUIRE(stats.catchUpSteps <= steps);
+        REQUIRE(stats.overrunCount <= steps);
+        REQUIRE(stats.maxJitterMs >= stats.meanJitterMs);
+        REQUIRE(stats.meanJitterMs >= 0.0);
+    }
+
+    SECTION("Works without spin window") {
+        thread.setSpinWindow(std::chrono::microseconds(0));
+        thread.start();
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        thread.stop();
+
+        REQUIRE(thread.getStepCount() >= 4);
+    }
+}
+
+// Wall-clock rate check: hidden because it fails on loaded machines (run with "[timing]")
+TEST_CASE("PhysicsThread: Step rate matches wall clock", "[.][timing][PhysicsThread]") {
+    entt::registry registry;
+    PhysicsWorld world(b2Vec2{0.0f, 9.8f});
+    PhysicsSystem system(world);
+
+    PhysicsThread thread(world, system, registry);
+    thread.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    thread.stop();
+
+    // 500 мс при 60 Гц = 30 шагов; абсолютные дедлайны не накапливают ошибку сна
+    REQUIRE(thread.getStepCount() >= 25);
+    REQUIRE(thread.getStepCount() <= 35);
+}
+
 TEST_CASE("PhysicsThread: Registry mutex", "[PhysicsThread]") {
     entt::registry registry;
     PhysicsWorld world(b2Vec2{0.0f, 9.8f});
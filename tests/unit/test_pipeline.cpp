@@ -0,0 +1,197 @@
+/**
+ * @file test_pipeline.cpp
+ * @brief Unit tests for the static Pipeline<Systems...> and its SystemScheduler interop
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <core/Components.h>
+#include <core/systems/Pipeline.h>
+#include <core/systems/SystemScheduler.h>
+#include <core/systems/UpdateSystem.h>
+#include <entt/entt.hpp>
+
+#include <memory>
+#include <string>
+
+using namespace core;
+
+namespace {
+
+std::string g_callOrder;
+
+struct FirstSystem : ISystem {
+    int calls = 0;
+    void update(entt::registry&, double) override {
+        ++calls;
+        g_callOrder += "1";
+    }
+    // Priority is ignored inside a pipeline: declaration order wins
+    int getPriority() const override { return 100; }
+    const char* getName() const override { return "FirstSystem"; }
+};
+
+struct SecondSystem : ISystem {
+    int calls = 0;
+    bool active = true;
+    explicit SecondSystem(int initialCalls = 0) : calls(initialCalls) {}
+    void update(entt::registry&, double) override {
+        ++calls;
+        g_callOrder += "2";
+    }
+    int getPriority() const override { return 0; }
+    const char* getName() const override { return "SecondSystem"; }
+    bool isActive() const override { return active; }
+    void setActive(bool value) override { active = value; }
+};
+
+// Not an ISystem: anything with update(registry, dt) can be a stage
+struct PlainStage {
+    int calls = 0;
+    void update(entt::registry&, double) { ++calls; }
+};
+
+struct PluginSystem : ISystem {
+    int calls = 0;
+    void update(entt::registry&, double) override { ++calls; }
+    int getPriority() const override { return 50; }
+    const char* getName() const override { return "PluginSystem"; }
+};
+
+} // namespace
+
+TEST_CASE("Pipeline: Runs systems in declaration order", "[Pipeline]") {
+    entt::registry registry;
+    Pipeline<FirstSystem, SecondSystem, PlainStage> pipeline;
+    g_callOrder.clear();
+
+    pipeline.update(registry, 0.016);
+    pipeline.update(registry, 0.016);
+
+    REQUIRE(g_callOrder == "1212");
+    REQUIRE(pipeline.get<FirstSystem>().calls == 2);
+    REQUIRE(pipeline.get<SecondSystem>().calls == 2);
+    REQUIRE(pipeline.get<PlainStage>().calls == 2);
+    STATIC_REQUIRE(Pipeline<FirstSystem, SecondSystem, PlainStage>::size() == 3);
+    STATIC_REQUIRE_FALSE(Pipeline<FirstSystem>::contains<SecondSystem>());
+}
+
+TEST_CASE("Pipeline: Inactive systems are skipped", "[Pipeline]") {
+    entt::registry registry;
+    Pipeline<FirstSystem, SecondSystem> pipeline;
+
+    pipeline.get<SecondSystem>().setActive(false);
+    pipeline.update(registry, 0.016);
+
+    REQUIRE(pipeline.get<FirstSystem>().calls == 1);
+    REQUIRE(pipeline.get<SecondSystem>().calls == 0);
+}
+
+TEST_CASE("Pipeline: Systems can be constructed from arguments", "[Pipeline]") {
+    entt::registry registry;
+    Pipeline<FirstSystem, SecondSystem> pipeline(FirstSystem{}, 10);
+
+    pipeline.update(registry, 0.016);
+    REQUIRE(pipeline.get<SecondSystem>().calls == 11);
+}
+
+TEST_CASE("Pipeline: Drives real systems", "[Pipeline]") {
+    entt::registry registry;
+    auto entity = registry.create();
+    registry.emplace<TransformComponent>(entity);
+    registry.emplace<VelocityComponent>(entity, 10.0f, 0.0f, 0.0f);
+
+    Pipeline<UpdateSystem> pipeline;
+    for (int i = 0; i < 10; ++i) {
+        pipeline.update(registry, 0.1);
+    }
+
+    REQUIRE(registry.get<TransformComponent>(entity).x > 9.99f);
+}
+
+TEST_CASE("Pipeline: Runs as one entry inside SystemScheduler", "[Pipeline][SystemScheduler]") {
+    entt::registry registry;
+    SystemScheduler scheduler;
+
+    using CorePipeline = Pipeline<FirstSystem, SecondSystem>;
+    auto pipeline = std::make_unique<CorePipeline>();
+    pipeline->setName("CorePipeline");
+    pipeline->setPriority(10);
+    scheduler.addSystem(std::move(pipeline));
+    scheduler.addSystem(std::make_unique<PluginSystem>());
+
+    scheduler.update(registry, 0.016);
+
+    auto* corePipeline = scheduler.getSystem<CorePipeline>();
+    REQUIRE(corePipeline != nullptr);
+    REQUIRE(corePipeline->get<FirstSystem>().calls == 1);
+    REQUIRE(scheduler.getSystem<PluginSystem>()->calls == 1);
+    REQUIRE(scheduler.getSystem("CorePipeline") == corePipeline);
+    REQUIRE(scheduler.getSystem("PluginSystem") == scheduler.getSystem<PluginSystem>());
+
+    // Systems inside the pipeline are not separate scheduler entries
+    REQUIRE(scheduler.getSystem<FirstSystem>() == nullptr);
+    REQUIRE(scheduler.getSystem("FirstSystem") == nullptr);
+    REQUIRE(scheduler.getSystemCount() == 2);
+}
+
+TEST_CASE("SystemScheduler: Type cache is invalidated when systems change", "[SystemScheduler]") {
+    SystemScheduler scheduler;
+
+    REQUIRE(scheduler.getSystem<PluginSystem>() == nullptr);
+    scheduler.addSystem(std::make_unique<PluginSystem>());
+    REQUIRE(scheduler.getSystem<PluginSystem>() != nullptr);
+
+    scheduler.clear();
+    REQUIRE(scheduler.getSystem<PluginSystem>() == nullptr);
+    REQUIRE(scheduler.getSystem("PluginSystem") == nullptr);
+}
+
+TEST_CASE("SystemScheduler: Name lookup returns the first system by priority", "[SystemScheduler]") {
+    SystemScheduler scheduler;
+
+    // Same name, added in reverse priority order
+    auto late = std::make_unique<Pipeline<FirstSystem>>();
+    late->setName("Shared");
+    late->setPriority(20);
+    auto early = std::make_unique<Pipeline<SecondSystem>>();
+    early->setName("Shared");
+    early->setPriority(5);
+    ISystem* earlyPtr = early.get();
+
+    scheduler.addSystem(std::move(late));
+    scheduler.addSystem(std::move(early));
+
+    REQUIRE(scheduler.getSystem("Shared") == earlyPtr);
+}
+
+TEST_CASE("SystemScheduler: Name lookup follows renamed systems", "[SystemScheduler]") {
+    SystemScheduler scheduler;
+
+    auto pipeline = std::make_unique<Pipeline<FirstSystem>>();
+    auto* pipelinePtr = pipeline.get();
+    std::string name = "Before";
+    pipeline->setName(name.c_str());
+    scheduler.addSystem(std::move(pipeline));
+    REQUIRE(scheduler.getSystem("Before") == pipelinePtr);
+
+    // The old name buffer is gone: the index must not keep views into it
+    name = "After_a_much_longer_name_that_reallocates";
+    pipelinePtr->setName(name.c_str());
+
+    // The stale entry is detected on lookup and the index is rebuilt
+    REQUIRE(scheduler.getSystem("Before") == nullptr);
+    REQUIRE(scheduler.getSystem("After_a_much_longer_name_that_reallocates") == pipelinePtr);
+}
+
+TEST_CASE("SystemScheduler: Missing names do not rebuild the index", "[SystemScheduler]") {
+    SystemScheduler scheduler;
+    scheduler.addSystem(std::make_unique<PluginSystem>());
+    ISystem* plugin = scheduler.getSystem("PluginSystem");
+    REQUIRE(plugin != nullptr);
+
+    for (int i = 0; i < 3; ++i) {
+        REQUIRE(scheduler.getSystem("NoSuchSystem") == nullptr);
+    }
+    REQUIRE(scheduler.getSystem(nullptr) == nullptr);
+    REQUIRE(scheduler.getSystem("PluginSystem") == plugin);
+}
@@ -0,0 +1,162 @@
+/**
+ * @file test_production_statistics.cpp
+ * @brief Unit tests for ProductionStatistics
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <core/ProductionStatistics.h>
+#include <entt/entt.hpp>
+
+using namespace core;
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+ProductionSettings hourWindow() {
+    ProductionSettings settings;
+    settings.windowSeconds = 3600.0;
+    settings.windowBuckets = 60;
+    settings.cycleSmoothing = 0.5;
+    return settings;
+}
+
+void produceEvery(ProductionStatistics& stats, entt::entity machine, double from, double to,
+                  double cycle) {
+    for (double t = from + cycle; t <= to + 1e-9; t += cycle) {
+        stats.addOutput(machine, 1, 0, t);
+    }
+}
+
+} // namespace
+
+TEST_CASE("ProductionStatistics: OEE from state and output events", "[Production]") {
+    entt::registry registry;
+    auto press = registry.create();
+    ProductionStatistics stats(hourWindow());
+    REQUIRE(stats.addMachine(press, "line_A", 30.0, true));
+    REQUIRE_FALSE(stats.addMachine(press, "line_A", 30.0));
+
+    stats.setState(press, MachineState::Running, 0.0);
+    produceEvery(stats, press, 0.0, 1800.0, 30.0);  // 60 parts at the ideal rate
+    stats.addOutput(press, 0, 3, 1800.0);
+    stats.setState(press, MachineState::Down, 1800.0);
+    stats.setState(press, MachineState::Running, 2400.0);
+    produceEvery(stats, press, 2400.0, 3600.0, 40.0);  // 30 parts, slower
+    stats.setState(press, MachineState::PlannedStop, 3600.0);
+
+    MachineStats machine;
+    REQUIRE(stats.getMachineStats(press, 4000.0, machine));
+    REQUIRE(machine.state == MachineState::PlannedStop);
+    REQUIRE_THAT(machine.timeInState, WithinAbs(400.0, 1e-9));
+    REQUIRE_THAT(machine.stateSeconds[0], WithinAbs(3000.0, 1e-9));
+    REQUIRE(machine.goodCount == 90);
+    REQUIRE(machine.scrapCount == 3);
+    REQUIRE(machine.failureCount == 1);
+
+    REQUIRE_THAT(machine.oee.availability, WithinAbs(3000.0 / 3600.0, 1e-9));
+    REQUIRE_THAT(machine.oee.performance, WithinAbs(30.0 * 93 / 3000.0, 1e-9));
+    REQUIRE_THAT(machine.oee.quality, WithinAbs(90.0 / 93.0, 1e-9));
+    REQUIRE_THAT(machine.oee.oee, WithinAbs(machine.oee.availability * machine.oee.performance *
+                                                machine.oee.quality, 1e-12));
+
+    REQUIRE_FALSE(stats.setState(registry.create(), MachineState::Running, 0.0));
+}
+
+TEST_CASE("ProductionStatistics: Sliding window forgets old downtime", "[Production]") {
+    entt::registry registry;
+    auto press = registry.create();
+    ProductionStatistics stats(hourWindow());
+    stats.addMachine(press, "line_A", 30.0);
+
+    stats.setState(press, MachineState::Down, 0.0);
+    stats.setState(press, MachineState::Running, 7200.0);
+    produceEvery(stats, press, 7200.0, 10800.0, 30.0);
+
+    MachineStats machine;
+    stats.getMachineStats(press, 10800.0, machine);
+    REQUIRE_THAT(machine.oee.availability, WithinAbs(1.0 / 3.0, 1e-9));
+    REQUIRE_THAT(machine.windowOee.availability, WithinAbs(1.0, 1e-9));
+    REQUIRE_THAT(machine.windowOee.performance, WithinAbs(1.0, 0.02));
+    REQUIRE_THAT(machine.throughputPerHour, WithinAbs(120.0, 2.0));
+    REQUIRE_THAT(machine.meanCycleSeconds, WithinAbs(30.0, 1e-6));
+
+    // Idle time after the last event is counted without any new event
+    stats.getMachineStats(press, 10800.0 + 3600.0, machine);
+    REQUIRE(machine.state == MachineState::Running);
+    REQUIRE_THAT(machine.windowOee.availability, WithinAbs(1.0, 1e-9));
+    REQUIRE_THAT(machine.throughputPerHour, WithinAbs(0.0, 1e-9));
+}
+
+TEST_CASE("ProductionStatistics: Lines aggregate their machines", "[Production]") {
+    entt::registry registry;
+    auto cutter = registry.create();
+    auto packer = registry.create();
+    auto mixer = registry.create();
+    ProductionStatistics stats(hourWindow());
+    stats.addMachine(cutter, "line_A", 10.0);
+    stats.addMachine(packer, "line_A", 20.0, true);
+    stats.addMachine(mixer, "line_B", 60.0, true);
+
+    stats.setState(cutter, MachineState::Running, 0.0);
+    stats.setState(packer, MachineState::Running, 0.0);
+    stats.setState(mixer, MachineState::Down, 0.0);
+    produceEvery(stats, cutter, 0.0, 1000.0, 10.0);  // 100 parts
+    produceEvery(stats, packer, 0.0, 1000.0, 20.0);  // 50 parts
+    stats.addOutput(cutter, 0, 4, 1000.0);
+    stats.setState(packer, MachineState::Idle, 1000.0);
+
+    ProductionSnapshot snapshot;
+    stats.snapshot(2000.0, snapshot);
+    REQUIRE(snapshot.machines.size() == 3);
+    REQUIRE(snapshot.lines.size() == 2);
+
+    const LineStats& lineA = snapshot.lines[0];
+    REQUIRE(lineA.line == "line_A");
+    REQUIRE(lineA.machineCount == 2);
+    REQUIRE(lineA.goodCount == 50);  // Only the packer is the line output
+    REQUIRE(lineA.scrapCount == 4);
+    REQUIRE_THAT(lineA.oee.availability, WithinAbs(3000.0 / 4000.0, 1e-9));
+    REQUIRE_THAT(lineA.throughputPerHour, WithinAbs(50.0 * 3600.0 / 2000.0, 1e-6));
+
+    const LineStats& lineB = snapshot.lines[1];
+    REQUIRE(lineB.machinesDown == 1);
+    REQUIRE(lineB.oee.oee == 0.0);
+
+    LineStats single;
+    REQUIRE(stats.getLineStats("line_A", 2000.0, single));
+    REQUIRE_THAT(single.oee.oee, WithinAbs(lineA.oee.oee, 1e-12));
+    REQUIRE_FALSE(stats.getLineStats("line_C", 2000.0, single));
+
+    SECTION("Removed machines leave the aggregates") {
+        REQUIRE(stats.removeMachine(cutter));
+        REQUIRE_FALSE(stats.removeMachine(cutter));
+        stats.snapshot(2000.0, snapshot);
+        REQUIRE(snapshot.machines.size() == 2);
+        REQUIRE(snapshot.lines[0].scrapCount == 0);
+
+        MachineStats mixerStats;
+        REQUIRE(stats.getMachineStats(mixer, 2000.0, mixerStats));
+        REQUIRE(mixerStats.state == MachineState::Down);
+    }
+}
+
+TEST_CASE("ProductionStatistics: Buffer fill levels are time-weighted", "[Production]") {
+    entt::registry registry;
+    auto buffer = registry.create();
+    ProductionStatistics stats(hourWindow());
+    REQUIRE(stats.addBuffer(buffer, "line_A", 10));
+
+    stats.setBufferLevel(buffer, 10, 100.0);
+    stats.setBufferLevel(buffer, 5, 200.0);
+
+    ProductionSnapshot snapshot;
+    stats.snapshot(300.0, snapshot);
+    REQUIRE(snapshot.buffers.size() == 1);
+    const BufferStats& fill = snapshot.buffers[0];
+    REQUIRE(fill.level == 5);
+    REQUIRE_THAT(fill.averageFill, WithinAbs(1500.0 / 3000.0, 1e-9));
+    REQUIRE_THAT(fill.emptySeconds, WithinAbs(100.0, 1e-9));
+    REQUIRE_THAT(fill.fullSeconds, WithinAbs(100.0, 1e-9));
+    REQUIRE(snapshot.lines.empty());  // No machines on the line yet
+}
@@ -123,6 +123,7 @@ TEST_CASE("ResourceManager: Texture unloading", "[ResourceManager]") {
     manager.loadTextureFromImage("texture2", image);
 
     REQUIRE(manager.getTextureCount() == 2);
+    const uint64_t generation = manager.getTextureGeneration();
 
     SECTION("Unload single texture") {
         bool unloaded = manager.unloadTexture("texture1");
@@ -130,17 +131,21 @@ TEST_CASE("ResourceManager: Texture unloading", "[ResourceManager]") {
         REQUIRE(manager.getTextureCount() == 1);
         REQUIRE(manager.hasTexture("texture1") == false);
         REQUIRE(manager.hasTexture("texture2") == true);
+        // Cached texture pointers (RenderSystem) must be dropped
+        REQUIRE(manager.getTextureGeneration() != generation);
     }
 
     SECTION("Unload non-existent texture") {
         bool unloaded = manager.unloadTexture("non_existent");
         REQUIRE(unloaded == false);
         REQUIRE(manager.getTextureCount() == 2);
+        REQUIRE(manager.getTextureGeneration() == generation);
     }
 
     SECTION("Clear all textures") {
         manager.clear();
         REQUIRE(manager.getTextureCount() == 0);
+        REQUIRE(manager.getTextureGeneration() != generation);
         REQUIRE(manager.hasTexture("texture1") == false);
         REQUIRE(manager.hasTexture("texture2") == false);
     }
@@ -0,0 +1,247 @@
+/**
+ * @file test_scene_tree_cache.cpp
+ * @brief Unit tests for the scene hierarchy cache, the background name filter
+ *        and component reflection used by the ImGui panels
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <core/Components.h>
+#include <ui/ComponentReflection.h>
+#include <ui/EntityNameFilter.h>
+#include <ui/SceneTreeCache.h>
+#include <entt/entt.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <optional>
+#include <thread>
+
+using namespace core;
+using namespace ui;
+
+namespace {
+
+entt::entity createNamed(entt::registry& registry, const char* name) {
+    auto entity = registry.create();
+    registry.emplace<NameComponent>(entity, name);
+    return entity;
+}
+
+bool containsEntity(std::span<const entt::entity> entities, entt::entity entity) {
+    return std::find(entities.begin(), entities.end(), entity) != entities.end();
+}
+
+std::optional<EntityNameFilter::Result> waitForResult(EntityNameFilter& filter) {
+    for (int i = 0; i < 500; ++i) {
+        if (auto result = filter.poll()) {
+            return result;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    return std::nullopt;
+}
+
+} // namespace
+
+TEST_CASE("SceneTreeCache: Builds hierarchy from existing ParentComponent", "[SceneTreeCache]") {
+    entt::registry registry;
+    auto child = createNamed(registry, "Child");   // Created before its parent
+    auto parent = createNamed(registry, "Parent");
+    auto loose = createNamed(registry, "Loose");
+    registry.emplace<ParentComponent>(child, parent);
+
+    SceneTreeCache tree;
+    tree.init(registry);
+
+    REQUIRE(tree.getNodeCount() == 3);
+    REQUIRE(tree.parentOf(child) == parent);
+    REQUIRE(containsEntity(tree.childrenOf(parent), child));
+    REQUIRE(tree.roots().size() == 2);
+    REQUIRE(containsEntity(tree.roots(), loose));
+
+    // Collapsed by default: only roots are rows
+    REQUIRE(tree.rows().size() == 2);
+
+    tree.setExpanded(parent, true);
+    const auto& rows = tree.rows();
+    REQUIRE(rows.size() == 3);
+    auto childRow = std::find_if(rows.begin(), rows.end(),
+                                 [&](const auto& row) { return row.entity == child; });
+    REQUIRE(childRow != rows.end());
+    REQUIRE(childRow->depth == 1);
+    REQUIRE(std::prev(childRow)->entity == parent);
+}
+
+TEST_CASE("SceneTreeCache: Follows registry signals", "[SceneTreeCache]") {
+    entt::registry registry;
+    SceneTreeCache tree;
+    tree.init(registry);
+
+    auto parent = createNamed(registry, "Parent");
+    auto child = createNamed(registry, "Child");
+    REQUIRE(tree.roots().size() == 2);
+
+    registry.emplace<ParentComponent>(child, parent);
+    REQUIRE(tree.parentOf(child) == parent);
+    REQUIRE(tree.roots().size() == 1);
+
+    SECTION("Reparent through patch") {
+        auto other = createNamed(registry, "Other");
+        registry.patch<ParentComponent>(child, [&](auto& p) { p.parent = other; });
+        REQUIRE(tree.parentOf(child) == other);
+        REQUIRE(tree.childrenOf(parent).empty());
+    }
+
+    SECTION("Removing ParentComponent makes a root") {
+        registry.remove<ParentComponent>(child);
+        REQUIRE(tree.parentOf(child) == entt::null);
+        REQUIRE(tree.roots().size() == 2);
+    }
+
+    SECTION("Destroying the parent keeps children as roots") {
+        registry.destroy(parent);
+        REQUIRE_FALSE(tree.contains(parent));
+        REQUIRE(tree.contains(child));
+        REQUIRE(tree.parentOf(child) == entt::null);
+        REQUIRE(tree.getNodeCount() == 1);
+    }
+
+    SECTION("Cycles are shown as roots") {
+        registry.emplace<ParentComponent>(parent, child);
+        REQUIRE(tree.parentOf(parent) == entt::null);
+    }
+}
+
+TEST_CASE("SceneTreeCache: Changes under collapsed nodes do not rebuild rows", "[SceneTreeCache]") {
+    entt::registry registry;
+    auto folder = createNamed(registry, "Folder");
+
+    SceneTreeCache tree;
+    tree.init(registry);
+    (void)tree.rows();
+    const uint64_t rebuilds = tree.getRowsRebuildCount();
+
+    for (int i = 0; i < 100; ++i) {
+        auto child = registry.create();
+        registry.emplace<ParentComponent>(child, folder);
+    }
+    // Each create adds a visible root before it gets its parent
+    REQUIRE(tree.rows().size() == 1);
+    REQUIRE(tree.getRowsRebuildCount() == rebuilds + 1);
+
+    // Nothing visible changes: moving entities inside a collapsed folder is free
+    auto first = tree.childrenOf(folder)[0];
+    auto second = tree.childrenOf(folder)[1];
+    const uint64_t before = tree.getRowsRebuildCount();
+    registry.patch<ParentComponent>(first, [&](auto& p) { p.parent = second; });
+    registry.patch<NameComponent>(folder, [](auto& n) { n.name = "Renamed"; });
+    REQUIRE(tree.parentOf(first) == second);
+    (void)tree.rows();
+    REQUIRE(tree.getRowsRebuildCount() == before);
+
+    tree.setExpanded(folder, true);
+    REQUIRE(tree.rows().size() == 100);  // folder + 99 direct children
+    REQUIRE(tree.getRowsRebuildCount() == before + 1);
+}
+
+TEST_CASE("SceneTreeCache: Filter shows matches with their ancestors", "[SceneTreeCache]") {
+    entt::registry registry;
+    auto line = createNamed(registry, "Line_1");
+    auto pump = createNamed(registry, "Pump_A");
+    auto valve = createNamed(registry, "Valve_A");
+    createNamed(registry, "Tank");
+    registry.emplace<ParentComponent>(pump, line);
+    registry.emplace<ParentComponent>(valve, line);
+
+    SceneTreeCache tree;
+    tree.init(registry);
+
+    auto names = tree.nameSnapshot();
+    REQUIRE(names->size() == 4);
+    REQUIRE(tree.nameSnapshot() == names);  // Reused while names are unchanged
+
+    auto matches = EntityNameFilter::filter(*names, "pump");
+    REQUIRE(matches.size() == 1);
+    tree.setFilter(matches);
+
+    const auto& rows = tree.rows();
+    REQUIRE(rows.size() == 2);
+    REQUIRE(rows[0].entity == line);
+    REQUIRE(rows[0].expanded);
+    REQUIRE(rows[1].entity == pump);
+
+    tree.clearFilter();
+    REQUIRE(tree.rows().size() == 2);  // line (collapsed) + Tank
+
+    registry.patch<NameComponent>(valve, [](auto& n) { n.name = "Valve_B"; });
+    REQUIRE(tree.nameSnapshot() != names);
+}
+
+TEST_CASE("EntityNameFilter: Case-insensitive substring match", "[EntityNameFilter]") {
+    REQUIRE(EntityNameFilter::matches("Conveyor_Belt_01", "belt"));
+    REQUIRE(EntityNameFilter::matches("Conveyor_Belt_01", ""));
+    REQUIRE_FALSE(EntityNameFilter::matches("Conveyor", "pump"));
+    REQUIRE_FALSE(EntityNameFilter::matches("Bel", "belt"));
+}
+
+TEST_CASE("EntityNameFilter: Worker delivers only the latest request", "[EntityNameFilter]") {
+    entt::registry registry;
+    for (int i = 0; i < 5000; ++i) {
+        createNamed(registry, i % 10 == 0 ? "Pump" : "Pipe");
+    }
+    SceneTreeCache tree;
+    tree.init(registry);
+
+    EntityNameFilter filter;
+    REQUIRE(filter.start());
+
+    filter.request("pipe", tree.nameSnapshot());
+    const uint64_t latest = filter.request("PUMP", tree.nameSnapshot());
+
+    auto result = waitForResult(filter);
+    REQUIRE(result.has_value());
+    REQUIRE(result->requestId == latest);
+    REQUIRE(result->query == "PUMP");
+    REQUIRE(result->matches.size() == 500);
+
+    filter.stop();
+    REQUIRE_FALSE(filter.isRunning());
+}
+
+TEST_CASE("ComponentReflection: Editors are generated per component type", "[ComponentReflection]") {
+    ComponentReflection reflection;
+    reflection.registerCoreComponents();
+
+    const ComponentDescriptor* transform = reflection.find<TransformComponent>();
+    REQUIRE(transform != nullptr);
+    REQUIRE(transform->fields.size() == 5);
+    REQUIRE(transform->fields[0].kind == FieldKind::Float);
+    REQUIRE(reflection.find<ChildrenComponent>() == nullptr);
+
+    // Parent references and interned strings are never edited directly
+    const ComponentDescriptor* parent = reflection.find<ParentComponent>();
+    REQUIRE(parent != nullptr);
+    REQUIRE(parent->fields[0].kind == FieldKind::Entity);
+    REQUIRE(parent->fields[0].readOnly);
+
+    entt::registry registry;
+    auto entity = registry.create();
+    registry.emplace<TransformComponent>(entity);
+    int updates = 0;
+    struct Counter {
+        int* updates;
+        void onUpdate(entt::registry&, entt::entity) { ++*updates; }
+    } counter{&updates};
+    registry.on_update<TransformComponent>().connect<&Counter::onUpdate>(counter);
+
+    void* data = transform->tryGet(registry, entity);
+    REQUIRE(data != nullptr);
+    *static_cast<float*>(transform->fields[1].access(data)) = 42.0f;
+    transform->notifyChanged(registry, entity);
+
+    REQUIRE(registry.get<TransformComponent>(entity).y == 42.0f);
+    REQUIRE(updates == 1);
+    REQUIRE(reflection.find<VelocityComponent>()->tryGet(registry, entity) == nullptr);
+
+    registry.on_update<TransformComponent>().disconnect<&Counter::onUpdate>(counter);
+}
@@ -0,0 +1,190 @@
+/**
+ * @file test_spatial_index.cpp
+ * @brief Unit tests for SpatialIndex (point / rect / radius picking)
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <core/SpatialIndex.h>
+#include <core/systems/OverlaySystem.h>
+#include <core/systems/TilePositionSystem.h>
+#include <core/Components.h>
+#include <entt/entt.hpp>
+#include <algorithm>
+
+using namespace core;
+
+namespace {
+
+// Entity with a 32x32 sprite whose bottom-left corner is at (x, y)
+entt::entity createSprite(entt::registry& registry, float x, float y, int layer = 0) {
+    auto entity = registry.create();
+    registry.emplace<TransformComponent>(entity, x, y);
+    auto& sprite = registry.emplace<SpriteComponent>(entity);
+    sprite.layer = layer;
+    return entity;
+}
+
+bool containsEntity(const std::vector<entt::entity>& entities, entt::entity entity) {
+    return std::find(entities.begin(), entities.end(), entity) != entities.end();
+}
+
+} // namespace
+
+TEST_CASE("SpatialIndex: Point, rect and radius queries", "[SpatialIndex]") {
+    entt::registry registry;
+    SpatialIndex index(64.0f);
+    index.init(registry);
+
+    auto a = createSprite(registry, 0.0f, 32.0f);     // [0,32] x [0,32]
+    auto b = createSprite(registry, 100.0f, 132.0f);  // [100,132] x [100,132]
+    auto far = createSprite(registry, 1000.0f, 1032.0f);
+    index.update();
+
+    REQUIRE(index.getEntityCount() == 3);
+
+    std::vector<entt::entity> hits;
+
+    SECTION("Point query") {
+        index.queryPoint({16.0f, 16.0f}, hits);
+        REQUIRE(hits.size() == 1);
+        REQUIRE(hits.front() == a);
+
+        hits.clear();
+        index.queryPoint({64.0f, 64.0f}, hits);
+        REQUIRE(hits.empty());
+    }
+
+    SECTION("Rect query normalizes negative size") {
+        index.queryRect(sf::FloatRect({150.0f, 150.0f}, {-150.0f, -150.0f}), hits);
+        REQUIRE(hits.size() == 2);
+        REQUIRE(containsEntity(hits, a));
+        REQUIRE(containsEntity(hits, b));
+    }
+
+    SECTION("Large rect query returns everything once") {
+        index.queryRect(sf::FloatRect({-10000.0f, -10000.0f}, {20000.0f, 20000.0f}), hits);
+        REQUIRE(hits.size() == 3);
+        REQUIRE(containsEntity(hits, far));
+    }
+
+    SECTION("Radius query uses circle-AABB distance") {
+        index.queryRadius({150.0f, 116.0f}, 20.0f, hits);
+        REQUIRE(hits.size() == 1);
+        REQUIRE(hits.front() == b);
+
+        hits.clear();
+        index.queryRadius({150.0f, 116.0f}, 10.0f, hits);
+        REQUIRE(hits.empty());
+    }
+}
+
+TEST_CASE("SpatialIndex: Incremental updates", "[SpatialIndex]") {
+    entt::registry registry;
+    SpatialIndex index(64.0f);
+    index.init(registry);
+
+    auto entity = createSprite(registry, 0.0f, 32.0f);
+    index.update();
+
+    SECTION("Moving entities are tracked without patch") {
+        registry.emplace<VelocityComponent>(entity);
+        index.update();
+
+        auto& transform = registry.get<TransformComponent>(entity);
+        transform.x = 500.0f;
+        transform.y = 532.0f;
+        index.update();
+
+        std::vector<entt::entity> hits;
+        index.queryPoint({516.0f, 516.0f}, hits);
+        REQUIRE(hits.size() == 1);
+        hits.clear();
+        index.queryPoint({16.0f, 16.0f}, hits);
+        REQUIRE(hits.empty());
+    }
+
+    SECTION("Patched static entity is refreshed") {
+        registry.patch<TransformComponent>(entity, [](auto& t) { t.x = 300.0f; });
+        index.update();
+
+        auto bounds = index.getBounds(entity);
+        REQUIRE(bounds.position.x == 300.0f);
+    }
+
+    SECTION("Collision bounds take precedence") {
+        registry.emplace<CollisionComponent>(entity).bounds =
+            sf::FloatRect({0.0f, -256.0f}, {256.0f, 256.0f});
+        index.update();
+
+        // Larger than a cell: stored in the oversized list
+        REQUIRE(index.getOversizedCount() == 1);
+        std::vector<entt::entity> hits;
+        index.queryPoint({200.0f, -200.0f}, hits);
+        REQUIRE(hits.size() == 1);
+    }
+
+    SECTION("Destroyed entities are removed") {
+        registry.destroy(entity);
+        REQUIRE_FALSE(index.contains(entity));
+        REQUIRE(index.getCellCount() == 0);
+    }
+}
+
+TEST_CASE("SpatialIndex: Filters and picking", "[SpatialIndex]") {
+    entt::registry registry;
+    SpatialIndex index;
+    index.init(registry);
+
+    auto floor = createSprite(registry, 0.0f, 32.0f, toInt(RenderLayer::Ground));
+    auto machine = createSprite(registry, 0.0f, 32.0f, toInt(RenderLayer::Objects));
+    registry.emplace<TagComponent>(machine, "machine");
+    index.update();
+
+    REQUIRE(index.pickTop({16.0f, 16.0f}) == machine);
+
+    SpatialQueryFilter groundOnly;
+    groundOnly.maxLayer = toInt(RenderLayer::Ground);
+    REQUIRE(index.pickTop({16.0f, 16.0f}, groundOnly) == floor);
+
+    SpatialQueryFilter machines;
+    machines.tag = "machine";
+    std::vector<entt::entity> hits;
+    index.queryPoint({16.0f, 16.0f}, hits, machines);
+    REQUIRE(hits.size() == 1);
+    REQUIRE(hits.front() == machine);
+
+    REQUIRE(index.pickTop({500.0f, 500.0f}) == entt::null);
+}
+
+TEST_CASE("SpatialIndex: Tile and overlay systems refresh the index", "[SpatialIndex]") {
+    entt::registry registry;
+    SpatialIndex index(64.0f);
+    index.init(registry);
+    TilePositionSystem tileSystem;
+    OverlaySystem overlaySystem;
+
+    auto machine = registry.create();
+    registry.emplace<TilePositionComponent>(machine, 1, 1);
+    registry.emplace<TransformComponent>(machine);
+    registry.emplace<SpriteComponent>(machine);
+
+    auto indicator = createSprite(registry, 0.0f, 0.0f, toInt(RenderLayer::Overlays));
+    registry.emplace<ParentComponent>(indicator, machine);
+    registry.emplace<OverlayComponent>(indicator, 8.0f, -8.0f);
+
+    tileSystem.update(registry);
+    overlaySystem.update(registry);
+    index.update();
+
+    // Neither entity moves by itself (no VelocityComponent) and nobody calls markDirty()
+    REQUIRE(index.getBounds(machine).position.x == 32.0f);
+    REQUIRE(index.getBounds(indicator).position.x == 40.0f);
+
+    registry.patch<TilePositionComponent>(machine, [](auto& pos) { pos.tileX = 10; });
+    tileSystem.update(registry);
+    overlaySystem.update(registry);
+    index.update();
+
+    REQUIRE(index.getBounds(indicator).position.x == 328.0f);
+    REQUIRE(index.pickTop({336.0f, 40.0f}) == indicator);
+}
@@ -0,0 +1,108 @@
+/**
+ * @file test_string_id.cpp
+ * @brief Unit tests for StringId and hot component layout
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <core/StringId.h>
+#include <core/Components.h>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+using namespace core;
+
+TEST_CASE("StringId: Empty string has id 0", "[StringId]") {
+    StringId empty;
+    REQUIRE(empty.empty());
+    REQUIRE(empty.value() == 0);
+    REQUIRE(empty.str().empty());
+    REQUIRE(StringId("") == empty);
+    REQUIRE(StringId(std::string()) == empty);
+}
+
+TEST_CASE("StringId: Same string interns to the same id", "[StringId]") {
+    StringId a("conveyor");
+    StringId b(std::string("conveyor"));
+    StringId c(std::string_view("conveyor"));
+    StringId other("press");
+
+    REQUIRE(a == b);
+    REQUIRE(a == c);
+    REQUIRE_FALSE(a == other);
+    REQUIRE(a.value() != 0);
+    REQUIRE(a.str() == "conveyor");
+}
+
+TEST_CASE("StringId: Compares with plain strings", "[StringId]") {
+    StringId id("wall");
+
+    REQUIRE(id == "wall");
+    REQUIRE(id == std::string("wall"));
+    REQUIRE(id == std::string_view("wall"));
+    REQUIRE_FALSE(id == "floor");
+}
+
+TEST_CASE("StringId: Usable as a hash key", "[StringId]") {
+    std::unordered_set<StringId> ids;
+    ids.insert("a");
+    ids.insert("b");
+    ids.insert("a");
+
+    REQUIRE(ids.size() == 2);
+    REQUIRE(ids.contains(StringId("b")));
+}
+
+TEST_CASE("StringId: Concurrent interning is consistent", "[StringId]") {
+    constexpr int THREADS = 4;
+    constexpr int NAMES = 200;
+
+    std::vector<std::vector<StringId::ValueType>> results(THREADS);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&results, t]() {
+            for (int i = 0; i < NAMES; ++i) {
+                results[t].push_back(StringId("concurrent_" + std::to_string(i)).value());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int t = 1; t < THREADS; ++t) {
+        REQUIRE(results[t] == results[0]);
+    }
+}
+
+TEST_CASE("Components: Hot components are compact", "[Components]") {
+    STATIC_REQUIRE(isHotComponent<TransformComponent>);
+    STATIC_REQUIRE(isHotComponent<SpriteComponent>);
+    STATIC_REQUIRE(isHotComponent<VelocityComponent>);
+    STATIC_REQUIRE(isHotComponent<CollisionComponent>);
+    STATIC_REQUIRE(isHotComponent<EntityStateComponent>);
+    STATIC_REQUIRE(isHotComponent<TilePositionComponent>);
+
+    SpriteComponent sprite("tile_brown");
+    SpriteComponent copy = sprite;
+    REQUIRE(copy.textureName == "tile_brown");
+}
+
+TEST_CASE("ChildrenComponent: No duplicates and swap-remove", "[Components]") {
+    ChildrenComponent children;
+    auto a = static_cast<entt::entity>(1);
+    auto b = static_cast<entt::entity>(2);
+    auto c = static_cast<entt::entity>(3);
+
+    children.addChild(a);
+    children.addChild(b);
+    children.addChild(a);
+    children.addChild(c);
+    REQUIRE(children.childCount() == 3);
+
+    children.removeChild(a);
+    REQUIRE(children.childCount() == 2);
+    REQUIRE_FALSE(children.hasChild(a));
+    REQUIRE(children.hasChild(b));
+    REQUIRE(children.hasChild(c));
+}
@@ -0,0 +1,71 @@
+/**
+ * @file test_thread_config.cpp
+ * @brief Unit tests for ThreadSchedulingConfig
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <core/ThreadConfig.h>
+#include <core/Config.h>
+
+#include <thread>
+
+using namespace core;
+
+TEST_CASE("ThreadSchedulingConfig: Policy parsing", "[ThreadConfig]") {
+    REQUIRE(ThreadSchedulingConfig::parsePolicy("fifo") == ThreadPolicy::Fifo);
+    REQUIRE(ThreadSchedulingConfig::parsePolicy("FIFO") == ThreadPolicy::Fifo);
+    REQUIRE(ThreadSchedulingConfig::parsePolicy("realtime") == ThreadPolicy::Fifo);
+    REQUIRE(ThreadSchedulingConfig::parsePolicy("nice") == ThreadPolicy::Nice);
+    REQUIRE(ThreadSchedulingConfig::parsePolicy("default") == ThreadPolicy::Default);
+    REQUIRE(ThreadSchedulingConfig::parsePolicy("unknown") == ThreadPolicy::Default);
+}
+
+TEST_CASE("ThreadSchedulingConfig: Loading from config", "[ThreadConfig]") {
+    Config& config = Config::getInstance();
+
+    config.set("threads.testName", std::string("opc-test"));
+    config.set("threads.testAffinity", std::vector<int>{0});
+    config.set("threads.testPolicy", std::string("nice"));
+    config.set("threads.testNice", 3);
+
+    auto result = ThreadSchedulingConfig::fromConfig("test", "fallback");
+
+    REQUIRE(result.name == "opc-test");
+    REQUIRE(result.cpuAffinity == std::vector<int>{0});
+    REQUIRE(result.policy == ThreadPolicy::Nice);
+    REQUIRE(result.niceValue == 3);
+
+    SECTION("Missing keys use defaults") {
+        auto missing = ThreadSchedulingConfig::fromConfig("missingThread", "fallback");
+        REQUIRE(missing.name == "fallback");
+        REQUIRE(missing.cpuAffinity.empty());
+        REQUIRE(missing.policy == ThreadPolicy::Default);
+    }
+}
+
+TEST_CASE("ThreadSchedulingConfig: Applying to a thread", "[ThreadConfig]") {
+    SECTION("Name-only config succeeds") {
+        ThreadSchedulingConfig config;
+        config.name = "opc-unit-test-thread-with-long-name";
+
+        bool applied = false;
+        std::thread worker([&]() { applied = config.applyToCurrentThread(); });
+        worker.join();
+
+#if defined(__linux__)
+        REQUIRE(applied);
+#else
+        (void)applied;
+#endif
+    }
+
+    SECTION("Unprivileged FIFO request never throws") {
+        ThreadSchedulingConfig config;
+        config.name = "opc-fifo-test";
+        config.policy = ThreadPolicy::Fifo;
+        config.priority = 10;
+
+        std::thread worker([&]() { REQUIRE_NOTHROW(config.applyToCurrentThread()); });
+        worker.join();
+    }
+}
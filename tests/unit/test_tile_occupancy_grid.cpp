@@ -0,0 +1,151 @@
+/**
+ * @file test_tile_occupancy_grid.cpp
+ * @brief Unit tests for TileOccupancyGrid (tile -> entity index)
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <core/TileOccupancyGrid.h>
+#include <core/Components.h>
+#include <entt/entt.hpp>
+
+using namespace core;
+
+namespace {
+
+entt::entity createTileEntity(entt::registry& registry, int x, int y, int w = 1, int h = 1,
+                              OccupancyLayer layer = OccupancyLayer::Object) {
+    auto entity = registry.create();
+    registry.emplace<TilePositionComponent>(entity, x, y, w, h, true, layer);
+    return entity;
+}
+
+} // namespace
+
+TEST_CASE("TileOccupancyGrid: Existing entities are indexed on init", "[TileOccupancyGrid]") {
+    entt::registry registry;
+    auto entity = createTileEntity(registry, 3, 4);
+
+    TileOccupancyGrid grid(16, 16);
+    grid.init(registry);
+
+    REQUIRE(grid.isDense());
+    REQUIRE(grid.at(3, 4) == entity);
+    REQUIRE(grid.at(4, 4) == entt::null);
+    REQUIRE(grid.getEntityCount() == 1);
+}
+
+TEST_CASE("TileOccupancyGrid: Hooks keep the index up to date", "[TileOccupancyGrid]") {
+    entt::registry registry;
+    TileOccupancyGrid grid(16, 16);
+    grid.init(registry);
+
+    auto entity = createTileEntity(registry, 1, 1);
+    REQUIRE(grid.at(1, 1) == entity);
+
+    SECTION("patch moves the footprint") {
+        registry.patch<TilePositionComponent>(entity, [](auto& pos) { pos.tileX = 5; });
+        REQUIRE(grid.at(1, 1) == entt::null);
+        REQUIRE(grid.at(5, 1) == entity);
+    }
+
+    SECTION("Removing the component frees the tile") {
+        registry.remove<TilePositionComponent>(entity);
+        REQUIRE(grid.at(1, 1) == entt::null);
+        REQUIRE_FALSE(grid.contains(entity));
+    }
+
+    SECTION("Destroying the entity frees the tile") {
+        registry.destroy(entity);
+        REQUIRE(grid.at(1, 1) == entt::null);
+        REQUIRE(grid.getEntityCount() == 0);
+    }
+}
+
+TEST_CASE("TileOccupancyGrid: Multi-tile footprints", "[TileOccupancyGrid]") {
+    entt::registry registry;
+    TileOccupancyGrid grid(16, 16);
+    grid.init(registry);
+
+    auto machine = createTileEntity(registry, 8, 2, 2, 3);
+
+    for (int y = 2; y < 5; ++y) {
+        for (int x = 8; x < 10; ++x) {
+            REQUIRE(grid.at(x, y) == machine);
+        }
+    }
+    REQUIRE(grid.at(10, 2) == entt::null);
+    REQUIRE(grid.at(8, 5) == entt::null);
+
+    REQUIRE_FALSE(grid.isAreaFree(7, 1, 2, 2));
+    REQUIRE(grid.isAreaFree(10, 2, 2, 2));
+    REQUIRE(grid.isAreaFree(8, 2, 2, 3, OccupancyLayer::Object, machine));
+
+    std::vector<entt::entity> found;
+    grid.queryArea(0, 0, 16, 16, OccupancyLayer::Object, found);
+    REQUIRE(found.size() == 1);
+    REQUIRE(found[0] == machine);
+}
+
+TEST_CASE("TileOccupancyGrid: Layers are independent", "[TileOccupancyGrid]") {
+    entt::registry registry;
+    TileOccupancyGrid grid(8, 8);
+    grid.init(registry);
+
+    auto ground = createTileEntity(registry, 2, 2, 1, 1, OccupancyLayer::Ground);
+    auto object = createTileEntity(registry, 2, 2, 1, 1, OccupancyLayer::Object);
+
+    REQUIRE(grid.at(2, 2, OccupancyLayer::Ground) == ground);
+    REQUIRE(grid.at(2, 2, OccupancyLayer::Object) == object);
+    REQUIRE(grid.at(2, 2, OccupancyLayer::Overlay) == entt::null);
+    REQUIRE(grid.topAt(2, 2) == object);
+
+    registry.destroy(object);
+    REQUIRE(grid.topAt(2, 2) == ground);
+}
+
+TEST_CASE("TileOccupancyGrid: Overlapping owners are promoted", "[TileOccupancyGrid]") {
+    entt::registry registry;
+    TileOccupancyGrid grid(8, 8);
+    grid.init(registry);
+
+    auto first = createTileEntity(registry, 1, 1, 2, 1);
+    auto second = createTileEntity(registry, 2, 1);
+
+    REQUIRE(grid.at(2, 1) == first);
+
+    registry.destroy(first);
+    REQUIRE(grid.at(1, 1) == entt::null);
+    REQUIRE(grid.at(2, 1) == second);
+}
+
+TEST_CASE("TileOccupancyGrid: Sparse chunks outside the dense area", "[TileOccupancyGrid]") {
+    entt::registry registry;
+    TileOccupancyGrid grid(4, 4);
+    grid.init(registry);
+
+    auto farAway = createTileEntity(registry, 1000, -50);
+    auto inside = createTileEntity(registry, 0, 0);
+
+    REQUIRE(grid.at(1000, -50) == farAway);
+    REQUIRE(grid.at(0, 0) == inside);
+    REQUIRE(grid.getChunkCount() == 1);
+    REQUIRE(grid.at(-1000, 3) == entt::null);
+
+    SECTION("Resize keeps the occupancy") {
+        grid.resize(2000, 100);
+        REQUIRE(grid.at(1000, -50) == farAway);
+        REQUIRE(grid.at(0, 0) == inside);
+    }
+}
+
+TEST_CASE("TileOccupancyGrid: Huge maps fall back to chunks only", "[TileOccupancyGrid]") {
+    // The registry outlives the grid: ~TileOccupancyGrid disconnects from it
+    entt::registry registry;
+    TileOccupancyGrid grid(100000, 100000);
+    REQUIRE_FALSE(grid.isDense());
+
+    grid.init(registry);
+    auto entity = createTileEntity(registry, 50000, 50000);
+    REQUIRE(grid.at(50000, 50000) == entity);
+    REQUIRE(grid.getChunkCount() == 1);
+}
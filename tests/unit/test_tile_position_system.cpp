@@ -180,3 +180,112 @@ TEST_CASE("TilePositionSystem: System properties", "[TilePositionSystem]") {
         REQUIRE(std::string(system.getName()) == "TilePositionSystem");
     }
 }
+
+TEST_CASE("TilePositionSystem: Reactive updates", "[TilePositionSystem]") {
+    entt::registry registry;
+    TilePositionSystem system;
+
+    auto entity = registry.create();
+    registry.emplace<TilePositionComponent>(entity, 2, 3);
+    registry.emplace<TransformComponent>(entity);
+    registry.emplace<SpriteComponent>(entity).layer = toInt(RenderLayer::Objects);
+
+    auto staticEntity = registry.create();
+    registry.emplace<TilePositionComponent>(staticEntity, 5, 5);
+    registry.emplace<TransformComponent>(staticEntity);
+    registry.emplace<SpriteComponent>(staticEntity).layer = toInt(RenderLayer::Objects);
+
+    system.update(registry);
+    REQUIRE(system.getLastProcessedCount() == 2);
+    REQUIRE(system.layersChanged());
+
+    SECTION("Unchanged entities are not reprocessed") {
+        system.update(registry);
+        REQUIRE(system.getLastProcessedCount() == 0);
+        REQUIRE_FALSE(system.layersChanged());
+    }
+
+    SECTION("Patched entity is resynced and reports layer change") {
+        registry.patch<TilePositionComponent>(entity, [](auto& pos) { pos.tileY = 6; });
+        registry.patch<TilePositionComponent>(entity, [](auto& pos) { pos.tileX = 4; });
+
+        system.update(registry);
+
+        // Two patches of the same entity are processed once
+        REQUIRE(system.getLastProcessedCount() == 1);
+        REQUIRE(system.layersChanged());
+        REQUIRE(registry.get<SpriteComponent>(entity).layer == toInt(RenderLayer::Objects) + 6);
+        REQUIRE_THAT(registry.get<TransformComponent>(entity).x,
+                     Catch::Matchers::WithinAbs(128.0f, 0.001f));  // 4 * 32
+        REQUIRE_THAT(registry.get<TransformComponent>(entity).y,
+                     Catch::Matchers::WithinAbs(224.0f, 0.001f));  // (6+1) * 32
+    }
+
+    SECTION("Horizontal move does not change layer") {
+        registry.patch<TilePositionComponent>(entity, [](auto& pos) { pos.tileX = 7; });
+
+        system.update(registry);
+
+        REQUIRE(system.getLastProcessedCount() == 1);
+        REQUIRE_FALSE(system.layersChanged());
+    }
+
+    SECTION("Transform added later is synced") {
+        auto late = registry.create();
+        registry.emplace<TilePositionComponent>(late, 1, 1);
+        system.update(registry);
+
+        auto& transform = registry.emplace<TransformComponent>(late);
+        system.update(registry);
+
+        REQUIRE_THAT(transform.x, Catch::Matchers::WithinAbs(32.0f, 0.001f));
+        REQUIRE_THAT(transform.y, Catch::Matchers::WithinAbs(64.0f, 0.001f));
+    }
+
+    SECTION("Destroyed entity is skipped") {
+        registry.patch<TilePositionComponent>(entity, [](auto& pos) { pos.tileY = 1; });
+        registry.destroy(entity);
+
+        system.update(registry);
+        REQUIRE(system.getLastProcessedCount() == 0);
+    }
+
+    SECTION("markAllDirty forces a full pass") {
+        system.markAllDirty();
+        system.update(registry);
+        REQUIRE(system.getLastProcessedCount() == 2);
+    }
+}
+
+namespace {
+
+size_t g_transformUpdates = 0;
+
+void countTransformUpdate(entt::registry&, entt::entity) {
+    ++g_transformUpdates;
+}
+
+} // namespace
+
+TEST_CASE("TilePositionSystem: Transform changes are published via patch", "[TilePositionSystem]") {
+    entt::registry registry;
+    TilePositionSystem system;
+    registry.on_update<TransformComponent>().connect<&countTransformUpdate>();
+    g_transformUpdates = 0;
+
+    auto entity = registry.create();
+    registry.emplace<TilePositionComponent>(entity, 2, 3);
+    registry.emplace<TransformComponent>(entity);
+
+    system.update(registry);
+    REQUIRE(g_transformUpdates == 1);
+
+    // Position already in sync: observers are not notified again
+    system.markAllDirty();
+    system.update(registry);
+    REQUIRE(g_transformUpdates == 1);
+
+    registry.patch<TilePositionComponent>(entity, [](auto& pos) { pos.tileX = 4; });
+    system.update(registry);
+    REQUIRE(g_transformUpdates == 2);
+}
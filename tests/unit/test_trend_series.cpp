@@ -0,0 +1,151 @@
+/**
+ * @file test_trend_series.cpp
+ * @brief Unit tests for trend storage: min/max pyramid maintenance,
+ *        LTTB downsampling and width-bounded window queries
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <core/TrendSeries.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace core;
+
+namespace {
+
+bool isSortedByTime(const std::vector<TrendPoint>& points) {
+    return std::is_sorted(points.begin(), points.end(),
+                          [](const TrendPoint& a, const TrendPoint& b) { return a.time < b.time; });
+}
+
+double maxValue(const std::vector<TrendPoint>& points) {
+    return std::max_element(points.begin(), points.end(),
+                            [](const auto& a, const auto& b) { return a.value < b.value; })
+        ->value;
+}
+
+double minValue(const std::vector<TrendPoint>& points) {
+    return std::min_element(points.begin(), points.end(),
+                            [](const auto& a, const auto& b) { return a.value < b.value; })
+        ->value;
+}
+
+} // namespace
+
+TEST_CASE("TrendSeries: LTTB keeps endpoints and the requested count", "[TrendSeries]") {
+    std::vector<TrendPoint> input;
+    for (int i = 0; i < 1000; ++i) {
+        input.push_back({static_cast<double>(i), std::sin(i * 0.05)});
+    }
+    input[500].value = 10.0;  // Single spike must survive
+
+    std::vector<TrendPoint> out;
+    TrendSeries::downsampleLttb(input, 100, out);
+
+    REQUIRE(out.size() == 100);
+    REQUIRE(out.front().time == input.front().time);
+    REQUIRE(out.back().time == input.back().time);
+    REQUIRE(isSortedByTime(out));
+    REQUIRE(maxValue(out) == 10.0);
+
+    SECTION("Threshold not below input size copies input") {
+        TrendSeries::downsampleLttb(std::span(input).first(50), 100, out);
+        REQUIRE(out.size() == 50);
+    }
+}
+
+TEST_CASE("TrendSeries: Pyramid levels close incrementally", "[TrendSeries]") {
+    TrendSeries series;
+    const size_t factor = TrendSeries::LEVEL_FACTOR;
+
+    for (size_t i = 0; i < factor * factor + 3; ++i) {
+        series.append(static_cast<double>(i), static_cast<double>(i));
+    }
+    REQUIRE(series.getRawCount() == factor * factor + 3);
+    REQUIRE(series.getLevelCount(0) == factor);
+    REQUIRE(series.getLevelCount(1) == 1);
+    REQUIRE(series.getLevelCount(2) == 0);
+
+    // Out-of-order samples are dropped
+    const uint64_t version = series.getVersion();
+    series.append(1.0, 100.0);
+    REQUIRE(series.getVersion() == version);
+    REQUIRE(series.last()->value == static_cast<double>(factor * factor + 2));
+
+    series.clear();
+    REQUIRE(series.getRawCount() == 0);
+    REQUIRE(series.last() == nullptr);
+}
+
+TEST_CASE("TrendSeries: Short window is served from raw samples", "[TrendSeries]") {
+    TrendSeries series;
+    for (int i = 0; i < 100; ++i) {
+        series.append(i * 0.1, static_cast<double>(i));
+    }
+
+    std::vector<TrendPoint> out;
+    series.query(2.0, 3.0, 800, out);
+
+    // 11 samples inside the window plus one on each side
+    REQUIRE(out.size() == 13);
+    REQUIRE(out.front().value == 19.0);
+    REQUIRE(out.back().value == 31.0);
+}
+
+TEST_CASE("TrendSeries: Long history query is bounded by plot width", "[TrendSeries]") {
+    TrendSettings settings;
+    settings.rawCapacity = 4096;
+    TrendSeries series(settings);
+
+    const int count = 1'000'000;
+    for (int i = 0; i < count; ++i) {
+        series.append(static_cast<double>(i), std::sin(i * 0.001));
+    }
+    series.append(static_cast<double>(count), 0.0);
+    REQUIRE(series.getTotalCount() == static_cast<uint64_t>(count) + 1);
+    REQUIRE(series.getRawCount() == 4096);
+
+    // Extremes far outside the raw buffer
+    TrendSeries spiky(settings);
+    for (int i = 0; i < count; ++i) {
+        double value = 0.0;
+        if (i == 123'457) {
+            value = 50.0;
+        } else if (i == 654'321) {
+            value = -50.0;
+        }
+        spiky.append(static_cast<double>(i), value);
+    }
+
+    const size_t width = 400;
+    std::vector<TrendPoint> out;
+    spiky.query(0.0, static_cast<double>(count), width, out);
+
+    REQUIRE(out.size() <= width * 2);
+    REQUIRE(out.size() >= 3);
+    REQUIRE(isSortedByTime(out));
+    REQUIRE(maxValue(out) == 50.0);
+    REQUIRE(minValue(out) == -50.0);
+    REQUIRE(out.back().time == count - 1.0);  // Line reaches the newest sample
+
+    // Zoomed into the recent past: raw resolution again
+    spiky.query(count - 100.0, count - 1.0, width, out);
+    REQUIRE(out.size() == 101);  // 100 in the window plus one before it
+}
+
+TEST_CASE("TrendStore: Series are created per tag on first sample", "[TrendSeries]") {
+    TrendStore store;
+    store.append("Tank1.Level", 0.0, 1.0);
+    store.append("Tank1.Level", 1.0, 2.0);
+    store.append("Pump1.Flow", 0.5, 3.0);
+
+    REQUIRE(store.tags().size() == 2);
+    REQUIRE(store.tags()[0] == core::StringId("Tank1.Level"));
+    REQUIRE(store.find("Tank1.Level")->getRawCount() == 2);
+    REQUIRE(store.find("Missing") == nullptr);
+
+    store.clear();
+    REQUIRE(store.tags().empty());
+}